@@ -0,0 +1,264 @@
+#include <QtCore/qcoreapplication.h>
+#include <QtCore/qcommandlineparser.h>
+#include <QtCore/qdiriterator.h>
+#include <QtCore/qelapsedtimer.h>
+#include <QtCore/qfileinfo.h>
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "GameMonitor2.h"
+#include "taflib/Logger.h"
+#include "tapacket/TADemoParser.h"
+#include "VersionString.h"
+
+static const std::uint32_t TICKS_TO_GAME_START = 1800;  // 60 sec.  same as TaLobby
+static const std::uint32_t TICKS_TO_GAME_DRAW = 60;     // 2 sec
+
+// GameMonitor2 needs somewhere to send its events, but we only care about the result it latches
+class NullGameEventHandler : public GameEventHandler
+{
+public:
+    virtual void onGameSettings(const std::string &, std::uint16_t, const std::string &, const std::string &) { }
+    virtual void onPlayerStatus(const PlayerData &, const std::set<std::string> &) { }
+    virtual void onClearSlot(const PlayerData &) { }
+    virtual void onGameStarted(std::uint32_t, bool) { }
+    virtual void onGameEnded(const GameResult &) { }
+    virtual void onChat(const std::string&, bool) { }
+};
+
+// replays a demo's records into a GameMonitor2 as though they had been received live
+class DemoResultParser : public tapacket::DemoParser
+{
+    GameMonitor2 &m_monitor;
+    std::map<int, std::string> m_playerNames;           // keyed by demo player number
+    std::map<int, std::uint32_t> m_playerDplayIds;      // keyed by demo player number
+
+public:
+    DemoResultParser(GameMonitor2 &monitor) :
+        m_monitor(monitor)
+    { }
+
+    virtual void handle(const tapacket::Header &)
+    { }
+
+    virtual void handle(const tapacket::Player &player, int n, int)
+    {
+        m_playerNames[player.number] = player.name;
+        if (n == 0)
+        {
+            // demos don't say who was host or who recorded.  host comes first in battleroom order which is the best we have
+            m_monitor.setHostPlayerName(player.name);
+            m_monitor.setLocalPlayerName(player.name);
+        }
+    }
+
+    virtual void handle(const tapacket::ExtraSector &, int, int)
+    { }
+
+    virtual void handle(const tapacket::PlayerStatusMessage &msg, std::uint32_t dplayid, int, int)
+    {
+        m_playerDplayIds[msg.number] = dplayid;
+        m_monitor.onDplayCreateOrForwardPlayer(0x0008, dplayid, m_playerNames[msg.number], NULL, NULL);
+        m_monitor.onTaPacket(dplayid, 0u, false, NULL, 0, std::vector<tapacket::bytestring>(1, msg.statusMessage));
+    }
+
+    virtual void handle(const tapacket::UnitData &)
+    { }
+
+    virtual void handle(const tapacket::Packet &packet, const std::vector<tapacket::bytestring> &unpaked, std::size_t)
+    {
+        auto it = m_playerDplayIds.find(packet.sender);
+        if (it != m_playerDplayIds.end())
+        {
+            m_monitor.onTaPacket(it->second, 0u, false, NULL, 0, unpaked);
+        }
+    }
+};
+
+struct ValidationResult
+{
+    QString fileName;
+    std::string error;          // empty unless the demo couldn't be processed
+    GameResult gameResult;
+    qint64 elapsedMs;
+
+    ValidationResult() : elapsedMs(0) { }
+};
+
+static const char* statusString(GameResult::Status status)
+{
+    switch (status)
+    {
+    case GameResult::Status::NOT_READY: return "NOT_READY";
+    case GameResult::Status::VOID_RESULT: return "VOID_RESULT";
+    case GameResult::Status::READY_RESULT: return "READY_RESULT";
+    default: return "UNKNOWN";
+    };
+}
+
+static void validateDemo(ValidationResult &result)
+{
+    QElapsedTimer timer;
+    timer.start();
+    try
+    {
+        std::ifstream fs(result.fileName.toStdString(), std::ios::in | std::ios::binary);
+        if (!fs.good())
+        {
+            throw std::runtime_error("unable to open file");
+        }
+
+        NullGameEventHandler gameEventHandler;
+        GameMonitor2 monitor(&gameEventHandler, TICKS_TO_GAME_START, TICKS_TO_GAME_DRAW);
+        DemoResultParser parser(monitor);
+        parser.parse(&fs, 0u);
+        result.gameResult = monitor.getGameResult();
+    }
+    catch (const std::exception &e)
+    {
+        result.error = e.what();
+    }
+    catch (...)
+    {
+        result.error = "general exception";
+    }
+    result.elapsedMs = timer.elapsed();
+}
+
+// one line per demo so that a run can be diffed against a baseline run
+static void printResult(std::ostream &os, const ValidationResult &result, bool printTiming)
+{
+    os << result.fileName.toStdString();
+    if (!result.error.empty())
+    {
+        os << "\tERROR\t" << result.error;
+    }
+    else
+    {
+        os << '\t' << statusString(result.gameResult.status) << "\tendGameTick=" << result.gameResult.endGameTick;
+        for (const auto &army : result.gameResult.results)
+        {
+            os << "\tarmy" << army.army << "(" << army.alias << "/slot" << army.slot << "/team" << army.team << "):score=" << army.score;
+        }
+    }
+    if (printTiming)
+    {
+        os << "\tms=" << result.elapsedMs;
+    }
+    os << std::endl;
+}
+
+static QStringList findDemos(const QStringList &paths)
+{
+    QStringList demos;
+    for (const QString &path : paths)
+    {
+        if (QFileInfo(path).isDir())
+        {
+            QDirIterator it(path, QStringList() << "*.tad", QDir::Files, QDirIterator::Subdirectories);
+            while (it.hasNext())
+            {
+                demos.append(it.next());
+            }
+        }
+        else
+        {
+            demos.append(path);
+        }
+    }
+    demos.sort();
+    return demos;
+}
+
+int doMain(int argc, char* argv[])
+{
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName("DemoValidator");
+    QCoreApplication::setApplicationVersion(VERSION_STRING);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Runs archived TA demos through GameMonitor2 and reports each game's result");
+    parser.addHelpOption();
+    parser.addVersionOption();
+    parser.addPositionalArgument("demos", "demo files, or directories to search recursively for *.tad", "[demos...]");
+    parser.addOption(QCommandLineOption("threads", "number of demos to process concurrently. 0 for one per core", "threads", "0"));
+    parser.addOption(QCommandLineOption("notiming", "omit per-demo timings so output can be diffed against a baseline"));
+    parser.addOption(QCommandLineOption("logfile", "path to file in which to write logs.", "logfile", ""));
+    parser.addOption(QCommandLineOption("loglevel", "level of noise in log files. 0 (silent) to 5 (debug).", "loglevel", "0"));
+    parser.process(app);
+
+    taflib::Logger::Initialise(parser.value("logfile").toStdString(), taflib::Logger::Verbosity(parser.value("loglevel").toInt()));
+    qInstallMessageHandler(taflib::Logger::Log);
+
+    const QStringList demos = findDemos(parser.positionalArguments());
+    std::vector<ValidationResult> results(demos.size());
+    for (int n = 0; n < demos.size(); ++n)
+    {
+        results[n].fileName = demos[n];
+    }
+
+    unsigned numThreads = parser.value("threads").toUInt();
+    if (numThreads == 0u)
+    {
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    numThreads = std::min(numThreads, unsigned(std::max(std::size_t(1), results.size())));
+
+    QElapsedTimer timer;
+    timer.start();
+    std::atomic<std::size_t> nextDemo(0u);
+    std::vector<std::thread> workers;
+    for (unsigned n = 0u; n < numThreads; ++n)
+    {
+        workers.emplace_back([&results, &nextDemo]() {
+            for (std::size_t i = nextDemo++; i < results.size(); i = nextDemo++)
+            {
+                validateDemo(results[i]);
+            }
+        });
+    }
+    for (std::thread &worker : workers)
+    {
+        worker.join();
+    }
+    const qint64 elapsedMs = timer.elapsed();
+
+    // printed in sorted file order regardless of which thread finished first
+    const bool printTiming = !parser.isSet("notiming");
+    int numErrors = 0;
+    for (const ValidationResult &result : results)
+    {
+        printResult(std::cout, result, printTiming);
+        numErrors += result.error.empty() ? 0 : 1;
+    }
+    std::cerr << "[DemoValidator] " << results.size() << " demos, " << numErrors << " errors, "
+        << numThreads << " threads, " << elapsedMs << " ms" << std::endl;
+    return numErrors > 0 ? 1 : 0;
+}
+
+int main(int argc, char* argv[])
+{
+    try
+    {
+        return doMain(argc, argv);
+    }
+    catch (std::exception & e)
+    {
+        std::cerr << "[main catch std::exception] " << e.what() << std::endl;
+        qWarning() << "[main catch std::exception]" << e.what();
+        return 1;
+    }
+    catch (...)
+    {
+        std::cerr << "[main catch ...] " << std::endl;
+        qWarning() << "[main catch ...]";
+        return 1;
+    }
+}
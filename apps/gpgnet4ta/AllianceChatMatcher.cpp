@@ -0,0 +1,155 @@
+#include "AllianceChatMatcher.h"
+
+#include <cstring>
+
+static const char ALLIED_WITH[] = ">  allied with ";
+static const char BROKE_ALLIANCE_WITH[] = ">  broke alliance with ";
+static const int SEEDS_PER_TABLE_SIZE = 64;
+
+// does chat contain text at pos?
+static bool matchAt(const std::string &chat, std::size_t pos, const char *text, std::size_t size)
+{
+    return chat.size() >= pos + size && std::memcmp(chat.data() + pos, text, size) == 0;
+}
+
+AllianceChatMatcher::AllianceChatMatcher() :
+    m_table(1u),
+    m_seed(0u)
+{ }
+
+std::uint32_t AllianceChatMatcher::hash(std::uint32_t seed, const char *s, std::size_t size)
+{
+    // FNV-1a
+    std::uint32_t h = 2166136261u ^ seed;
+    for (std::size_t n = 0u; n < size; ++n)
+    {
+        h = (h ^ std::uint8_t(s[n])) * 16777619u;
+    }
+    return h ^ (h >> 16);
+}
+
+void AllianceChatMatcher::compile(const std::vector<std::pair<std::uint32_t, std::string> > &players)
+{
+    m_roster = players;
+
+    // a table 4x the roster has a fair chance of being collision free for any given seed.
+    // if a few dozen seeds don't find one, try a bigger table
+    std::size_t tableSize = 1u;
+    while (tableSize < 4u * m_roster.size())
+    {
+        tableSize <<= 1;
+    }
+    for (std::uint32_t seed = 0u; !tryCompile(seed, tableSize); ++seed)
+    {
+        if (seed % SEEDS_PER_TABLE_SIZE == SEEDS_PER_TABLE_SIZE - 1)
+        {
+            tableSize <<= 1;
+        }
+    }
+}
+
+bool AllianceChatMatcher::tryCompile(std::uint32_t seed, std::size_t tableSize)
+{
+    m_seed = seed;
+    m_table.assign(tableSize, Entry());
+    for (const auto &player : m_roster)
+    {
+        Entry &entry = m_table[hash(seed, player.second.data(), player.second.size()) & (tableSize - 1u)];
+        if (entry.dplayid != 0u && entry.name == player.second)
+        {
+            continue;   // duplicate name.  first one wins
+        }
+        else if (entry.dplayid != 0u)
+        {
+            return false;
+        }
+        entry.dplayid = player.first;
+        entry.name = player.second;
+    }
+    return true;
+}
+
+std::uint32_t AllianceChatMatcher::lookup(const char *name, std::size_t size) const
+{
+    const Entry &entry = m_table[hash(m_seed, name, size) & (m_table.size() - 1u)];
+    if (entry.dplayid != 0u && entry.name.size() == size && std::memcmp(entry.name.data(), name, size) == 0)
+    {
+        return entry.dplayid;
+    }
+    return 0u;
+}
+
+const std::string *AllianceChatMatcher::findName(std::uint32_t dplayid) const
+{
+    for (const auto &player : m_roster)
+    {
+        if (player.first == dplayid)
+        {
+            return &player.second;
+        }
+    }
+    return NULL;
+}
+
+AllianceChatMatcher::Match AllianceChatMatcher::match(std::uint32_t sender, const std::string &chat, std::uint32_t &subject, std::uint32_t &object) const
+{
+    if (chat.empty() || chat[0] != '<')
+    {
+        return Match::NONE;
+    }
+
+    // "<name1>"
+    std::size_t pos;
+    if (sender == 0u)
+    {
+        pos = chat.find('>');
+        if (pos == std::string::npos || pos < 2u)
+        {
+            return Match::NONE;
+        }
+        sender = lookup(chat.data() + 1, pos - 1u);
+    }
+    else
+    {
+        const std::string *name = findName(sender);
+        if (name == NULL || !matchAt(chat, 1u, name->data(), name->size()))
+        {
+            return Match::NONE;
+        }
+        pos = 1u + name->size();
+    }
+    if (sender == 0u)
+    {
+        return Match::NONE;
+    }
+
+    // ">  allied with " or ">  broke alliance with "
+    Match result;
+    if (matchAt(chat, pos, ALLIED_WITH, sizeof(ALLIED_WITH) - 1u))
+    {
+        result = Match::ALLIED;
+        pos += sizeof(ALLIED_WITH) - 1u;
+    }
+    else if (matchAt(chat, pos, BROKE_ALLIANCE_WITH, sizeof(BROKE_ALLIANCE_WITH) - 1u))
+    {
+        result = Match::BROKE_ALLIANCE;
+        pos += sizeof(BROKE_ALLIANCE_WITH) - 1u;
+    }
+    else
+    {
+        return Match::NONE;
+    }
+
+    // "name2".  the last word of the chat, so can't contain a space
+    if (pos >= chat.size() || chat.find(' ', pos) != std::string::npos)
+    {
+        return Match::NONE;
+    }
+    object = lookup(chat.data() + pos, chat.size() - pos);
+    if (object == 0u || object == sender)
+    {
+        return Match::NONE;
+    }
+    subject = sender;
+    return result;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Recognises the "<name1>  allied with name2" and "<name1>  broke alliance with name2" messages TA broadcasts
+// when alliances change.  The roster's names are compiled into a perfect hash table whenever the roster changes,
+// so that each chat line is matched without allocating and without scanning the roster
+class AllianceChatMatcher
+{
+public:
+    enum class Match
+    {
+        NONE,
+        ALLIED,
+        BROKE_ALLIANCE
+    };
+
+    AllianceChatMatcher();
+
+    // players as (dplayid, name) in dplayid order.  Where a name is duplicated the lowest dplayid wins,
+    // same as GameMonitor2::getPlayerDpidByName
+    void compile(const std::vector<std::pair<std::uint32_t, std::string> > &players);
+
+    // sender is the dplayid the chat came from, or 0u to take sender from the "<name1>" the chat begins with.
+    // on a match, subject and object are set to the dplayids of name1 and name2
+    Match match(std::uint32_t sender, const std::string &chat, std::uint32_t &subject, std::uint32_t &object) const;
+
+    // returns 0u if name is not on the roster
+    std::uint32_t lookup(const char *name, std::size_t size) const;
+
+private:
+    struct Entry
+    {
+        std::uint32_t dplayid;      // 0u where slot is empty
+        std::string name;
+    };
+
+    static std::uint32_t hash(std::uint32_t seed, const char *s, std::size_t size);
+    bool tryCompile(std::uint32_t seed, std::size_t tableSize);
+
+    // returns name of sender, or NULL if not on the roster
+    const std::string *findName(std::uint32_t dplayid) const;
+
+    std::vector<std::pair<std::uint32_t, std::string> > m_roster;  // as compiled, including any duplicate names
+    std::vector<Entry> m_table;     // by hash(m_seed, name), power of 2 sized
+    std::uint32_t m_seed;
+};
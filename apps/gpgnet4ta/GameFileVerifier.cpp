@@ -0,0 +1,199 @@
+#include "GameFileVerifier.h"
+#include "taflib/nswfl_crc32.h"
+
+#include <QtCore/qdebug.h>
+#include <QtCore/qdir.h>
+#include <QtCore/qelapsedtimer.h>
+#include <QtCore/qfile.h>
+#include <QtCore/qfileinfo.h>
+#include <QtCore/qstandardpaths.h>
+#include <QtCore/qtextstream.h>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+static const qint64 MAP_WINDOW_SIZE = 16 * 1024 * 1024;     // mapped a window at a time so large archives don't exhaust a 32 bit address space
+static const qint64 READ_BUFFER_SIZE = 1024 * 1024;         // if mapping isn't possible
+
+GameFileVerifier::GameFileVerifier(QString cacheFileName) :
+    m_cacheFileName(cacheFileName),
+    m_cacheLoaded(false),
+    m_cacheChanged(false)
+{ }
+
+QString GameFileVerifier::defaultCacheFileName()
+{
+    return QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/gamefilecrc32.txt";
+}
+
+std::vector<GameFileVerifier::Result> GameFileVerifier::crc32(const QStringList &fileNames, unsigned numThreads)
+{
+    QElapsedTimer timer;
+    timer.start();
+    loadCache();
+
+    std::vector<Result> results(fileNames.size());
+    for (int n = 0; n < fileNames.size(); ++n)
+    {
+        results[n].fileName = fileNames[n];
+    }
+
+    numThreads = std::min(std::max(1u, numThreads), unsigned(std::max(std::size_t(1u), results.size())));
+    std::atomic<std::size_t> nextFile(0u);
+    std::vector<std::thread> workers;
+    for (unsigned n = 0u; n < numThreads; ++n)
+    {
+        workers.emplace_back([this, &results, &nextFile]() {
+            for (std::size_t i = nextFile++; i < results.size(); i = nextFile++)
+            {
+                lookupOrCompute(results[i]);
+            }
+        });
+    }
+    for (std::thread &worker : workers)
+    {
+        worker.join();
+    }
+
+    saveCache();
+    qInfo() << "[GameFileVerifier::crc32]" << results.size() << "files," << numThreads << "threads," << timer.elapsed() << "ms";
+    return results;
+}
+
+void GameFileVerifier::lookupOrCompute(Result &result)
+{
+    const QFileInfo before(result.fileName);
+    const QString path = before.absoluteFilePath();
+    const qint64 lastModifiedMs = before.lastModified().toMSecsSinceEpoch();
+    {
+        QMutexLocker lock(&m_cacheMutex);
+        auto it = m_cache.find(path);
+        if (it != m_cache.end() && it->size == before.size() && it->lastModifiedMs == lastModifiedMs)
+        {
+            result.ok = true;
+            result.crc32 = it->crc32;
+            result.fromCache = true;
+            return;
+        }
+    }
+
+    result.ok = computeCrc32(result.fileName, result.crc32);
+
+    // don't cache a file that changed while we were reading it
+    const QFileInfo after(result.fileName);
+    if (result.ok && after.size() == before.size() && after.lastModified().toMSecsSinceEpoch() == lastModifiedMs)
+    {
+        QMutexLocker lock(&m_cacheMutex);
+        CacheEntry &entry = m_cache[path];
+        entry.size = before.size();
+        entry.lastModifiedMs = lastModifiedMs;
+        entry.crc32 = result.crc32;
+        m_cacheChanged = true;
+    }
+}
+
+bool GameFileVerifier::computeCrc32(const QString &fileName, quint32 &crc)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        return false;
+    }
+
+    taflib::CRC32 crc32;
+    unsigned int partialCrc(-1);
+    const qint64 size = file.size();
+    qint64 offset = 0;
+    while (offset < size)
+    {
+        const qint64 windowSize = std::min(MAP_WINDOW_SIZE, size - offset);
+        uchar *window = file.map(offset, windowSize);
+        if (window == NULL)
+        {
+            break;
+        }
+        crc32.PartialCRC(&partialCrc, window, std::size_t(windowSize));
+        file.unmap(window);
+        offset += windowSize;
+    }
+
+    if (offset < size)
+    {
+        std::vector<char> buffer(READ_BUFFER_SIZE);
+        if (!file.seek(offset))
+        {
+            return false;
+        }
+        while (!file.atEnd())
+        {
+            const qint64 bytesRead = file.read(buffer.data(), buffer.size());
+            if (bytesRead < 0)
+            {
+                return false;
+            }
+            crc32.PartialCRC(&partialCrc, (const unsigned char*)buffer.data(), std::size_t(bytesRead));
+        }
+    }
+
+    crc = partialCrc ^ -1;
+    return true;
+}
+
+void GameFileVerifier::loadCache()
+{
+    if (m_cacheLoaded || m_cacheFileName.isEmpty())
+    {
+        return;
+    }
+    m_cacheLoaded = true;
+
+    // each line: crc32 <tab> size <tab> lastModifiedMs <tab> absolute path
+    QFile file(m_cacheFileName);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text))
+    {
+        return;
+    }
+    QTextStream in(&file);
+    in.setCodec("UTF-8");
+    while (!in.atEnd())
+    {
+        const QStringList fields = in.readLine().split('\t');
+        bool ok[3] = { false, false, false };
+        if (fields.size() == 4)
+        {
+            CacheEntry entry;
+            entry.crc32 = fields[0].toUInt(&ok[0], 16);
+            entry.size = fields[1].toLongLong(&ok[1]);
+            entry.lastModifiedMs = fields[2].toLongLong(&ok[2]);
+            if (ok[0] && ok[1] && ok[2])
+            {
+                m_cache[fields[3]] = entry;
+            }
+        }
+    }
+    qInfo() << "[GameFileVerifier::loadCache]" << m_cache.size() << "entries from" << m_cacheFileName;
+}
+
+void GameFileVerifier::saveCache()
+{
+    if (!m_cacheChanged || m_cacheFileName.isEmpty())
+    {
+        return;
+    }
+
+    QDir().mkpath(QFileInfo(m_cacheFileName).absolutePath());
+    QFile file(m_cacheFileName);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text))
+    {
+        qWarning() << "[GameFileVerifier::saveCache] unable to write" << m_cacheFileName;
+        return;
+    }
+    QTextStream out(&file);
+    out.setCodec("UTF-8");
+    for (auto it = m_cache.begin(); it != m_cache.end(); ++it)
+    {
+        out << QString::number(it->crc32, 16) << '\t' << it->size << '\t' << it->lastModifiedMs << '\t' << it.key() << '\n';
+    }
+    m_cacheChanged = false;
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <QtCore/qmap.h>
+#include <QtCore/qmutex.h>
+#include <QtCore/qstring.h>
+#include <QtCore/qstringlist.h>
+
+#include <vector>
+
+// Computes the crc32s of game files, several files at once, and remembers each crc against the file's size and
+// modification time so that files unchanged since a previous launch needn't be read again.
+// NB the cache is only a convenience.  Like the rest of the version check it runs on the player's machine
+// and is no defence against a player determined to get around it
+class GameFileVerifier
+{
+public:
+    struct Result
+    {
+        QString fileName;
+        bool ok;                // false if file could not be read
+        quint32 crc32;
+        bool fromCache;
+
+        Result() : ok(false), crc32(0u), fromCache(false) { }
+    };
+
+    // cacheFileName may be empty to disable caching
+    GameFileVerifier(QString cacheFileName);
+
+    // @return a Result for each of fileNames, in the same order
+    std::vector<Result> crc32(const QStringList &fileNames, unsigned numThreads);
+
+    // default location for the cache file, under the user's cache directory
+    static QString defaultCacheFileName();
+
+private:
+    struct CacheEntry
+    {
+        qint64 size;
+        qint64 lastModifiedMs;
+        quint32 crc32;
+    };
+
+    void lookupOrCompute(Result &result);
+    static bool computeCrc32(const QString &fileName, quint32 &crc);
+    void loadCache();
+    void saveCache();
+
+    const QString m_cacheFileName;
+    QMutex m_cacheMutex;
+    QMap<QString, CacheEntry> m_cache;      // keyed by absolute file path
+    bool m_cacheLoaded;
+    bool m_cacheChanged;
+};
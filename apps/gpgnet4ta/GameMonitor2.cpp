@@ -3,15 +3,21 @@
 
 #include <algorithm>
 #include <iostream>
+#include <random>
 #include <sstream>
 
 #ifdef QT_CORE_LIB
 #include "QtCore/qdebug.h"
-#include "taflib/Watchdog.h"
 #define LOG_WARNING(x) qWarning() << x
 #define LOG_INFO(x) qInfo() << x
 #define LOG_DEBUG(x) qDebug() << x
+#ifdef GAMEMONITOR_NO_WATCHDOG
+// watchdog timers are keyed by name, so can't be shared by monitors running concurrently on several threads
+#define WATCHDOG(name,timeout)
+#else
+#include "taflib/Watchdog.h"
 #define WATCHDOG(name,timeout) taflib::Watchdog wd(name,timeout)
+#endif
 #else
 #define LOG_WARNING(x) std::cout << x << std::endl
 #define LOG_INFO(x) std::cout << x << std::endl
@@ -19,6 +25,45 @@
 #define WATCHDOG(name,timeout)
 #endif
 
+static GameMonitor2::PlayerMask bit(int index)
+{
+    return GameMonitor2::PlayerMask(1u << index);
+}
+
+static void setBit(GameMonitor2::PlayerMask &mask, int index, bool value)
+{
+    if (value)
+    {
+        mask |= bit(index);
+    }
+    else
+    {
+        mask &= GameMonitor2::PlayerMask(~bit(index));
+    }
+}
+
+static int lowestIndex(GameMonitor2::PlayerMask mask)
+{
+    for (int n = 0; n < GameMonitor2::MAX_PLAYERS; ++n)
+    {
+        if (mask & bit(n))
+        {
+            return n;
+        }
+    }
+    return -1;
+}
+
+static int countPlayers(GameMonitor2::PlayerMask mask)
+{
+    int count = 0;
+    for (; mask; mask &= mask - 1u)
+    {
+        ++count;
+    }
+    return count;
+}
+
 Player::Player():
     side(-1)
 { }
@@ -32,7 +77,8 @@ PlayerData::PlayerData():
     tick(0u),
     dplayid(0u),
     armyNumber(0),
-    teamNumber(0)
+    teamNumber(0),
+    index(-1)
 { }
 
 PlayerData::PlayerData(const Player &player):
@@ -45,13 +91,14 @@ PlayerData::PlayerData(const Player &player):
     tick(0u),
     dplayid(0u),
     armyNumber(0),
-    teamNumber(0)
+    teamNumber(0),
+    index(-1)
 { }
 
 std::ostream & PlayerData::print(std::ostream &s) const
 {
     s << "'" << name << "': id=" << std::hex << dplayid
-        << ", slot=" << slotNumber << ", side=" << int(side) << ", isAI=" << isAI << ", isDead=" << isDead << ", tick=" << tick << ", nrAllies=" << allies.size();
+        << ", slot=" << slotNumber << ", side=" << int(side) << ", isAI=" << isAI << ", isDead=" << isDead << ", tick=" << tick << ", index=" << std::dec << index;
     return s;
 }
 
@@ -65,6 +112,14 @@ m_gameLaunched(false),
 m_gameStarted(false),
 m_cheatsEnabled(false),
 m_suspiciousStatus(false),
+m_usedIndices(0u),
+m_watchers(0u),
+m_dead(0u),
+m_indexPlayers(),
+m_playerHash(),
+m_mostRecentGameTick(0u),
+m_alliances(),
+m_frozenAlliances(),
 m_gameEventHandler(gameEventHandler)
 { }
 
@@ -131,6 +186,12 @@ void GameMonitor2::reset()
     m_suspiciousStatus = false;
     m_mapName.clear();
     m_players.clear();
+    m_usedIndices = m_watchers = m_dead = 0u;
+    std::fill(m_indexPlayers, m_indexPlayers + MAX_PLAYERS, (PlayerData*)NULL);
+    std::fill(m_playerHash, m_playerHash + PLAYER_HASH_SIZE, std::int8_t(0));
+    m_mostRecentGameTick = 0u;
+    compileChatMatcher();
+    m_alliances = m_frozenAlliances = AllianceTable();
     m_gameResult = GameResult();
 }
 
@@ -165,6 +226,12 @@ void GameMonitor2::onDplaySuperEnumPlayerReply(std::uint32_t dplayId, const std:
         auto &player = m_players[dplayId];
         player.name = name;
         player.dplayid = dplayId;
+        if (!allocatePlayerIndex(player))
+        {
+            LOG_WARNING("[GameMonitor2::onDplaySuperEnumPlayerReply] ERROR too many players. ignoring dplayid=" << dplayId);
+            m_players.erase(dplayId);
+            return;
+        }
 
         if (m_hostPlayerName.empty())
         {
@@ -184,6 +251,7 @@ void GameMonitor2::onDplaySuperEnumPlayerReply(std::uint32_t dplayId, const std:
             m_localDplayId = dplayId;
         }
 
+        compileChatMatcher();
         updatePlayerArmies();
     }
 }
@@ -196,6 +264,12 @@ void GameMonitor2::onDplayCreateOrForwardPlayer(std::uint16_t command, std::uint
         auto &player = m_players[dplayId];
         player.name = name;
         player.dplayid = dplayId;
+        if (!allocatePlayerIndex(player))
+        {
+            LOG_WARNING("[GameMonitor2::onDplayCreateOrForwardPlayer] ERROR too many players. ignoring dplayid=" << dplayId);
+            m_players.erase(dplayId);
+            return;
+        }
 
         if (m_hostPlayerName.empty())
         {
@@ -215,6 +289,7 @@ void GameMonitor2::onDplayCreateOrForwardPlayer(std::uint16_t command, std::uint
             m_localDplayId = dplayId;
         }
 
+        compileChatMatcher();
         updatePlayerArmies();
         // cannot notify at this point because we dont' know yet whether or not player as an AI (unless we assume AI names start with "AI:" ...)
         // notifyPlayerStatuses();
@@ -232,13 +307,8 @@ void GameMonitor2::onDplayDeletePlayer(std::uint32_t dplayId)
 
     if (!m_gameStarted)
     {
-        PlayerData& player = m_players.at(dplayId);
-        m_gameEventHandler->onClearSlot(player);
-        m_players.erase(dplayId);
-        for (auto &player : m_players)
-        {
-            player.second.allies.erase(dplayId);
-        }
+        if (m_gameEventHandler) m_gameEventHandler->onClearSlot(m_players.at(dplayId));
+        removePlayer(dplayId);
         updatePlayerArmies();
         notifyPlayerStatuses();
     }
@@ -253,6 +323,19 @@ void GameMonitor2::onDplayDeletePlayer(std::uint32_t dplayId)
     }
 }
 
+std::set<tapacket::SubPacketCode> GameMonitor2::getSubPacketCodes()
+{
+    return std::set<tapacket::SubPacketCode>({
+        tapacket::SubPacketCode::PLAYER_INFO_20,
+        tapacket::SubPacketCode::ALLY_23,
+        tapacket::SubPacketCode::TEAM_24,
+        tapacket::SubPacketCode::CHAT_05,
+        tapacket::SubPacketCode::UNIT_KILLED_0C,
+        tapacket::SubPacketCode::REJECT_1B,
+        tapacket::SubPacketCode::UNIT_STAT_AND_MOVE_2C
+    });
+}
+
 void GameMonitor2::onTaPacket(std::uint32_t sourceDplayId, std::uint32_t otherDplayId, bool isLocalSource, const char* encrypted, int sizeEncrypted, const std::vector<tapacket::bytestring>& subpaks)
 {
     for (const tapacket::bytestring& s : subpaks)
@@ -326,20 +409,22 @@ void GameMonitor2::onStatus(
     unsigned playerSlotNumber, int playerSide, bool isWatcher, bool isAI, bool cheats)
 {
     WATCHDOG("GameMonitor2::onStatus", 100);
-    if (m_players.count(sourceDplayId) == 0)
+    PlayerData *pPlayer = findPlayer(sourceDplayId);
+    if (pPlayer == NULL)
     {
         LOG_WARNING("[GameMonitor2::onStatus] ERROR unexpected dplayid=" << sourceDplayId);
         return;
     }
     if (!m_gameStarted)
     {
-        auto &player = m_players[sourceDplayId];
+        auto &player = *pPlayer;
         player.isAI = isAI;
         player.slotNumber = playerSlotNumber;
         if (player.side < 0 || player.isWatcher != isWatcher || player.side != playerSide)
         {
             player.side = playerSide;
             player.isWatcher = isWatcher;
+            setBit(m_watchers, player.index, isWatcher);
             updatePlayerArmies();
             notifyPlayerStatuses();
         }
@@ -359,7 +444,7 @@ void GameMonitor2::onStatus(
 void GameMonitor2::onChat(std::uint32_t sourceDplayId, const std::string &chat)
 {
     WATCHDOG("GameMonitor2::onChat", 100);
-    if (m_players.count(sourceDplayId) == 0)
+    if (findPlayer(sourceDplayId) == NULL)
     {
         LOG_WARNING("[GameMonitor2::onChat] ERROR unexpected dplayid=" << sourceDplayId);
         return;
@@ -388,30 +473,24 @@ void GameMonitor2::onChat(std::uint32_t sourceDplayId, const std::string &chat)
 void GameMonitor2::onAlliance(std::uint32_t subjectDpid, std::uint32_t objectDpid, bool isAllied)
 {
     WATCHDOG("GameMonitor2::onAlliance", 100);
-    auto itSubject = m_players.find(subjectDpid);
-    if (itSubject == m_players.end())
+    const PlayerData *subject = findPlayer(subjectDpid);
+    if (subject == NULL)
     {
         LOG_WARNING("[GameMonitor2::onAlliance] ERROR unexpected subjectDpid=" << subjectDpid);
         return;
     }
-    auto itObject = m_players.find(objectDpid);
-    if (itObject == m_players.end())
+    const PlayerData *object = findPlayer(objectDpid);
+    if (object == NULL)
     {
         LOG_WARNING("[GameMonitor2::onAlliance] ERROR unexpected objectDpid=" << objectDpid);
         return;
     }
 
-    const bool wasAllied = itSubject->second.allies.count(objectDpid);
-    LOG_INFO("[GameMonitor2::onAlliance] subject=" << itSubject->second.name.c_str() << "object=" << itObject->second.name.c_str() << "wasAllied=" << wasAllied << "isAllied=" << isAllied);
+    PlayerMask &subjectAllies = m_alliances.allies[subject->index];
+    const bool wasAllied = (subjectAllies & bit(object->index)) != 0u;
+    LOG_INFO("[GameMonitor2::onAlliance] subject=" << subject->name.c_str() << "object=" << object->name.c_str() << "wasAllied=" << wasAllied << "isAllied=" << isAllied);
 
-    if (isAllied)
-    {
-        itSubject->second.allies.insert(objectDpid);
-    }
-    else
-    {
-        itSubject->second.allies.erase(objectDpid);
-    }
+    setBit(subjectAllies, object->index, isAllied);
 
     if (wasAllied != isAllied)
     {
@@ -435,37 +514,30 @@ void GameMonitor2::onAlliance(std::uint32_t subjectDpid, std::uint32_t objectDpi
 void GameMonitor2::onTeamSelection(std::uint32_t fromDplayId, int teamNumber)
 {
     WATCHDOG("GameMonitor2::onTeamSelection", 100);
-    auto itSubject = m_players.find(fromDplayId);
-    if (itSubject == m_players.end())
+    PlayerData *subject = findPlayer(fromDplayId);
+    if (subject == NULL)
     {
         LOG_WARNING("[GameMonitor2::onTeamSelection] ERROR unexpected subjectDpid=" << fromDplayId);
         return;
     }
 
-    LOG_INFO("[GameMonitor2::onTeamSelection] subject=" << itSubject->second.name.c_str() << "brTeamNumber=" << teamNumber);
-    itSubject->second.battleroomTeamSelection = teamNumber;
+    LOG_INFO("[GameMonitor2::onTeamSelection] subject=" << subject->name.c_str() << "brTeamNumber=" << teamNumber);
+    subject->battleroomTeamSelection = teamNumber;
 
+    const int subjectIndex = subject->index;
     bool anyAllianceChange = false;
     for (auto itObject = m_players.begin(); itObject != m_players.end(); ++itObject)
     {
         if (itObject->second.dplayid != fromDplayId)
         {
-            const bool wasAlliedAB = itSubject->second.allies.count(itObject->second.dplayid);
-            const bool wasAlliedBA = itObject->second.allies.count(itSubject->second.dplayid);
+            const int objectIndex = itObject->second.index;
+            const bool wasAlliedAB = (m_alliances.allies[subjectIndex] & bit(objectIndex)) != 0u;
+            const bool wasAlliedBA = (m_alliances.allies[objectIndex] & bit(subjectIndex)) != 0u;
             const bool nowAllied = (teamNumber < 5) && (teamNumber == itObject->second.battleroomTeamSelection);
 
-            if (nowAllied)
-            {
-                itSubject->second.allies.insert(itObject->second.dplayid);
-                itObject->second.allies.insert(itSubject->second.dplayid);
-                anyAllianceChange = anyAllianceChange || !wasAlliedAB || !wasAlliedBA;
-            }
-            else
-            {
-                itSubject->second.allies.erase(itObject->second.dplayid);
-                itObject->second.allies.erase(itSubject->second.dplayid);
-                anyAllianceChange = anyAllianceChange || wasAlliedAB || wasAlliedBA;
-            }
+            setBit(m_alliances.allies[subjectIndex], objectIndex, nowAllied);
+            setBit(m_alliances.allies[objectIndex], subjectIndex, nowAllied);
+            anyAllianceChange = anyAllianceChange || wasAlliedAB != nowAllied || wasAlliedBA != nowAllied;
             LOG_INFO("[GameMonitor2::onTeamSelection] object:" << itObject->second.name.c_str() << "brTeam:" << itObject->second.battleroomTeamSelection << "wasAlliedAB:" << wasAlliedAB << "wasAlliedBA:" << wasAlliedBA << "nowAllied:" << nowAllied << "anyAllianceChange:" << anyAllianceChange);
         }
     }
@@ -490,7 +562,8 @@ void GameMonitor2::onTeamSelection(std::uint32_t fromDplayId, int teamNumber)
 void GameMonitor2::onUnitDied(std::uint32_t sourceDplayId, std::uint16_t unitId)
 {
     WATCHDOG("GameMonitor2::onUnitDied", 100);
-    if (m_players.count(sourceDplayId) == 0)
+    PlayerData *player = findPlayer(sourceDplayId);
+    if (player == NULL)
     {
         LOG_WARNING("[GameMonitor2::onUnitDied] ERROR unexpected dplayid=" << sourceDplayId);
         return;
@@ -500,12 +573,13 @@ void GameMonitor2::onUnitDied(std::uint32_t sourceDplayId, std::uint16_t unitId)
     {
         LOG_INFO("[GameMonitor2::onUnitDied] sourcedplayId=" << sourceDplayId << " tick=" << getMostRecentGameTick() << " unitId=" << unitId << "(commander), maxUnits=" << m_maxUnits);
         std::ostringstream ss;
-        m_players[sourceDplayId].print(ss);
+        player->print(ss);
         LOG_INFO(ss.str().c_str());
 
-        m_players[sourceDplayId].isDead = true;
+        player->isDead = true;
+        m_dead |= bit(player->index);
 
-        int winningTeamNumber;;
+        int winningTeamNumber;
         if (checkEndGameCondition(winningTeamNumber))
         {
             if (winningTeamNumber > 0)
@@ -525,12 +599,14 @@ void GameMonitor2::onUnitDied(std::uint32_t sourceDplayId, std::uint16_t unitId)
 void GameMonitor2::onRejectOther(std::uint32_t sourceDplayId, std::uint32_t rejectedDplayId)
 {
     WATCHDOG("GameMonitor2::onRejectOther", 100);
-    if (m_players.count(sourceDplayId) == 0)
+    const PlayerData *source = findPlayer(sourceDplayId);
+    if (source == NULL)
     {
         LOG_WARNING("[GameMonitor2::onRejectOther] ERROR unexpected sourceDplayId=" << sourceDplayId);
         return;
     }
-    if (m_players.count(rejectedDplayId) == 0)
+    PlayerData *rejected = findPlayer(rejectedDplayId);
+    if (rejected == NULL)
     {
         // player left before game started?
         return;
@@ -539,30 +615,26 @@ void GameMonitor2::onRejectOther(std::uint32_t sourceDplayId, std::uint32_t reje
     LOG_INFO("[GameMonitor2::onRejectOther] sourceDplayId=" << sourceDplayId << " rejectedDplayId=" << rejectedDplayId);
     {
         std::ostringstream ss;
-        m_players[sourceDplayId].print(ss);
+        source->print(ss);
         LOG_INFO(ss.str().c_str());
     }
     {
         std::ostringstream ss;
-        m_players[rejectedDplayId].print(ss);
+        rejected->print(ss);
         LOG_INFO(ss.str().c_str());
     }
 
     if (!m_gameStarted)
     {
-        PlayerData& player = m_players.at(rejectedDplayId);
-        m_gameEventHandler->onClearSlot(player);
-        m_players.erase(rejectedDplayId);
-        for (auto &player : m_players)
-        {
-            player.second.allies.erase(rejectedDplayId);
-        }
+        if (m_gameEventHandler) m_gameEventHandler->onClearSlot(*rejected);
+        removePlayer(rejectedDplayId);
         updatePlayerArmies();
         notifyPlayerStatuses();
     }
     else
     {
-        m_players[rejectedDplayId].isDead = true;
+        rejected->isDead = true;
+        m_dead |= bit(rejected->index);
 
         int winningTeamNumber;
         if (checkEndGameCondition(winningTeamNumber))
@@ -575,8 +647,9 @@ void GameMonitor2::onRejectOther(std::uint32_t sourceDplayId, std::uint32_t reje
 
 void GameMonitor2::onGameTick(std::uint32_t sourceDplayId, std::uint32_t tick)
 {
-    WATCHDOG("GameMonitor2::onGameTick", 100);
-    if (m_players.count(sourceDplayId) == 0)
+    // called for every 0x2c subpacket, so the watchdog is only armed for the handful of ticks that do more than bookkeeping
+    PlayerData *player = findPlayer(sourceDplayId);
+    if (player == NULL)
     {
         LOG_WARNING("[GameMonitor2::onGameTick] ERROR unexpected sourceDplayId=" << sourceDplayId);
         return;
@@ -584,15 +657,17 @@ void GameMonitor2::onGameTick(std::uint32_t sourceDplayId, std::uint32_t tick)
 
     if (!m_gameLaunched)
     {
+        WATCHDOG("GameMonitor2::onGameTick", 100);
         m_gameLaunched = true;
         if (m_gameEventHandler) m_gameEventHandler->onGameStarted(tick, false);
     }
 
     if (!m_gameStarted && tick > m_gameStartsAfterTickCount)
     {
+        WATCHDOG("GameMonitor2::onGameTick", 100);
         // server logic requires alliances to be locked at launch so we require teams to be set before game starts (tick > m_gameStartsAfterTickCount)
-        // so here we grab the player status (in particular the alliances) at time of game start
-        m_frozenPlayers = m_players;
+        // so here we grab the alliances, teams and armies at time of game start
+        m_frozenAlliances = m_alliances;
 
         m_gameStarted = true;
         notifyPlayerStatuses();
@@ -606,14 +681,19 @@ void GameMonitor2::onGameTick(std::uint32_t sourceDplayId, std::uint32_t tick)
         }
     }
 
-    if (std::int32_t(tick - m_players[sourceDplayId].tick) > 0)
+    if (std::int32_t(tick - player->tick) > 0)
     {
-        m_players[sourceDplayId].tick = tick;
+        player->tick = tick;
+        if (std::int32_t(tick - m_mostRecentGameTick) > 0)
+        {
+            m_mostRecentGameTick = tick;
+        }
     }
 
     if (m_gameResult.endGameTick > 0u && 
-        std::int32_t(getMostRecentGameTick() - m_gameResult.endGameTick) >= 0)
+        std::int32_t(m_mostRecentGameTick - m_gameResult.endGameTick) >= 0)
     {
+        WATCHDOG("GameMonitor2::onGameTick", 100);
         int winningTeamNumber;
         if (!checkEndGameCondition(winningTeamNumber))
         {
@@ -636,74 +716,147 @@ std::uint32_t GameMonitor2::getPlayerDpidByName(const std::string &name) const
     return 0u;
 }
 
-// return player numbers who have neither died nor are watchers
-std::set<std::uint32_t> GameMonitor2::getActivePlayers() const
+unsigned GameMonitor2::hashDplayId(std::uint32_t dplayId)
 {
-    std::set<std::uint32_t> activePlayers;
-    for (const auto & player : m_players)
+    // Fibonacci hashing.  dplay ids tend to differ only in their low bits
+    return unsigned((dplayId * 2654435769u) >> 24) & unsigned(PLAYER_HASH_SIZE - 1);
+}
+
+PlayerData* GameMonitor2::findPlayer(std::uint32_t dplayId)
+{
+    for (unsigned h = hashDplayId(dplayId); m_playerHash[h] != 0; h = (h + 1u) & unsigned(PLAYER_HASH_SIZE - 1))
     {
-        if (!player.second.isDead && !player.second.isWatcher)
+        PlayerData *player = m_indexPlayers[m_playerHash[h] - 1];
+        if (player->dplayid == dplayId)
         {
-            activePlayers.insert(player.second.dplayid);
+            return player;
         }
     }
-    return activePlayers;
+    return NULL;
 }
 
-std::uint32_t GameMonitor2::getMostRecentGameTick() const
+void GameMonitor2::rebuildPlayerHash()
 {
-    std::uint32_t tick = 0u;
-    for (const auto & player : m_players)
+    std::fill(m_playerHash, m_playerHash + PLAYER_HASH_SIZE, std::int8_t(0));
+    for (int n = 0; n < MAX_PLAYERS; ++n)
     {
-        if (player.second.tick > tick)
+        if (m_indexPlayers[n])
         {
-            tick = player.second.tick;
+            unsigned h = hashDplayId(m_indexPlayers[n]->dplayid);
+            while (m_playerHash[h] != 0)
+            {
+                h = (h + 1u) & unsigned(PLAYER_HASH_SIZE - 1);
+            }
+            m_playerHash[h] = std::int8_t(n + 1);
         }
     }
-    return tick;
 }
 
+bool GameMonitor2::allocatePlayerIndex(PlayerData &player)
+{
+    if (player.index >= 0)
+    {
+        return true;
+    }
+    for (int n = 0; n < MAX_PLAYERS; ++n)
+    {
+        if ((m_usedIndices & bit(n)) == 0u)
+        {
+            player.index = n;
+            m_usedIndices |= bit(n);
+            m_alliances.allies[n] = 0u;
+            m_indexPlayers[n] = &player;
+            rebuildPlayerHash();
+            return true;
+        }
+    }
+    return false;
+}
 
-// determine whether a set of players are all allied (ie are all on one team)
-bool GameMonitor2::isAllied(const std::set<std::uint32_t> &playerIds) const
+void GameMonitor2::removePlayer(std::uint32_t dplayId)
 {
-    for (std::uint32_t m : playerIds)
+    auto it = m_players.find(dplayId);
+    if (it == m_players.end())
+    {
+        return;
+    }
+
+    const int index = it->second.index;
+    const PlayerMask others = PlayerMask(~bit(index));
+    m_usedIndices &= others;
+    m_watchers &= others;
+    m_dead &= others;
+    m_alliances.allies[index] = 0u;
+    m_indexPlayers[index] = NULL;
+    for (PlayerMask &allies : m_alliances.allies)
+    {
+        allies &= others;
+    }
+    m_players.erase(it);
+    rebuildPlayerHash();
+    compileChatMatcher();
+
+    // the departed player may have been the one furthest ahead
+    m_mostRecentGameTick = m_players.empty() ? 0u : m_players.begin()->second.tick;
+    for (const auto &player : m_players)
     {
-        for (std::uint32_t n : playerIds)
+        if (std::int32_t(player.second.tick - m_mostRecentGameTick) > 0)
         {
-            if (m != n && m_players.at(m).allies.count(n) == 0)
-            {
-                return false;
-            }
+            m_mostRecentGameTick = player.second.tick;
         }
     }
-    return true;
 }
 
-std::set<std::uint32_t> GameMonitor2::getMutualAllies(std::uint32_t playerId, const std::map<std::uint32_t, PlayerData>& playerData) const
+// return players who have neither died nor are watchers
+GameMonitor2::PlayerMask GameMonitor2::getActivePlayers() const
 {
-    std::set<std::uint32_t> mutualAllies;
+    return PlayerMask(m_usedIndices & ~m_watchers & ~m_dead);
+}
+
+std::uint32_t GameMonitor2::getMostRecentGameTick() const
+{
+    return m_mostRecentGameTick;
+}
 
-    const PlayerData &player = playerData.at(playerId);
-    for (std::uint32_t otherId: player.allies)
+
+// determine whether a set of players are all allied (ie are all on one team)
+bool GameMonitor2::isAllied(PlayerMask players) const
+{
+    for (int n = 0; n < MAX_PLAYERS; ++n)
     {
-        const PlayerData& other = playerData.at(otherId);
-        if (other.allies.count(player.dplayid) > 0)
+        if ((players & bit(n)) && (players & ~bit(n) & ~m_alliances.allies[n]))
         {
-            mutualAllies.insert(other.dplayid);
+            return false;
         }
     }
+    return true;
+}
 
+GameMonitor2::PlayerMask GameMonitor2::getMutualAllies(int playerIndex, const AllianceTable &alliances) const
+{
+    PlayerMask mutualAllies = 0u;
+    const PlayerMask allies = alliances.allies[playerIndex];
+    for (int n = 0; n < MAX_PLAYERS; ++n)
+    {
+        if ((allies & bit(n)) && (alliances.allies[n] & bit(playerIndex)))
+        {
+            mutualAllies |= bit(n);
+        }
+    }
     return mutualAllies;
 }
 
 
-std::set<std::string> GameMonitor2::getMutualAllyNames(std::uint32_t playerId, const std::map<std::uint32_t, PlayerData>& playerData) const
+std::set<std::string> GameMonitor2::getMutualAllyNames(std::uint32_t dplayId) const
 {
     std::set<std::string> mutualAllyNames;
-    for (std::uint32_t id : getMutualAllies(playerId, playerData))
+    const PlayerMask mutualAllies = getMutualAllies(m_players.at(dplayId).index, m_alliances);
+    for (int n = 0; n < MAX_PLAYERS; ++n)
     {
-        mutualAllyNames.insert(m_players.at(id).name);
+        if (mutualAllies & bit(n))
+        {
+            mutualAllyNames.insert(m_indexPlayers[n]->name);
+        }
     }
     return mutualAllyNames;
 }
@@ -715,95 +868,78 @@ std::set<std::string> GameMonitor2::getMutualAllyNames(std::uint32_t playerId, c
 // anyway alliance has to be created mutually to have any effect ...
 bool GameMonitor2::updateAlliances(std::uint32_t sender, const std::string &chat)
 {
-    if (sender == 0u)
+    // the double ' ' between name and text is the magic that prevents player spoofing the alliance ... ?
+    // actually it can be spoofed in lobby, but not in game
+    std::uint32_t subject, object;
+    switch (m_chatMatcher.match(sender, chat, subject, object))
     {
-        std::size_t senderStart = chat.find_first_of('<');
-        std::size_t senderEnd = chat.find_first_of('>');
-        if (senderStart != std::string::npos && senderEnd != std::string::npos && senderStart == 0u && senderEnd > 1u)
-        {
-            std::string senderName = chat.substr(1, senderEnd - 1);
-            sender = getPlayerDpidByName(senderName);
-        }
-        if (sender == 0u)
-        {
-            return false;
-        }
-    }
+    case AllianceChatMatcher::Match::ALLIED:
+        m_alliances.allies[findPlayer(subject)->index] |= bit(findPlayer(object)->index);
+        return true;
 
-    // look for: 
-    //     "<name1>  allied with name2"
-    //     "<name1>  broke alliance with name2"
-    // where name1 must match the sender
-    std::size_t lastWordStart = chat.find_last_of(' ');
-    if (lastWordStart != std::string::npos && 1 + lastWordStart < chat.size())
-    {
-        std::string lastWord = chat.substr(1 + lastWordStart);
-        std::uint32_t playernumber2 = getPlayerDpidByName(lastWord);
-        if (playernumber2 == 0u || playernumber2 == sender)
-        {
-            return false;
-        }
+    case AllianceChatMatcher::Match::BROKE_ALLIANCE:
+        setBit(m_alliances.allies[findPlayer(subject)->index], findPlayer(object)->index, false);
+        return true;
 
-        // the double ' ' between name and text is the magic that prevents player spoofing the alliance ... ?
-        // actually it can be spoofed in lobby, but not in game
-        std::ostringstream makeAlliancePrototype, breakAlliancePrototype;
-        makeAlliancePrototype << "<" << m_players[sender].name << ">  allied with " << lastWord;
-        breakAlliancePrototype << "<" << m_players[sender].name << ">  broke alliance with " << lastWord;
+    default:
+        return false;
+    };
+}
 
-        if (chat == makeAlliancePrototype.str())
-        {
-            m_players[sender].allies.insert(playernumber2);
-            return true;
-        }
-        else if (chat == breakAlliancePrototype.str())
-        {
-            m_players[sender].allies.erase(playernumber2);
-            return true;
-        }
+void GameMonitor2::compileChatMatcher()
+{
+    std::vector<std::pair<std::uint32_t, std::string> > roster;
+    for (const auto &player : m_players)
+    {
+        roster.push_back(std::make_pair(player.first, player.second.name));
     }
-    return false;
+    m_chatMatcher.compile(roster);
 }
 
 void GameMonitor2::updatePlayerArmies()
 {
-    std::vector<PlayerData*> sortedPlayers;
-    for (auto& player : m_players)
-    {
-        sortedPlayers.push_back(&player.second);
-        player.second.armyNumber = 0;       // reset any previous determination
-        player.second.teamNumber = 0;       // reset any previous determination
-    }
+    // reset any previous determination
+    std::fill(m_alliances.teamNumbers, m_alliances.teamNumbers + MAX_PLAYERS, 0);
+    std::fill(m_alliances.armyNumbers, m_alliances.armyNumbers + MAX_PLAYERS, 0);
+    std::fill(m_alliances.teamMasks, m_alliances.teamMasks + MAX_PLAYERS + 2, PlayerMask(0u));
 
-    // sort by dplayid to ensure consistent across all players' instances
-    std::sort(sortedPlayers.begin(), sortedPlayers.end(),
-        [](const PlayerData* p1, const PlayerData* p2)
-        -> bool { return p1->dplayid < p2->dplayid; });
+    const PlayerMask activePlayers = getActivePlayers();
+    PlayerMask unassigned = activePlayers;
 
+    // m_players is keyed by dplayid which ensures consistency across all players' instances
     int teamCount = 1;  // assign team numbers consecutively to each mutually allied set
-    int armyCount = 0;  // assign army number by consecutive sortedPlayer
-    for (PlayerData* sortedPlayer : sortedPlayers)
+    int armyCount = 0;  // assign army number by consecutive dplayid
+    for (const auto& player : m_players)
     {
-        if (sortedPlayer->isWatcher || sortedPlayer->isDead)
+        const int index = player.second.index;
+        if ((activePlayers & bit(index)) == 0u)
         {
             continue;
         }
-        sortedPlayer->armyNumber = ++armyCount;
-        if (sortedPlayer->teamNumber == 0)
+        m_alliances.armyNumbers[index] = ++armyCount;
+        if (unassigned & bit(index))
         {
             ++teamCount;
-            std::set<std::uint32_t> mutualAllies = getMutualAllies(sortedPlayer->dplayid, m_players);
-            mutualAllies.insert(sortedPlayer->dplayid);
-            for (std::uint32_t allynumber : mutualAllies)
+            // this is arbitrary - ie how to deal with someone who's allies aren't allied?
+            const PlayerMask team = (getMutualAllies(index, m_alliances) | bit(index)) & unassigned;
+            for (int n = 0; n < MAX_PLAYERS; ++n)
             {
-                if (m_players.at(allynumber).teamNumber == 0 &&   // this is arbitrary - ie how to deal with someone who's allies aren't allied?
-                    !m_players.at(allynumber).isWatcher &&
-                    !m_players.at(allynumber).isDead)
+                if (team & bit(n))
                 {
-                    m_players.at(allynumber).teamNumber = teamCount;
+                    m_alliances.teamNumbers[n] = teamCount;
                 }
             }
+            unassigned &= PlayerMask(~team);
         }
     }
+
+    for (auto& player : m_players)
+    {
+        const int index = player.second.index;
+        player.second.armyNumber = m_alliances.armyNumbers[index];
+        player.second.teamNumber = m_alliances.teamNumbers[index];
+        m_alliances.teamMasks[player.second.teamNumber] |= bit(index);
+    }
 }
 
 void GameMonitor2::notifyPlayerStatuses()
@@ -818,7 +954,7 @@ void GameMonitor2::notifyPlayerStatuses()
     {
         if (p.second.side >= 0)
         {
-            m_gameEventHandler->onPlayerStatus(p.second, getMutualAllyNames(p.first, m_players));
+            m_gameEventHandler->onPlayerStatus(p.second, getMutualAllyNames(p.first));
             // NB UNKNOWN side means the slot number is invalid too
             if (unsigned(p.second.slotNumber) < isSlotUsed.size())
             {
@@ -847,8 +983,8 @@ bool GameMonitor2::checkEndGameCondition(int &winningTeamNumber)
         return false;
     }
 
-    std::set<std::uint32_t> activePlayers = getActivePlayers();
-    if (activePlayers.empty())
+    const PlayerMask activePlayers = getActivePlayers();
+    if (activePlayers == 0u)
     {
         // game over with forced draw (everyone is dead)
         winningTeamNumber = 0;
@@ -860,24 +996,24 @@ bool GameMonitor2::checkEndGameCondition(int &winningTeamNumber)
     }
 
     int lastTeamStanding;
-    if (isPlayersAllAllied(activePlayers, m_frozenPlayers, lastTeamStanding))
+    if (isPlayersAllAllied(activePlayers, m_frozenAlliances, lastTeamStanding))
     {
         // game over with one team prevailing
         winningTeamNumber = lastTeamStanding;
         if (m_gameResult.endGameTick == 0)
         {
-            LOG_INFO("[GameMonitor2::checkEndGameCondition] end game at tick " << getMostRecentGameTick() << " because all (" << activePlayers.size() << ") active players belong to same (frozen) team:" << lastTeamStanding);
+            LOG_INFO("[GameMonitor2::checkEndGameCondition] end game at tick " << getMostRecentGameTick() << " because all (" << countPlayers(activePlayers) << ") active players belong to same (frozen) team:" << lastTeamStanding);
         }
         return true;
     }
 
-    if (isPlayersAllAllied(activePlayers, m_players, lastTeamStanding))
+    if (isPlayersAllAllied(activePlayers, m_alliances, lastTeamStanding))
     {
         // game over with mutually agreed draw
         winningTeamNumber = -1;
         if (m_gameResult.endGameTick == 0)
         {
-            LOG_INFO("[GameMonitor2::checkEndGameCondition] end game at tick " << getMostRecentGameTick() << " because all (" << activePlayers.size() << ") active players belong to same (dynamic) team:" << lastTeamStanding);
+            LOG_INFO("[GameMonitor2::checkEndGameCondition] end game at tick " << getMostRecentGameTick() << " because all (" << countPlayers(activePlayers) << ") active players belong to same (dynamic) team:" << lastTeamStanding);
         }
         return true;
     }
@@ -886,19 +1022,10 @@ bool GameMonitor2::checkEndGameCondition(int &winningTeamNumber)
     return false;
 }
 
-bool GameMonitor2::isPlayersAllAllied(const std::set<std::uint32_t> & playerIds, const std::map<std::uint32_t, PlayerData>& playerData, int &teamNumber)
+bool GameMonitor2::isPlayersAllAllied(PlayerMask players, const AllianceTable &alliances, int &teamNumber)
 {
-    teamNumber = playerData.at(*playerIds.begin()).teamNumber;
-    for (std::uint32_t id : playerIds)
-    {
-        if (playerData.at(id).teamNumber != teamNumber)
-        {
-            // not allied
-            return false;
-        }
-    }
-    // yes and they are all on firstTeam
-    return true;
+    teamNumber = alliances.teamNumbers[lowestIndex(players)];
+    return (players & ~alliances.teamMasks[teamNumber]) == 0u;
 }
 
 std::uint32_t GameMonitor2::latchEndGameTick(std::uint32_t endGameTick)
@@ -933,10 +1060,11 @@ const GameResult & GameMonitor2::latchEndGameResult(int winningTeamNumber /* or
     }
 
     m_gameResult.status = GameResult::Status::VOID_RESULT;
-    for (const auto& player : m_frozenPlayers)
+    // players can't join or leave m_players once the game has started, so its the same roster as m_frozenAlliances
+    for (const auto& player : m_players)
     {
-        int nArmy = player.second.armyNumber;
-        int nTeam = player.second.teamNumber;
+        int nArmy = m_frozenAlliances.armyNumbers[player.second.index];
+        int nTeam = m_frozenAlliances.teamNumbers[player.second.index];
         if (nArmy == 0 || nTeam == 0 || player.second.isWatcher)
         {
             // either updatePlayerArmies hasn't been called (a bug), or player is a watcher (is normal)
@@ -1057,6 +1185,193 @@ static void SetTestAlliance(int method, GameMonitor2& gm, int p1, int p2, bool i
     };
 }
 
+// the std::set based alliance and team logic GameMonitor2 used before alliances were held as bitmasks.
+// kept only as a reference for testAllianceEquivalence
+class SetBasedAlliances
+{
+public:
+    struct Player
+    {
+        std::set<std::uint32_t> allies;
+        int battleroomTeamSelection;
+        bool isWatcher;
+        bool isDead;
+        int armyNumber;
+        int teamNumber;
+
+        Player() : battleroomTeamSelection(5), isWatcher(false), isDead(false), armyNumber(0), teamNumber(0) { }
+    };
+
+    std::map<std::uint32_t, Player> players;
+    std::map<std::uint32_t, Player> frozenPlayers;
+
+    void add(std::uint32_t id)
+    {
+        players[id];
+        updatePlayerArmies();
+    }
+
+    void remove(std::uint32_t id)
+    {
+        players.erase(id);
+        for (auto& player : players)
+        {
+            player.second.allies.erase(id);
+        }
+        updatePlayerArmies();
+    }
+
+    void setWatcher(std::uint32_t id, bool isWatcher)
+    {
+        if (players.at(id).isWatcher != isWatcher)
+        {
+            players.at(id).isWatcher = isWatcher;
+            updatePlayerArmies();
+        }
+    }
+
+    // alliance chat updates armies whether or not anything changed. NB that matters since deaths don't update armies
+    void setAlliance(std::uint32_t subject, std::uint32_t object, bool isAllied, bool isChat)
+    {
+        const bool wasAllied = players.at(subject).allies.count(object) > 0;
+        if (isAllied)
+        {
+            players.at(subject).allies.insert(object);
+        }
+        else
+        {
+            players.at(subject).allies.erase(object);
+        }
+        if (wasAllied != isAllied || isChat)
+        {
+            updatePlayerArmies();
+        }
+    }
+
+    void selectTeam(std::uint32_t subject, int teamNumber)
+    {
+        players.at(subject).battleroomTeamSelection = teamNumber;
+        bool anyAllianceChange = false;
+        for (auto& object : players)
+        {
+            if (object.first != subject)
+            {
+                std::set<std::uint32_t>& subjectAllies = players.at(subject).allies;
+                const std::size_t sizeBefore = subjectAllies.size() + object.second.allies.size();
+                if (teamNumber < 5 && teamNumber == object.second.battleroomTeamSelection)
+                {
+                    subjectAllies.insert(object.first);
+                    object.second.allies.insert(subject);
+                }
+                else
+                {
+                    subjectAllies.erase(object.first);
+                    object.second.allies.erase(subject);
+                }
+                anyAllianceChange = anyAllianceChange || sizeBefore != subjectAllies.size() + object.second.allies.size();
+            }
+        }
+        if (anyAllianceChange)
+        {
+            updatePlayerArmies();
+        }
+    }
+
+    std::set<std::uint32_t> getMutualAllies(std::uint32_t id) const
+    {
+        std::set<std::uint32_t> mutualAllies;
+        for (std::uint32_t otherId : players.at(id).allies)
+        {
+            if (players.at(otherId).allies.count(id) > 0)
+            {
+                mutualAllies.insert(otherId);
+            }
+        }
+        return mutualAllies;
+    }
+
+    void updatePlayerArmies()
+    {
+        for (auto& player : players)
+        {
+            player.second.armyNumber = 0;
+            player.second.teamNumber = 0;
+        }
+        int teamCount = 1;
+        int armyCount = 0;
+        for (auto& player : players)
+        {
+            if (player.second.isWatcher || player.second.isDead)
+            {
+                continue;
+            }
+            player.second.armyNumber = ++armyCount;
+            if (player.second.teamNumber == 0)
+            {
+                ++teamCount;
+                std::set<std::uint32_t> mutualAllies = getMutualAllies(player.first);
+                mutualAllies.insert(player.first);
+                for (std::uint32_t id : mutualAllies)
+                {
+                    Player& ally = players.at(id);
+                    if (ally.teamNumber == 0 && !ally.isWatcher && !ally.isDead)
+                    {
+                        ally.teamNumber = teamCount;
+                    }
+                }
+            }
+        }
+    }
+
+    static bool isPlayersAllAllied(const std::set<std::uint32_t>& ids, const std::map<std::uint32_t, Player>& playerData, int& teamNumber)
+    {
+        teamNumber = playerData.at(*ids.begin()).teamNumber;
+        for (std::uint32_t id : ids)
+        {
+            if (playerData.at(id).teamNumber != teamNumber)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool checkEndGameCondition(bool gameStarted, int& winningTeamNumber) const
+    {
+        if (!gameStarted)
+        {
+            return false;
+        }
+
+        std::set<std::uint32_t> activePlayers;
+        for (const auto& player : players)
+        {
+            if (!player.second.isDead && !player.second.isWatcher)
+            {
+                activePlayers.insert(player.first);
+            }
+        }
+        if (activePlayers.empty())
+        {
+            winningTeamNumber = 0;
+            return true;
+        }
+
+        int lastTeamStanding;
+        if (isPlayersAllAllied(activePlayers, frozenPlayers, lastTeamStanding))
+        {
+            winningTeamNumber = lastTeamStanding;
+            return true;
+        }
+        if (isPlayersAllAllied(activePlayers, players, lastTeamStanding))
+        {
+            winningTeamNumber = -1;
+            return true;
+        }
+        return false;
+    }
+};
+
 void GameMonitor2::test(int allianceMethod)
 {
     qInfo() << "[GameMonitor2::test] =========== allianceMethod:" << allianceMethod;
@@ -1441,10 +1756,10 @@ void GameMonitor2::test(int allianceMethod)
         gm.onGameTick(4, 101);
         TESTASSERT(gm.isGameStarted());
         TESTASSERT(!gm.isGameOver());
-        TESTASSERT(*gm.getMutualAllies(1, gm.m_frozenPlayers).begin() == 2);
-        TESTASSERT(*gm.getMutualAllies(2, gm.m_frozenPlayers).begin() == 1);
-        TESTASSERT(*gm.getMutualAllies(3, gm.m_frozenPlayers).begin() == 4);
-        TESTASSERT(*gm.getMutualAllies(4, gm.m_frozenPlayers).begin() == 3);
+        TESTASSERT(gm.getMutualAllies(gm.m_players.at(1).index, gm.m_frozenAlliances) == bit(gm.m_players.at(2).index));
+        TESTASSERT(gm.getMutualAllies(gm.m_players.at(2).index, gm.m_frozenAlliances) == bit(gm.m_players.at(1).index));
+        TESTASSERT(gm.getMutualAllies(gm.m_players.at(3).index, gm.m_frozenAlliances) == bit(gm.m_players.at(4).index));
+        TESTASSERT(gm.getMutualAllies(gm.m_players.at(4).index, gm.m_frozenAlliances) == bit(gm.m_players.at(3).index));
 
         // game started already, changes in alliance should be ignored
         SetTestAlliance(allianceMethod, gm, 3, 4, false);
@@ -1459,10 +1774,10 @@ void GameMonitor2::test(int allianceMethod)
         gm.onGameTick(4, 102);
         TESTASSERT(gm.isGameStarted());
         TESTASSERT(!gm.isGameOver());
-        TESTASSERT(*gm.getMutualAllies(1, gm.m_frozenPlayers).begin() == 2);
-        TESTASSERT(*gm.getMutualAllies(2, gm.m_frozenPlayers).begin() == 1);
-        TESTASSERT(*gm.getMutualAllies(3, gm.m_frozenPlayers).begin() == 4);
-        TESTASSERT(*gm.getMutualAllies(4, gm.m_frozenPlayers).begin() == 3);
+        TESTASSERT(gm.getMutualAllies(gm.m_players.at(1).index, gm.m_frozenAlliances) == bit(gm.m_players.at(2).index));
+        TESTASSERT(gm.getMutualAllies(gm.m_players.at(2).index, gm.m_frozenAlliances) == bit(gm.m_players.at(1).index));
+        TESTASSERT(gm.getMutualAllies(gm.m_players.at(3).index, gm.m_frozenAlliances) == bit(gm.m_players.at(4).index));
+        TESTASSERT(gm.getMutualAllies(gm.m_players.at(4).index, gm.m_frozenAlliances) == bit(gm.m_players.at(3).index));
 
         // original teams 1+2 vs 3+4 still in effect
         gm.onUnitDied(1, 1);
@@ -1512,10 +1827,10 @@ void GameMonitor2::test(int allianceMethod)
         gm.onGameTick(4, 101);
         TESTASSERT(gm.isGameStarted());
         TESTASSERT(!gm.isGameOver());
-        TESTASSERT(*gm.getMutualAllies(1, gm.m_frozenPlayers).begin() == 2);
-        TESTASSERT(*gm.getMutualAllies(2, gm.m_frozenPlayers).begin() == 1);
-        TESTASSERT(*gm.getMutualAllies(3, gm.m_frozenPlayers).begin() == 4);
-        TESTASSERT(*gm.getMutualAllies(4, gm.m_frozenPlayers).begin() == 3);
+        TESTASSERT(gm.getMutualAllies(gm.m_players.at(1).index, gm.m_frozenAlliances) == bit(gm.m_players.at(2).index));
+        TESTASSERT(gm.getMutualAllies(gm.m_players.at(2).index, gm.m_frozenAlliances) == bit(gm.m_players.at(1).index));
+        TESTASSERT(gm.getMutualAllies(gm.m_players.at(3).index, gm.m_frozenAlliances) == bit(gm.m_players.at(4).index));
+        TESTASSERT(gm.getMutualAllies(gm.m_players.at(4).index, gm.m_frozenAlliances) == bit(gm.m_players.at(3).index));
 
         // original teams 1+2 vs 3+4 still in effect
         gm.onUnitDied(1, 1);
@@ -1608,4 +1923,157 @@ void GameMonitor2::test(int allianceMethod)
         TestGameResult(gr.results, 3, -1);
         TestGameResult(gr.results, 4, -1);
     }
+
+    testAllianceEquivalence(allianceMethod, 200, 200);
 }
+
+void GameMonitor2::testAllianceEquivalence(unsigned seed, int numGames, int numEvents)
+{
+    qInfo() << "[GameMonitor2::testAllianceEquivalence] seed:" << seed << "numGames:" << numGames << "numEvents:" << numEvents;
+    std::mt19937 rng(seed);
+    auto playerName = [](std::uint32_t id) {
+        std::ostringstream ss;
+        ss << "player" << id;
+        return ss.str();
+    };
+
+    for (int nGame = 0; nGame < numGames; ++nGame)
+    {
+        GameMonitor2 gm(NULL, 100, 10);
+        SetBasedAlliances reference;
+
+        std::vector<std::uint32_t> ids;
+        const int numPlayers = 2 + rng() % 9;
+        while (ids.size() < std::size_t(numPlayers))
+        {
+            std::uint32_t id = 1u + rng() % 1000000u;
+            if (std::find(ids.begin(), ids.end(), id) == ids.end())
+            {
+                ids.push_back(id);
+            }
+        }
+
+        gm.setHostPlayerName(playerName(ids[0]));
+        gm.setLocalPlayerName(playerName(ids[1]));
+        for (std::size_t n = 0; n < ids.size(); ++n)
+        {
+            gm.onDplayCreateOrForwardPlayer(0x0008, ids[n], playerName(ids[n]), NULL, NULL);
+            reference.add(ids[n]);
+        }
+        for (std::size_t n = 0; n < ids.size(); ++n)
+        {
+            gm.onStatus(ids[n], "Comet Catcher", 1500, n, 0, false, false, false);
+        }
+
+        std::uint32_t tick = 0u;
+        for (int nEvent = 0; nEvent < numEvents && !ids.empty(); ++nEvent)
+        {
+            const std::uint32_t subject = ids[rng() % ids.size()];
+            const std::uint32_t object = ids[rng() % ids.size()];
+            const bool isAllied = rng() % 3 != 0;
+            switch (rng() % 10)
+            {
+            case 0:
+            case 1:
+            case 2:
+                gm.onAlliance(subject, object, isAllied);
+                reference.setAlliance(subject, object, isAllied, false);
+                break;
+
+            case 3:
+            {
+                const int teamNumber = rng() % 6;
+                gm.onTeamSelection(subject, teamNumber);
+                reference.selectTeam(subject, teamNumber);
+                break;
+            }
+
+            case 4:
+                if (subject != object)
+                {
+                    std::ostringstream chat;
+                    chat << "<" << playerName(subject) << ">  " << (isAllied ? "allied with " : "broke alliance with ") << playerName(object);
+                    gm.onChat(subject, chat.str());
+                    reference.setAlliance(subject, object, isAllied, true);
+                }
+                break;
+
+            case 5:
+                if (!gm.isGameStarted())
+                {
+                    const bool isWatcher = rng() % 4 == 0;
+                    gm.onStatus(subject, "Comet Catcher", 1500, gm.getPlayerData(subject).slotNumber, 0, isWatcher, false, false);
+                    reference.setWatcher(subject, isWatcher);
+                }
+                break;
+
+            case 6:
+                if (rng() % 4 == 0)
+                {
+                    gm.onUnitDied(subject, 1u + 1500u * (rng() % 10));
+                    reference.players.at(subject).isDead = true;
+                }
+                break;
+
+            case 7:
+                if (rng() % 4 == 0 && subject != object)
+                {
+                    gm.onRejectOther(subject, object);
+                    if (gm.isGameStarted())
+                    {
+                        reference.players.at(object).isDead = true;
+                    }
+                    else
+                    {
+                        reference.remove(object);
+                        ids.erase(std::find(ids.begin(), ids.end(), object));
+                    }
+                }
+                break;
+
+            default:
+            {
+                const bool wasStarted = gm.isGameStarted();
+                tick += rng() % 20;
+                gm.onGameTick(subject, tick);
+                if (!wasStarted && gm.isGameStarted())
+                {
+                    reference.frozenPlayers = reference.players;
+                }
+                break;
+            }
+            };
+
+            for (const auto& player : reference.players)
+            {
+                const PlayerData& pd = gm.getPlayerData(player.first);
+                TESTASSERT(pd.teamNumber == player.second.teamNumber);
+                TESTASSERT(pd.armyNumber == player.second.armyNumber);
+
+                std::set<std::string> mutualAllyNames;
+                for (std::uint32_t id : reference.getMutualAllies(player.first))
+                {
+                    mutualAllyNames.insert(playerName(id));
+                }
+                TESTASSERT(gm.getMutualAllyNames(player.first) == mutualAllyNames);
+            }
+
+            int winningTeamNumber = 0, referenceWinningTeamNumber = 0;
+            const bool isEnded = gm.checkEndGameCondition(winningTeamNumber);
+            TESTASSERT(isEnded == reference.checkEndGameCondition(gm.isGameStarted(), referenceWinningTeamNumber));
+            TESTASSERT(!isEnded || winningTeamNumber == referenceWinningTeamNumber);
+        }
+
+        const GameResult& result = gm.getGameResult();
+        if (result.status == GameResult::Status::READY_RESULT)
+        {
+            for (const GameResult::ArmyResult& army : result.results)
+            {
+                const SetBasedAlliances::Player& frozen = reference.frozenPlayers.at(gm.getPlayerData(army.alias).dplayid);
+                TESTASSERT(army.army == frozen.armyNumber);
+                TESTASSERT(army.team == frozen.teamNumber);
+            }
+        }
+    }
+}
+
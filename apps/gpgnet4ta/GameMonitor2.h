@@ -7,6 +7,7 @@
 #include <set>
 #include <vector>
 
+#include "AllianceChatMatcher.h"
 #include "TAPacketParser.h"
 #include "tapacket/TPacket.h"
 
@@ -25,7 +26,7 @@ struct PlayerData : public Player
 
     std::ostream& print(std::ostream& s) const;
 
-    std::set<std::uint32_t> allies;
+    int index;                  // dense 0..GameMonitor2::MAX_PLAYERS-1 assigned by GameMonitor2. ie this player's bit in alliance and team masks
     int battleroomTeamSelection;// not to be confused with teamNumber. teamnumber is our own deduction
     bool isWatcher;
     bool isAI;
@@ -96,6 +97,22 @@ public:
 
 class GameMonitor2 : public tapacket::TaPacketHandler
 {
+public:
+    static const int MAX_PLAYERS = 16;                  // dplay players including watchers and AIs. TA itself allows 10
+    typedef std::uint16_t PlayerMask;                   // bit n represents player with PlayerData::index == n
+    static const int PLAYER_HASH_SIZE = 2 * MAX_PLAYERS;// power of 2, and never more than half full so probes are short and always terminate
+
+protected:
+    // alliances, and the teams and armies updatePlayerArmies() derives from them, indexed for bitwise end game checks
+    struct AllianceTable
+    {
+        PlayerMask allies[MAX_PLAYERS];                 // allies[n] has bit m set if player n has allied with player m. not necessarily mutual
+        int teamNumbers[MAX_PLAYERS];                   // by PlayerData::index
+        int armyNumbers[MAX_PLAYERS];                   // by PlayerData::index
+        PlayerMask teamMasks[MAX_PLAYERS + 2];          // by team number. team numbers are assigned from 2 upwards
+    };
+
+private:
     std::string m_hostPlayerName;
     std::string m_localPlayerName;
     const std::uint32_t m_gameStartsAfterTickCount;
@@ -109,8 +126,16 @@ class GameMonitor2 : public tapacket::TaPacketHandler
     std::string m_mapName;
     std::uint16_t m_maxUnits;
     std::map<std::uint32_t, PlayerData> m_players;      // keyed by PlayerData::dplayid
-    std::map<std::uint32_t, PlayerData> m_frozenPlayers;// m_players (in particular the teams and alliances) as is was at time of game start
+    PlayerMask m_usedIndices;                           // PlayerData::index of each player in m_players
+    PlayerMask m_watchers;
+    PlayerMask m_dead;
+    PlayerData *m_indexPlayers[MAX_PLAYERS];            // nodes of m_players by PlayerData::index.  NULL where index is free
+    std::int8_t m_playerHash[PLAYER_HASH_SIZE];         // 1+PlayerData::index by hashed dplayid, linear probing.  0 where empty
+    std::uint32_t m_mostRecentGameTick;                 // highest PlayerData::tick seen
+    AllianceTable m_alliances;
+    AllianceTable m_frozenAlliances;                    // m_alliances as it was at time of game start
     std::map<std::string, std::string> m_playerRealNames;// keyed by in-game alias
+    AllianceChatMatcher m_chatMatcher;                  // compiled from m_players each time it changes
     GameResult m_gameResult;                            // empty until latched onto the first encountered victory condition
 
     GameEventHandler *m_gameEventHandler;
@@ -118,6 +143,10 @@ class GameMonitor2 : public tapacket::TaPacketHandler
 public:
     static void test(int allianceMethod);
 
+    // drives random alliance, team, watcher, death and reject events through GameMonitor2 and through the
+    // std::set based logic it used to have, and checks that teams, armies and end game conditions agree
+    static void testAllianceEquivalence(unsigned seed, int numGames, int numEvents);
+
     GameMonitor2(GameEventHandler *gameEventHandler, std::uint32_t gameStartsAfterTickCount, std::uint32_t drawGameTicks);
 
     // Unfortunately we need to be informed who is host so we can determine who's status packets (ie mapname and maxunits)
@@ -144,6 +173,9 @@ public:
     virtual void onDplayCreateOrForwardPlayer(std::uint16_t command, std::uint32_t dplayId, const std::string &name, tapacket::DPAddress *tcp, tapacket::DPAddress *udp);
     virtual void onDplayDeletePlayer(std::uint32_t dplayId);
 
+    // the subpackets onTaPacket() acts on, for TAPacketParser::subscribe
+    static std::set<tapacket::SubPacketCode> getSubPacketCodes();
+
     virtual void onTaPacket(std::uint32_t sourceDplayId, std::uint32_t otherDplayId, bool isLocalSource,
         const char* encrypted, int sizeEncrypted,
         const std::vector<tapacket::bytestring>& subpaks);
@@ -166,7 +198,8 @@ protected:
 
     // return <0 if players are not all on same team
     // return winningTeam>0 if players are all on same team
-    virtual bool isPlayersAllAllied(const std::set<std::uint32_t> & playerIds, const std::map<std::uint32_t, PlayerData>& playerData, int &teamNumber);
+    // players must not be empty
+    virtual bool isPlayersAllAllied(PlayerMask players, const AllianceTable &alliances, int &teamNumber);
 
     // set the EndGame tick after which the game will be considered over.
     // can only be set once.  endGameTick=0u will be quietly incremented to endGameTick=1u.
@@ -180,15 +213,27 @@ protected:
     // returns 0u if not found
     virtual std::uint32_t getPlayerDpidByName(const std::string &name) const;
 
-    // return dplayids who have neither died nor are watchers
-    virtual std::set<std::uint32_t> getActivePlayers() const;
+    // m_players lookup by way of m_playerHash for the per-subpacket handlers.  returns NULL if not found
+    PlayerData* findPlayer(std::uint32_t dplayId);
+    static unsigned hashDplayId(std::uint32_t dplayId);
+    void rebuildPlayerHash();
+
+    // assign the lowest free PlayerData::index to a newly created player, which must be a node of m_players,
+    // and add it to m_indexPlayers and m_playerHash. return false if there are already MAX_PLAYERS
+    virtual bool allocatePlayerIndex(PlayerData &player);
+
+    // erase player from m_players, m_indexPlayers and m_playerHash, and from everyone's alliances
+    virtual void removePlayer(std::uint32_t dplayId);
+
+    // return players who have neither died nor are watchers
+    virtual PlayerMask getActivePlayers() const;
 
     // determine whether a set of players are all allied (ie are all on one team)
-    virtual bool isAllied(const std::set<std::uint32_t> &playernums) const;
+    virtual bool isAllied(PlayerMask players) const;
 
     // get all players for which alliance is mutal (whether alive or dead)
-    virtual std::set<std::uint32_t> getMutualAllies(std::uint32_t playernum, const std::map<std::uint32_t, PlayerData> &playerData) const;
-    virtual std::set<std::string> getMutualAllyNames(std::uint32_t playernum, const std::map<std::uint32_t, PlayerData> & playerData) const;
+    virtual PlayerMask getMutualAllies(int playerIndex, const AllianceTable &alliances) const;
+    virtual std::set<std::string> getMutualAllyNames(std::uint32_t dplayId) const;
 
     // based on chat messages "<player1>  allied with player2".
     // not spoofable in-game, but can be spoofed in lobby :(
@@ -196,6 +241,9 @@ protected:
     // return true if alliances were updated
     virtual bool updateAlliances(std::uint32_t sender, const std::string &chat);
 
+    // m_chatMatcher must be recompiled whenever a player joins, leaves or is renamed
+    virtual void compileChatMatcher();
+
     // works out mutual alliances and assigns team and army numbers to each player
     // in a way that is consistent across all players' demo recordings.
     // The designations will change completely everytime alliances change.
@@ -1,10 +1,10 @@
 #include "GpgNetGameLauncher.h"
 #include "taflib/Watchdog.h"
-#include "taflib/nswfl_crc32.h"
 #include <QtCore/qcoreapplication.h>
 #include <QtCore/qfileinfo.h>
 #include "QtCore/qthread.h"
 #include <cstring>
+#include <thread>
 
 GpgNetGameLauncher::GpgNetGameLauncher(
     QString iniTemplate, QString gamePath, QString iniTarget, QString guid, int playerLimit, bool lockOptions, int maxUnits,
@@ -18,7 +18,8 @@ GpgNetGameLauncher::GpgNetGameLauncher(
     m_maxUnits(maxUnits),
     m_launchClient(launchClient),
     m_gpgNetClient(gpgNetclient),
-    m_enableGameFileVersionVerify(false)
+    m_enableGameFileVersionVerify(false),
+    m_gameFileVerifier(GameFileVerifier::defaultCacheFileName())
 {
     m_gpgNetClient.sendGameState("Idle", "Idle");
     QObject::connect(&m_pollStillActiveTimer, &QTimer::timeout, this, &GpgNetGameLauncher::pollJdplayStillActive);
@@ -353,40 +354,34 @@ void GpgNetGameLauncher::copyOnlineDll(QString target)
 
 bool GpgNetGameLauncher::verifyGameFileVersions()
 {
+    QStringList fileNames;
+    QList<QSet<qint64> > permittedCrcs;
     for (auto it = m_gameFileVersions.begin(); it != m_gameFileVersions.end(); ++it)
     {
-        QFile file(m_gamePath + "/" + it.key());
-        if (file.exists() && !it.value().empty())
+        QString fileName = m_gamePath + "/" + it.key();
+        if (QFile::exists(fileName) && !it.value().empty())
         {
-            if (!file.open(QIODevice::ReadOnly))
-            {
-                qWarning() << "[GpgNetGameLauncher::verifyGameFileVersions]" << file.fileName() << "unable to open for reading";
-                m_launchClient.failGameFileVersions(file.fileName(), "unable to open for reading");
-                return false;
-            }
-
-            unsigned int fileCrc32(-1);
-            {
-                taflib::CRC32 crc32;
-                crc32.Initialize();
-                const qint64 bufferSize = 4096;
-                char buffer[bufferSize];
-                while (!file.atEnd())
-                {
-                    qint64 bytesRead = file.read(buffer, bufferSize);
-                    crc32.PartialCRC(&fileCrc32, (const unsigned char*)buffer, bytesRead);
-                }
+            fileNames.append(fileName);
+            permittedCrcs.append(it.value());
+        }
+    }
 
-                file.close();
-                fileCrc32 ^= -1;
-            }
+    const std::vector<GameFileVerifier::Result> results = m_gameFileVerifier.crc32(fileNames, std::thread::hardware_concurrency());
+    for (std::size_t n = 0u; n < results.size(); ++n)
+    {
+        const GameFileVerifier::Result &result = results[n];
+        if (!result.ok)
+        {
+            qWarning() << "[GpgNetGameLauncher::verifyGameFileVersions]" << result.fileName << "unable to open for reading";
+            m_launchClient.failGameFileVersions(result.fileName, "unable to open for reading");
+            return false;
+        }
 
-            if (!it.value().contains(fileCrc32))
-            {
-                qWarning() << "[GpgNetGameLauncher::verifyGameFileVersions]" << file.fileName() << "crc32 version mismatch" << QString::number(fileCrc32, 16);
-                m_launchClient.failGameFileVersions(file.fileName(), QString(" (crc=") + QString::number(fileCrc32, 16) + ") fails version verification.  It is not whitelisted for competitive play.  Please revert to an official version, or play an unranked game instead.");
-                return false;
-            }
+        if (!permittedCrcs[int(n)].contains(result.crc32))
+        {
+            qWarning() << "[GpgNetGameLauncher::verifyGameFileVersions]" << result.fileName << "crc32 version mismatch" << QString::number(result.crc32, 16);
+            m_launchClient.failGameFileVersions(result.fileName, QString(" (crc=") + QString::number(result.crc32, 16) + ") fails version verification.  It is not whitelisted for competitive play.  Please revert to an official version, or play an unranked game instead.");
+            return false;
         }
     }
     return true;
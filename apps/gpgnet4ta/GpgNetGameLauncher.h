@@ -8,6 +8,7 @@
 #include <QtCore/qfile.h>
 #include <QtCore/qtimer.h>
 
+#include "GameFileVerifier.h"
 #include "LaunchClient.h"
 #include "gpgnet/GpgNetClient.h"
 
@@ -41,6 +42,7 @@ class GpgNetGameLauncher: public QObject
 
     QMap<QString, QSet<qint64> > m_gameFileVersions;    // key: filename; value: list of permitted crc32
     bool m_enableGameFileVersionVerify;
+    GameFileVerifier m_gameFileVerifier;
 
 public:
     GpgNetGameLauncher(
@@ -0,0 +1,147 @@
+#include "PacketAnalysisThread.h"
+
+#include <QtCore/qdebug.h>
+
+static const int STATISTICS_LOG_INTERVAL_MS = 30000;
+static const int OVERFLOW_RETRY_INTERVAL_MS = 1;    // packets in the overflow wait at most about this long for room if nothing else is posted
+
+PacketAnalysisThread::PacketAnalysisThread(tapacket::TAPacketParser* packetParser, unsigned ringCapacity) :
+    m_packetParser(packetParser),
+    m_ring(ringCapacity),
+    m_drainPending(false),
+    m_packets(0u),
+    m_maxDepth(0u),
+    m_maxOverflow(0u),
+    m_packetsAtLastLog(0u)
+{
+    qInfo() << "[PacketAnalysisThread::PacketAnalysisThread] ring capacity" << m_ring.capacity();
+    // m_overflowTimer isn't a child, so it stays on the forwarding thread when we move
+    m_overflowTimer.setInterval(OVERFLOW_RETRY_INTERVAL_MS);
+    QObject::connect(&m_overflowTimer, &QTimer::timeout, [this]() {
+        if (flushOverflow())
+        {
+            m_overflowTimer.stop();
+        }
+    });
+    this->startTimer(STATISTICS_LOG_INTERVAL_MS);   // timer moves with us to m_thread
+    this->moveToThread(&m_thread);
+    m_thread.start();
+}
+
+PacketAnalysisThread::~PacketAnalysisThread()
+{
+    m_thread.quit();
+    m_thread.wait();
+    logStatistics();
+}
+
+void PacketAnalysisThread::post(tapacket::ParsedGameData& parsed)
+{
+    ++m_packets;
+    if (flushOverflow() && m_ring.tryPush(parsed))
+    {
+        scheduleDrain();
+        return;
+    }
+
+    // a drain is necessarily pending or in progress, so it only remains to keep the packet until there's room
+    m_overflow.emplace_back();
+    std::swap(m_overflow.back(), parsed);
+    const std::uint32_t overflow = std::uint32_t(m_overflow.size());
+    if (overflow > m_maxOverflow.load(std::memory_order_relaxed))
+    {
+        if (m_maxOverflow.exchange(overflow, std::memory_order_relaxed) == 0u)
+        {
+            qWarning() << "[PacketAnalysisThread::post] analysis ring full, holding packets back until it drains. consider a larger --analysisthread";
+        }
+    }
+    if (!m_overflowTimer.isActive())
+    {
+        m_overflowTimer.start();
+    }
+}
+
+bool PacketAnalysisThread::flushOverflow()
+{
+    if (m_overflow.empty())
+    {
+        return true;
+    }
+    while (!m_overflow.empty() && m_ring.tryPush(m_overflow.front()))
+    {
+        m_overflow.pop_front();
+    }
+    scheduleDrain();
+    return m_overflow.empty();
+}
+
+void PacketAnalysisThread::scheduleDrain()
+{
+    const std::uint32_t depth = std::uint32_t(m_ring.size());
+    if (depth > m_maxDepth.load(std::memory_order_relaxed))
+    {
+        m_maxDepth.store(depth, std::memory_order_relaxed);
+    }
+
+    if (!m_drainPending.exchange(true))
+    {
+        QMetaObject::invokeMethod(this, "drain", Qt::QueuedConnection);
+    }
+}
+
+QMutex* PacketAnalysisThread::handlerMutex()
+{
+    return &m_handlerMutex;
+}
+
+void PacketAnalysisThread::moveToAnalysisThread(QObject* object)
+{
+    object->moveToThread(&m_thread);
+}
+
+PacketAnalysisThread::Statistics PacketAnalysisThread::getStatistics() const
+{
+    Statistics stats;
+    stats.packets = m_packets.load();
+    stats.maxDepth = m_maxDepth.load();
+    stats.maxOverflow = m_maxOverflow.load();
+    return stats;
+}
+
+void PacketAnalysisThread::drain()
+{
+    // cleared before popping so that anything posted from here on queues another drain
+    m_drainPending.store(false);
+    while (m_ring.tryPop(m_parsedGameData))
+    {
+        try
+        {
+            QMutexLocker lock(&m_handlerMutex);
+            m_packetParser->dispatch(m_parsedGameData);
+        }
+        catch (const std::exception& e)
+        {
+            qWarning() << "[PacketAnalysisThread::drain] exception:" << e.what();
+        }
+        catch (...)
+        {
+            qWarning() << "[PacketAnalysisThread::drain] general exception";
+        }
+    }
+}
+
+void PacketAnalysisThread::timerEvent(QTimerEvent*)
+{
+    if (m_packets.load() != m_packetsAtLastLog)
+    {
+        logStatistics();
+    }
+}
+
+void PacketAnalysisThread::logStatistics()
+{
+    const Statistics stats = getStatistics();
+    m_packetsAtLastLog = stats.packets;
+    qInfo() << "[PacketAnalysisThread::logStatistics] packets:" << stats.packets << "maxDepth:" << stats.maxDepth << "/" << m_ring.capacity()
+        << "maxOverflow:" << stats.maxOverflow;
+}
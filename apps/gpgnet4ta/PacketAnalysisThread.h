@@ -0,0 +1,70 @@
+#pragma once
+
+#include <QtCore/qmutex.h>
+#include <QtCore/qobject.h>
+#include <QtCore/qthread.h>
+#include <QtCore/qtimer.h>
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+
+#include "taflib/SpscRing.h"
+#include "tapacket/TAPacketParser.h"
+
+// Runs TAPacketParser::dispatch(), and hence GameMonitor2 and TaDemoCompilerClient, on a thread of its own
+// so that a slow handler can't delay the forwarding of game traffic.
+// The forwarding thread hands over each split packet through a bounded single-producer single-consumer ring.
+// Packets that find the ring full wait in an overflow queue on the forwarding thread, so none are lost
+class PacketAnalysisThread : public QObject
+{
+    Q_OBJECT
+
+public:
+    struct Statistics
+    {
+        std::uint64_t packets;              // posted in total
+        std::uint32_t maxDepth;             // most packets ever waiting in the ring
+        std::uint32_t maxOverflow;          // most packets ever waiting for room in the ring.  nonzero means the ring is too small
+    };
+
+    // construct on the forwarding thread
+    PacketAnalysisThread(tapacket::TAPacketParser* packetParser, unsigned ringCapacity);
+    ~PacketAnalysisThread();
+
+    // forwarding thread only.  parsed is swapped for a recycled ParsedGameData.
+    // if the ring is full the packet joins the overflow rather than stall forwarding.  the overflow moves into the ring,
+    // oldest first, ahead of the next packet posted, or from a timer if none is
+    void post(tapacket::ParsedGameData& parsed);
+
+    // held by the analysis thread while handlers run.  other threads must hold it while using the handlers
+    QMutex* handlerMutex();
+
+    // handler objects with thread affinity (eg those owning sockets) must live on the analysis thread
+    void moveToAnalysisThread(QObject* object);
+
+    Statistics getStatistics() const;
+
+private slots:
+    void drain();
+
+private:
+    void timerEvent(QTimerEvent* event);
+    bool flushOverflow();   // forwarding thread.  @return true if the overflow is now empty
+    void scheduleDrain();
+    void logStatistics();
+
+    QThread m_thread;
+    tapacket::TAPacketParser* m_packetParser;
+    taflib::SpscRing<tapacket::ParsedGameData> m_ring;
+    tapacket::ParsedGameData m_parsedGameData;  // analysis thread's side of the swap
+    QMutex m_handlerMutex;
+    std::atomic<bool> m_drainPending;
+    std::deque<tapacket::ParsedGameData> m_overflow;    // forwarding thread's, like m_overflowTimer
+    QTimer m_overflowTimer;
+
+    std::atomic<std::uint64_t> m_packets;
+    std::atomic<std::uint32_t> m_maxDepth;
+    std::atomic<std::uint32_t> m_maxOverflow;
+    std::uint64_t m_packetsAtLastLog;
+};
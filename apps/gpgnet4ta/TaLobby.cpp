@@ -6,6 +6,8 @@
 #include "tapacket/TAPacketParser.h"
 #include "tareplay/TaDemoCompilerClient.h"
 
+#include <QtCore/qstandardpaths.h>
+
 static const std::uint32_t TICKS_TO_GAME_START = 1800;  // 60 sec
 static const std::uint32_t TICKS_TO_GAME_DRAW = 60;     // 2 sec
 
@@ -37,7 +39,7 @@ TaLobby::TaLobby(
     m_gameEvents.reset(new GameEventsSignalQt());
     m_gameMonitor.reset(new GameMonitor2(m_gameEvents.data(), TICKS_TO_GAME_START, TICKS_TO_GAME_DRAW));
     m_packetParser.reset(new tapacket::TAPacketParser());
-    m_packetParser->subscribe(m_gameMonitor.data());
+    m_packetParser->subscribe(m_gameMonitor.data(), GameMonitor2::getSubPacketCodes());
     m_pingTimer.setInterval(3000);
 }
 
@@ -49,6 +51,17 @@ void TaLobby::enableForwardToDemoCompiler(QString hostName, quint16 port, quint3
 }
 
 
+void TaLobby::enableAnalysisThread(unsigned ringCapacity)
+{
+    qRegisterMetaType<QList<QVariantMap> >("QList<QVariantMap>");  // m_gameEvents signals now cross threads
+    m_analysisThread.reset(new PacketAnalysisThread(m_packetParser.data(), ringCapacity));
+}
+
+QMutex* TaLobby::handlerMutex()
+{
+    return m_analysisThread ? m_analysisThread->handlerMutex() : NULL;
+}
+
 void TaLobby::connectGameEvents(GameEventHandlerQt &subscriber)
 {
     QObject::connect(m_gameEvents.data(), &GameEventsSignalQt::gameSettings, &subscriber, &GameEventHandlerQt::onGameSettings);
@@ -63,6 +76,7 @@ quint32 TaLobby::getLocalPlayerDplayId()
 {
     if (m_gameMonitor)
     {
+        QMutexLocker lock(handlerMutex());
         return m_gameMonitor->getLocalPlayerDplayId();
     }
     else
@@ -82,24 +96,39 @@ void TaLobby::onCreateLobby(int protocol, int localPort, QString playerAlias, QS
         }
 
         m_tafnetIdsByPlayerName[playerAlias] = playerId;
-        m_gameMonitor->setHostPlayerName(playerAlias.toStdString()); // assume we're host until call to onJoinGame() indicates otherwise
-        m_gameMonitor->setLocalPlayerName(playerAlias.toStdString()); // this won't change
-        m_gameMonitor->setPlayerRealName(playerAlias.toStdString(), playerRealName.toStdString());
-
-        if (m_taDemoCompilerClient)
         {
-            m_taDemoCompilerClient->setHostPlayerName(playerAlias);
-            m_taDemoCompilerClient->setLocalPlayerName(playerAlias);
+            QMutexLocker lock(handlerMutex());
+            m_gameMonitor->setHostPlayerName(playerAlias.toStdString()); // assume we're host until call to onJoinGame() indicates otherwise
+            m_gameMonitor->setLocalPlayerName(playerAlias.toStdString()); // this won't change
+            m_gameMonitor->setPlayerRealName(playerAlias.toStdString(), playerRealName.toStdString());
+
+            if (m_taDemoCompilerClient)
+            {
+                m_taDemoCompilerClient->setHostPlayerName(playerAlias);
+                m_taDemoCompilerClient->setLocalPlayerName(playerAlias);
+            }
         }
 
         m_proxy.reset(new tafnet::TafnetNode(
             playerId, false, m_lobbyBindAddress, m_lobbyPortOverride ? m_lobbyPortOverride : localPort, m_proactiveResendEnabled, m_maxPacketSize));
+        m_proxy->setPacksizeCacheFile(QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/packsize.txt");
         m_game.reset(new tafnet::TafnetGameNode(
             m_proxy.data(),
             m_packetParser.data(),
             [this]() { return new tafnet::GameSender(this->m_gameAddress, 47624); },
             [this](QSharedPointer<QUdpSocket> udpSocket) { return new tafnet::GameReceiver(this->m_gameReceiveBindAddress, 0, 0, udpSocket);
         }));
+        if (m_analysisThread)
+        {
+            if (m_taDemoCompilerClient)
+            {
+                m_analysisThread->moveToAnalysisThread(m_taDemoCompilerClient.data());
+            }
+            PacketAnalysisThread* analysisThread = m_analysisThread.data();
+            m_game->setPacketDispatcher([analysisThread](tapacket::ParsedGameData& parsed) {
+                analysisThread->post(parsed);
+            });
+        }
         QObject::connect(&m_pingTimer, &QTimer::timeout, [this]() {
             std::map<std::uint32_t, std::int64_t> lags = m_proxy->getPingToPeers();
             m_proxy->sendPingToPeers();
@@ -144,11 +173,14 @@ void TaLobby::onJoinGame(QString _host, QString playerAlias, QString playerRealN
         QHostAddress host("127.0.0.1");
         quint16 port = 6112;
         SplitHostAndPort(_host, host, port);
-        m_gameMonitor->setHostPlayerName(playerAlias.toStdString());
-        m_gameMonitor->setPlayerRealName(playerAlias.toStdString(), playerRealName.toStdString());
-        if (m_taDemoCompilerClient)
         {
-            m_taDemoCompilerClient->setHostPlayerName(playerAlias);
+            QMutexLocker lock(handlerMutex());
+            m_gameMonitor->setHostPlayerName(playerAlias.toStdString());
+            m_gameMonitor->setPlayerRealName(playerAlias.toStdString(), playerRealName.toStdString());
+            if (m_taDemoCompilerClient)
+            {
+                m_taDemoCompilerClient->setHostPlayerName(playerAlias);
+            }
         }
         m_proxy->joinGame(host, port, playerId);
         m_game->registerRemotePlayer(playerId, 47624);
@@ -174,7 +206,10 @@ void TaLobby::onConnectToPeer(QString _host, QString playerAlias, QString player
         }
 
         m_tafnetIdsByPlayerName[playerAlias] = playerId;
-        m_gameMonitor->setPlayerRealName(playerAlias.toStdString(), playerRealName.toStdString());
+        {
+            QMutexLocker lock(handlerMutex());
+            m_gameMonitor->setPlayerRealName(playerAlias.toStdString(), playerRealName.toStdString());
+        }
         QHostAddress host("127.0.0.1");
         quint16 port = 6112;
         SplitHostAndPort(_host, host, port);
@@ -232,6 +267,7 @@ void TaLobby::echoToGame(bool isPrivate, QString name, QString chat)
     }
     if (m_gameMonitor)
     {
+        QMutexLocker lock(handlerMutex());
         for (const std::string& playerName : m_gameMonitor->getPlayerNames(true, true))
         {
             if (playerName != m_gameMonitor->getLocalPlayerName())
@@ -248,6 +284,7 @@ void TaLobby::echoToGame(bool isPrivate, QString name, QString chat)
 
 std::uint32_t TaLobby::getDplayIdFromTafnetId(std::uint32_t tafnetId)
 {
+    QMutexLocker lock(handlerMutex());
     const std::set<std::string> knownPlayerNames = m_gameMonitor->getPlayerNames();
     for (auto it = m_tafnetIdsByPlayerName.begin(); it != m_tafnetIdsByPlayerName.end(); ++it)
     {
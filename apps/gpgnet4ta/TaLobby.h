@@ -2,9 +2,11 @@
 
 #include <QtNetwork/qhostaddress.h>
 #include <QtCore/quuid.h>
+#include <QtCore/qmutex.h>
 #include <QtCore/qtimer.h>
 #include "GameEventHandlerQt.h"
 #include "GameMonitor2.h"
+#include "PacketAnalysisThread.h"
 #include "tareplay/TaDemoCompilerClient.h"
 
 namespace tafnet
@@ -32,6 +34,7 @@ class TaLobby : public QObject
     QSharedPointer<GameMonitor2> m_gameMonitor;             // infers major game events from packets provided by m_packetParser
     QSharedPointer<GameEventsSignalQt> m_gameEvents;        // translates inferred game events into Qt signals for external consumption
     QSharedPointer<tareplay::TaDemoCompilerClient> m_taDemoCompilerClient;          // submits data to TaDemoCompiler server for live replay
+    QSharedPointer<PacketAnalysisThread> m_analysisThread;  // if set, m_packetParser's handlers run here instead of on m_game's thread.  declared after them so it stops first
 
     QMap<QString, quint32> m_tafnetIdsByPlayerName;
 
@@ -39,12 +42,19 @@ public:
     TaLobby(QUuid gameGuid, QString lobbyBindAddress, QString gameReceiveBindAddress, QString gameAddress, bool proactiveResend, quint32 maxPacketSize);
     void enableForwardToDemoCompiler(QString hostName, quint16 port, quint32 tafGameId);
 
+    // run game monitor and demo compiler upload on a thread of their own, fed through a ring of ringCapacity packets.
+    // must be called before onCreateLobby
+    void enableAnalysisThread(unsigned ringCapacity);
+
     void connectGameEvents(GameEventHandlerQt &subscriber);
     quint32 getLocalPlayerDplayId();
     void setPeerPingInterval(int milliseconds);
     std::uint32_t getDplayIdFromTafnetId(std::uint32_t tafnetId);
     std::string getPlayerNameFromTafnetId(std::uint32_t tafnetId);
 
+private:
+    // to be held while using m_gameMonitor or m_taDemoCompilerClient.  NULL (ie no locking needed) unless analysis thread is enabled
+    QMutex* handlerMutex();
 
 signals:
     void peerPingStats(QMap<quint32, qint64> pingsPerPeer);
@@ -11,6 +11,7 @@
 #include "taflib/ConsoleReader.h"
 #include "taflib/Logger.h"
 #include "taflib/Watchdog.h"
+#include "tafnet/PacketCapture.h"
 #include "tafnet/TafnetGameNode.h"
 #include "tapacket/TADemoParser.h"
 
@@ -610,7 +611,9 @@ int doMain(int argc, char* argv[])
     parser.setApplicationDescription("GPGNet facade for Direct Play games");
     parser.addHelpOption();
     parser.addVersionOption();
+    parser.addOption(QCommandLineOption("analysisthread", "Run game monitoring and demo compiler upload on a thread of their own, fed through a ring of the given number of packets, so that they can't delay game traffic. Packets arriving while the ring is full are held back until it has room.", "packets"));
     parser.addOption(QCommandLineOption("autolaunch", "Normally gpgnet4ta sets up the connections then waits for a /launch command before it launches TA. This option causes TA to launch straight away."));
+    parser.addOption(QCommandLineOption("capture", "Write all tafnet and game traffic to the given pcapng file, eg for wireshark with tadissector.lua or for tafnetsim --replay.", "capture"));
     parser.addOption(QCommandLineOption("consoleport", "Specifies port for ConsoleReader to listen on (consoleport receives less-privileged commands than LaunchServer does)", "48685"));
     parser.addOption(QCommandLineOption("country", "Player country code.", "code"));
     parser.addOption(QCommandLineOption("democompilerdebugreq", "host:port/gameid of TA Demo Compiler to issue debug req to", "democompilerdebugreq"));
@@ -626,6 +629,7 @@ int doMain(int argc, char* argv[])
     parser.addOption(QCommandLineOption("lockoptions", "Lock (some of) the lobby options."));
     parser.addOption(QCommandLineOption("logfile", "path to file in which to write logs.", "logfile", ""));
     parser.addOption(QCommandLineOption("loglevel", "level of noise in log files. 0 (silent) to 5 (debug).", "logfile", "5"));
+    parser.addOption(QCommandLineOption("logratelimit", "Log at most this many messages per second from any one place in the code, eg 20 so that a lossy peer can't flood the log. 0 (the default) for no limit.", "messages", "0"));
     parser.addOption(QCommandLineOption("maxpacketsize", "Place an upper limit on the otherwise auto-discovered maximum UDP packet size.", "maxpacketsize", "1500"));
     parser.addOption(QCommandLineOption("mean", "Player rating mean.", "mean"));
     parser.addOption(QCommandLineOption("numgames", "Player game count.", "count"));
@@ -636,8 +640,14 @@ int doMain(int argc, char* argv[])
     parser.process(app);
 
     taflib::Logger::Initialise(parser.value("logfile").toStdString(), taflib::Logger::Verbosity(parser.value("loglevel").toInt()));
+    taflib::Logger::Get()->setMaxPerCallSite(parser.value("logratelimit").toInt());
     qInstallMessageHandler(taflib::Logger::Log);
 
+    if (parser.isSet("capture"))
+    {
+        tafnet::PacketCapture::instance().start(parser.value("capture").toStdString());
+    }
+
     if (parser.isSet("runtests"))
     {
         for (int allianceMethod = 0; allianceMethod <=6; ++allianceMethod)
@@ -761,6 +771,12 @@ int doMain(int argc, char* argv[])
             lobby.enableForwardToDemoCompiler(host, port, gameId.toInt());
         }
 
+        if (parser.isSet("analysisthread"))
+        {
+            qInfo() << "[main] enabling analysis thread";
+            lobby.enableAnalysisThread(parser.value("analysisthread").toUInt());
+        }
+
         if (ircForward)
         {
             qInfo() << "[main] connecting IRC to lobby";
@@ -118,9 +118,9 @@ public:
         {
             for (auto it = m_units.get().begin(); it != m_units.get().end(); ++it)
             {
-                int sub = it->first.first;
-                unsigned id = it->first.second;
-                tapacket::bytestring bs = it->second;
+                int sub = it->sub();
+                unsigned id = it->id();
+                tapacket::bytestring bs = it->subpacket();
                 qInfo() << "UnitInfo: sub=" << sub << "id=" << id << '(' << QString::number(id, 16) << ") data=" << QByteArray((const char*)bs.data(), bs.size()).toHex();
             }
         }
@@ -0,0 +1,177 @@
+#include "LossyLink.h"
+#include "tafnet/TafnetNode.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+LossyLink::Stats::Stats() :
+    datagrams(0),
+    bytes(0),
+    dropped(0),
+    bufferedFirstSends(0),
+    bufferedResends(0),
+    acks(0)
+{ }
+
+LossyLink::Stats& LossyLink::Stats::operator+=(const Stats& other)
+{
+    datagrams += other.datagrams;
+    bytes += other.bytes;
+    dropped += other.dropped;
+    bufferedFirstSends += other.bufferedFirstSends;
+    bufferedResends += other.bufferedResends;
+    acks += other.acks;
+    return *this;
+}
+
+bool LossyLink::Pending::operator>(const Pending& other) const
+{
+    return dueNs > other.dueNs || (dueNs == other.dueNs && order > other.order);
+}
+
+LossyLink::LossyLink(const Params& params, quint16 nodePortA, quint16 nodePortB, unsigned randomSeed) :
+    m_params(params),
+    m_numArrived(0),
+    m_random(randomSeed)
+{
+    m_sides[0].nodePort = nodePortA;
+    m_sides[1].nodePort = nodePortB;
+    for (int side = 0; side < 2; ++side)
+    {
+        if (!m_sides[side].socket.bind(QHostAddress(QHostAddress::SpecialAddress::LocalHost), 0u))
+        {
+            throw std::runtime_error("[LossyLink::LossyLink] unable to bind");
+        }
+        QObject::connect(&m_sides[side].socket, &QUdpSocket::readyRead, this, [this, side]() {
+            onReadyRead(side);
+        });
+    }
+
+    m_relayTimer.setSingleShot(true);
+    m_relayTimer.setTimerType(Qt::PreciseTimer);
+    QObject::connect(&m_relayTimer, &QTimer::timeout, this, &LossyLink::relayDue);
+    m_clock.start();
+}
+
+quint16 LossyLink::portFacingA() const
+{
+    return m_sides[0].socket.localPort();
+}
+
+quint16 LossyLink::portFacingB() const
+{
+    return m_sides[1].socket.localPort();
+}
+
+const LossyLink::Stats& LossyLink::stats() const
+{
+    return m_stats;
+}
+
+void LossyLink::rebindFacingA()
+{
+    QUdpSocket& socket = m_sides[0].socket;
+    socket.close();
+    if (!socket.bind(QHostAddress(QHostAddress::SpecialAddress::LocalHost), 0u))
+    {
+        throw std::runtime_error("[LossyLink::rebindFacingA] unable to bind");
+    }
+}
+
+void LossyLink::onReadyRead(int fromSide)
+{
+    std::bernoulli_distribution loss(m_params.lossProbability);
+    std::uniform_int_distribution<int> jitter(0, std::max(0, m_params.jitterMs));
+
+    Side& from = m_sides[fromSide];
+    while (from.socket.hasPendingDatagrams())
+    {
+        QByteArray datagram;
+        datagram.resize(int(from.socket.pendingDatagramSize()));
+        const qint64 size = from.socket.readDatagram(datagram.data(), datagram.size());
+        if (size < 0)
+        {
+            continue;
+        }
+        datagram.resize(int(size));
+        countDatagram(from, datagram);
+
+        if (loss(m_random))
+        {
+            ++m_stats.dropped;
+            continue;
+        }
+        Pending pending;
+        pending.dueNs = m_clock.nsecsElapsed() + 1000000LL * (m_params.latencyMs + jitter(m_random));
+        pending.order = m_numArrived++;
+        pending.toSide = 1 - fromSide;
+        pending.datagram = datagram;
+        m_pending.push(pending);
+    }
+    scheduleRelay();
+}
+
+void LossyLink::countDatagram(Side& from, const QByteArray& datagram)
+{
+    using tafnet::Payload;
+
+    ++m_stats.datagrams;
+    m_stats.bytes += datagram.size();
+    if (datagram.isEmpty())
+    {
+        return;
+    }
+
+    const unsigned action = std::uint8_t(datagram[0]);
+    if (action == Payload::ACTION_TCP_ACK)
+    {
+        ++m_stats.acks;
+    }
+    else if (datagram.size() >= int(sizeof(tafnet::TafnetBufferedHeader)) && (
+        action == Payload::ACTION_TCP_DATA ||
+        action == Payload::ACTION_MORE ||
+        action == Payload::ACTION_ENUM ||
+        action == Payload::ACTION_UDP_PROTECTED ||
+        action == Payload::ACTION_HELLO))
+    {
+        tafnet::TafnetBufferedHeader header;
+        std::memcpy(&header, datagram.data(), sizeof(header));
+        if (from.seqsSeen.insert(header.seq).second)
+        {
+            ++m_stats.bufferedFirstSends;
+        }
+        else
+        {
+            ++m_stats.bufferedResends;
+        }
+    }
+}
+
+void LossyLink::relayDue()
+{
+    const qint64 now = m_clock.nsecsElapsed();
+    while (!m_pending.empty() && m_pending.top().dueNs <= now)
+    {
+        const Pending& pending = m_pending.top();
+        // sent from the socket facing the receiving node, which it knows as the sending node's address
+        Side& to = m_sides[pending.toSide];
+        to.socket.writeDatagram(pending.datagram, QHostAddress(QHostAddress::SpecialAddress::LocalHost), to.nodePort);
+        m_pending.pop();
+    }
+    scheduleRelay();
+}
+
+void LossyLink::scheduleRelay()
+{
+    if (m_pending.empty())
+    {
+        return;
+    }
+    const qint64 waitNs = m_pending.top().dueNs - m_clock.nsecsElapsed();
+    const int waitMs = int(std::max(qint64(0), (waitNs + 999999LL) / 1000000LL));
+    if (!m_relayTimer.isActive() || m_relayTimer.remainingTime() > waitMs)
+    {
+        m_relayTimer.start(waitMs);
+    }
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstdint>
+#include <queue>
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+#include <QtCore/qbytearray.h>
+#include <QtCore/qelapsedtimer.h>
+#include <QtCore/qtimer.h>
+#include <QtNetwork/qudpsocket.h>
+
+// Stands in for the network between two TafnetNodes A and B on 127.0.0.1.
+// A is told that B is at portFacingA() and vice versa.  Datagrams arriving at either socket are dropped or held back
+// for latency plus a random jitter, then relayed from the socket facing the other node so that it sees them come from
+// where it expects.  Jitter greater than the interval between datagrams reorders them
+class LossyLink : public QObject
+{
+public:
+    struct Params
+    {
+        double lossProbability;
+        int latencyMs;
+        int jitterMs;       // each datagram delayed by an extra 0..jitterMs
+    };
+
+    struct Stats
+    {
+        qint64 datagrams;           // arrived at the link, in either direction
+        qint64 bytes;
+        qint64 dropped;
+        qint64 bufferedFirstSends;  // datagrams carrying a tafnet buffered message seq not seen before in that direction
+        qint64 bufferedResends;     // and those carrying one seen before
+        qint64 acks;
+
+        Stats();
+        Stats& operator+=(const Stats& other);
+    };
+
+    LossyLink(const Params& params, quint16 nodePortA, quint16 nodePortB, unsigned randomSeed);
+
+    quint16 portFacingA() const;
+    quint16 portFacingB() const;
+    const Stats& stats() const;
+
+    // as if B's NAT mapping changed: from now on A sees B's datagrams come from a new portFacingA(),
+    // and anything A sends to the old one is lost
+    void rebindFacingA();
+
+private:
+    struct Side
+    {
+        QUdpSocket socket;
+        quint16 nodePort;                           // port of the node on this side
+        std::unordered_set<std::uint32_t> seqsSeen; // tafnet buffered message seqs sent by the node on this side
+    };
+
+    struct Pending
+    {
+        qint64 dueNs;
+        qint64 order;       // keeps datagrams due at the same time in arrival order
+        int toSide;
+        QByteArray datagram;
+
+        bool operator>(const Pending& other) const;
+    };
+
+    void onReadyRead(int fromSide);
+    void countDatagram(Side& from, const QByteArray& datagram);
+    void relayDue();
+    void scheduleRelay();
+
+    const Params m_params;
+    Side m_sides[2];
+    std::priority_queue<Pending, std::vector<Pending>, std::greater<Pending> > m_pending;
+    qint64 m_numArrived;
+    QTimer m_relayTimer;
+    QElapsedTimer m_clock;
+    std::mt19937 m_random;
+    Stats m_stats;
+};
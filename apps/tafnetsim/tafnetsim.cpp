@@ -0,0 +1,639 @@
+#include <QtCore/qcoreapplication.h>
+#include <QtCore/qcommandlineparser.h>
+#include <QtCore/qelapsedtimer.h>
+#include <QtCore/qeventloop.h>
+#include <QtCore/qtimer.h>
+
+#include <algorithm>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "LossyLink.h"
+#include "taflib/Logger.h"
+#include "tafnet/GameReceiver.h"
+#include "tafnet/GameSender.h"
+#include "tafnet/PacketCapture.h"
+#include "tafnet/TafnetGameNode.h"
+#include "tafnet/TafnetNode.h"
+#include "tapacket/TADemoParser.h"
+#include "tapacket/TestPackets.h"
+#include "VersionString.h"
+
+static const std::uint32_t FIRST_PLAYER_ID = 1001u;     // node n is tafnet player FIRST_PLAYER_ID + n
+static const int TICK_INTERVAL = 1;                     // milliseconds, between checks for scripted packets that are due
+static const int MAX_REPLAYED_PER_TICK = 100;            // datagrams, so an accelerated replay doesn't overflow the node's socket buffer
+
+#pragma pack(push, 1)   // no padding
+// written at the front of each game packet so it can be recognised on delivery.
+// unique contents also keep TafnetNode's udp duplicate detection from discarding repeats of the same test packet
+struct SimStamp
+{
+    std::uint32_t size;         // whole packet, in place of a dplay header's size_and_token since TafnetGameNode walks tcp data
+                                // message by message.  a zero token means none is mistaken for a real dplay header
+    std::uint32_t seq;
+    std::uint32_t sourceNode;
+};
+#pragma pack(pop)
+
+// a packet that one node's game sends to each of the others
+struct ScriptedPacket
+{
+    qint64 dueMs;           // since replay began
+    int channel;            // GameReceiver::CHANNEL_UDP or CHANNEL_TCP
+    QByteArray data;        // starting with room for a SimStamp
+};
+
+// stands in for the game receiving from a peer.  hands each packet tafnet delivers to onDelivered instead of passing it on
+class SimGameSender : public tafnet::GameSender
+{
+    std::function<void(const char*, int)> m_onDelivered;
+
+public:
+    SimGameSender(const std::function<void(const char*, int)> &onDelivered) :
+        GameSender(QHostAddress(QHostAddress::SpecialAddress::LocalHost), 0u),
+        m_onDelivered(onDelivered)
+    { }
+
+    virtual bool enumSessions(const char*, int) { return true; }
+    virtual bool openTcpSocket(int) { return true; }
+    virtual void sendTcpData(char* data, int len) { m_onDelivered(data, len); }
+    virtual void sendUdpData(char* data, int len, quint16) { m_onDelivered(data, len); }
+};
+
+// stands in for the game sending to a peer.  the simulation hands packets straight to tafnet's handler
+// rather than the game writing them to our sockets
+class SimGameReceiver : public tafnet::GameReceiver
+{
+    QSharedPointer<QUdpSocket> m_udpSocket;
+    std::function<void(QAbstractSocket*, int, const tafnet::PacketBufferPtr&)> m_handler;
+
+public:
+    SimGameReceiver(QSharedPointer<QUdpSocket> udpSocket) :
+        GameReceiver(QHostAddress(QHostAddress::SpecialAddress::LocalHost), 0u, 0u, udpSocket),
+        m_udpSocket(udpSocket)
+    { }
+
+    virtual void setHandler(const std::function<void(QAbstractSocket*, int, const tafnet::PacketBufferPtr&)>& f)
+    {
+        m_handler = f;
+        GameReceiver::setHandler(f);
+    }
+
+    // TafnetGameNode identifies the peer by the port of the receiving socket, not by the channel
+    void inject(int channel, const tafnet::PacketBufferPtr& packet)
+    {
+        if (m_handler)
+        {
+            m_handler(m_udpSocket.data(), channel, packet);
+        }
+    }
+};
+
+// N TafnetNodes in one process, each pair joined by a LossyLink, each node's game replaying its script to all the others
+class Simulation
+{
+public:
+    struct Options
+    {
+        int numNodes;
+        quint16 basePort;               // node n binds basePort + n
+        LossyLink::Params link;
+        bool proactiveResend;
+        std::uint32_t maxPacketSize;
+        int warmupMs;                   // for nodes to connect and find max packet sizes before the games start sending
+        int drainMs;                    // after the last packet is sent, for resends to arrive
+        int rebindMs;                   // after the games start sending, when every link's rebindFacingA().  0 for never
+        unsigned randomSeed;
+    };
+
+    Simulation(const Options &options, const std::vector<std::vector<ScriptedPacket> > &scripts);
+
+    void run();
+    void report(std::ostream &os) const;
+    void onDelivered(int destNode, const char* data, int len);
+
+private:
+    struct Node
+    {
+        std::unique_ptr<tafnet::TafnetNode> tafnetNode;
+        std::unique_ptr<tafnet::TafnetGameNode> gameNode;   // destroyed first, it refers to tafnetNode
+        std::map<int, SimGameReceiver*> gameReceivers;      // keyed by peer node.  owned by gameNode
+        std::size_t nextScripted;
+        std::vector<qint64> sendTimesNs;                    // by seq
+
+        Node() : nextScripted(0u) { }
+    };
+
+    void onTick();
+    bool allSent() const;
+
+    const Options m_options;
+    const std::vector<std::vector<ScriptedPacket> > &m_scripts;
+    std::vector<Node> m_nodes;
+    std::vector<std::unique_ptr<LossyLink> > m_links;
+    SimGameReceiver* m_lastGameReceiver;
+
+    // m_delivered[dest][source][seq]
+    std::vector<std::vector<std::vector<char> > > m_delivered;
+    qint64 m_numExpected;
+    qint64 m_numDelivered;
+    qint64 m_numDuplicates;
+    qint64 m_bytesDelivered;
+    std::vector<qint64> m_latenciesNs;
+
+    QEventLoop m_loop;
+    QTimer m_tickTimer;
+    QElapsedTimer m_clock;
+    qint64 m_replayStartNs;
+    qint64 m_lastSendNs;
+    qint64 m_lastDeliveryNs;
+    std::clock_t m_replayStartCpu;
+    std::clock_t m_replayEndCpu;
+};
+
+Simulation::Simulation(const Options &options, const std::vector<std::vector<ScriptedPacket> > &scripts) :
+    m_options(options),
+    m_scripts(scripts),
+    m_nodes(options.numNodes),
+    m_lastGameReceiver(NULL),
+    m_numExpected(0),
+    m_numDelivered(0),
+    m_numDuplicates(0),
+    m_bytesDelivered(0),
+    m_replayStartNs(0),
+    m_lastSendNs(0),
+    m_lastDeliveryNs(0),
+    m_replayStartCpu(0),
+    m_replayEndCpu(0)
+{
+    const QHostAddress localHost(QHostAddress::SpecialAddress::LocalHost);
+    const int numNodes = options.numNodes;
+
+    m_delivered.resize(numNodes);
+    for (int dest = 0; dest < numNodes; ++dest)
+    {
+        m_delivered[dest].resize(numNodes);
+        for (int source = 0; source < numNodes; ++source)
+        {
+            m_delivered[dest][source].resize(scripts[source].size(), 0);
+            m_numExpected += dest == source ? 0 : qint64(scripts[source].size());
+        }
+    }
+
+    for (int n = 0; n < numNodes; ++n)
+    {
+        Node &node = m_nodes[n];
+        node.sendTimesNs.resize(scripts[n].size(), 0);
+        node.tafnetNode.reset(new tafnet::TafnetNode(
+            FIRST_PLAYER_ID + n, n == 0, localHost, quint16(options.basePort + n), options.proactiveResend, options.maxPacketSize));
+        node.gameNode.reset(new tafnet::TafnetGameNode(
+            node.tafnetNode.get(),
+            NULL,
+            [this, n]() { return new SimGameSender([this, n](const char* data, int len) { onDelivered(n, data, len); }); },
+            [this](QSharedPointer<QUdpSocket> udpSocket) { return m_lastGameReceiver = new SimGameReceiver(udpSocket); }));
+    }
+
+    for (int a = 0; a < numNodes; ++a)
+    {
+        for (int b = a + 1; b < numNodes; ++b)
+        {
+            LossyLink* link = new LossyLink(options.link, quint16(options.basePort + a), quint16(options.basePort + b), options.randomSeed + m_links.size());
+            m_links.emplace_back(link);
+
+            // node 0 hosts, as the first to join a TaLobby game would
+            const int ends[2] = { a, b };
+            const quint16 linkPorts[2] = { link->portFacingA(), link->portFacingB() };
+            for (int end = 0; end < 2; ++end)
+            {
+                Node &node = m_nodes[ends[end]];
+                const int peer = ends[1 - end];
+                if (peer == 0)
+                {
+                    node.tafnetNode->joinGame(localHost, linkPorts[end], FIRST_PLAYER_ID + peer);
+                }
+                else
+                {
+                    node.tafnetNode->connectToPeer(localHost, linkPorts[end], FIRST_PLAYER_ID + peer);
+                }
+                node.gameNode->registerRemotePlayer(FIRST_PLAYER_ID + peer, 0u);
+                node.gameReceivers[peer] = m_lastGameReceiver;
+            }
+        }
+    }
+
+    m_tickTimer.setTimerType(Qt::PreciseTimer);
+    m_tickTimer.setInterval(TICK_INTERVAL);
+    QObject::connect(&m_tickTimer, &QTimer::timeout, [this]() { onTick(); });
+}
+
+void Simulation::run()
+{
+    m_clock.start();
+    QTimer::singleShot(m_options.warmupMs, [this]() {
+        m_replayStartNs = m_lastSendNs = m_lastDeliveryNs = m_clock.nsecsElapsed();
+        m_replayStartCpu = std::clock();
+        m_tickTimer.start();
+    });
+    if (m_options.rebindMs > 0)
+    {
+        QTimer::singleShot(m_options.warmupMs + m_options.rebindMs, [this]() {
+            for (auto &link : m_links)
+            {
+                link->rebindFacingA();
+            }
+        });
+    }
+    m_loop.exec();
+    m_tickTimer.stop();
+    m_replayEndCpu = std::clock();
+}
+
+bool Simulation::allSent() const
+{
+    for (std::size_t n = 0u; n < m_nodes.size(); ++n)
+    {
+        if (m_nodes[n].nextScripted < m_scripts[n].size())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void Simulation::onTick()
+{
+    tafnet::PacketBufferPool &pool = tafnet::PacketBufferPool::instance();
+    const qint64 nowNs = m_clock.nsecsElapsed();
+    const qint64 replayMs = (nowNs - m_replayStartNs) / 1000000LL;
+
+    for (std::size_t source = 0u; source < m_nodes.size(); ++source)
+    {
+        Node &node = m_nodes[source];
+        const std::vector<ScriptedPacket> &script = m_scripts[source];
+        for (; node.nextScripted < script.size() && script[node.nextScripted].dueMs <= replayMs; ++node.nextScripted)
+        {
+            const ScriptedPacket &scripted = script[node.nextScripted];
+            SimStamp stamp;
+            stamp.size = std::uint32_t(scripted.data.size());
+            stamp.seq = std::uint32_t(node.nextScripted);
+            stamp.sourceNode = std::uint32_t(source);
+
+            node.sendTimesNs[node.nextScripted] = m_lastSendNs = m_clock.nsecsElapsed();
+            for (auto &it : node.gameReceivers)
+            {
+                // each peer's copy is buffered separately by TafnetNode
+                tafnet::PacketBufferPtr packet = pool.copy(scripted.data.data(), scripted.data.size());
+                std::memcpy(packet->data(), &stamp, sizeof(stamp));
+                it.second->inject(scripted.channel, packet);
+            }
+        }
+    }
+
+    const bool allDelivered = m_numDelivered >= m_numExpected;
+    const bool drained = nowNs - m_lastSendNs > 1000000LL * m_options.drainMs;
+    if (allSent() && (allDelivered || drained))
+    {
+        m_loop.quit();
+    }
+}
+
+void Simulation::onDelivered(int destNode, const char* data, int len)
+{
+    const qint64 nowNs = m_clock.nsecsElapsed();
+    SimStamp stamp;
+    if (len < int(sizeof(stamp)))
+    {
+        return;
+    }
+    std::memcpy(&stamp, data, sizeof(stamp));
+    if (stamp.sourceNode >= m_nodes.size() || stamp.seq >= m_nodes[stamp.sourceNode].nextScripted)
+    {
+        return;     // eg HELLO
+    }
+
+    char &delivered = m_delivered[destNode][stamp.sourceNode][stamp.seq];
+    if (delivered)
+    {
+        ++m_numDuplicates;
+        return;
+    }
+    delivered = 1;
+    ++m_numDelivered;
+    m_bytesDelivered += len;
+    m_lastDeliveryNs = nowNs;
+    m_latenciesNs.push_back(nowNs - m_nodes[stamp.sourceNode].sendTimesNs[stamp.seq]);
+}
+
+static double percentileMs(const std::vector<qint64> &sortedNs, double fraction)
+{
+    if (sortedNs.empty())
+    {
+        return 0.0;
+    }
+    const std::size_t n = std::min(sortedNs.size() - 1u, std::size_t(fraction * sortedNs.size()));
+    return 1e-6 * sortedNs[n];
+}
+
+void Simulation::report(std::ostream &os) const
+{
+    LossyLink::Stats linkStats;
+    for (const auto &link : m_links)
+    {
+        linkStats += link->stats();
+    }
+
+    std::vector<qint64> latenciesNs(m_latenciesNs);
+    std::sort(latenciesNs.begin(), latenciesNs.end());
+
+    const double replaySecs = std::max(1e-9, 1e-9 * (m_lastDeliveryNs - m_replayStartNs));
+    const double cpuSecs = double(m_replayEndCpu - m_replayStartCpu) / CLOCKS_PER_SEC;
+
+    os << "[TafnetSim] " << m_options.numNodes << " nodes, loss=" << 100.0 * m_options.link.lossProbability << "%, latency="
+        << m_options.link.latencyMs << "ms, jitter=" << m_options.link.jitterMs << "ms, proactive resend="
+        << (m_options.proactiveResend ? "on" : "off");
+    if (m_options.rebindMs > 0)
+    {
+        os << ", links rebound after " << m_options.rebindMs << "ms";
+    }
+    os << std::endl;
+    os << "[TafnetSim] delivered " << m_numDelivered << " of " << m_numExpected << " packets ("
+        << (m_numExpected ? 100.0 * m_numDelivered / m_numExpected : 0.0) << "%), " << m_numDuplicates << " duplicates" << std::endl;
+    os << "[TafnetSim] latency ms: p50=" << percentileMs(latenciesNs, 0.5) << " p90=" << percentileMs(latenciesNs, 0.9)
+        << " p99=" << percentileMs(latenciesNs, 0.99) << " max=" << percentileMs(latenciesNs, 1.0) << std::endl;
+    os << "[TafnetSim] goodput " << m_bytesDelivered / replaySecs / 1024.0 << " KiB/s over " << replaySecs << " s" << std::endl;
+    os << "[TafnetSim] on the wire " << linkStats.datagrams << " datagrams (" << linkStats.bytes << " bytes), "
+        << linkStats.dropped << " dropped, " << linkStats.acks << " acks" << std::endl;
+    os << "[TafnetSim] buffered messages " << linkStats.bufferedFirstSends << " sent, " << linkStats.bufferedResends
+        << " resent, resend ratio " << (linkStats.bufferedFirstSends ? double(linkStats.bufferedResends) / linkStats.bufferedFirstSends : 0.0) << std::endl;
+    // every node and link shares this process, so this is the whole cost of a packet: sending node, shim and receiving node.
+    // NB std::clock measures wall time rather than cpu time on Windows
+    os << "[TafnetSim] cpu " << cpuSecs << " s, "
+        << (m_numDelivered ? 1e6 * cpuSecs / m_numDelivered : 0.0) << " us per delivered packet" << std::endl;
+}
+
+// collects a demo's game packets, sharing them out between nodes by the player that sent them
+class DemoScriptParser : public tapacket::DemoParser
+{
+    std::vector<std::vector<ScriptedPacket> > &m_scripts;
+    const std::size_t m_maxPacketsPerNode;
+    std::map<int, int> m_nodeBySender;
+    qint64 m_timeMs;
+
+public:
+    DemoScriptParser(std::vector<std::vector<ScriptedPacket> > &scripts, std::size_t maxPacketsPerNode) :
+        m_scripts(scripts),
+        m_maxPacketsPerNode(maxPacketsPerNode),
+        m_timeMs(0)
+    { }
+
+    virtual void handle(const tapacket::Header &) { }
+    virtual void handle(const tapacket::Player &, int, int) { }
+    virtual void handle(const tapacket::ExtraSector &, int, int) { }
+    virtual void handle(const tapacket::PlayerStatusMessage &, std::uint32_t, int, int) { }
+    virtual void handle(const tapacket::UnitData &) { }
+
+    virtual void handle(const tapacket::Packet &packet, const std::vector<tapacket::bytestring> &, std::size_t)
+    {
+        m_timeMs += packet.time;
+        auto it = m_nodeBySender.find(packet.sender);
+        if (it == m_nodeBySender.end())
+        {
+            it = m_nodeBySender.insert(std::make_pair(int(packet.sender), int(m_nodeBySender.size() % m_scripts.size()))).first;
+        }
+
+        std::vector<ScriptedPacket> &script = m_scripts[it->second];
+        if (script.size() < m_maxPacketsPerNode)
+        {
+            ScriptedPacket scripted;
+            scripted.dueMs = m_timeMs;
+            scripted.channel = tafnet::GameReceiver::CHANNEL_UDP;
+            scripted.data = QByteArray(sizeof(SimStamp), '\0');
+            scripted.data.append((const char*)packet.data.data(), int(packet.data.size()));
+            script.push_back(scripted);
+        }
+    }
+};
+
+static std::vector<std::vector<ScriptedPacket> > scriptFromDemo(const QString &fileName, int numNodes, std::size_t maxPacketsPerNode)
+{
+    std::ifstream fs(fileName.toStdString(), std::ios::in | std::ios::binary);
+    if (!fs.good())
+    {
+        throw std::runtime_error("unable to open demo file");
+    }
+    std::vector<std::vector<ScriptedPacket> > scripts(numNodes);
+    DemoScriptParser parser(scripts, maxPacketsPerNode);
+    parser.parse(&fs, 0u);
+    return scripts;
+}
+
+// the captured test packets, cycled at a steady rate
+static std::vector<std::vector<ScriptedPacket> > scriptFromTestPackets(int numNodes, std::size_t packetsPerNode, double packetsPerSecond, int tcpPercent)
+{
+    using namespace tapacket::TestPackets;
+    const tapacket::bytestring* testPackets[] = { &td1, &td2, &td3, &td4, &td5, &td6, &td7, &td8, &td9, &td10 };
+    const std::size_t numTestPackets = sizeof(testPackets) / sizeof(testPackets[0]);
+
+    std::vector<std::vector<ScriptedPacket> > scripts(numNodes);
+    for (int node = 0; node < numNodes; ++node)
+    {
+        for (std::size_t n = 0u; n < packetsPerNode; ++n)
+        {
+            const tapacket::bytestring &tp = *testPackets[(n + node) % numTestPackets];
+            ScriptedPacket scripted;
+            scripted.dueMs = qint64(1000.0 * n / packetsPerSecond);
+            scripted.channel = int(n % 100u) < tcpPercent ? tafnet::GameReceiver::CHANNEL_TCP : tafnet::GameReceiver::CHANNEL_UDP;
+            scripted.data = QByteArray(sizeof(SimStamp), '\0');
+            scripted.data.append((const char*)tp.data(), int(tp.size()));
+            scripts[node].push_back(scripted);
+        }
+    }
+    return scripts;
+}
+
+// feeds the tafnet datagrams that one node received, as captured by gpgnet4ta --capture, back into a fresh TafnetNode
+// from sockets standing in for its peers.  speed 2 replays twice as fast as captured, 0 as fast as MAX_REPLAYED_PER_TICK allows.
+// the node's buffered message seqs start afresh so the capture should start with the session
+static void replayCapture(const QString &fileName, double speed, quint16 bindPort, std::ostream &os)
+{
+    const QHostAddress localHost(QHostAddress::SpecialAddress::LocalHost);
+
+    std::vector<tafnet::PacketCaptureReader::Record> records;
+    tafnet::PacketCaptureReader reader(fileName.toStdString());
+    tafnet::PacketCaptureReader::Record record;
+    while (reader.next(record))
+    {
+        if (record.source == tafnet::PacketCapture::SOURCE_TAFNET && record.direction == tafnet::PacketCapture::DIRECTION_RECEIVED && record.peerId != 0u)
+        {
+            records.push_back(record);
+        }
+    }
+    if (records.empty())
+    {
+        throw std::runtime_error("no tafnet datagrams from known peers in capture");
+    }
+
+    qint64 numDelivered = 0;
+    qint64 numReplies = 0;
+    tafnet::TafnetNode tafnetNode(records.front().playerId, false, localHost, bindPort, false, 1500u);
+    tafnet::TafnetGameNode gameNode(
+        &tafnetNode,
+        NULL,
+        [&numDelivered]() { return new SimGameSender([&numDelivered](const char*, int) { ++numDelivered; }); },
+        [](QSharedPointer<QUdpSocket> udpSocket) { return new SimGameReceiver(udpSocket); });
+
+    std::map<std::uint32_t, std::unique_ptr<QUdpSocket> > peerSockets;     // keyed by peer tafnet id
+    for (const tafnet::PacketCaptureReader::Record &r : records)
+    {
+        std::unique_ptr<QUdpSocket> &socket = peerSockets[r.peerId];
+        if (!socket)
+        {
+            socket.reset(new QUdpSocket);
+            socket->bind(localHost, 0u);
+            QUdpSocket *s = socket.get();
+            QObject::connect(s, &QUdpSocket::readyRead, [s, &numReplies]() {
+                while (s->hasPendingDatagrams())
+                {
+                    QByteArray datagram(int(std::max(qint64(0), s->pendingDatagramSize())), '\0');
+                    s->readDatagram(datagram.data(), datagram.size());
+                    ++numReplies;
+                }
+            });
+            tafnetNode.connectToPeer(localHost, socket->localPort(), r.peerId);
+            gameNode.registerRemotePlayer(r.peerId, 0u);
+        }
+    }
+
+    QEventLoop loop;
+    QTimer tickTimer;
+    QElapsedTimer clock;
+    std::size_t next = 0u;
+    qint64 lastSendMs = 0;
+    tickTimer.setTimerType(Qt::PreciseTimer);
+    tickTimer.setInterval(TICK_INTERVAL);
+    QObject::connect(&tickTimer, &QTimer::timeout, [&]() {
+        const double replayUs = speed > 0.0 ? 1e-3 * clock.nsecsElapsed() * speed : 1e18;
+        for (int n = 0; n < MAX_REPLAYED_PER_TICK && next < records.size() && records[next].timestampUs - records.front().timestampUs <= replayUs; ++n, ++next)
+        {
+            const tafnet::PacketCaptureReader::Record &r = records[next];
+            peerSockets[r.peerId]->writeDatagram(r.data.data(), qint64(r.data.size()), localHost, bindPort);
+            lastSendMs = clock.elapsed();
+        }
+        // a little longer for the node to process the last of them
+        if (next == records.size() && clock.elapsed() - lastSendMs > 500)
+        {
+            loop.quit();
+        }
+    });
+
+    clock.start();
+    const std::clock_t startCpu = std::clock();
+    tickTimer.start();
+    loop.exec();
+    const double cpuSecs = double(std::clock() - startCpu) / CLOCKS_PER_SEC;
+
+    const double capturedSecs = 1e-6 * (records.back().timestampUs - records.front().timestampUs);
+    os << "[TafnetSim::replay] " << records.size() << " datagrams from " << peerSockets.size() << " peers, captured over "
+        << capturedSecs << " s, replayed in " << 1e-3 * lastSendMs << " s" << std::endl;
+    os << "[TafnetSim::replay] " << numDelivered << " packets delivered to game, " << numReplies << " datagrams sent back to peers" << std::endl;
+    // includes the cost of the sockets standing in for peers
+    os << "[TafnetSim::replay] cpu " << cpuSecs << " s, " << 1e6 * cpuSecs / records.size() << " us per datagram" << std::endl;
+}
+
+int doMain(int argc, char* argv[])
+{
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName("TafnetSim");
+    QCoreApplication::setApplicationVersion(VERSION_STRING);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Runs several TafnetNodes on 127.0.0.1 joined by a lossy link, replays game traffic between them and reports how well it was forwarded");
+    parser.addHelpOption();
+    parser.addVersionOption();
+    parser.addOption(QCommandLineOption("nodes", "number of TafnetNodes.", "nodes", "4"));
+    parser.addOption(QCommandLineOption("demo", "replay packets from this .tad instead of cycling the built in test packets.", "demo", ""));
+    parser.addOption(QCommandLineOption("packets", "packets each node's game sends to each peer.", "packets", "3000"));
+    parser.addOption(QCommandLineOption("rate", "packets per second each node's game sends, without --demo.", "rate", "30"));
+    parser.addOption(QCommandLineOption("tcppercent", "percentage of packets sent on the game's tcp channel (reliable), without --demo.", "tcppercent", "0"));
+    parser.addOption(QCommandLineOption("loss", "percentage of datagrams the link drops.", "loss", "0"));
+    parser.addOption(QCommandLineOption("latency", "one way link latency in milliseconds.", "latency", "0"));
+    parser.addOption(QCommandLineOption("jitter", "extra random one way latency in milliseconds, which reorders datagrams.", "jitter", "0"));
+    parser.addOption(QCommandLineOption("proactiveresend", "enable TafnetNode's proactive resend."));
+    parser.addOption(QCommandLineOption("maxpacketsize", "upper limit on TafnetNode's udp packet size.", "maxpacketsize", "1500"));
+    parser.addOption(QCommandLineOption("baseport", "node n binds to 127.0.0.1:baseport+n.", "baseport", "6200"));
+    parser.addOption(QCommandLineOption("warmup", "milliseconds for nodes to connect before games start sending.", "warmup", "2000"));
+    parser.addOption(QCommandLineOption("drain", "milliseconds to wait after the last packet is sent for resends to arrive.", "drain", "3000"));
+    parser.addOption(QCommandLineOption("rebind", "milliseconds after the games start sending to change the port each link relays to one of its nodes from, as a NAT rebinding would.  0 for never.", "rebind", "0"));
+    parser.addOption(QCommandLineOption("replay", "instead of simulating, replay the tafnet datagrams received in a gpgnet4ta --capture into a single TafnetNode.", "replay", ""));
+    parser.addOption(QCommandLineOption("speed", "with --replay, multiple of the captured rate.  0 for as fast as possible.", "speed", "1"));
+    parser.addOption(QCommandLineOption("seed", "seed for the link's random loss and jitter.", "seed", "1"));
+    parser.addOption(QCommandLineOption("logfile", "path to file in which to write logs.", "logfile", ""));
+    parser.addOption(QCommandLineOption("loglevel", "level of noise in log files. 0 (silent) to 5 (debug).", "loglevel", "0"));
+    parser.process(app);
+
+    taflib::Logger::Initialise(parser.value("logfile").toStdString(), taflib::Logger::Verbosity(parser.value("loglevel").toInt()));
+    qInstallMessageHandler(taflib::Logger::Log);
+
+    if (parser.isSet("replay"))
+    {
+        replayCapture(parser.value("replay"), std::max(0.0, parser.value("speed").toDouble()), quint16(parser.value("baseport").toUInt()), std::cout);
+        return 0;
+    }
+
+    Simulation::Options options;
+    options.numNodes = std::max(2, parser.value("nodes").toInt());
+    options.basePort = quint16(parser.value("baseport").toUInt());
+    options.link.lossProbability = std::min(1.0, std::max(0.0, 0.01 * parser.value("loss").toDouble()));
+    options.link.latencyMs = std::max(0, parser.value("latency").toInt());
+    options.link.jitterMs = std::max(0, parser.value("jitter").toInt());
+    options.proactiveResend = parser.isSet("proactiveresend");
+    options.maxPacketSize = parser.value("maxpacketsize").toUInt();
+    options.warmupMs = std::max(0, parser.value("warmup").toInt());
+    options.drainMs = std::max(0, parser.value("drain").toInt());
+    options.rebindMs = std::max(0, parser.value("rebind").toInt());
+    options.randomSeed = parser.value("seed").toUInt();
+
+    const std::size_t packetsPerNode = parser.value("packets").toUInt();
+    std::vector<std::vector<ScriptedPacket> > scripts;
+    if (parser.isSet("demo"))
+    {
+        scripts = scriptFromDemo(parser.value("demo"), options.numNodes, packetsPerNode);
+    }
+    else
+    {
+        const double rate = std::max(1.0, parser.value("rate").toDouble());
+        scripts = scriptFromTestPackets(options.numNodes, packetsPerNode, rate, parser.value("tcppercent").toInt());
+    }
+
+    Simulation simulation(options, scripts);
+    simulation.run();
+    simulation.report(std::cout);
+    return 0;
+}
+
+int main(int argc, char* argv[])
+{
+    try
+    {
+        return doMain(argc, argv);
+    }
+    catch (std::exception & e)
+    {
+        std::cerr << "[main catch std::exception] " << e.what() << std::endl;
+        qWarning() << "[main catch std::exception]" << e.what();
+        return 1;
+    }
+    catch (...)
+    {
+        std::cerr << "[main catch ...] " << std::endl;
+        qWarning() << "[main catch ...]";
+        return 1;
+    }
+}
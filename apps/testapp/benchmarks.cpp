@@ -0,0 +1,648 @@
+#include "benchmarks.h"
+
+#include "gpgnet/GpgNetEncoder.h"
+#include "gpgnet/GpgNetSend.h"
+#include "taflib/Logger.h"
+#include "tafnet/GameAddressTranslater.h"
+#include "tafnet/GameReceiver.h"
+#include "tafnet/GameSender.h"
+#include "tafnet/TafnetGameNode.h"
+#include "tafnet/TafnetNode.h"
+#include "tapacket/DPlayPacket.h"
+#include "tapacket/TestPackets.h"
+
+#include <QtCore/qbuffer.h>
+#include <QtCore/qcoreapplication.h>
+#include <QtCore/qdatastream.h>
+#include <QtCore/qdir.h>
+#include <QtCore/qelapsedtimer.h>
+#include <QtCore/qeventloop.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace tafnet;
+
+namespace
+{
+    const int BATCH_SIZE = 64;              // datagrams in flight at once, few enough for the receiving socket's buffer
+    const qint64 BATCH_TIMEOUT = 1000;      // milliseconds, for the receiver to catch up with a batch
+
+    // sends numDatagrams to port on localhost, datagram n being makeDatagram(n) sent from senders[n % senders.size()].
+    // after each batch the event loop runs until caughtUp(number sent so far) says the receiver has handled them all
+    // @return false if it didn't within BATCH_TIMEOUT, eg because datagrams were dropped
+    bool sendInBatches(const std::vector<QUdpSocket*>& senders, quint16 port, int numDatagrams,
+        const std::function<QByteArray(int)>& makeDatagram, const std::function<bool(int)>& caughtUp)
+    {
+        const QHostAddress localhost(QHostAddress::SpecialAddress::LocalHost);
+        for (int n = 0; n < numDatagrams;)
+        {
+            for (const int end = std::min(numDatagrams, n + BATCH_SIZE); n < end; ++n)
+            {
+                senders[n % senders.size()]->writeDatagram(makeDatagram(n), localhost, port);
+            }
+
+            QElapsedTimer timer;
+            timer.start();
+            while (!caughtUp(n))
+            {
+                if (timer.elapsed() > BATCH_TIMEOUT)
+                {
+                    return false;
+                }
+                QCoreApplication::processEvents();
+            }
+        }
+        return true;
+    }
+
+    // swallows forwarded game data so that the TafnetGameNode benchmark measures only the game side
+    class NullTafnetNode : public TafnetNode
+    {
+    public:
+        unsigned forwarded;
+        unsigned forwardedProtected;
+
+        NullTafnetNode() :
+            TafnetNode(1u, true, QHostAddress(QHostAddress::SpecialAddress::LocalHost), 0u, false, 1500u),
+            forwarded(0u),
+            forwardedProtected(0u)
+        { }
+
+        virtual std::uint32_t maxPacketSizeForPlayerId(std::uint32_t) const
+        {
+            return 1500u;
+        }
+
+        virtual void forwardGameData(std::uint32_t, std::uint32_t action, const PacketBufferPtr&)
+        {
+            ++forwarded;
+            forwardedProtected += action == Payload::ACTION_UDP_PROTECTED ? 1u : 0u;
+        }
+    };
+
+    // DirectPlay messages of the kinds GameAddressTranslater rewrites
+    const unsigned HEADER_SIZE = sizeof(tapacket::DPHeader);
+    const unsigned HEADER_ACTIONSTRING = offsetof(tapacket::DPHeader, actionstring);
+    const unsigned SUPERENUM_HEADER_SIZE = HEADER_SIZE + 7u * 4u;
+    const unsigned SUPERPACKED_FIXED_SIZE = 16u;
+    const unsigned ADDRESS_SIZE = sizeof(tapacket::DPAddress);
+
+    struct TestPlayer
+    {
+        std::uint32_t id;
+        std::uint32_t address;  // of its SPAs
+        std::uint16_t ports[2];
+    };
+
+    template <typename T>
+    std::string bytesOf(const T& t)
+    {
+        return std::string((const char*)&t, sizeof(t));
+    }
+
+    std::uint32_t read32(const char* p)
+    {
+        std::uint32_t x;
+        std::memcpy(&x, p, sizeof(x));
+        return x;
+    }
+
+    std::string cwstr(const char* s)
+    {
+        std::string result;
+        do
+        {
+            result += bytesOf(std::uint16_t(*s));
+        } while (*s++);
+        return result;
+    }
+
+    std::string spas(const TestPlayer& player)
+    {
+        return bytesOf(tapacket::DPAddress(player.address, player.ports[0])) + bytesOf(tapacket::DPAddress(player.address, player.ports[1]));
+    }
+
+    std::string message(tapacket::DPlayCommandCode command, std::uint32_t replyAddress, std::uint16_t replyPort, const std::string& payload)
+    {
+        const tapacket::DPHeader header(replyAddress, replyPort, "play", command, 0x0e, payload.size());
+        return bytesOf(header) + payload;
+    }
+
+    std::string forwardOrCreateRequest(tapacket::DPlayCommandCode command, std::uint32_t replyAddress, std::uint16_t replyPort, const TestPlayer& player)
+    {
+        const std::string shortName = cwstr("Axle");
+        const std::string longName = cwstr("Axle1097");
+        const std::uint32_t ids[5] = { 0u, player.id, 0u, 0x14u, 0u };
+        tapacket::DPPackedPlayer packed;
+        std::memset(&packed, 0, sizeof(packed));
+        packed.size = std::uint32_t(sizeof(packed) + shortName.size() + longName.size() + 2u * ADDRESS_SIZE);
+        packed.flags = 0x0000000c;
+        packed.id = player.id;
+        packed.short_name_length = std::uint32_t(shortName.size());
+        packed.long_name_length = std::uint32_t(longName.size());
+        packed.service_provider_data_size = 2u * ADDRESS_SIZE;
+        packed.fixed_size = sizeof(packed);
+        packed.dplay_version = 0x0e;
+        return message(command, replyAddress, replyPort, bytesOf(ids) + bytesOf(packed) + shortName + longName + spas(player));
+    }
+
+    std::string superEnumPlayersReply(std::uint32_t replyAddress, std::uint16_t replyPort, const std::vector<TestPlayer>& players)
+    {
+        std::string packed;
+        for (const TestPlayer& player : players)
+        {
+            const std::uint32_t fixed[5] = { SUPERPACKED_FIXED_SIZE, 0x0000000c, player.id, 0x00000017, 0x0e };   // short and long names, 1 byte lengths
+            const std::uint32_t playerData = 0x12345678;
+            packed += bytesOf(fixed) + cwstr("Axle") + cwstr("Axle1097");
+            packed += char(sizeof(playerData)) + bytesOf(playerData);
+            packed += char(2u * ADDRESS_SIZE) + spas(player);
+        }
+        const std::uint32_t replyHeader[7] = { std::uint32_t(players.size()), 0u, SUPERENUM_HEADER_SIZE - HEADER_ACTIONSTRING, 0u, 0u, 0u, 0u };
+        return message(tapacket::DPlayCommandCode::SUPERENUMPLAYERSREPLY, replyAddress, replyPort, bytesOf(replyHeader) + packed);
+    }
+
+    // as local game on node 1001 would send to node 1002, when 1002 is reachable at localhost:2310/2360 via 1001's GameReceiver.
+    // with addresses as they'd be after translation by 1001 (gameToTafnet), then by 1002 (tafnetToGame) whose GameReceiver for 1001 is at localhost:2320/2370
+    std::string testMessages(bool gameToTafnet, bool tafnetToGame)
+    {
+        const std::uint32_t GAME_ADDRESS = 0xc0a8010a;
+        const std::uint32_t LOCALHOST = 0x7f000001;
+        const std::uint16_t REPLY_PORTS[] = { 0xdead, 0xbeef };
+
+        std::uint32_t replyAddress = GAME_ADDRESS;
+        std::uint16_t replyPort = 2300;
+        TestPlayer player1001 = { 1001u, GAME_ADDRESS, { 2300, 2350 } };
+        TestPlayer player1002 = { 1002u, LOCALHOST, { 2310, 2360 } };
+        if (gameToTafnet)
+        {
+            replyAddress = 0u;
+            replyPort = REPLY_PORTS[0];
+            player1001.address = 1001u;
+            player1002.address = 1002u;
+        }
+        if (tafnetToGame)
+        {
+            // 1002 has no GameReceiver for itself, so it gets the reply address too
+            replyAddress = LOCALHOST;
+            replyPort = 2320;
+            for (TestPlayer* player : { &player1001, &player1002 })
+            {
+                player->address = LOCALHOST;
+                player->ports[0] = 2320;
+                player->ports[1] = 2370;
+            }
+        }
+
+        std::vector<TestPlayer> players;
+        players.push_back(player1001);
+        players.push_back(player1002);
+        return
+            message(tapacket::DPlayCommandCode::PING, replyAddress, replyPort, bytesOf(std::uint32_t(1001u)) + bytesOf(std::uint32_t(0u))) +
+            forwardOrCreateRequest(tapacket::DPlayCommandCode::CREATEPLAYER, replyAddress, replyPort, player1001) +
+            forwardOrCreateRequest(tapacket::DPlayCommandCode::ADDFORWARDREQUEST, replyAddress, replyPort, player1001) +
+            superEnumPlayersReply(replyAddress, replyPort, players);
+    }
+
+    void makeTranslaters(std::unique_ptr<GameAddressTranslater>& fromGame, std::unique_ptr<GameAddressTranslater>& toGame)
+    {
+        const std::uint16_t dummyPorts[] = { 0xdead, 0xbeef };
+        const std::uint16_t receiverPorts1002[] = { 2310, 2360 };
+        const std::uint16_t receiverPorts1001[] = { 2320, 2370 };
+        fromGame.reset(new GameAddressTranslater(0u, dummyPorts, 1001u));
+        fromGame->setPlayer(1002u, 0x7f000001, receiverPorts1002);
+        toGame.reset(new GameAddressTranslater(0x7f000001, receiverPorts1001));
+        toGame->setPlayer(1001u, 0x7f000001, receiverPorts1001);
+    }
+}
+
+bool Benchmarks::run(int argc, char* argv[])
+{
+    struct Benchmark
+    {
+        const char* name;
+        bool needsApplication;  // for an event loop, or sockets
+        void (*run)(int argc, char* argv[]);
+    };
+
+    static const Benchmark BENCHMARKS[] = {
+        { "gpgnetbench", false, gpgNetEncoder },
+        { "tafnetbench", true, tafnetGameNode },
+        { "tafnetnodebench", true, tafnetNode },
+        { "translaterbench", false, gameAddressTranslater },
+        { "translaterfuzz", false, gameAddressTranslaterFuzz },
+        { "loggerbench", false, logger },
+        { "gamesenderbench", true, gameSender }
+    };
+
+    if (argc < 2)
+    {
+        return false;
+    }
+    for (const Benchmark& benchmark : BENCHMARKS)
+    {
+        if (std::strcmp(argv[1], benchmark.name) == 0)
+        {
+            std::unique_ptr<QCoreApplication> app(benchmark.needsApplication ? new QCoreApplication(argc, argv) : NULL);
+            benchmark.run(argc, argv);
+            return true;
+        }
+    }
+    return false;
+}
+
+void Benchmarks::gpgNetEncoder(int, char*[])
+{
+    const int numMessages = 100000;
+    const int payloadSize = 1000;
+    const QByteArray payload(payloadSize, 'x');
+    const char* command = "ReplayServerData";
+
+    QByteArray streamSink;
+    streamSink.reserve((payloadSize + 64) * numMessages);
+    QByteArray encoderSink;
+    encoderSink.reserve((payloadSize + 64) * numMessages);
+
+    QElapsedTimer timer;
+    {
+        QBuffer device(&streamSink);
+        device.open(QIODevice::WriteOnly);
+        QDataStream ds(&device);
+        ds.setByteOrder(QDataStream::LittleEndian);
+        gpgnet::GpgNetSend protocol(ds);
+
+        timer.start();
+        for (int n = 0; n < numMessages; ++n)
+        {
+            protocol.sendCommand(command, 2);
+            protocol.sendArgument(1);
+            protocol.sendArgument(payload);
+        }
+        const qint64 nsecs = std::max(qint64(1), timer.nsecsElapsed());
+        std::cout << "[Benchmarks::gpgNetEncoder] GpgNetSend:    " << numMessages << " messages of " << payloadSize << " bytes, "
+            << qint64(1e9 * numMessages / nsecs) << " msgs/sec" << std::endl;
+    }
+
+    {
+        QBuffer device(&encoderSink);
+        device.open(QIODevice::WriteOnly);
+        gpgnet::GpgNetEncoder encoder;
+
+        timer.start();
+        for (int n = 0; n < numMessages; ++n)
+        {
+            encoder.send(device, command, 1, payload);
+        }
+        const qint64 nsecs = std::max(qint64(1), timer.nsecsElapsed());
+        std::cout << "[Benchmarks::gpgNetEncoder] GpgNetEncoder: " << numMessages << " messages of " << payloadSize << " bytes, "
+            << qint64(1e9 * numMessages / nsecs) << " msgs/sec" << std::endl;
+    }
+
+    if (streamSink != encoderSink)
+    {
+        throw std::runtime_error("[Benchmarks::gpgNetEncoder] GpgNetEncoder output differs from GpgNetSend");
+    }
+}
+
+void Benchmarks::tafnetGameNode(int, char*[])
+{
+    // the packets are sent to the udp port of the GameReceiver that TafnetGameNode makes for a peer, as the game would send them.
+    // so both figures include sending and reading them, and the difference between them is what the TAPacketParser costs
+    const int numPackets = 100000;
+    const QHostAddress localhost(QHostAddress::SpecialAddress::LocalHost);
+    using namespace tapacket::TestPackets;
+    const tapacket::bytestring* testPackets[] = { &td1, &td2, &td3, &td4, &td5, &td6, &td7, &td8, &td9, &td10 };
+
+    // as received from game on its UDP port: source and destination dplay ids followed by the TA packet
+    std::vector<QByteArray> packets;
+    for (const tapacket::bytestring* tp : testPackets)
+    {
+        const std::uint32_t dplayIds[2] = { 0x11111111u, 0x22222222u };
+        QByteArray packet((const char*)dplayIds, sizeof(dplayIds));
+        packet.append((const char*)tp->data(), int(tp->size()));
+        packets.push_back(packet);
+    }
+
+    QUdpSocket gameSocket;
+    gameSocket.bind(localhost, 0u);
+
+    for (int withParser = 0; withParser < 2; ++withParser)
+    {
+        NullTafnetNode tafnetNode;
+        tapacket::TAPacketParser packetParser;
+        GameReceiver* gameReceiver = NULL;
+        TafnetGameNode gameNode(&tafnetNode, withParser ? &packetParser : NULL,
+            [localhost] { return new GameSender(localhost, 0u); },
+            [localhost, &gameReceiver](QSharedPointer<QUdpSocket> udpSocket) { return gameReceiver = new GameReceiver(localhost, 0u, 0u, udpSocket); });
+        gameNode.registerRemotePlayer(2u, 0u);
+
+        QElapsedTimer timer;
+        timer.start();
+        const bool ok = sendInBatches({ &gameSocket }, gameReceiver->getUdpListenPort(), numPackets,
+            [&packets](int n) { return packets[n % packets.size()]; },
+            [&tafnetNode](int numSent) { return tafnetNode.forwarded >= unsigned(numSent); });
+        const qint64 nsecs = std::max(qint64(1), timer.nsecsElapsed());
+        if (!ok)
+        {
+            std::cout << "[Benchmarks::tafnetGameNode] " << (withParser ? "with" : "without") << " TAPacketParser: "
+                << "only " << tafnetNode.forwarded << " UDP packets arrived, no figures" << std::endl;
+            continue;
+        }
+        std::cout << "[Benchmarks::tafnetGameNode] " << (withParser ? "with" : "without") << " TAPacketParser: "
+            << numPackets << " UDP packets, " << tafnetNode.forwardedProtected << " protected, "
+            << qint64(1e9 * numPackets / nsecs) << " packets/sec" << std::endl;
+    }
+}
+
+void Benchmarks::tafnetNode(int, char*[])
+{
+    // peers' datagrams arrive on the node's socket, where it reads and handles them as in a game.
+    // the same datagrams sent to a socket that only reads them give the cost of sending and reading, which the node's figure includes.
+    // the node doesn't pass TCP_ACKs to its handler, so the last of each batch is a UDP_DATA instead, to tell when it has caught up
+    const int numDatagrams = 1000000;
+    const int NUM_PEERS = 8;
+    const int PAYLOAD_SIZE = 64;
+    const quint16 NODE_PORT = 47100;
+    const QHostAddress localhost(QHostAddress::SpecialAddress::LocalHost);
+
+    std::vector<std::unique_ptr<QUdpSocket> > peerSockets;
+    std::vector<QUdpSocket*> peers;
+    for (int n = 0; n < NUM_PEERS; ++n)
+    {
+        peerSockets.emplace_back(new QUdpSocket());
+        peerSockets.back()->bind(localhost, 0u);
+        peers.push_back(peerSockets.back().get());
+    }
+
+    TafnetNode node(1u, true, localhost, NODE_PORT, false, 1500u);
+    unsigned handled = 0u;
+    node.setHandler([&handled](std::uint8_t, std::uint32_t, char*, int) { ++handled; });
+    for (int n = 0; n < NUM_PEERS; ++n)
+    {
+        node.connectToPeer(localhost, peers[n]->localPort(), std::uint32_t(2 + n));
+    }
+
+    // reads datagrams as the node does, counting the UDP_DATA that the node would pass to its handler
+    QUdpSocket sink;
+    sink.bind(localhost, 0u);
+    unsigned sunk = 0u;
+    QObject::connect(&sink, &QUdpSocket::readyRead, [&sink, &sunk]() {
+        while (sink.hasPendingDatagrams())
+        {
+            PacketBufferPtr datagram = PacketBufferPool::instance().acquire(int(std::max(qint64(0), sink.pendingDatagramSize())));
+            QHostAddress senderAddress;
+            quint16 senderPort;
+            datagram->resize(int(std::max(qint64(0), sink.readDatagram(datagram->data(), datagram->size(), &senderAddress, &senderPort))));
+            sunk += datagram->size() > 0 && std::uint8_t(datagram->data()[0]) == Payload::ACTION_UDP_DATA ? 1u : 0u;
+        }
+    });
+
+    const std::uint8_t actions[] = { Payload::ACTION_UDP_DATA, Payload::ACTION_TCP_ACK };
+    for (std::uint8_t action : actions)
+    {
+        const bool allUdpData = action == Payload::ACTION_UDP_DATA;
+        auto makeDatagram = [=](int n) -> QByteArray {
+            if (allUdpData || n % BATCH_SIZE == BATCH_SIZE - 1 || n == numDatagrams - 1)
+            {
+                // distinct contents, so none are dropped as duplicates
+                QByteArray datagram(int(sizeof(TafnetMessageHeader)) + PAYLOAD_SIZE, '\0');
+                ((TafnetMessageHeader*)datagram.data())->action = Payload::ACTION_UDP_DATA;
+                std::memcpy(datagram.data() + sizeof(TafnetMessageHeader), &n, sizeof(n));
+                datagram[int(sizeof(TafnetMessageHeader) + sizeof(n))] = char(action);
+                return datagram;
+            }
+            QByteArray datagram(int(sizeof(TafnetBufferedHeader)), '\0');
+            TafnetBufferedHeader* header = (TafnetBufferedHeader*)datagram.data();
+            header->action = action;
+            header->seq = std::uint32_t(n);
+            return datagram;
+        };
+
+        // @return ns per datagram, or -1 if some were dropped
+        auto measure = [&](quint16 port, unsigned& received) -> qint64 {
+            received = 0u;
+            QElapsedTimer timer;
+            timer.start();
+            const bool ok = sendInBatches(peers, port, numDatagrams, makeDatagram, [&](int numSent) {
+                return received >= unsigned(allUdpData ? numSent : (numSent + BATCH_SIZE - 1) / BATCH_SIZE);
+            });
+            return ok ? timer.nsecsElapsed() / numDatagrams : -1;
+        };
+        const qint64 nodeNs = measure(NODE_PORT, handled);
+        const qint64 readNs = measure(sink.localPort(), sunk);
+
+        std::cout << "[Benchmarks::tafnetNode] action " << int(action) << ": " << numDatagrams << " datagrams from " << NUM_PEERS << " peers, ";
+        if (nodeNs < 0 || readNs < 0)
+        {
+            std::cout << "some were dropped, no figures" << std::endl;
+            continue;
+        }
+        std::cout << nodeNs << " ns/datagram through TafnetNode, " << readNs << " ns/datagram only read, "
+            << nodeNs - readNs << " ns/datagram for TafnetNode to handle" << std::endl;
+    }
+}
+
+void Benchmarks::gameAddressTranslater(int, char*[])
+{
+    const int numMessages = 1000000;
+    std::unique_ptr<GameAddressTranslater> fromGame, toGame;
+    makeTranslaters(fromGame, toGame);
+
+    for (int direction = 0; direction < 2; ++direction)
+    {
+        const std::string original = testMessages(direction > 0, false);
+        std::vector<char> buf(original.begin(), original.end());
+        GameAddressTranslater& translater = direction > 0 ? *toGame : *fromGame;
+
+        QElapsedTimer timer;
+        timer.start();
+        for (int n = 0; n < numMessages; ++n)
+        {
+            std::memcpy(buf.data(), original.data(), buf.size());
+            translater(buf.data(), int(buf.size()));
+        }
+        const qint64 nsecs = std::max(qint64(1), timer.nsecsElapsed());
+        std::cout << "[Benchmarks::gameAddressTranslater] " << (direction > 0 ? "to game" : "from game") << ": "
+            << numMessages << " buffers of 4 messages and 6 SPAs, " << nsecs / std::max(1, numMessages) << " ns/buffer" << std::endl;
+    }
+}
+
+void Benchmarks::gameAddressTranslaterFuzz(int argc, char* argv[])
+{
+    // eg "translaterfuzz 10000000 42" for more iterations from another seed
+    const int numIterations = argc > 2 ? std::atoi(argv[2]) : 1000000;
+    const unsigned seed = argc > 3 ? unsigned(std::atoi(argv[3])) : 1u;
+
+    std::unique_ptr<GameAddressTranslater> fromGame, toGame;
+    makeTranslaters(fromGame, toGame);
+
+    std::string messages = testMessages(false, false);
+    const bool fromGameOk = (*fromGame)(&messages[0], int(messages.size())) && messages == testMessages(true, false) && fromGame->unmatched().size() == 6u;
+    const bool toGameOk = (*toGame)(&messages[0], int(messages.size())) && messages == testMessages(true, true);
+    std::cout << "[Benchmarks::gameAddressTranslaterFuzz] round trip from game " << (fromGameOk ? "ok" : "FAILED")
+        << ", to game " << (toGameOk ? "ok" : "FAILED") << std::endl;
+
+    std::vector<std::string> seeds;
+    for (int n = 0; n < 3; ++n)
+    {
+        // split back into individual messages, as from game, as from tafnet and as to game
+        const std::string all = testMessages(n > 0, n > 1);
+        for (std::size_t pos = 0u; pos + 4u <= all.size();)
+        {
+            const std::size_t size = read32(&all[pos]) & 0x000fffff;
+            seeds.push_back(all.substr(pos, size));
+            pos += size;
+        }
+    }
+    static const std::uint32_t INTERESTING[] = { 0u, 1u, 2u, 0x10u, 0x20u, 0x7fu, 0xffu, 0xffffu, 0x7fffffffu, 0x80000000u, 0xffffffffu, 0xfab00000u, 0xfab00001u, 0xfab0001cu, 0xfabfffffu };
+
+    std::mt19937 rng(seed);
+    int numMalformed = 0;
+    std::size_t numUnmatched = 0u;
+    qint64 totalBytes = 0;
+    QElapsedTimer timer;
+    timer.start();
+    for (int iteration = 0; iteration < numIterations; ++iteration)
+    {
+        std::string s;
+        for (unsigned n = 1u + rng() % 3u; n > 0u; --n)
+        {
+            s += seeds[rng() % seeds.size()];
+        }
+
+        for (unsigned n = rng() % 8u; n > 0u; --n)
+        {
+            const std::size_t pos = s.empty() ? 0u : rng() % s.size();
+            switch (rng() % 5u)
+            {
+            case 0:
+                if (!s.empty()) s[pos] ^= char(1u << (rng() % 8u));
+                break;
+            case 1:
+                if (!s.empty()) s[pos] = char(rng());
+                break;
+            case 2:
+                if (pos + 4u <= s.size())
+                {
+                    const std::uint32_t x = INTERESTING[rng() % (sizeof(INTERESTING) / sizeof(INTERESTING[0]))];
+                    std::memcpy(&s[pos], &x, sizeof(x));
+                }
+                break;
+            case 3:
+                s.resize(pos);
+                break;
+            case 4:
+                for (unsigned m = rng() % 64u; m > 0u; --m)
+                {
+                    s += char(rng());
+                }
+                break;
+            };
+        }
+
+        // sized exactly, so that an address sanitizer sees anything past the end
+        std::vector<char> buf(s.begin(), s.end());
+        GameAddressTranslater& translater = (iteration & 1) ? *toGame : *fromGame;
+        if (!translater(buf.data(), int(buf.size())))
+        {
+            ++numMalformed;
+        }
+        numUnmatched += translater.unmatched().size();
+        totalBytes += qint64(buf.size());
+    }
+    const qint64 nsecs = std::max(qint64(1), timer.nsecsElapsed());
+    std::cout << "[Benchmarks::gameAddressTranslaterFuzz] " << numIterations << " buffers, " << totalBytes << " bytes, " << numMalformed << " malformed, "
+        << numUnmatched << " unmatched SPAs, " << nsecs / std::max(1, numIterations) << " ns/buffer" << std::endl;
+}
+
+void Benchmarks::logger(int, char*[])
+{
+    const int numMessages = 100000;
+    const int maxPerCallSite = 20;  // as for gpgnet4ta --logratelimit 20
+    const std::string fileName = QDir::temp().filePath("loggerbench.log").toStdString();
+    const QMessageLogContext context("benchmarks.cpp", 1, "logger", "default");
+
+    for (int async = 0; async < 2; ++async)
+    {
+        for (int limited = 0; limited < 2; ++limited)
+        {
+            taflib::Logger logger(fileName, taflib::Logger::Verbosity::INFO, async != 0);
+            logger.setMaxPerCallSite(limited ? maxPerCallSite : 0);
+
+            QElapsedTimer timer;
+            timer.start();
+            for (int n = 0; n < numMessages; ++n)
+            {
+                logger.LogToFile(QtInfoMsg, context, QString("[Benchmarks::logger] peer 1234 ERROR unexpected message seq=%1").arg(n));
+            }
+            const qint64 nsecs = std::max(qint64(1), timer.nsecsElapsed());
+
+            std::cout << "[Benchmarks::logger] " << (async ? "async" : "sync") << (limited ? ", rate limited" : "") << ": "
+                << numMessages << " messages, " << nsecs / numMessages << " ns/message on logging thread, "
+                << logger.numDropped() << " dropped" << std::endl;
+        }
+    }
+    std::remove(fileName.c_str());
+}
+
+void Benchmarks::gameSender(int argc, char* argv[])
+{
+    // a fresh GameSender every 50ms, as TafnetGameNode makes when a peer leaves and rejoins, each connecting to address:port
+    // while a 1ms timer stands in for forwarding to other peers.
+    // eg "gamesenderbench 192.0.2.1 2300" for a game address that silently drops SYNs, which is where a blocking connect would stall
+    const QHostAddress gameAddress(argc > 2 ? argv[2] : "127.0.0.1");
+    const quint16 tcpPort = argc > 3 ? quint16(std::atoi(argv[3])) : 2300;
+    const int numReconnects = 100;
+
+    QEventLoop loop;
+    QElapsedTimer clock;
+    clock.start();
+
+    // stands in for the forwarding of other peers' traffic, which shares our event loop
+    QTimer forwardTimer;
+    forwardTimer.setTimerType(Qt::PreciseTimer);
+    qint64 lastForwardNs = clock.nsecsElapsed();
+    qint64 maxGapNs = 0;
+    qint64 numForwards = 0;
+    QObject::connect(&forwardTimer, &QTimer::timeout, [&]() {
+        const qint64 now = clock.nsecsElapsed();
+        maxGapNs = std::max(maxGapNs, now - lastForwardNs);
+        lastForwardNs = now;
+        ++numForwards;
+    });
+
+    std::unique_ptr<GameSender> sender;
+    QTimer reconnectTimer;
+    int reconnects = 0;
+    QObject::connect(&reconnectTimer, &QTimer::timeout, [&]() {
+        if (reconnects++ == numReconnects)
+        {
+            loop.quit();
+            return;
+        }
+        char data[64] = { 0 };
+        sender.reset(new GameSender(gameAddress, 0));
+        sender->setTcpPort(tcpPort);
+        sender->sendTcpData(data, sizeof(data));
+    });
+
+    forwardTimer.start(1);
+    reconnectTimer.start(50);
+    const qint64 startNs = clock.nsecsElapsed();
+    loop.exec();
+    const qint64 elapsedNs = clock.nsecsElapsed() - startNs;
+
+    std::cout << "[Benchmarks::gameSender] " << numReconnects << " connects to " << gameAddress.toString().toStdString() << ":" << tcpPort
+        << ", 1ms forwarding timer fired " << numForwards << " times, mean interval " << (elapsedNs / std::max(qint64(1), numForwards)) / 1000
+        << " us, max interval " << maxGapNs / 1000 << " us" << std::endl;
+}
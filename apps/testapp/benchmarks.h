@@ -0,0 +1,28 @@
+#pragma once
+
+// The benchmarks and fuzzers testapp runs, eg "testapp gpgnetbench", with results written to std::cout.
+// They drive the classes they measure through their public interfaces only, as the applications do
+class Benchmarks
+{
+public:
+    // runs the benchmark named by argv[1].  later arguments, if any, are its options
+    // @return false if there is no such benchmark
+    static bool run(int argc, char* argv[]);
+
+private:
+    // messages per second of GpgNetSend versus GpgNetEncoder
+    static void gpgNetEncoder(int argc, char* argv[]);
+    // UDP packets per second from the game through a GameReceiver and TafnetGameNode, with and without a TAPacketParser attached
+    static void tafnetGameNode(int argc, char* argv[]);
+    // time per datagram for TafnetNode to read and handle its peers' datagrams, by kind of datagram
+    static void tafnetNode(int argc, char* argv[]);
+    // GameAddressTranslater time per SuperEnumPlayersReply
+    static void gameAddressTranslater(int argc, char* argv[]);
+    // mutated and truncated DirectPlay messages through both kinds of GameAddressTranslater.
+    // Build with -fsanitize=address,undefined for it to catch any read or write outside the message
+    static void gameAddressTranslaterFuzz(int argc, char* argv[]);
+    // time taken by the logging thread per message, synchronous and asynchronous, with and without rate limiting
+    static void logger(int argc, char* argv[]);
+    // how late a 1ms timer standing in for other peers' forwarding fires while GameSenders repeatedly connect to the game
+    static void gameSender(int argc, char* argv[]);
+};
@@ -0,0 +1,80 @@
+#include "replaytest.h"
+
+#include "tareplay/TaReplayClient.h"
+#include "tareplay/TaReplayServer.h"
+
+#include <QtCore/qeventloop.h>
+#include <QtCore/qfile.h>
+#include <QtCore/qtemporarydir.h>
+#include <QtCore/qtimer.h>
+
+#include <iostream>
+
+static const int TEST_TIMEOUT = 20000;      // milliseconds.  TaReplayClient waits 3s before connecting
+static const int POLL_INTERVAL = 100;       // milliseconds
+
+bool testReplayServerCompletedGame(quint16 port)
+{
+    const quint32 gameId = 1234u;
+    const quint32 missingGameId = 1235u;
+
+    // a game that has ended: TaDemoCompiler has renamed its .part and the server was never told about it
+    QTemporaryDir dir;
+    const QString demoPathTemplate = dir.path() + "/%1.tad";
+    QByteArray demo(300000, '\0');
+    for (int n = 0; n < demo.size(); ++n)
+    {
+        demo[n] = char(n * 7 + n / 251);
+    }
+    QFile demoFile(demoPathTemplate.arg(gameId));
+    if (!dir.isValid() || !demoFile.open(QIODevice::WriteOnly) || demoFile.write(demo) != demo.size())
+    {
+        std::cout << "[testReplayServerCompletedGame] FAIL unable to write demo file" << std::endl;
+        return false;
+    }
+    demoFile.close();
+
+    tareplay::TaReplayServer server(demoPathTemplate, QHostAddress(QHostAddress::SpecialAddress::LocalHost), port, 0u, 1024 * 1024);
+    tareplay::TaReplayClient client("127.0.0.1", port, gameId, 0u);
+    tareplay::TaReplayClient missingClient("127.0.0.1", port, missingGameId, 0u);
+
+    bool missingNotFound = false;
+    bool gameNotFound = false;
+    QObject::connect(&missingClient, &tareplay::TaReplayClient::gameNotFound, [&missingNotFound](tareplay::TaReplayServerStatus status) {
+        missingNotFound = status == tareplay::TaReplayServerStatus::GAME_NOT_FOUND;
+    });
+    QObject::connect(&client, &tareplay::TaReplayClient::gameNotFound, [&gameNotFound](tareplay::TaReplayServerStatus) {
+        gameNotFound = true;
+    });
+
+    QByteArray received;
+    QEventLoop loop;
+    QTimer pollTimer;
+    QObject::connect(&pollTimer, &QTimer::timeout, [&]() {
+        std::istream* is = client.getReplayStream();
+        char buf[4096];
+        for (;;)
+        {
+            is->clear();
+            is->read(buf, sizeof(buf));
+            if (is->gcount() <= 0)
+            {
+                break;
+            }
+            received.append(buf, int(is->gcount()));
+        }
+        if ((received.size() >= demo.size() || gameNotFound) && missingNotFound)
+        {
+            loop.quit();
+        }
+    });
+    QTimer::singleShot(TEST_TIMEOUT, &loop, &QEventLoop::quit);
+    pollTimer.start(POLL_INTERVAL);
+    loop.exec();
+
+    const bool passed = !gameNotFound && received == demo && missingNotFound;
+    std::cout << "[testReplayServerCompletedGame] " << (passed ? "PASS" : "FAIL") << ": received " << received.size() << " of " << demo.size()
+        << " bytes" << (received.size() == demo.size() && received != demo ? " (corrupt)" : "") << (gameNotFound ? ", completed game not found" : "")
+        << ", missing game " << (missingNotFound ? "not found" : "not reported") << std::endl;
+    return passed;
+}
@@ -0,0 +1,9 @@
+#pragma once
+
+#include <QtCore/qglobal.h>
+
+// TaReplayServer and TaReplayClient talking over 127.0.0.1:port.
+// subscribes to a game that has finished and checks its completed demo arrives intact, and that a game with no demo is reported not found.
+// results to std::cout
+// @return true if passed
+bool testReplayServerCompletedGame(quint16 port);
@@ -1,7 +1,27 @@
 #include "TPacket.h"
+#include "benchmarks.h"
+#include "replaytest.h"
+
+#include <QtCore/qcoreapplication.h>
+
+#include <cstdlib>
+#include <cstring>
 
 int main(int argc, char* argv[])
 {
+    if (Benchmarks::run(argc, argv))
+    {
+        return 0;
+    }
+
+    if (argc > 1 && std::strcmp(argv[1], "replaytest") == 0)
+    {
+        // eg "replaytest 46100" if the default port is in use
+        QCoreApplication app(argc, argv);
+        const quint16 port = argc > 2 ? quint16(std::atoi(argv[2])) : 46099;
+        return testReplayServerCompletedGame(port) ? 0 : 1;
+    }
+
     tapacket::TPacket::test();
     return 0;
 }
@@ -0,0 +1,48 @@
+#include "GpgNetEncoder.h"
+
+#include <QtCore/qendian.h>
+
+using namespace gpgnet;
+
+static const int INITIAL_BUFFER_CAPACITY = 4096;
+
+GpgNetEncoder::GpgNetEncoder()
+{
+    // reserved capacity survives resize(), so encode() doesn't reallocate for typical message sizes
+    m_buffer.reserve(INITIAL_BUFFER_CAPACITY);
+}
+
+char* GpgNetEncoder::put(char* p, quint32 value)
+{
+    qToLittleEndian<quint32>(value, (uchar*)p);
+    return p + 4;
+}
+
+char* GpgNetEncoder::putArgument(char* p, int arg)
+{
+    *p++ = 0;
+    return put(p, quint32(arg));
+}
+
+char* GpgNetEncoder::putArgument(char* p, quint32 arg)
+{
+    *p++ = 0;
+    return put(p, arg);
+}
+
+char* GpgNetEncoder::putArgument(char* p, const QByteArray& arg)
+{
+    // NB a null QByteArray is sent as empty, same as GpgNetSend
+    *p++ = 1;
+    p = put(p, quint32(arg.size()));
+    std::memcpy(p, arg.constData(), arg.size());
+    return p + arg.size();
+}
+
+char* GpgNetEncoder::putArgument(char* p, const Bytes& arg)
+{
+    *p++ = 1;
+    p = put(p, quint32(arg.size));
+    std::memcpy(p, arg.data, arg.size);
+    return p + arg.size;
+}
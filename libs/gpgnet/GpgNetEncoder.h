@@ -0,0 +1,73 @@
+#pragma once
+
+#include <QtCore/qbytearray.h>
+#include <QtCore/qiodevice.h>
+
+#include <cstring>
+
+namespace gpgnet
+{
+    // Serialises a complete GpgNet command, argument types known at compile time, into one contiguous buffer.
+    // Wire format is identical to GpgNetSend. Buffer is reused so steady state is allocation free and the device sees a single write per command
+    class GpgNetEncoder
+    {
+    public:
+        // view of raw bytes to be sent as a byte array argument without first copying into a QByteArray
+        struct Bytes
+        {
+            const char* data;
+            int size;
+            Bytes(const char* _data, int _size) : data(_data), size(_size) { }
+        };
+
+        GpgNetEncoder();
+
+        template<typename... Args>
+        const QByteArray& encode(const char* command, const Args&... args)
+        {
+            const int commandSize = int(std::strlen(command));
+            m_buffer.resize(4 + commandSize + 4 + encodedSize(args...));
+            char* p = m_buffer.data();
+            p = put(p, quint32(commandSize));
+            std::memcpy(p, command, commandSize);
+            p += commandSize;
+            p = put(p, quint32(sizeof...(args)));
+            putArgs(p, args...);
+            return m_buffer;
+        }
+
+        template<typename... Args>
+        qint64 send(QIODevice& device, const char* command, const Args&... args)
+        {
+            return device.write(encode(command, args...));
+        }
+
+    private:
+        static int encodedSize() { return 0; }
+        template<typename T, typename... Rest>
+        static int encodedSize(const T& arg, const Rest&... rest)
+        {
+            return argumentSize(arg) + encodedSize(rest...);
+        }
+
+        static int argumentSize(int) { return 5; }
+        static int argumentSize(quint32) { return 5; }
+        static int argumentSize(const QByteArray& arg) { return 5 + arg.size(); }
+        static int argumentSize(const Bytes& arg) { return 5 + arg.size; }
+
+        static char* putArgs(char* p) { return p; }
+        template<typename T, typename... Rest>
+        static char* putArgs(char* p, const T& arg, const Rest&... rest)
+        {
+            return putArgs(putArgument(p, arg), rest...);
+        }
+
+        static char* put(char* p, quint32 value);
+        static char* putArgument(char* p, int arg);
+        static char* putArgument(char* p, quint32 arg);
+        static char* putArgument(char* p, const QByteArray& arg);
+        static char* putArgument(char* p, const Bytes& arg);
+
+        QByteArray m_buffer;
+    };
+}
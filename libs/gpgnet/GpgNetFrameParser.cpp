@@ -0,0 +1,196 @@
+#include "GpgNetFrameParser.h"
+
+#include <QtCore/qendian.h>
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+using namespace gpgnet;
+
+static const int INITIAL_BUFFER_CAPACITY = 4096;
+
+quint32 GpgNetFrameParser::Argument::toUInt() const
+{
+    return isInt() ? intValue : 0u;
+}
+
+QByteArray GpgNetFrameParser::Argument::toByteArray() const
+{
+    return isBytes() ? QByteArray(data, size) : QByteArray();
+}
+
+GpgNetFrameParser::Command::Command() :
+    m_name(NULL),
+    m_nameSize(0),
+    m_argCount(0)
+{ }
+
+bool GpgNetFrameParser::Command::is(const char* id) const
+{
+    return int(std::strlen(id)) == m_nameSize && std::memcmp(id, m_name, m_nameSize) == 0;
+}
+
+QByteArray GpgNetFrameParser::Command::name() const
+{
+    return QByteArray(m_name, m_nameSize);
+}
+
+const GpgNetFrameParser::Argument& GpgNetFrameParser::Command::arg(int n) const
+{
+    if (n < 0 || n >= m_argCount)
+    {
+        throw std::runtime_error("[GpgNetFrameParser::Command::arg] argument index out of range");
+    }
+    return m_args[n];
+}
+
+QVariantList GpgNetFrameParser::Command::toVariantList() const
+{
+    QVariantList commandAndArgs;
+    commandAndArgs.reserve(1 + m_argCount);
+    commandAndArgs.append(name());
+    for (int n = 0; n < m_argCount; ++n)
+    {
+        if (m_args[n].isInt())
+        {
+            commandAndArgs.append(m_args[n].intValue);
+        }
+        else
+        {
+            commandAndArgs.append(m_args[n].toByteArray());
+        }
+    }
+    return commandAndArgs;
+}
+
+GpgNetFrameParser::GpgNetFrameParser() :
+    m_consumed(0)
+{
+    // reserved capacity survives resize(0), so steady state is allocation free
+    m_buffer.reserve(INITIAL_BUFFER_CAPACITY);
+}
+
+void GpgNetFrameParser::reset()
+{
+    m_buffer.resize(0);
+    m_consumed = 0;
+}
+
+bool GpgNetFrameParser::next(QIODevice& device, Command& command)
+{
+    if (m_consumed > 0)
+    {
+        // buffer never holds more than one command
+        reset();
+    }
+
+    int bytesNeeded = 0;
+    while (!frame(command, bytesNeeded))
+    {
+        const qint64 bytesAvailable = device.bytesAvailable();
+        if (bytesAvailable <= 0)
+        {
+            return false;
+        }
+
+        const int oldSize = m_buffer.size();
+        const int bytesToRead = int(std::min(qint64(bytesNeeded), bytesAvailable));
+        m_buffer.resize(oldSize + bytesToRead);
+        const qint64 bytesRead = device.read(m_buffer.data() + oldSize, bytesToRead);
+        m_buffer.resize(oldSize + int(std::max(qint64(0), bytesRead)));
+        if (bytesRead <= 0)
+        {
+            return false;
+        }
+    }
+    m_consumed = m_buffer.size();
+    return true;
+}
+
+bool GpgNetFrameParser::frame(Command& command, int& bytesNeeded)
+{
+    const char* data = m_buffer.constData();
+    const int size = m_buffer.size();
+    int pos = 0;
+
+    auto need = [&](int n) {
+        bytesNeeded = pos + n - size;
+        return bytesNeeded <= 0;
+    };
+    auto readUInt = [&]() {
+        quint32 value = qFromLittleEndian<quint32>((const uchar*)data + pos);
+        pos += 4;
+        return value;
+    };
+
+    if (!need(4))
+    {
+        return false;
+    }
+    quint32 nameSize = readUInt();
+    if (nameSize > MAX_RECORD_SIZE)
+    {
+        std::ostringstream ss;
+        ss << "[GpgNetFrameParser::frame] record exceeds MAX_RECORD_SIZE. size=" << nameSize;
+        throw std::runtime_error(ss.str());
+    }
+    if (!need(nameSize + 4))
+    {
+        return false;
+    }
+    command.m_name = data + pos;
+    command.m_nameSize = nameSize;
+    pos += nameSize;
+
+    quint32 numArgs = readUInt();
+    if (numArgs > MAX_NUM_ARGS)
+    {
+        std::ostringstream ss;
+        ss << "[GpgNetFrameParser::frame] number of arguments exceeds MAX_NUM_ARGS. numArgs=" << numArgs;
+        throw std::runtime_error(ss.str());
+    }
+
+    for (quint32 nArg = 0u; nArg < numArgs; ++nArg)
+    {
+        Argument& arg = command.m_args[nArg];
+        if (!need(5))
+        {
+            return false;
+        }
+        arg.type = quint8(data[pos++]);
+        if (arg.type == Argument::TYPE_INT)
+        {
+            arg.intValue = readUInt();
+            arg.data = NULL;
+            arg.size = 0;
+        }
+        else if (arg.type == Argument::TYPE_BYTES)
+        {
+            quint32 argSize = readUInt();
+            if (argSize > MAX_RECORD_SIZE)
+            {
+                std::ostringstream ss;
+                ss << "[GpgNetFrameParser::frame] record exceeds MAX_RECORD_SIZE. size=" << argSize;
+                throw std::runtime_error(ss.str());
+            }
+            if (!need(argSize))
+            {
+                return false;
+            }
+            arg.intValue = 0u;
+            arg.data = data + pos;
+            arg.size = argSize;
+            pos += argSize;
+        }
+        else
+        {
+            throw std::runtime_error("[GpgNetFrameParser::frame] unexpected argument type");
+        }
+    }
+
+    command.m_argCount = numArgs;
+    bytesNeeded = 0;
+    return true;
+}
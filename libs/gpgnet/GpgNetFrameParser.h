@@ -0,0 +1,68 @@
+#pragma once
+
+#include <QtCore/qbytearray.h>
+#include <QtCore/qiodevice.h>
+#include <QtCore/qvariant.h>
+
+namespace gpgnet
+{
+    // Frames GpgNet commands in place within a single receive buffer.
+    // Unlike GpgNetParse::GetCommand there is no per-argument allocation, no QVariant and no exception when a command is incomplete.
+    // Only as many bytes as the current command needs are taken from the device, so callers may read raw data from it between commands.
+    class GpgNetFrameParser
+    {
+    public:
+        static const quint32 MAX_RECORD_SIZE = 10000u;
+        static const quint32 MAX_NUM_ARGS = 10u;
+
+        class Argument
+        {
+        public:
+            static const quint8 TYPE_INT = 0u;
+            static const quint8 TYPE_BYTES = 1u;
+
+            quint8 type;
+            quint32 intValue;
+            const char* data;   // TYPE_BYTES only. view into parser's buffer
+            int size;
+
+            bool isInt() const { return type == TYPE_INT; }
+            bool isBytes() const { return type == TYPE_BYTES; }
+            quint32 toUInt() const;
+            QByteArray toByteArray() const;         // deep copy
+        };
+
+        // views remain valid until the next call to next() or reset()
+        class Command
+        {
+            friend class GpgNetFrameParser;
+            const char* m_name;
+            int m_nameSize;
+            int m_argCount;
+            Argument m_args[MAX_NUM_ARGS];
+
+        public:
+            Command();
+            bool is(const char* id) const;
+            QByteArray name() const;
+            int argCount() const { return m_argCount; }
+            const Argument& arg(int n) const;
+
+            // [name, args...] as returned by GpgNetParse::GetCommand
+            QVariantList toVariantList() const;
+        };
+
+        GpgNetFrameParser();
+
+        // @return false if device doesn't yet have enough bytes for a complete command
+        bool next(QIODevice& device, Command& command);
+        void reset();
+
+    private:
+        // @return true if a complete command is framed at the start of the buffer.  otherwise bytesNeeded says how many more to read
+        bool frame(Command& command, int& bytesNeeded);
+
+        QByteArray m_buffer;
+        int m_consumed;         // bytes at start of m_buffer belonging to the previously returned command
+    };
+}
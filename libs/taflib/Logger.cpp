@@ -2,12 +2,29 @@
 
 #include <QtCore/qdatetime.h>
 #include <QtCore/qthread.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
 #include <iostream>
+#include <sstream>
 
 using namespace taflib;
 
-Logger::Logger(const std::string& filename, Verbosity verbosity) :
-    m_verbosity(verbosity)
+static const int WRITER_INTERVAL = 10;                  // milliseconds, that the writer thread sleeps when there's nothing to write
+static const std::size_t MAX_BATCH_BYTES = 64u * 1024u; // written to file at once
+static const qint64 RATE_LIMIT_WINDOW = 1000;           // milliseconds
+static const int WAIT_FOR_WRITER_INTERVAL = 1;          // milliseconds, that qCritical sleeps while waiting for its message to be written
+
+Logger::Logger(const std::string& filename, Verbosity verbosity, bool async) :
+    m_verbosity(verbosity),
+    m_async(async),
+    m_maxPerCallSite(0),
+    m_callSites(new CallSite[NUM_CALL_SITES]),
+    m_ring(RING_CAPACITY),
+    m_numDropped(0u),
+    m_numDrained(0u),
+    m_writing(false)
 {
     if (filename.empty())
     {
@@ -19,9 +36,27 @@ Logger::Logger(const std::string& filename, Verbosity verbosity) :
         m_ostream = m_optionalLogFile.get();
     }
 
+    for (std::size_t n = 0u; n < NUM_CALL_SITES; ++n)
+    {
+        m_callSites[n].windowStart.store(0, std::memory_order_relaxed);
+        m_callSites[n].count.store(0, std::memory_order_relaxed);
+        m_callSites[n].suppressed.store(0, std::memory_order_relaxed);
+    }
+
     QString datetime = QDateTime::currentDateTimeUtc().toString("yyyy.MM.dd hh:mm:ss");
     ostream() << std::endl;
     ostream() << datetime.toStdString() << " -------------- BEGIN LOG --------------" << std::endl;
+
+    if (m_async)
+    {
+        m_writing = true;
+        m_writerThread = std::thread([this]() { writerLoop(); });
+    }
+}
+
+Logger::~Logger()
+{
+    stopWriter();
 }
 
 std::ostream& Logger::ostream()
@@ -30,9 +65,9 @@ std::ostream& Logger::ostream()
 }
 
 
-void Logger::Initialise(const std::string& filename, Verbosity level)
+void Logger::Initialise(const std::string& filename, Verbosity level, bool async)
 {
-    m_instance.reset(new Logger(filename, level));
+    m_instance.reset(new Logger(filename, level, async));
 }
 
 Logger* Logger::Get()
@@ -45,43 +80,232 @@ void Logger::Log(QtMsgType type, const QMessageLogContext& context, const QStrin
     Logger::Get()->LogToFile(type, context, msg);
 }
 
-void Logger::LogToFile(QtMsgType type, const QMessageLogContext& context, const QString& msg) {
+void Logger::setMaxPerCallSite(int messagesPerSecond)
+{
+    m_maxPerCallSite = messagesPerSecond;
+}
+
+bool Logger::isEnabled(QtMsgType type) const
+{
     switch (type) {
-    case QtDebugMsg:
-        if (m_verbosity >= Verbosity::DEBUG)
+    case QtDebugMsg: return m_verbosity >= Verbosity::DEBUG;
+    case QtInfoMsg: return m_verbosity >= Verbosity::INFO;
+    case QtCriticalMsg: return m_verbosity >= Verbosity::CRITICAL;
+    case QtWarningMsg: return m_verbosity >= Verbosity::WARNING;
+    case QtFatalMsg: return m_verbosity >= Verbosity::FATAL;
+    default: return false;
+    };
+}
+
+bool Logger::rateLimit(const QMessageLogContext& context, const QString& msg, qint64 now, int &suppressed)
+{
+    suppressed = 0;
+    const int maxPerCallSite = m_maxPerCallSite.load(std::memory_order_relaxed);
+    if (maxPerCallSite <= 0)
+    {
+        return true;
+    }
+
+    // FNV-1a.  release builds of Qt don't give file and line, in which case we go by our "[Class::method]" convention
+    std::size_t hash = 2166136261u;
+    if (context.file != NULL && context.line > 0)
+    {
+        for (const char* p = context.file; *p; ++p)
         {
-            QString datetime = QDateTime::currentDateTimeUtc().toString("yyyy.MM.dd hh:mm:ss");
-            ostream() << datetime.toStdString() << " [" << QThread::currentThreadId() << ":Debug] " << msg.toStdString() << std::endl;
+            hash = (hash ^ std::uint8_t(*p)) * 16777619u;
         }
-        break;
-    case QtInfoMsg:
-        if (m_verbosity >= Verbosity::INFO)
+        hash = (hash ^ std::size_t(context.line)) * 16777619u;
+    }
+    else
+    {
+        const int len = std::min(msg.size(), 64);
+        for (int n = 0; n < len && msg[n] != ']'; ++n)
         {
-            QString datetime = QDateTime::currentDateTimeUtc().toString("yyyy.MM.dd hh:mm:ss");
-            ostream() << datetime.toStdString() << " [" << QThread::currentThreadId() << ":Info] " << msg.toStdString() << std::endl;
+            hash = (hash ^ msg[n].unicode()) * 16777619u;
         }
-        break;
-    case QtCriticalMsg:
-        if (m_verbosity >= Verbosity::CRITICAL)
+    }
+    CallSite &site = m_callSites[hash % NUM_CALL_SITES];
+
+    qint64 windowStart = site.windowStart.load(std::memory_order_relaxed);
+    if (now - windowStart >= RATE_LIMIT_WINDOW && site.windowStart.compare_exchange_strong(windowStart, now, std::memory_order_relaxed))
+    {
+        site.count.store(0, std::memory_order_relaxed);
+        suppressed = site.suppressed.exchange(0, std::memory_order_relaxed);
+    }
+    if (site.count.fetch_add(1, std::memory_order_relaxed) >= maxPerCallSite)
+    {
+        site.suppressed.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    return true;
+}
+
+void Logger::LogToFile(QtMsgType type, const QMessageLogContext& context, const QString& msg)
+{
+    if (isEnabled(type))
+    {
+        Record record;
+        record.msecsSinceEpoch = QDateTime::currentMSecsSinceEpoch();
+        record.threadId = QThread::currentThreadId();
+        record.type = type;
+
+        int suppressed = 0;
+        const bool allowed = type == QtFatalMsg || type == QtCriticalMsg || rateLimit(context, msg, record.msecsSinceEpoch, suppressed);
+        if (suppressed > 0)
         {
-            QString datetime = QDateTime::currentDateTimeUtc().toString("yyyy.MM.dd hh:mm:ss");
-            ostream() << datetime.toStdString() << " [" << QThread::currentThreadId() << ":Critical] " << msg.toStdString() << std::endl;
+            record.msg = QString("[Logger] suppressed %1 more messages like: %2").arg(suppressed).arg(msg.left(80));
+            dispatch(record);
         }
-        break;
-    case QtWarningMsg:
-        if (m_verbosity >= Verbosity::WARNING)
+        if (allowed)
         {
-            QString datetime = QDateTime::currentDateTimeUtc().toString("yyyy.MM.dd hh:mm:ss");
-            ostream() << datetime.toStdString() << " [" << QThread::currentThreadId() << ":Warning] " << msg.toStdString() << std::endl;
+            record.msg = msg;
+            dispatch(record);
         }
-        break;
-    case QtFatalMsg:
-        if (m_verbosity >= Verbosity::FATAL)
+    }
+    if (type == QtFatalMsg)
+    {
+        abort();
+    }
+}
+
+void Logger::dispatch(Record& record)
+{
+    if (m_async && record.type == QtCriticalMsg)
+    {
+        // not dropped, and written before we return, in case it heralds a crash
+        while (!m_ring.tryPush(record))
         {
-            QString datetime = QDateTime::currentDateTimeUtc().toString("yyyy.MM.dd hh:mm:ss");
-            ostream() << datetime.toStdString() << " [" << QThread::currentThreadId() << ":Fatal] " << msg.toStdString() << std::endl;
+            std::this_thread::yield();
         }
-        abort();
+        waitForWriter();
+        return;
+    }
+    if (m_async && record.type != QtFatalMsg)
+    {
+        if (!m_ring.tryPush(record))
+        {
+            m_numDropped.fetch_add(1u, std::memory_order_relaxed);
+        }
+        return;
+    }
+
+    // synchronously.  a fatal message first lets the writer finish, so that it comes last in the file before we abort
+    if (record.type == QtFatalMsg)
+    {
+        stopWriter();
+    }
+    std::string line;
+    DateTimeCache cache = { -1, std::string() };
+    appendRecord(line, record, cache);
+    ostream() << line << std::flush;
+}
+
+void Logger::waitForWriter()
+{
+    // the writer's next pass but one starts after whatever we queued, and ends only once the queue is empty
+    const std::uint64_t numDrained = m_numDrained.load(std::memory_order_acquire);
+    while (m_numDrained.load(std::memory_order_acquire) < numDrained + 2u && m_writing.load(std::memory_order_relaxed))
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(WAIT_FOR_WRITER_INTERVAL));
+    }
+}
+
+void Logger::appendRecord(std::string& out, const Record& record, DateTimeCache& cache)
+{
+    const qint64 second = record.msecsSinceEpoch / 1000;
+    if (second != cache.second)
+    {
+        cache.second = second;
+        cache.text = QDateTime::fromMSecsSinceEpoch(record.msecsSinceEpoch, Qt::UTC).toString("yyyy.MM.dd hh:mm:ss").toStdString();
+    }
+
+    const char* typeName = "";
+    switch (record.type) {
+    case QtDebugMsg: typeName = "Debug"; break;
+    case QtInfoMsg: typeName = "Info"; break;
+    case QtCriticalMsg: typeName = "Critical"; break;
+    case QtWarningMsg: typeName = "Warning"; break;
+    case QtFatalMsg: typeName = "Fatal"; break;
+    };
+
+    std::ostringstream threadId;
+    threadId << record.threadId;
+
+    out += cache.text;
+    out += " [";
+    out += threadId.str();
+    out += ':';
+    out += typeName;
+    out += "] ";
+    out += record.msg.toStdString();
+    out += '\n';
+}
+
+void Logger::writerLoop()
+{
+    std::string batch;
+    Record record;
+    DateTimeCache cache = { -1, std::string() };
+    std::uint64_t numDroppedReported = 0u;
+    for (;;)
+    {
+        // checked before the ring so that everything logged before stopWriter() is written
+        const bool writing = m_writing.load(std::memory_order_acquire);
+        bool drained = false;
+        while (batch.size() < MAX_BATCH_BYTES)
+        {
+            if (!m_ring.tryPop(record))
+            {
+                drained = true;
+                break;
+            }
+            appendRecord(batch, record, cache);
+        }
+
+        const std::uint64_t numDropped = m_numDropped.load(std::memory_order_relaxed) - numDroppedReported;
+        if (numDropped > 0u)
+        {
+            numDroppedReported += numDropped;
+            record.msecsSinceEpoch = QDateTime::currentMSecsSinceEpoch();
+            record.threadId = QThread::currentThreadId();
+            record.type = QtWarningMsg;
+            record.msg = QString("[Logger] dropped %1 messages, queue full").arg(qulonglong(numDropped));
+            appendRecord(batch, record, cache);
+        }
+
+        const bool wrote = !batch.empty();
+        if (wrote)
+        {
+            ostream().write(batch.data(), batch.size());
+            ostream().flush();
+            batch.clear();
+        }
+        if (drained)
+        {
+            m_numDrained.fetch_add(1u, std::memory_order_release);
+        }
+
+        if (wrote)
+        {
+            continue;
+        }
+        else if (!writing)
+        {
+            break;
+        }
+        else
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(WRITER_INTERVAL));
+        }
+    }
+}
+
+void Logger::stopWriter()
+{
+    if (m_writerThread.joinable() && m_writerThread.get_id() != std::this_thread::get_id())
+    {
+        m_writing = false;
+        m_writerThread.join();
     }
 }
 
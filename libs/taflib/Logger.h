@@ -1,33 +1,92 @@
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <fstream>
 #include <memory>
 #include <string>
+#include <thread>
 
 #include <QtCore/qdebug.h>
 
+#include "MpscRing.h"
+
 namespace taflib
 {
 
+    // Handler for qInfo/qWarning etc.
+    // Asynchronously by default: the calling thread only queues the message, and a writer thread formats queued messages and
+    // writes them to file in batches.  If the queue is full the message is dropped and counted, and the count logged later.
+    // qCritical and qFatal don't return until they, and everything logged before them, are written.
+    // Optionally (setMaxPerCallSite) each call site (file and line if Qt provides them, otherwise the message's leading
+    // "[Class::method]") is also limited to a number of messages per second, so that eg a lossy peer can't flood the log from one place
     class Logger
     {
     public:
         enum class Verbosity { SILENT = 0, FATAL = 1, WARNING = 2, CRITICAL = 3, INFO = 4, DEBUG = 5 };
 
+        static const std::size_t RING_CAPACITY = 8192u;         // messages queued for the writer thread
+
     private:
+        struct Record
+        {
+            qint64 msecsSinceEpoch;
+            Qt::HANDLE threadId;
+            QtMsgType type;
+            QString msg;
+        };
+
+        // buckets of call sites.  sites that hash alike share a budget
+        struct CallSite
+        {
+            std::atomic<qint64> windowStart;
+            std::atomic<int> count;
+            std::atomic<int> suppressed;
+        };
+        static const std::size_t NUM_CALL_SITES = 1024u;
+
+        // only used by whichever thread formats records
+        struct DateTimeCache
+        {
+            qint64 second;
+            std::string text;
+        };
+
         std::ostream *m_ostream;    // points to either m_optionalLogFile or std::cout
         std::shared_ptr<std::ofstream> m_optionalLogFile;
         Verbosity m_verbosity;
+        const bool m_async;
+        std::atomic<int> m_maxPerCallSite;  // 0 for no limit
+        std::unique_ptr<CallSite[]> m_callSites;
+        MpscRing<Record> m_ring;
+        std::atomic<std::uint64_t> m_numDropped;           // since construction
+        std::atomic<std::uint64_t> m_numDrained;           // times the writer has written everything it found queued
+        std::atomic<bool> m_writing;
+        std::thread m_writerThread;
         static std::shared_ptr<Logger> m_instance;
 
         std::ostream& ostream();
+        bool isEnabled(QtMsgType type) const;
+        bool rateLimit(const QMessageLogContext& context, const QString& msg, qint64 now, int &suppressed);
+        void dispatch(Record& record);
+        void waitForWriter();
+        void writerLoop();
+        void stopWriter();
+        static void appendRecord(std::string& out, const Record& record, DateTimeCache& cache);
 
     public:
-        Logger(const std::string& filename, Verbosity verbosity);
-        static void Initialise(const std::string& filename, Verbosity level);
+        Logger(const std::string& filename, Verbosity verbosity, bool async = true);
+        ~Logger();
+        static void Initialise(const std::string& filename, Verbosity level, bool async = true);
         static Logger* Get();
         static void Log(QtMsgType type, const QMessageLogContext& context, const QString& msg);
         void LogToFile(QtMsgType type, const QMessageLogContext& context, const QString& msg);
+
+        // 0, the default, for no limit.  qCritical and qFatal are never limited
+        void setMaxPerCallSite(int messagesPerSecond);
+
+        // messages dropped because the queue was full, since construction
+        std::uint64_t numDropped() const { return m_numDropped.load(std::memory_order_relaxed); }
     };
 
-}
\ No newline at end of file
+}
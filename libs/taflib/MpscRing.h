@@ -0,0 +1,107 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace taflib
+{
+
+    // Bounded lock-free queue for any number of producer threads and exactly one consumer thread.
+    // Each slot carries a sequence number that says whether it's free for the producer that claimed it or ready for the consumer,
+    // so producers only contend on claiming a position, never on a lock.
+    // Like SpscRing, items are exchanged with the slots by swap rather than copied
+    template <typename T>
+    class MpscRing
+    {
+        struct Slot
+        {
+            std::atomic<std::size_t> seq;   // == position when free to push into, == position+1 when ready to pop
+            T item;
+        };
+
+        std::unique_ptr<Slot[]> m_slots;
+        const std::size_t m_capacity;
+        const std::size_t m_mask;
+        alignas(64) std::atomic<std::size_t> m_head;    // next position to pop.  written only by consumer
+        alignas(64) std::atomic<std::size_t> m_tail;    // next position to push.  claimed by producers
+
+        static std::size_t roundUpToPowerOf2(std::size_t n)
+        {
+            std::size_t p = 1u;
+            while (p < n)
+            {
+                p <<= 1;
+            }
+            return p;
+        }
+
+    public:
+        // capacity is rounded up to a power of 2
+        explicit MpscRing(std::size_t capacity) :
+            m_slots(new Slot[roundUpToPowerOf2(capacity)]),
+            m_capacity(roundUpToPowerOf2(capacity)),
+            m_mask(m_capacity - 1u),
+            m_head(0u),
+            m_tail(0u)
+        {
+            for (std::size_t n = 0u; n < m_capacity; ++n)
+            {
+                m_slots[n].seq.store(n, std::memory_order_relaxed);
+            }
+        }
+
+        // any thread.  on success item is left holding whatever the slot held before
+        // @return false if ring is full
+        bool tryPush(T &item)
+        {
+            std::size_t pos = m_tail.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                Slot &slot = m_slots[pos & m_mask];
+                const std::size_t seq = slot.seq.load(std::memory_order_acquire);
+                if (seq == pos)
+                {
+                    if (m_tail.compare_exchange_weak(pos, pos + 1u, std::memory_order_relaxed))
+                    {
+                        std::swap(slot.item, item);
+                        slot.seq.store(pos + 1u, std::memory_order_release);
+                        return true;
+                    }
+                    // pos has been updated to the current tail.  try again
+                }
+                else if (std::ptrdiff_t(seq - pos) < 0)
+                {
+                    return false;   // slot still holds an item from the previous lap.  ring is full
+                }
+                else
+                {
+                    pos = m_tail.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        // consumer only.  on success the slot is left holding item's previous contents
+        // @return false if ring is empty (or the next item's producer hasn't finished pushing it)
+        bool tryPop(T &item)
+        {
+            const std::size_t head = m_head.load(std::memory_order_relaxed);
+            Slot &slot = m_slots[head & m_mask];
+            if (slot.seq.load(std::memory_order_acquire) != head + 1u)
+            {
+                return false;
+            }
+            std::swap(item, slot.item);
+            slot.seq.store(head + m_capacity, std::memory_order_release);
+            m_head.store(head + 1u, std::memory_order_relaxed);
+            return true;
+        }
+
+        std::size_t capacity() const
+        {
+            return m_capacity;
+        }
+    };
+
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace taflib
+{
+
+    // Bounded lock-free queue for exactly one producer thread and one consumer thread.
+    // Items are exchanged with the slots by swap rather than copied, so buffers owned by items circulate between
+    // producer and consumer instead of being reallocated for every item
+    template <typename T>
+    class SpscRing
+    {
+        std::vector<T> m_slots;
+        const std::size_t m_mask;
+        alignas(64) std::atomic<std::size_t> m_head;    // next slot to pop.  written only by consumer
+        alignas(64) std::atomic<std::size_t> m_tail;    // next slot to push.  written only by producer
+
+        static std::size_t roundUpToPowerOf2(std::size_t n)
+        {
+            std::size_t p = 1u;
+            while (p < n)
+            {
+                p <<= 1;
+            }
+            return p;
+        }
+
+    public:
+        // capacity is rounded up to a power of 2
+        explicit SpscRing(std::size_t capacity) :
+            m_slots(roundUpToPowerOf2(capacity)),
+            m_mask(m_slots.size() - 1u),
+            m_head(0u),
+            m_tail(0u)
+        { }
+
+        // producer only.  on success item is left holding whatever the slot held before
+        // @return false if ring is full
+        bool tryPush(T &item)
+        {
+            const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+            if (tail - m_head.load(std::memory_order_acquire) == m_slots.size())
+            {
+                return false;
+            }
+            std::swap(m_slots[tail & m_mask], item);
+            m_tail.store(tail + 1u, std::memory_order_release);
+            return true;
+        }
+
+        // consumer only.  on success the slot is left holding item's previous contents
+        // @return false if ring is empty
+        bool tryPop(T &item)
+        {
+            const std::size_t head = m_head.load(std::memory_order_relaxed);
+            if (head == m_tail.load(std::memory_order_acquire))
+            {
+                return false;
+            }
+            std::swap(item, m_slots[head & m_mask]);
+            m_head.store(head + 1u, std::memory_order_release);
+            return true;
+        }
+
+        // exact only when called from producer or consumer while the other is idle
+        std::size_t size() const
+        {
+            return m_tail.load(std::memory_order_acquire) - m_head.load(std::memory_order_acquire);
+        }
+
+        std::size_t capacity() const
+        {
+            return m_slots.size();
+        }
+    };
+
+}
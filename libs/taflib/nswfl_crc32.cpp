@@ -54,15 +54,25 @@ void CRC32::Initialize(void)
     // 256 values representing ASCII character codes.
     for (int iCodes = 0; iCodes <= 0xFF; iCodes++)
     {
-        this->iTable[iCodes] = this->Reflect(iCodes, 8) << 24;
+        this->iTable[0][iCodes] = this->Reflect(iCodes, 8) << 24;
 
         for (int iPos = 0; iPos < 8; iPos++)
         {
-            this->iTable[iCodes] = (this->iTable[iCodes] << 1)
-                ^ ((this->iTable[iCodes] & (1 << 31)) ? iPolynomial : 0);
+            this->iTable[0][iCodes] = (this->iTable[0][iCodes] << 1)
+                ^ ((this->iTable[0][iCodes] & (1 << 31)) ? iPolynomial : 0);
         }
 
-        this->iTable[iCodes] = this->Reflect(this->iTable[iCodes], 32);
+        this->iTable[0][iCodes] = this->Reflect(this->iTable[0][iCodes], 32);
+    }
+
+    // iTable[k][n] is the CRC of byte n followed by k zero bytes
+    for (int iSlice = 1; iSlice < 8; iSlice++)
+    {
+        for (int iCodes = 0; iCodes <= 0xFF; iCodes++)
+        {
+            const unsigned int iPrev = this->iTable[iSlice - 1][iCodes];
+            this->iTable[iSlice][iCodes] = (iPrev >> 8) ^ this->iTable[0][iPrev & 0xFF];
+        }
     }
 }
 
@@ -98,12 +108,26 @@ unsigned int CRC32::Reflect(unsigned int iReflect, const char cChar)
 
 void CRC32::PartialCRC(unsigned int *iCRC, const unsigned char *sData, size_t iDataLength) const
 {
+    // slicing-by-8: fold in 8 bytes per iteration using the extended tables
+    unsigned int iValue = *iCRC;
+    while (iDataLength >= 8)
+    {
+        const unsigned int iLow = iValue ^ (sData[0] | (sData[1] << 8) | (sData[2] << 16) | ((unsigned int)sData[3] << 24));
+        iValue = this->iTable[7][iLow & 0xFF] ^ this->iTable[6][(iLow >> 8) & 0xFF]
+            ^ this->iTable[5][(iLow >> 16) & 0xFF] ^ this->iTable[4][iLow >> 24]
+            ^ this->iTable[3][sData[4]] ^ this->iTable[2][sData[5]]
+            ^ this->iTable[1][sData[6]] ^ this->iTable[0][sData[7]];
+        sData += 8;
+        iDataLength -= 8;
+    }
+    *iCRC = iValue;
+
     while (iDataLength--)
     {
         //If your compiler complains about the following line, try changing
         //	each occurrence of *iCRC with ((unsigned int)*iCRC).
 
-        *iCRC = (*iCRC >> 8) ^ this->iTable[(*iCRC & 0xFF) ^ *sData++];
+        *iCRC = (*iCRC >> 8) ^ this->iTable[0][(*iCRC & 0xFF) ^ *sData++];
     }
 }
 
@@ -29,7 +29,7 @@ namespace taflib {
 
     private:
         unsigned int Reflect(unsigned int iReflect, const char cChar);
-        unsigned int iTable[256]; // CRC lookup table array.
+        unsigned int iTable[8][256]; // CRC lookup table arrays.  iTable[0] is the classic table, iTable[1..7] extend it for slicing-by-8
     };
 
 } //namespace::NSWFL
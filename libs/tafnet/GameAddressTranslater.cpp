@@ -2,184 +2,288 @@
 
 #include "tapacket/DPlayPacket.h"
 
+#include <cstddef>
 #include <cstring>
-#include <sstream>
-#include <iostream>
 
 using namespace tafnet;
 
-GameAddressTranslater::GameAddressTranslater(std::uint32_t _replyAddress, const std::uint16_t _replyPorts[]) :
-    replyAddress(_replyAddress),
-    translatePlayerSPA([] (tapacket::DPAddress &, int) { return false; })
+// offsets within a message
+static const unsigned HEADER_SIZE = sizeof(tapacket::DPHeader);
+static const unsigned HEADER_ADDRESS = offsetof(tapacket::DPHeader, address);           // reply address
+static const unsigned HEADER_ACTIONSTRING = offsetof(tapacket::DPHeader, actionstring); // offsets given within messages are relative to this
+
+// AddForward(Request), CreatePlayer(Verify): idTo, playerId, groupId, createOffset, passwordOffset, DPPackedPlayer, short name, long name, SPAs
+static const unsigned FORWARD_PLAYER = HEADER_SIZE + 5u * 4u;
+static const unsigned FORWARD_NAMES = FORWARD_PLAYER + sizeof(tapacket::DPPackedPlayer);
+
+// SuperEnumPlayersReply: playerCount, groupCount, packedOffset, shortcutCount, descriptionOffset, nameOffset, passwordOffset
+static const unsigned SUPERENUM_PLAYER_COUNT = HEADER_SIZE;
+static const unsigned SUPERENUM_PACKED_OFFSET = HEADER_SIZE + 8u;
+static const unsigned SUPERENUM_HEADER_SIZE = HEADER_SIZE + 7u * 4u;
+
+// super packed player: size, flags, id, infoMask.  at size: systemPlayerIdOrDirectPlayVersion, short name, long name, player data, SPAs
+static const unsigned SUPERPACKED_INFO_MASK = 12u;
+static const unsigned SUPERPACKED_FIXED_SIZE = 16u;
+
+// offsets within a DPAddress
+static const unsigned ADDRESS_SIZE = sizeof(tapacket::DPAddress);
+static const unsigned ADDRESS_PORT = offsetof(tapacket::DPAddress, _port);
+static const unsigned ADDRESS_IPV4 = offsetof(tapacket::DPAddress, _ipv4);
+
+// messages need not be aligned within the buffer
+static std::uint16_t read16(const char* p)
 {
-    replyPorts[0] = _replyPorts[0];
-    replyPorts[1] = _replyPorts[1];
+    std::uint16_t x;
+    std::memcpy(&x, p, sizeof(x));
+    return x;
 }
 
-
-GameAddressTranslater::GameAddressTranslater(
-    std::uint32_t _replyAddress, const std::uint16_t _replyPorts[],
-    const TranslatePlayerSPA &_translate) :
-    replyAddress(_replyAddress),
-    translatePlayerSPA(_translate)
+static std::uint32_t read32(const char* p)
 {
-    replyPorts[0] = _replyPorts[0];
-    replyPorts[1] = _replyPorts[1];
+    std::uint32_t x;
+    std::memcpy(&x, p, sizeof(x));
+    return x;
 }
 
-void GameAddressTranslater::operator()(char* buf, int len) const
+// bounded version of tapacket::skipCWStr
+static bool skipCWStr(const char* msg, unsigned size, std::uint64_t& pos)
 {
-    for (char* ptr = buf; ptr < buf + len;) {
-        tapacket::DPHeader* hdr = (tapacket::DPHeader*)ptr;
-        if (translateHeader(ptr, hdr->size()))
+    for (; pos + 2u <= size; pos += 2u)
+    {
+        if (read16(msg + pos) == 0u)
         {
-            translateSuperEnumPlayersReply(ptr, hdr->size()) ||
-                translateForwardOrCreateRequest(ptr, hdr->size());
+            pos += 2u;
+            return true;
         }
-        ptr += hdr->size();
     }
+    return false;
 }
 
-bool GameAddressTranslater::translateHeader(char* buf, int len) const
+// super packed player's 2 bit length codes: 0 absent, 1 byte, 2 word, 3 dword
+static bool readLength(const char* msg, unsigned size, std::uint64_t& pos, unsigned code, std::uint64_t& length)
 {
-    tapacket::DPHeader* dp = (tapacket::DPHeader*)buf;
-    if (dp->looksOk())
-    {
-        translateReplyAddress(dp->address, 0);
-        return true;
-    }
-    else
+    static const unsigned LENGTH_BYTES[4] = { 0u, 1u, 2u, 4u };
+    const unsigned bytes = LENGTH_BYTES[code & 3u];
+    if (pos + bytes > size)
     {
         return false;
     }
+    length = 0u;
+    std::memcpy(&length, msg + pos, bytes);
+    pos += bytes;
+    return true;
 }
 
-void GameAddressTranslater::translateReplyAddress(tapacket::DPAddress &address, int index) const
+GameAddressTranslater::GameAddressTranslater(std::uint32_t replyAddress, const std::uint16_t replyPorts[]) :
+    m_reply(makeSubstitution(0u, replyAddress, replyPorts)),
+    m_unmatchedPlayer(m_reply),
+    m_fromLocalGame(false)
+{ }
+
+GameAddressTranslater::GameAddressTranslater(std::uint32_t replyAddress, const std::uint16_t replyPorts[], std::uint32_t localPlayerId) :
+    m_reply(makeSubstitution(0u, replyAddress, replyPorts)),
+    m_unmatchedPlayer(makeSubstitution(localPlayerId, localPlayerId, replyPorts)),
+    m_fromLocalGame(true)
+{ }
+
+GameAddressTranslater::Substitution GameAddressTranslater::makeSubstitution(std::uint32_t playerId, std::uint32_t address, const std::uint16_t ports[])
 {
-    address.address(replyAddress);
-    address.port(replyPorts[index]);
+    const tapacket::DPAddress tcp(address, ports[0]);
+    const tapacket::DPAddress udp(address, ports[1]);
+    Substitution substitution;
+    substitution.playerId = playerId;
+    substitution.ipv4 = tcp._ipv4;
+    substitution.ports[0] = tcp._port;
+    substitution.ports[1] = udp._port;
+    return substitution;
 }
 
-
-bool GameAddressTranslater::translateForwardOrCreateRequest(char* buf, int len) const
+void GameAddressTranslater::setPlayer(std::uint32_t playerId, std::uint32_t address, const std::uint16_t ports[])
 {
-    tapacket::DPHeader* dp = (tapacket::DPHeader*)buf;
-    if (dp->command != 0x2e && // DPSP_MSG_ADDFORWARD
-        dp->command != 0x13 && // DPSP_MSG_ADDFORWARDREQUEST
-        dp->command != 0x08 && // DPSP_MSG_CREATEPLAYER
-        dp->command != 0x38    // DPSP_MSG_CREATEPLAYERVERIFY
-        )
+    if (m_fromLocalGame)
     {
-        return false;
+        // local game knows the player by the ports of its GameReceiver.  we tell the other end the playerId instead
+        const Substitution substitution = makeSubstitution(playerId, playerId, ports);
+        m_players[ports[0]] = substitution;
+        m_players[ports[1]] = substitution;
     }
-    struct DPForwardOrCreateRequest
+    else
     {
-        std::uint32_t id_to;
-        std::uint32_t player_id;
-        std::uint32_t group_id;
-        std::uint32_t create_offset;
-        std::uint32_t password_offset;
-        tapacket::DPPackedPlayer player;
-        char sentinel;
-    };
-    DPForwardOrCreateRequest* req = (DPForwardOrCreateRequest*)(dp + 1);
-    if (req->player.service_provider_data_size == 0)
+        m_players[playerId] = makeSubstitution(playerId, address, ports);
+    }
+}
+
+void GameAddressTranslater::removePlayer(std::uint32_t playerId)
+{
+    for (auto it = m_players.begin(); it != m_players.end();)
     {
-        return false;
+        if (it->second.playerId == playerId)
+        {
+            it = m_players.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
     }
-    tapacket::DPAddress* addr = (tapacket::DPAddress*)(&req->sentinel + req->player.short_name_length + req->player.long_name_length);
-    for (unsigned n = 0u; n * sizeof(tapacket::DPAddress) < req->player.service_provider_data_size; ++n, ++addr)
+}
+
+const std::vector<GameAddressTranslater::UnmatchedAddress>& GameAddressTranslater::unmatched() const
+{
+    return m_unmatched;
+}
+
+bool GameAddressTranslater::operator()(char* buf, int len)
+{
+    m_unmatched.clear();
+
+    bool ok = true;
+    tapacket::DPHeader header(0u, 0u, "\0\0\0\0", tapacket::DPlayCommandCode::NONE, 0u, 0u);
+    for (int pos = 0; pos < len;)
     {
-        if (!translatePlayerSPA(*addr, n))
+        char* msg = buf + pos;
+        const unsigned remaining = unsigned(len - pos);
+        if (remaining < sizeof(header.size_and_token))
+        {
+            return false;
+        }
+        std::memcpy(&header.size_and_token, msg, sizeof(header.size_and_token));
+        const unsigned size = header.size();
+        if (size == 0u || size > remaining)
+        {
+            return false;
+        }
+
+        if (size >= HEADER_SIZE)
         {
-            translateReplyAddress(*addr, n);
+            std::memcpy(&header, msg, HEADER_SIZE);
         }
+        if (size >= HEADER_SIZE && header.looksOk())
+        {
+            substitute(msg + HEADER_ADDRESS, 0, m_reply, true);
+            switch (tapacket::DPlayCommandCode(header.command))
+            {
+            case tapacket::DPlayCommandCode::SUPERENUMPLAYERSREPLY:
+                ok = translateSuperEnumPlayersReply(msg, size) && ok;
+                break;
+            case tapacket::DPlayCommandCode::ADDFORWARD:
+            case tapacket::DPlayCommandCode::ADDFORWARDREQUEST:
+            case tapacket::DPlayCommandCode::CREATEPLAYER:
+            case tapacket::DPlayCommandCode::CREATEPLAYERVERIFY:
+                ok = translateForwardOrCreateRequest(msg, size) && ok;
+                break;
+            default:
+                break;
+            };
+        }
+        pos += int(size);
     }
-    return true;
+    return ok;
 }
 
-bool GameAddressTranslater::translateSuperEnumPlayersReply(char* buf, int len) const
+bool GameAddressTranslater::translateForwardOrCreateRequest(char* msg, unsigned size)
 {
-    tapacket::DPHeader* dp = (tapacket::DPHeader*)buf;
-    if (dp->command != 0x0029) // Super Enum Players Reply
+    if (size < FORWARD_NAMES)
     {
         return false;
     }
-
-    struct DPSuperEnumPlayersReplyHeader
+    const char* player = msg + FORWARD_PLAYER;
+    const std::uint32_t spaSize = read32(player + offsetof(tapacket::DPPackedPlayer, service_provider_data_size));
+    std::uint64_t pos = FORWARD_NAMES;
+    pos += read32(player + offsetof(tapacket::DPPackedPlayer, short_name_length));
+    pos += read32(player + offsetof(tapacket::DPPackedPlayer, long_name_length));
+    if (pos + spaSize > size)
     {
-        std::uint32_t player_count;
-        std::uint32_t group_count;
-        std::uint32_t packed_offset;
-        std::uint32_t shortcut_count;
-        std::uint32_t description_offset;
-        std::uint32_t name_offset;
-        std::uint32_t password_offset;
-    };
-    DPSuperEnumPlayersReplyHeader* ephdr = (DPSuperEnumPlayersReplyHeader*)(dp + 1);
-    if (ephdr->packed_offset == 0)
+        return false;
+    }
+    for (int index = 0; index < 2 && (index + 1u) * ADDRESS_SIZE <= spaSize; ++index)
     {
-        return true;
+        translatePlayerAddress(msg + pos + index * ADDRESS_SIZE, index);
     }
+    return true;
+}
 
-    struct DPSuperPackedPlayerInfo
+bool GameAddressTranslater::translateSuperEnumPlayersReply(char* msg, unsigned size)
+{
+    if (size < SUPERENUM_HEADER_SIZE)
     {
-        unsigned haveShortName : 1;
-        unsigned haveLongName : 1;
-        unsigned serviceProvideDataLengthBytes : 2;
-        unsigned playerDataLengthBytes : 2;
-        unsigned pad : 26;
-    };
-    struct DPSuperPackedPlayer
+        return false;
+    }
+    const std::uint32_t playerCount = read32(msg + SUPERENUM_PLAYER_COUNT);
+    const std::uint32_t packedOffset = read32(msg + SUPERENUM_PACKED_OFFSET);
+    if (packedOffset == 0u)
     {
-        std::uint32_t size;
-        std::uint32_t flags;
-        std::uint32_t id;
-        DPSuperPackedPlayerInfo info;
-    };
+        return true;
+    }
 
-    DPSuperPackedPlayer* player = (DPSuperPackedPlayer*)(buf + 0x4a - 0x36 + ephdr->packed_offset);
-    for (unsigned n = 0u; n < ephdr->player_count; ++n)
+    // each player advances pos by at least 4, so a bogus playerCount can't keep us here for long
+    std::uint64_t pos = std::uint64_t(HEADER_ACTIONSTRING) + packedOffset;
+    for (std::uint32_t n = 0u; n < playerCount; ++n)
     {
-        char* ptr = (char*)player + player->size;
-        ptr += 4;  //  systemPlayerIdOrDirectPlayVersion
-        if (player->info.haveShortName)
-        {
-            ptr = (char*)tapacket::skipCWStr((std::uint16_t*)ptr);
-        }
-        if (player->info.haveLongName)
+        if (pos + SUPERPACKED_FIXED_SIZE > size)
         {
-            ptr = (char*)tapacket::skipCWStr((std::uint16_t*)ptr);
+            return false;
         }
-        if (player->info.playerDataLengthBytes == 1)
+        const std::uint32_t infoMask = read32(msg + pos + SUPERPACKED_INFO_MASK);
+        pos += read32(msg + pos);
+        pos += 4u;  // systemPlayerIdOrDirectPlayVersion
+
+        if ((infoMask & 1u) && !skipCWStr(msg, size, pos))
         {
-            int len = *(std::uint8_t*)ptr;
-            ptr += 1 + len;
+            return false;
         }
-        if (player->info.playerDataLengthBytes == 2)
+        if ((infoMask & 2u) && !skipCWStr(msg, size, pos))
         {
-            int len = *(std::uint16_t*)ptr;
-            ptr += 2 + len;
+            return false;
         }
-        if (player->info.serviceProvideDataLengthBytes == 1)
+        std::uint64_t playerDataSize = 0u;
+        if (!readLength(msg, size, pos, infoMask >> 4, playerDataSize))
         {
-            int len = *(std::uint8_t*)ptr;
-            ptr += 1;
+            return false;
         }
-        if (player->info.serviceProvideDataLengthBytes == 2)
+        pos += playerDataSize;
+        std::uint64_t spaSize = 0u;
+        if (!readLength(msg, size, pos, infoMask >> 2, spaSize) || pos + spaSize > size)
         {
-            int len = *(std::uint16_t*)ptr;
-            ptr += 2;
+            return false;
         }
-        tapacket::DPAddress* addr = (tapacket::DPAddress*)ptr;
-        for (int i = 0; i < 2; ++i, ++addr)
+
+        for (int index = 0; index < 2 && (index + 1u) * ADDRESS_SIZE <= spaSize; ++index)
         {
-            if (!translatePlayerSPA(*addr, i))
-            {
-                translateReplyAddress(*addr, i);
-            }
+            translatePlayerAddress(msg + pos + index * ADDRESS_SIZE, index);
         }
-        player = (DPSuperPackedPlayer*)(addr);
+        pos += spaSize;
     }
     return true;
 }
+
+void GameAddressTranslater::translatePlayerAddress(char* address, int index)
+{
+    tapacket::DPAddress spa(0u, 0u);
+    std::memcpy(&spa, address, sizeof(spa));
+
+    auto it = m_players.find(m_fromLocalGame ? spa.port() : spa.address());
+    if (it != m_players.end())
+    {
+        substitute(address, index, it->second, !m_fromLocalGame);
+    }
+    else if (m_fromLocalGame)
+    {
+        const UnmatchedAddress unmatched = { index, spa.address(), spa.port() };
+        m_unmatched.push_back(unmatched);
+        substitute(address, index, m_unmatchedPlayer, false);
+    }
+    else
+    {
+        substitute(address, index, m_reply, true);
+    }
+}
+
+void GameAddressTranslater::substitute(char* address, int index, const Substitution& substitution, bool withPort) const
+{
+    std::memcpy(address + ADDRESS_IPV4, &substitution.ipv4, sizeof(substitution.ipv4));
+    if (withPort)
+    {
+        std::memcpy(address + ADDRESS_PORT, &substitution.ports[index], sizeof(substitution.ports[index]));
+    }
+}
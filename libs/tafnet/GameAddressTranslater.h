@@ -1,40 +1,70 @@
 #pragma once
 
 #include <cinttypes>
-#include <functional>
 #include <map>
-#include <string>
-
-namespace tapacket
-{
-    struct DPAddress;
-}
+#include <vector>
 
 namespace tafnet
 {
+    // Rewrites the addresses in a buffer of DirectPlay messages in place:
+    // the reply address in each message header, and the player service provider addresses (SPAs) in
+    // SuperEnumPlayersReply, AddForward(Request) and CreatePlayer(Verify) messages.
+    //
+    // Substituted addresses are held already in network byte order, so a translater is meant to be kept and reused,
+    // eg one per peer, and told about players as they come and go with setPlayer/removePlayer.
+    //
+    // Messages may come from a remote peer so nothing in them is trusted: every length and offset is bounds checked
+    // against the message and the message against the buffer
     class GameAddressTranslater
     {
-        std::uint32_t replyAddress;
-        std::uint16_t replyPorts[2];
-        std::function<bool(tapacket::DPAddress & address, int /* 0:tcp, 1:udp */)> translatePlayerSPA;
-
     public:
-        typedef std::function<bool(tapacket::DPAddress & address, int /* 0:tcp, 1:udp */)> TranslatePlayerSPA;
+        // a player SPA from local game that didn't match any setPlayer() port
+        struct UnmatchedAddress
+        {
+            int index;              // 0:tcp, 1:udp
+            std::uint32_t address;  // as it was before translation
+            std::uint16_t port;
+        };
 
+        // For messages to local game.  Player SPAs hold a tafnet playerId (see below).
+        // Those given to setPlayer() are substituted with that player's address and ports, others with replyAddress/replyPorts
         GameAddressTranslater(std::uint32_t replyAddress, const std::uint16_t replyPorts[]);
 
-        GameAddressTranslater(
-            std::uint32_t replyAddress, const std::uint16_t replyPorts[],
-            const TranslatePlayerSPA & translatePlayerSPAddress);
+        // For messages from local game.  Player SPAs hold an address as seen by the local game.
+        // Those on ports given to setPlayer() have their address substituted with that player's tafnet playerId, others with localPlayerId.
+        // Ports are left alone, and the other end substitutes them back
+        GameAddressTranslater(std::uint32_t replyAddress, const std::uint16_t replyPorts[], std::uint32_t localPlayerId);
 
-        void operator()(char* buf, int len) const;
+        // address and ports [0:tcp, 1:udp] that local game should use to reach the player, ie that player's GameReceiver
+        void setPlayer(std::uint32_t playerId, std::uint32_t address, const std::uint16_t ports[]);
+        void removePlayer(std::uint32_t playerId);
 
-        bool translateHeader(char* buf, int len) const;
-        bool translateForwardOrCreateRequest(char* buf, int len) const;
-        bool translateSuperEnumPlayersReply(char* buf, int len) const;
+        // @return false if buf isn't a whole number of well formed messages.  Messages up to the malformed one are still translated
+        bool operator()(char* buf, int len);
+
+        // player SPAs that the last operator() call substituted with localPlayerId
+        const std::vector<UnmatchedAddress>& unmatched() const;
 
     private:
-        void translateReplyAddress(tapacket::DPAddress& address, int index) const;
+        struct Substitution
+        {
+            std::uint32_t playerId;
+            std::uint32_t ipv4;         // network byte order, as in DPAddress
+            std::uint16_t ports[2];     // network byte order, as in DPAddress
+        };
+
+        Substitution m_reply;
+        Substitution m_unmatchedPlayer;
+        const bool m_fromLocalGame;
+        std::map<std::uint32_t, Substitution> m_players;   // keyed by playerId to local game, or by port from local game
+        std::vector<UnmatchedAddress> m_unmatched;
+
+        static Substitution makeSubstitution(std::uint32_t playerId, std::uint32_t address, const std::uint16_t ports[]);
+
+        bool translateForwardOrCreateRequest(char* msg, unsigned size);
+        bool translateSuperEnumPlayersReply(char* msg, unsigned size);
+        void translatePlayerAddress(char* address, int index);
+        void substitute(char* address, int index, const Substitution& substitution, bool withPort) const;
     };
 
 }
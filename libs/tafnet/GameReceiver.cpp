@@ -1,10 +1,13 @@
 #include "GameAddressTranslater.h"
 #include "GameReceiver.h"
 #include "GameSender.h"
+#include "PacketCapture.h"
 #include "taflib/Watchdog.h"
 
 #include <QtNetwork/qtcpsocket.h>
 
+#include <algorithm>
+
 using namespace tafnet;
 
 GameReceiver::GameReceiver(QHostAddress bindAddress, quint16 tcpPort, quint16 udpPort, QSharedPointer<QUdpSocket> udpSocket) :
@@ -144,8 +147,15 @@ void GameReceiver::onReadyReadTcp()
         //qInfo() << "[GameReceiver::onReadyReadTcp]" << sender->localAddress().toString() << ":" << sender->localPort() << "from" << sender->peerAddress().toString() << ":" << sender->peerPort();
         while (sender->bytesAvailable())
         {
-            QByteArray datas = sender->readAll();
-            handleMessage(sender, getChannelCodeFromSocket(sender), datas.data(), datas.size());
+            PacketBufferPtr packet = PacketBufferPool::instance().acquire(int(sender->bytesAvailable()));
+            packet->resize(int(std::max(qint64(0), sender->read(packet->data(), packet->size()))));
+            PacketCapture& capture = PacketCapture::instance();
+            if (capture.isActive())
+            {
+                capture.record(PacketCapture::SOURCE_GAME_TCP, PacketCapture::DIRECTION_RECEIVED, 0u, 0u,
+                    sender->localAddress().toIPv4Address(), sender->localPort(), sender->peerAddress().toIPv4Address(), sender->peerPort(), packet->data(), packet->size());
+            }
+            handleMessage(sender, getChannelCodeFromSocket(sender), packet);
         }
     }
     catch (std::exception &e)
@@ -164,14 +174,20 @@ void GameReceiver::onReadyReadUdp()
     {
         taflib::Watchdog wd("GameReceiver::onReadyReadUdp", 100);
         QUdpSocket* sender = dynamic_cast<QUdpSocket*>(QObject::sender());
-        QByteArray datas;
         while (sender->hasPendingDatagrams())
         {
-            datas.resize(sender->pendingDatagramSize());
+            // a fresh buffer for each datagram since TafnetNode may hang on to it for resending
+            PacketBufferPtr packet = PacketBufferPool::instance().acquire(int(std::max(qint64(0), sender->pendingDatagramSize())));
             QHostAddress senderAddress;
             quint16 senderPort;
-            sender->readDatagram(datas.data(), datas.size(), &senderAddress, &senderPort);
-            handleMessage(sender, CHANNEL_UDP, datas.data(), datas.size());
+            packet->resize(int(std::max(qint64(0), sender->readDatagram(packet->data(), packet->size(), &senderAddress, &senderPort))));
+            PacketCapture& capture = PacketCapture::instance();
+            if (capture.isActive())
+            {
+                capture.record(PacketCapture::SOURCE_GAME_UDP, PacketCapture::DIRECTION_RECEIVED, 0u, 0u,
+                    sender->localAddress().toIPv4Address(), sender->localPort(), senderAddress.toIPv4Address(), senderPort, packet->data(), packet->size());
+            }
+            handleMessage(sender, CHANNEL_UDP, packet);
         }
     }
     catch (std::exception &e)
@@ -184,12 +200,12 @@ void GameReceiver::onReadyReadUdp()
     }
 }
 
-void GameReceiver::handleMessage(QAbstractSocket* receivingSocket, int channel, char* data, int len)
+void GameReceiver::handleMessage(QAbstractSocket* receivingSocket, int channel, const PacketBufferPtr& packet)
 {
-    m_handleMessage(receivingSocket, channel, data, len);
+    m_handleMessage(receivingSocket, channel, packet);
 }
 
-void GameReceiver::setHandler(const std::function<void(QAbstractSocket*, int, char*, int)>& f)
+void GameReceiver::setHandler(const std::function<void(QAbstractSocket*, int, const PacketBufferPtr&)>& f)
 {
     m_handleMessage = f;
 }
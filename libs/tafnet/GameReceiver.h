@@ -5,6 +5,8 @@
 #include <QtNetwork/qtcpserver.h>
 #include <QtNetwork/qudpsocket.h>
 
+#include "PacketBuffer.h"
+
 namespace tafnet
 {
     class GameSender;
@@ -20,14 +22,14 @@ namespace tafnet
         QTcpServer m_enumServer;
         QSharedPointer<QUdpSocket> m_udpSocket;
         QList<QAbstractSocket*> m_sockets;   // those associated with m_tcpServer, and also those not
-        std::function<void(QAbstractSocket*, int, char*, int)> m_handleMessage; // optional hook for handleMessage
+        std::function<void(QAbstractSocket*, int, const PacketBufferPtr&)> m_handleMessage; // optional hook for handleMessage
 
         virtual int getChannelCodeFromSocket(QAbstractSocket* socket);
         virtual void onNewConnection();
         virtual void onSocketStateChanged(QAbstractSocket::SocketState socketState);
         virtual void onReadyReadTcp();
         virtual void onReadyReadUdp();
-        virtual void handleMessage(QAbstractSocket* receivingSocket, int channel, char* data, int len);
+        virtual void handleMessage(QAbstractSocket* receivingSocket, int channel, const PacketBufferPtr& packet);
 
     public:
         static const int CHANNEL_ENUM = 1;
@@ -37,7 +39,8 @@ namespace tafnet
         GameReceiver(QHostAddress bindAddress, quint16 tcpPort, quint16 udpPort, QSharedPointer<QUdpSocket> udpSocket);
         ~GameReceiver();
 
-        virtual void setHandler(const std::function<void(QAbstractSocket*, int, char*, int)>& f);
+        // handler is given each packet in the pooled buffer it was read into, with headroom for a tafnet header
+        virtual void setHandler(const std::function<void(QAbstractSocket*, int, const PacketBufferPtr&)>& f);
         virtual QHostAddress getBindAddress();
         virtual quint16 getEnumListenPort();
         virtual quint16 getTcpListenPort();
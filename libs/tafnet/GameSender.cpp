@@ -1,20 +1,52 @@
 #include "GameSender.h"
+#include "PacketCapture.h"
 #include "taflib/Watchdog.h"
 #include <taflib/HexDump.h>
 #include <sstream>
 
 using namespace tafnet;
 
+static const int ENUM_CONNECT_TIMEOUT_MS = 30;
+static const int TCP_CONNECT_TIMEOUT_MS = 500;
+static const int MAX_PENDING_WRITE_BYTES = 1024 * 1024;
+
+GameSender::AsyncTcpSocket::AsyncTcpSocket(const char *name, bool disconnectWhenWritten) :
+    name(name),
+    disconnectWhenWritten(disconnectWhenWritten),
+    reconnectWhenClosed(false)
+{
+    connectTimer.setSingleShot(true);
+}
+
 GameSender::GameSender(QHostAddress gameAddress, quint16 enumPort) :
+    m_enumSocket("enum", true),
+    m_tcpSocket("tcp", false),
     m_gameAddress(gameAddress),
     m_enumPort(enumPort),
     m_udpSocket(new QUdpSocket()),
     m_tcpPort(0),
     m_udpPort(0)
-{ }
+{
+    initSocket(m_enumSocket);
+    initSocket(m_tcpSocket);
+}
 
 GameSender::~GameSender()
-{ }
+{
+    // sockets emit stateChanged as they're destroyed, by which time we're no longer fit to handle it
+    m_enumSocket.socket.disconnect(this);
+    m_tcpSocket.socket.disconnect(this);
+}
+
+void GameSender::initSocket(AsyncTcpSocket &s)
+{
+    QObject::connect(&s.socket, &QAbstractSocket::stateChanged, this, [this, &s](QAbstractSocket::SocketState state) {
+        onSocketStateChanged(s, state);
+    });
+    QObject::connect(&s.connectTimer, &QTimer::timeout, this, [this, &s]() {
+        onSocketConnectTimeout(s);
+    });
+}
 
 void GameSender::setTcpPort(quint16 port)
 {
@@ -34,43 +66,139 @@ void GameSender::setGameAddress(QHostAddress gameAddress)
 bool GameSender::enumSessions(const char* data, int len)
 {
     taflib::Watchdog wd("[GameSender::enumSessions]", 100);
-    m_enumSocket.connectToHost(m_gameAddress, m_enumPort);
-    if (!m_enumSocket.waitForConnected(30))
+    // only good for the very next call, so a stale delivery can't admit some later request
+    const bool written = m_enumSocket.lastWritten == QByteArray::fromRawData(data, len);
+    m_enumSocket.lastWritten.clear();
+    if (written)
     {
-        return false;
+        return true;
     }
 
-    m_enumSocket.write(data, len);
-    m_enumSocket.flush();
-    m_enumSocket.disconnectFromHost();
-    return true;
+    // a failed attempt drops its queued request, so asking again is what retries it
+    if (m_enumSocket.pendingWrites.isEmpty())
+    {
+        writeSocket(m_enumSocket, data, len, ENUM_CONNECT_TIMEOUT_MS);
+    }
+    return false;
 }
 
 bool GameSender::openTcpSocket(int timeoutMillisecond)
 {
-    taflib::Watchdog wd("GameSender::openTcpSocket", 100+timeoutMillisecond);
-    if (m_tcpPort > 0 && !m_tcpSocket.isOpen())
+    taflib::Watchdog wd("GameSender::openTcpSocket", 100);
+    return connectSocket(m_tcpSocket, m_tcpPort, timeoutMillisecond);
+}
+
+void GameSender::sendTcpData(char* data, int len)
+{
+    taflib::Watchdog wd("GameSender::sendTcpData", 100);
+    writeSocket(m_tcpSocket, data, len, TCP_CONNECT_TIMEOUT_MS);
+}
+
+bool GameSender::connectSocket(AsyncTcpSocket &s, quint16 port, int timeoutMillisecond)
+{
+    if (port == 0)
     {
-        qInfo() << "[GameSender::openTcpSocket]" << m_gameAddress.toString() << ":" << m_tcpPort;
-        m_tcpSocket.connectToHost(m_gameAddress, m_tcpPort);
-        m_tcpSocket.waitForConnected(timeoutMillisecond);
+        return false;
     }
-    return m_tcpSocket.isOpen();
+    if (s.socket.state() == QAbstractSocket::UnconnectedState)
+    {
+        qInfo() << "[GameSender::connectSocket]" << s.name << m_gameAddress.toString() << ":" << port;
+        // timer first, in case the attempt fails synchronously and stops it
+        s.connectTimer.start(timeoutMillisecond);
+        s.socket.connectToHost(m_gameAddress, port);
+    }
+    return true;
 }
 
-void GameSender::sendTcpData(char* data, int len)
+void GameSender::writeSocket(AsyncTcpSocket &s, const char *data, int len, int timeoutMillisecond)
+{
+    PacketCapture& capture = PacketCapture::instance();
+    if (capture.isActive())
+    {
+        const quint16 port = &s == &m_enumSocket ? m_enumPort : m_tcpPort;
+        capture.record(PacketCapture::SOURCE_GAME_TCP, PacketCapture::DIRECTION_SENT, 0u, 0u,
+            s.socket.localAddress().toIPv4Address(), s.socket.localPort(), m_gameAddress.toIPv4Address(), port, data, len);
+    }
+
+    if (s.socket.state() == QAbstractSocket::ConnectedState && !s.disconnectWhenWritten)
+    {
+        s.socket.write(data, len);
+        s.socket.flush();
+        return;
+    }
+
+    if (s.pendingWrites.size() + len > MAX_PENDING_WRITE_BYTES)
+    {
+        qWarning() << "[GameSender::writeSocket]" << s.name << "pending write queue full.  dropping" << len << "bytes";
+        return;
+    }
+    s.pendingWrites.append(data, len);
+
+    const quint16 port = &s == &m_enumSocket ? m_enumPort : m_tcpPort;
+    if (s.socket.state() == QAbstractSocket::ClosingState)
+    {
+        // can't connect again until the close completes
+        s.reconnectWhenClosed = true;
+    }
+    else if (!connectSocket(s, port, timeoutMillisecond))
+    {
+        qWarning() << "[GameSender::writeSocket]" << s.name << "unable to open socket!  port not known";
+        s.pendingWrites.clear();
+    }
+}
+
+void GameSender::onSocketStateChanged(AsyncTcpSocket &s, QAbstractSocket::SocketState state)
 {
-    taflib::Watchdog wd("GameSender::sendTcpData", 600);
-    if (!m_tcpSocket.isOpen())
+    if (state == QAbstractSocket::ConnectedState)
     {
-        openTcpSocket(500);
+        s.connectTimer.stop();
+        if (!s.pendingWrites.isEmpty())
+        {
+            s.socket.write(s.pendingWrites);
+            s.socket.flush();
+            if (s.disconnectWhenWritten)
+            {
+                s.lastWritten = s.pendingWrites;
+            }
+            s.pendingWrites.clear();
+        }
+        if (s.disconnectWhenWritten)
+        {
+            s.socket.disconnectFromHost();
+        }
     }
-    if (!m_tcpSocket.isOpen())
+    else if (state == QAbstractSocket::UnconnectedState)
     {
-        qWarning() << "[GameSender::sendTcpData] unable to open socket!";
+        s.connectTimer.stop();
+        if (s.reconnectWhenClosed && !s.pendingWrites.isEmpty())
+        {
+            // not from within the socket's own state change
+            s.reconnectWhenClosed = false;
+            QTimer::singleShot(0, this, [this, &s]() {
+                const quint16 port = &s == &m_enumSocket ? m_enumPort : m_tcpPort;
+                const int timeoutMillisecond = &s == &m_enumSocket ? ENUM_CONNECT_TIMEOUT_MS : TCP_CONNECT_TIMEOUT_MS;
+                if (!s.pendingWrites.isEmpty() && !connectSocket(s, port, timeoutMillisecond))
+                {
+                    qWarning() << "[GameSender::onSocketStateChanged]" << s.name << "unable to reopen socket!  port not known";
+                    s.pendingWrites.clear();
+                }
+            });
+        }
+        else if (!s.pendingWrites.isEmpty())
+        {
+            qWarning() << "[GameSender::onSocketStateChanged]" << s.name << "unable to connect:" << s.socket.errorString() << ".  dropping" << s.pendingWrites.size() << "bytes";
+            s.pendingWrites.clear();
+        }
+    }
+}
+
+void GameSender::onSocketConnectTimeout(AsyncTcpSocket &s)
+{
+    if (s.socket.state() != QAbstractSocket::ConnectedState && s.socket.state() != QAbstractSocket::UnconnectedState)
+    {
+        qWarning() << "[GameSender::onSocketConnectTimeout]" << s.name << "not connected after" << s.connectTimer.interval() << "ms.  giving up";
+        s.socket.abort();
     }
-    m_tcpSocket.write(data, len);
-    m_tcpSocket.flush();
 }
 
 void GameSender::sendUdpData(char* data, int len, quint16 port)
@@ -86,36 +214,44 @@ void GameSender::sendUdpData(char* data, int len, quint16 port)
     if (port > 0)
     {
         if (!logged) qInfo() << "[GameSender::sendUdpData] sending to udp port" << port;
-        m_udpSocket->writeDatagram(data, len, m_gameAddress, port);
-        m_udpSocket->flush();
+        writeUdpSocket(data, len, port);
     }
     else if (m_tcpPort >= 2300 && m_tcpPort < 2350)
     {
         if (!logged) qWarning() << "[GameSender::sendUdpData] UDP port not known! Going scatter gun from port" << 2350 << "to" << m_tcpPort+50;
         for (quint16 port = 2350; port <= m_tcpPort+50; ++port)
         {
-            m_udpSocket->writeDatagram(data, len, m_gameAddress, port);
-            m_udpSocket->flush();
+            writeUdpSocket(data, len, port);
         }
     }
     else if (m_tcpPort > 0)
     {
         if (!logged) qWarning() << "[GameSender::sendUdpData] no information about udp port assignments available, and weird tcp port.  going tcp+50:" << m_tcpPort + 50;
-        m_udpSocket->writeDatagram(data, len, m_gameAddress, m_tcpPort+50);
-        m_udpSocket->flush();
+        writeUdpSocket(data, len, m_tcpPort+50);
     }
     else
     {
         if (!logged) qWarning() << "[GameSender::sendUdpData] no information about tcp or udp port assignments available!  Going scatter gun from 2350 to 2399";
         for (quint16 port = 2350; port < 2400; ++port)
         {
-            m_udpSocket->writeDatagram(data, len, m_gameAddress, port);
-            m_udpSocket->flush();
+            writeUdpSocket(data, len, port);
         }
     }
     logged = true;
 }
 
+void GameSender::writeUdpSocket(const char* data, int len, quint16 port)
+{
+    PacketCapture& capture = PacketCapture::instance();
+    if (capture.isActive())
+    {
+        capture.record(PacketCapture::SOURCE_GAME_UDP, PacketCapture::DIRECTION_SENT, 0u, 0u,
+            m_udpSocket->localAddress().toIPv4Address(), m_udpSocket->localPort(), m_gameAddress.toIPv4Address(), port, data, len);
+    }
+    m_udpSocket->writeDatagram(data, len, m_gameAddress, port);
+    m_udpSocket->flush();
+}
+
 QSharedPointer<QUdpSocket> GameSender::getUdpSocket()
 {
     return m_udpSocket;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <QtCore/qtimer.h>
 #include <QtNetwork/qtcpsocket.h>
 #include <QtNetwork/qudpsocket.h>
 
@@ -8,8 +9,23 @@ namespace tafnet
 
     class GameSender : public QObject
     {
-        QTcpSocket m_enumSocket;                // game responds to messages on this socket by advertising any hosted sessions
-        QTcpSocket m_tcpSocket;                 // game receives tcp data on this socket, typically dplay session messages during game setup
+        // tcp socket to the game that connects without blocking the event loop (and hence every other peer's forwarding).
+        // anything written while it is still connecting is queued and sent once it connects
+        struct AsyncTcpSocket
+        {
+            const char *name;
+            QTcpSocket socket;
+            QTimer connectTimer;                // abandons a connection attempt that takes too long
+            QByteArray pendingWrites;
+            QByteArray lastWritten;             // for one-shot connections, the last pendingWrites to actually reach the socket
+            bool disconnectWhenWritten;         // for one-shot connections, viz enumeration
+            bool reconnectWhenClosed;           // written to while closing, so connect again once closed
+
+            AsyncTcpSocket(const char *name, bool disconnectWhenWritten);
+        };
+
+        AsyncTcpSocket m_enumSocket;            // game responds to messages on this socket by advertising any hosted sessions
+        AsyncTcpSocket m_tcpSocket;             // game receives tcp data on this socket, typically dplay session messages during game setup
         QSharedPointer<QUdpSocket> m_udpSocket; // shared with GameReceiver. game receives udp data on this socket, typically game data
 
         QHostAddress m_gameAddress;
@@ -24,11 +40,25 @@ namespace tafnet
         virtual void setTcpPort(quint16 port);
         virtual void setUdpPort(quint16 port);
         virtual void setGameAddress(QHostAddress gameAddress);
+
+        // the connecting, queueing and sending all happen later on the event loop.
+        // @return true once a connection to the enum port has taken this request.
+        // until then it is queued (connecting if need be) and the caller should ask again later
         virtual bool enumSessions(const char* data, int len);
+        // @return false if no connection is possible (eg port not yet known)
         virtual bool openTcpSocket(int timeoutMillisecond);
         virtual void sendTcpData(char* data, int len);
+
         virtual void sendUdpData(char* data, int len, quint16 portOverride = 0);
         virtual QSharedPointer<QUdpSocket> getUdpSocket();
+
+    private:
+        void initSocket(AsyncTcpSocket &s);
+        bool connectSocket(AsyncTcpSocket &s, quint16 port, int timeoutMillisecond);
+        void writeSocket(AsyncTcpSocket &s, const char *data, int len, int timeoutMillisecond);
+        void writeUdpSocket(const char *data, int len, quint16 port);
+        void onSocketStateChanged(AsyncTcpSocket &s, QAbstractSocket::SocketState state);
+        void onSocketConnectTimeout(AsyncTcpSocket &s);
     };
 
 }
@@ -0,0 +1,109 @@
+#include "PacketBuffer.h"
+
+#include <cstring>
+#include <stdexcept>
+
+using namespace tafnet;
+
+void PacketBuffer::reset(int size)
+{
+    m_offset = HEADROOM;
+    m_size = 0;
+    resize(size);
+}
+
+void PacketBuffer::resize(int size)
+{
+    if (size < 0)
+    {
+        throw std::runtime_error("[PacketBuffer::resize] negative size");
+    }
+    if (std::size_t(m_offset + size) > m_storage.size())
+    {
+        m_storage.resize(m_offset + size);
+    }
+    m_size = size;
+}
+
+void PacketBuffer::consume(int n)
+{
+    if (n < 0 || n > m_size)
+    {
+        throw std::runtime_error("[PacketBuffer::consume] more than size");
+    }
+    m_offset += n;
+    m_size -= n;
+}
+
+char* PacketBuffer::headroom(int n)
+{
+    if (n < 0 || n > m_offset)
+    {
+        throw std::runtime_error("[PacketBuffer::headroom] more than available headroom");
+    }
+    return data() - n;
+}
+
+PacketBufferPool& PacketBufferPool::instance()
+{
+    static PacketBufferPool pool;
+    return pool;
+}
+
+PacketBufferPool::PacketBufferPool() :
+    m_freeList(new FreeList)
+{ }
+
+PacketBufferPool::FreeList::~FreeList()
+{
+    for (PacketBuffer* buffer : buffers)
+    {
+        delete buffer;
+    }
+}
+
+void PacketBufferPool::Recycler::operator()(PacketBuffer* buffer) const
+{
+    if (buffer->m_storage.size() <= MAX_POOLED_CAPACITY)
+    {
+        QMutexLocker lock(&freeList->mutex);
+        if (freeList->buffers.size() < MAX_FREE_BUFFERS)
+        {
+            freeList->buffers.push_back(buffer);
+            return;
+        }
+    }
+    delete buffer;
+}
+
+PacketBufferPtr PacketBufferPool::acquire(int size)
+{
+    PacketBuffer* buffer = NULL;
+    {
+        QMutexLocker lock(&m_freeList->mutex);
+        if (!m_freeList->buffers.empty())
+        {
+            buffer = m_freeList->buffers.back();
+            m_freeList->buffers.pop_back();
+        }
+    }
+    if (buffer == NULL)
+    {
+        buffer = new PacketBuffer;
+    }
+
+    Recycler recycler = { m_freeList };
+    PacketBufferPtr result(buffer, recycler);
+    buffer->reset(size);
+    return result;
+}
+
+PacketBufferPtr PacketBufferPool::copy(const char* data, int size)
+{
+    PacketBufferPtr result = acquire(size);
+    if (size > 0)
+    {
+        std::memcpy(result->data(), data, size);
+    }
+    return result;
+}
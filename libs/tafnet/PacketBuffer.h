@@ -0,0 +1,76 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <QtCore/qmutex.h>
+#include <QtCore/qsharedpointer.h>
+
+namespace tafnet
+{
+
+    // A packet with some spare bytes in front of it, so that a tafnet header can be written in front of game data
+    // and the two sent together without first copying the game data into a new buffer.
+    // Obtained from PacketBufferPool and returned to it when the last reference is dropped
+    class PacketBuffer
+    {
+    public:
+        static const int HEADROOM = 8;      // at least sizeof(TafnetBufferedHeader)
+
+        char* data() { return m_storage.data() + m_offset; }
+        const char* data() const { return m_storage.data() + m_offset; }
+        int size() const { return m_size; }
+
+        void resize(int size);
+
+        // discard n bytes from front of data, eg a header that has been read.  they become part of the headroom
+        void consume(int n);
+
+        // the n bytes immediately in front of data(), for a header to be written into
+        char* headroom(int n);
+
+    private:
+        friend class PacketBufferPool;
+        void reset(int size);
+
+        std::vector<char> m_storage;
+        int m_offset;
+        int m_size;
+    };
+
+    typedef QSharedPointer<PacketBuffer> PacketBufferPtr;
+
+    class PacketBufferPool
+    {
+    public:
+        // shared by all GameReceivers and TafnetNode
+        static PacketBufferPool& instance();
+
+        // contents of the returned buffer are undefined
+        PacketBufferPtr acquire(int size);
+        PacketBufferPtr copy(const char* data, int size);
+
+    private:
+        static const std::size_t MAX_FREE_BUFFERS = 256u;
+        static const std::size_t MAX_POOLED_CAPACITY = 65536u + PacketBuffer::HEADROOM;    // a bigger buffer isn't kept for reuse
+
+        struct FreeList
+        {
+            QMutex mutex;
+            std::vector<PacketBuffer*> buffers;
+            ~FreeList();
+        };
+
+        // held by each outstanding buffer, so that buffers still referenced when the pool is destroyed are freed safely
+        struct Recycler
+        {
+            std::shared_ptr<FreeList> freeList;
+            void operator()(PacketBuffer* buffer) const;
+        };
+
+        PacketBufferPool();
+
+        std::shared_ptr<FreeList> m_freeList;
+    };
+
+}
@@ -0,0 +1,435 @@
+#include "PacketCapture.h"
+#include "TafnetNode.h"
+
+#include <QtCore/qdebug.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+
+using namespace tafnet;
+
+static const std::uint32_t PCAPNG_SECTION_HEADER_BLOCK = 0x0a0d0d0au;
+static const std::uint32_t PCAPNG_INTERFACE_DESCRIPTION_BLOCK = 0x00000001u;
+static const std::uint32_t PCAPNG_ENHANCED_PACKET_BLOCK = 0x00000006u;
+static const std::uint32_t PCAPNG_BYTE_ORDER_MAGIC = 0x1a2b3c4du;
+static const std::uint16_t PCAPNG_OPT_ENDOFOPT = 0u;
+static const std::uint16_t PCAPNG_OPT_COMMENT = 1u;
+static const std::uint16_t LINKTYPE_IPV4 = 228u;        // raw IPv4 packets, no link layer header
+static const std::size_t IPV4_HEADER_SIZE = 20u;
+static const std::size_t UDP_HEADER_SIZE = 8u;
+static const std::size_t MAX_UDP_PAYLOAD = 65535u - IPV4_HEADER_SIZE - UDP_HEADER_SIZE;
+static const int DRAIN_INTERVAL = 10;                   // milliseconds, that the drain thread sleeps when the ring is empty
+
+static void put8(std::vector<char>& buf, std::uint8_t x)
+{
+    buf.push_back(char(x));
+}
+
+// pcapng fields are in the writer's byte order, as declared by PCAPNG_BYTE_ORDER_MAGIC
+template<typename T>
+static void putNative(std::vector<char>& buf, T x)
+{
+    const char* p = (const char*)&x;
+    buf.insert(buf.end(), p, p + sizeof(x));
+}
+
+// ip and udp headers are in network byte order
+static void putBigEndian16(std::vector<char>& buf, std::uint16_t x)
+{
+    put8(buf, std::uint8_t(x >> 8));
+    put8(buf, std::uint8_t(x));
+}
+
+static void putBigEndian32(std::vector<char>& buf, std::uint32_t x)
+{
+    putBigEndian16(buf, std::uint16_t(x >> 16));
+    putBigEndian16(buf, std::uint16_t(x));
+}
+
+static std::uint16_t getBigEndian16(const char* p)
+{
+    return std::uint16_t((std::uint8_t(p[0]) << 8) | std::uint8_t(p[1]));
+}
+
+static std::uint32_t getBigEndian32(const char* p)
+{
+    return (std::uint32_t(getBigEndian16(p)) << 16) | getBigEndian16(p + 2);
+}
+
+static void padTo32Bits(std::vector<char>& buf)
+{
+    buf.resize((buf.size() + 3u) & ~std::size_t(3u), '\0');
+}
+
+static void writeBlock(std::ofstream& file, std::uint32_t type, const std::vector<char>& body)
+{
+    const std::uint32_t totalLength = std::uint32_t(3u * sizeof(std::uint32_t) + body.size());
+    file.write((const char*)&type, sizeof(type));
+    file.write((const char*)&totalLength, sizeof(totalLength));
+    file.write(body.data(), body.size());
+    file.write((const char*)&totalLength, sizeof(totalLength));
+}
+
+static const char* sourceName(std::uint8_t source)
+{
+    switch (source)
+    {
+    case PacketCapture::SOURCE_TAFNET: return "tafnet";
+    case PacketCapture::SOURCE_GAME_UDP: return "gameudp";
+    case PacketCapture::SOURCE_GAME_TCP: return "gametcp";
+    default: return "unknown";
+    };
+}
+
+PacketCapture& PacketCapture::instance()
+{
+    static PacketCapture capture;
+    return capture;
+}
+
+PacketCapture::PacketCapture() :
+    m_head(0u),
+    m_tail(0u),
+    m_active(false),
+    m_draining(false),
+    m_numDropped(0u)
+{ }
+
+PacketCapture::~PacketCapture()
+{
+    // quietly, since logging may already be gone by the time statics are destroyed
+    if (m_drainThread.joinable())
+    {
+        m_active = false;
+        m_draining = false;
+        m_drainThread.join();
+    }
+}
+
+bool PacketCapture::start(const std::string& fileName)
+{
+    stop();
+    m_file.open(fileName, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!m_file.good())
+    {
+        qWarning() << "[PacketCapture::start] unable to open" << fileName.c_str();
+        m_file.close();
+        return false;
+    }
+
+    std::vector<char> shb;
+    putNative(shb, PCAPNG_BYTE_ORDER_MAGIC);
+    putNative(shb, std::uint16_t(1u));          // major version
+    putNative(shb, std::uint16_t(0u));          // minor version
+    putNative(shb, std::int64_t(-1));           // section length not known
+    writeBlock(m_file, PCAPNG_SECTION_HEADER_BLOCK, shb);
+
+    std::vector<char> idb;
+    putNative(idb, LINKTYPE_IPV4);
+    putNative(idb, std::uint16_t(0u));          // reserved
+    putNative(idb, std::uint32_t(0u));          // no snap length.  timestamps in the default microseconds
+    writeBlock(m_file, PCAPNG_INTERFACE_DESCRIPTION_BLOCK, idb);
+
+    m_ring.resize(RING_SIZE);
+    m_head = 0u;
+    m_tail = 0u;
+    m_numDropped = 0u;
+    m_draining = true;
+    m_drainThread = std::thread([this]() { drain(); });
+    m_active = true;
+    qInfo() << "[PacketCapture::start] capturing to" << fileName.c_str();
+    return true;
+}
+
+void PacketCapture::stop()
+{
+    if (!m_drainThread.joinable())
+    {
+        return;
+    }
+    m_active = false;
+    m_draining = false;
+    m_drainThread.join();
+    m_file.close();
+    qInfo() << "[PacketCapture::stop] stopped." << numDropped() << "datagrams dropped for want of ring space";
+}
+
+void PacketCapture::record(Source source, Direction direction, std::uint32_t playerId, std::uint32_t peerId,
+    std::uint32_t localAddress, std::uint16_t localPort, std::uint32_t remoteAddress, std::uint16_t remotePort,
+    const char* data, int len)
+{
+    if (!isActive() || len < 0)
+    {
+        return;
+    }
+
+    RecordHeader header;
+    header.timestampUs = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    header.playerId = playerId;
+    header.peerId = peerId;
+    header.localAddress = localAddress;
+    header.remoteAddress = remoteAddress;
+    header.localPort = localPort;
+    header.remotePort = remotePort;
+    header.source = std::uint8_t(source);
+    header.direction = std::uint8_t(direction);
+    header.len = std::uint32_t(len);
+
+    const std::uint64_t head = m_head.load(std::memory_order_relaxed);
+    const std::uint64_t tail = m_tail.load(std::memory_order_acquire);
+    const std::uint64_t size = sizeof(header) + header.len;
+    if (size > RING_SIZE - (head - tail))
+    {
+        m_numDropped.fetch_add(1u, std::memory_order_relaxed);
+        return;
+    }
+    ringWrite(head, &header, sizeof(header));
+    ringWrite(head + sizeof(header), data, header.len);
+    m_head.store(head + size, std::memory_order_release);
+}
+
+void PacketCapture::ringWrite(std::uint64_t at, const void* data, std::size_t len)
+{
+    const std::size_t offset = std::size_t(at % RING_SIZE);
+    const std::size_t first = std::min(len, RING_SIZE - offset);
+    if (first > 0u)
+    {
+        std::memcpy(m_ring.data() + offset, data, first);
+    }
+    if (len > first)
+    {
+        std::memcpy(m_ring.data(), (const char*)data + first, len - first);
+    }
+}
+
+void PacketCapture::ringRead(std::uint64_t at, void* data, std::size_t len) const
+{
+    const std::size_t offset = std::size_t(at % RING_SIZE);
+    const std::size_t first = std::min(len, RING_SIZE - offset);
+    if (first > 0u)
+    {
+        std::memcpy(data, m_ring.data() + offset, first);
+    }
+    if (len > first)
+    {
+        std::memcpy((char*)data + first, m_ring.data(), len - first);
+    }
+}
+
+void PacketCapture::drain()
+{
+    std::vector<char> data;
+    for (;;)
+    {
+        // checked before the ring so that everything recorded before stop() is written
+        const bool draining = m_draining.load(std::memory_order_acquire);
+        std::uint64_t tail = m_tail.load(std::memory_order_relaxed);
+        const std::uint64_t head = m_head.load(std::memory_order_acquire);
+        if (tail == head)
+        {
+            if (!draining)
+            {
+                break;
+            }
+            m_file.flush();
+            std::this_thread::sleep_for(std::chrono::milliseconds(DRAIN_INTERVAL));
+            continue;
+        }
+
+        while (tail != head)
+        {
+            RecordHeader header;
+            ringRead(tail, &header, sizeof(header));
+            data.resize(header.len);
+            ringRead(tail + sizeof(header), data.data(), header.len);
+            tail += sizeof(header) + header.len;
+            m_tail.store(tail, std::memory_order_release);
+            writeRecord(header, data);
+        }
+    }
+    m_file.flush();
+}
+
+void PacketCapture::writeRecord(const RecordHeader& header, const std::vector<char>& data)
+{
+    const std::size_t payloadLen = std::min(data.size(), MAX_UDP_PAYLOAD);
+    const bool sent = header.direction == DIRECTION_SENT;
+
+    std::vector<char> packet;
+    packet.reserve(IPV4_HEADER_SIZE + UDP_HEADER_SIZE + payloadLen);
+    put8(packet, 0x45);                                 // version 4, 5 word header
+    put8(packet, 0u);                                   // dscp/ecn
+    putBigEndian16(packet, std::uint16_t(IPV4_HEADER_SIZE + UDP_HEADER_SIZE + payloadLen));
+    putBigEndian16(packet, 0u);                         // identification
+    putBigEndian16(packet, 0x4000);                     // don't fragment
+    put8(packet, 64u);                                  // ttl
+    put8(packet, 17u);                                  // udp
+    putBigEndian16(packet, 0u);                         // checksum, filled in below
+    putBigEndian32(packet, sent ? header.localAddress : header.remoteAddress);
+    putBigEndian32(packet, sent ? header.remoteAddress : header.localAddress);
+    std::uint32_t checksum = 0u;
+    for (std::size_t n = 0u; n < IPV4_HEADER_SIZE; n += 2u)
+    {
+        checksum += getBigEndian16(packet.data() + n);
+    }
+    checksum = (checksum & 0xffffu) + (checksum >> 16);
+    checksum = (checksum & 0xffffu) + (checksum >> 16);
+    packet[10] = char(~checksum >> 8);
+    packet[11] = char(~checksum);
+
+    putBigEndian16(packet, sent ? header.localPort : header.remotePort);
+    putBigEndian16(packet, sent ? header.remotePort : header.localPort);
+    putBigEndian16(packet, std::uint16_t(UDP_HEADER_SIZE + payloadLen));
+    putBigEndian16(packet, 0u);                         // no udp checksum
+    packet.insert(packet.end(), data.begin(), data.begin() + payloadLen);
+
+    char comment[128];
+    int commentLen = std::snprintf(comment, sizeof(comment), "player=%u peer=%u %s %s",
+        unsigned(header.playerId), unsigned(header.peerId), sourceName(header.source), sent ? "sent" : "received");
+    if (header.source == SOURCE_TAFNET && data.size() >= sizeof(TafnetMessageHeader))
+    {
+        const unsigned action = std::uint8_t(data[0]);
+        commentLen += std::snprintf(comment + commentLen, sizeof(comment) - commentLen, " action=%u", action);
+        if (action >= Payload::ACTION_TCP_DATA && data.size() >= sizeof(TafnetBufferedHeader))
+        {
+            TafnetBufferedHeader tafheader;
+            std::memcpy(&tafheader, data.data(), sizeof(tafheader));
+            commentLen += std::snprintf(comment + commentLen, sizeof(comment) - commentLen, " seq=%u", unsigned(tafheader.seq));
+        }
+    }
+
+    std::vector<char> epb;
+    epb.reserve(64u + packet.size() + sizeof(comment));
+    putNative(epb, std::uint32_t(0u));                  // interface
+    putNative(epb, std::uint32_t(std::uint64_t(header.timestampUs) >> 32));
+    putNative(epb, std::uint32_t(std::uint64_t(header.timestampUs)));
+    putNative(epb, std::uint32_t(packet.size()));       // captured length
+    putNative(epb, std::uint32_t(IPV4_HEADER_SIZE + UDP_HEADER_SIZE + data.size()));   // original length
+    epb.insert(epb.end(), packet.begin(), packet.end());
+    padTo32Bits(epb);
+    putNative(epb, PCAPNG_OPT_COMMENT);
+    putNative(epb, std::uint16_t(commentLen));
+    epb.insert(epb.end(), comment, comment + commentLen);
+    padTo32Bits(epb);
+    putNative(epb, PCAPNG_OPT_ENDOFOPT);
+    putNative(epb, std::uint16_t(0u));
+    writeBlock(m_file, PCAPNG_ENHANCED_PACKET_BLOCK, epb);
+}
+
+PacketCaptureReader::PacketCaptureReader(const std::string& fileName) :
+    m_file(fileName, std::ios::in | std::ios::binary)
+{
+    if (!m_file.good())
+    {
+        throw std::runtime_error("[PacketCaptureReader::PacketCaptureReader] unable to open file");
+    }
+}
+
+bool PacketCaptureReader::next(Record& record)
+{
+    for (;;)
+    {
+        std::uint32_t type = 0u, totalLength = 0u;
+        m_file.read((char*)&type, sizeof(type));
+        m_file.read((char*)&totalLength, sizeof(totalLength));
+        if (!m_file.good())
+        {
+            return false;
+        }
+        if (totalLength < 3u * sizeof(std::uint32_t) || totalLength % 4u != 0u)
+        {
+            throw std::runtime_error("[PacketCaptureReader::next] bad block length");
+        }
+        std::vector<char> body(totalLength - 2u * sizeof(std::uint32_t));
+        m_file.read(body.data(), body.size());
+        if (!m_file.good())
+        {
+            return false;   // truncated, eg by a crash while capturing
+        }
+        body.resize(body.size() - sizeof(std::uint32_t));
+
+        if (type == PCAPNG_SECTION_HEADER_BLOCK)
+        {
+            std::uint32_t magic = 0u;
+            std::memcpy(&magic, body.data(), std::min(sizeof(magic), body.size()));
+            if (magic != PCAPNG_BYTE_ORDER_MAGIC)
+            {
+                throw std::runtime_error("[PacketCaptureReader::next] not a pcapng file, or written on a machine of other byte order");
+            }
+            continue;
+        }
+        if (type == PCAPNG_INTERFACE_DESCRIPTION_BLOCK)
+        {
+            std::uint16_t linkType = 0u;
+            std::memcpy(&linkType, body.data(), std::min(sizeof(linkType), body.size()));
+            if (linkType != LINKTYPE_IPV4)
+            {
+                throw std::runtime_error("[PacketCaptureReader::next] not written by PacketCapture");
+            }
+            continue;
+        }
+        if (type != PCAPNG_ENHANCED_PACKET_BLOCK || body.size() < 20u)
+        {
+            continue;
+        }
+
+        std::uint32_t fields[5];    // interface, timestamp high, timestamp low, captured length, original length
+        std::memcpy(fields, body.data(), sizeof(fields));
+        const std::size_t capturedLength = fields[3];
+        const std::size_t optionsAt = 20u + ((capturedLength + 3u) & ~std::size_t(3u));
+        if (optionsAt > body.size() || capturedLength < IPV4_HEADER_SIZE + UDP_HEADER_SIZE)
+        {
+            continue;
+        }
+        const char* packet = body.data() + 20u;
+
+        std::string comment;
+        for (std::size_t at = optionsAt; at + 4u <= body.size();)
+        {
+            std::uint16_t code, len;
+            std::memcpy(&code, body.data() + at, sizeof(code));
+            std::memcpy(&len, body.data() + at + 2u, sizeof(len));
+            at += 4u;
+            if (code == PCAPNG_OPT_ENDOFOPT || at + len > body.size())
+            {
+                break;
+            }
+            if (code == PCAPNG_OPT_COMMENT)
+            {
+                comment.assign(body.data() + at, len);
+            }
+            at += (len + 3u) & ~3u;
+        }
+
+        unsigned playerId = 0u, peerId = 0u;
+        char source[16] = "", direction[16] = "";
+        if (std::sscanf(comment.c_str(), "player=%u peer=%u %15s %15s", &playerId, &peerId, source, direction) != 4)
+        {
+            continue;
+        }
+
+        record.timestampUs = std::int64_t((std::uint64_t(fields[1]) << 32) | fields[2]);
+        record.playerId = playerId;
+        record.peerId = peerId;
+        record.source =
+            std::strcmp(source, "gameudp") == 0 ? PacketCapture::SOURCE_GAME_UDP :
+            std::strcmp(source, "gametcp") == 0 ? PacketCapture::SOURCE_GAME_TCP :
+            PacketCapture::SOURCE_TAFNET;
+        record.direction = std::strcmp(direction, "sent") == 0 ? PacketCapture::DIRECTION_SENT : PacketCapture::DIRECTION_RECEIVED;
+
+        const bool sent = record.direction == PacketCapture::DIRECTION_SENT;
+        const std::uint32_t srcAddress = getBigEndian32(packet + 12);
+        const std::uint32_t dstAddress = getBigEndian32(packet + 16);
+        const std::uint16_t srcPort = getBigEndian16(packet + IPV4_HEADER_SIZE);
+        const std::uint16_t dstPort = getBigEndian16(packet + IPV4_HEADER_SIZE + 2);
+        record.localAddress = sent ? srcAddress : dstAddress;
+        record.localPort = sent ? srcPort : dstPort;
+        record.remoteAddress = sent ? dstAddress : srcAddress;
+        record.remotePort = sent ? dstPort : srcPort;
+        record.data.assign(packet + IPV4_HEADER_SIZE + UDP_HEADER_SIZE, capturedLength - IPV4_HEADER_SIZE - UDP_HEADER_SIZE);
+        return true;
+    }
+}
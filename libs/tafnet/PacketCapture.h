@@ -0,0 +1,116 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace tafnet
+{
+
+    // Writes datagrams sent and received by TafnetNode, GameReceiver and GameSender to a pcapng file, each as an IPv4/UDP packet
+    // between the addresses it actually went between, so that it opens in wireshark with tadissector.lua.
+    // Each packet's comment gives the player and peer tafnet ids, what it was (tafnet or game data) and the tafnet action and seq.
+    //
+    // record() only copies the datagram into a lock-free ring; a background thread drains the ring to file.
+    // If the ring is full the datagram is counted as dropped rather than holding up the caller.
+    // record() must only be called from one thread at a time, which it is since all its callers live on the event loop thread
+    class PacketCapture
+    {
+    public:
+        enum Source
+        {
+            SOURCE_TAFNET = 0,      // between TafnetNodes
+            SOURCE_GAME_UDP = 1,    // between game and GameReceiver/GameSender
+            SOURCE_GAME_TCP = 2
+        };
+
+        enum Direction
+        {
+            DIRECTION_RECEIVED = 0,
+            DIRECTION_SENT = 1
+        };
+
+        static const std::size_t RING_SIZE = 8u * 1024u * 1024u;    // bytes.  a power of two
+
+        // shared by all TafnetNodes, GameReceivers and GameSenders
+        static PacketCapture& instance();
+        ~PacketCapture();
+
+        // @return false if file can't be opened
+        bool start(const std::string& fileName);
+        void stop();
+
+        // cheap enough to check before every datagram
+        bool isActive() const { return m_active.load(std::memory_order_relaxed); }
+
+        // addresses in host byte order, as given by QHostAddress::toIPv4Address()
+        void record(Source source, Direction direction, std::uint32_t playerId, std::uint32_t peerId,
+            std::uint32_t localAddress, std::uint16_t localPort, std::uint32_t remoteAddress, std::uint16_t remotePort,
+            const char* data, int len);
+
+        std::uint64_t numDropped() const { return m_numDropped.load(std::memory_order_relaxed); }
+
+    private:
+        struct RecordHeader
+        {
+            std::int64_t timestampUs;       // since epoch
+            std::uint32_t playerId;
+            std::uint32_t peerId;
+            std::uint32_t localAddress;
+            std::uint32_t remoteAddress;
+            std::uint16_t localPort;
+            std::uint16_t remotePort;
+            std::uint8_t source;
+            std::uint8_t direction;
+            std::uint32_t len;
+        };
+
+        PacketCapture();
+        void ringWrite(std::uint64_t at, const void* data, std::size_t len);
+        void ringRead(std::uint64_t at, void* data, std::size_t len) const;
+        void drain();
+        void writeRecord(const RecordHeader& header, const std::vector<char>& data);
+
+        std::vector<char> m_ring;
+        std::atomic<std::uint64_t> m_head;      // written up to here by record().  ring offsets are these modulo RING_SIZE
+        std::atomic<std::uint64_t> m_tail;      // read up to here by drain()
+        std::atomic<bool> m_active;
+        std::atomic<bool> m_draining;
+        std::atomic<std::uint64_t> m_numDropped;
+        std::thread m_drainThread;
+        std::ofstream m_file;
+    };
+
+    // reads back a file written by PacketCapture
+    class PacketCaptureReader
+    {
+    public:
+        struct Record
+        {
+            std::int64_t timestampUs;
+            std::uint32_t playerId;
+            std::uint32_t peerId;
+            PacketCapture::Source source;
+            PacketCapture::Direction direction;
+            std::uint32_t localAddress;
+            std::uint16_t localPort;
+            std::uint32_t remoteAddress;
+            std::uint16_t remotePort;
+            std::string data;               // udp payload, as sent or received
+        };
+
+        // throws std::runtime_error if file can't be opened or isn't a PacketCapture pcapng
+        PacketCaptureReader(const std::string& fileName);
+
+        // @return false at end of file
+        bool next(Record& record);
+
+    private:
+        std::ifstream m_file;
+    };
+
+}
@@ -26,6 +26,10 @@ static const std::uint16_t GAME_UDP_PORT_PROBE_END = 2360;  // if dplay is tryin
 
 static const uint32_t TICKS_TO_PROTECT_UDP = 300u;  // 10 sec
 
+// our local ports are meaningless to the remote peer.
+// what is important is the playerId that m_localGameTranslater substitutes into the address field
+static const std::uint16_t LOCAL_GAME_REPLY_PORTS[] = { 0xdead, 0xbeef };
+
 GameSender* TafnetGameNode::getGameSender(std::uint32_t remoteTafnetId)
 {
     std::shared_ptr<GameSender>& gameSender = m_gameSenders[remoteTafnetId];
@@ -52,8 +56,29 @@ GameReceiver* TafnetGameNode::getGameReceiver(std::uint32_t remoteTafnetId, QSha
         gameReceiver.reset(m_gameReceiverFactory(udpSocket));
         if (m_remotePlayerIds.count(gameReceiver->getTcpListenPort()) == 0) m_remotePlayerIds[gameReceiver->getTcpListenPort()] = remoteTafnetId;
         if (m_remotePlayerIds.count(gameReceiver->getUdpListenPort()) == 0) m_remotePlayerIds[gameReceiver->getUdpListenPort()] = remoteTafnetId;
-        gameReceiver->setHandler([this](QAbstractSocket* receivingSocket, int channelCode, char* data, int len) {
-            this->handleGameData(receivingSocket, channelCode, data, len);
+
+        // the new peer replies via its own GameReceiver, and is known to the others by it
+        quint16 ports[2];
+        const std::uint32_t bindAddress = gameReceiver->getBindAddress().toIPv4Address();
+        gameReceiver->getListenPorts(ports);
+        GameAddressTranslater& translater = m_remoteGameTranslaters.insert(std::make_pair(remoteTafnetId, GameAddressTranslater(bindAddress, ports))).first->second;
+        for (const auto& it : m_gameReceivers)
+        {
+            if (it.second && it.first != remoteTafnetId)
+            {
+                quint16 otherPorts[2];
+                it.second->getListenPorts(otherPorts);
+                translater.setPlayer(it.first, it.second->getBindAddress().toIPv4Address(), otherPorts);
+            }
+        }
+        for (auto& it : m_remoteGameTranslaters)
+        {
+            it.second.setPlayer(remoteTafnetId, bindAddress, ports);
+        }
+        m_localGameTranslater.setPlayer(remoteTafnetId, bindAddress, ports);
+
+        gameReceiver->setHandler([this](QAbstractSocket* receivingSocket, int channelCode, const PacketBufferPtr& packet) {
+            this->handleGameData(receivingSocket, channelCode, packet);
         });
     }
     return gameReceiver.get();
@@ -71,38 +96,39 @@ void TafnetGameNode::killGameReceiver(std::uint32_t remoteTafnetId)
             m_remotePlayerIds.erase(it->second->getEnumListenPort());
         }
         m_gameReceivers.erase(remoteTafnetId);
+
+        m_remoteGameTranslaters.erase(remoteTafnetId);
+        for (auto& it : m_remoteGameTranslaters)
+        {
+            it.second.removePlayer(remoteTafnetId);
+        }
+        m_localGameTranslater.removePlayer(remoteTafnetId);
     }
 }
 
-void TafnetGameNode::translateMessageFromLocalGame(char* data, int len, std::uint32_t replyAddress, const std::uint16_t replyPorts[])
+void TafnetGameNode::translateMessageFromLocalGame(char* data, int len)
 {
     // message from game will include SP Addresses with locally visible address.
     // We need to translate them into playerIds so the remote Tafnet nodes can
     // substitute them back with their own local address/port for the respective player
-    GameAddressTranslater tx(replyAddress, replyPorts, [this](tapacket::DPAddress& address, int index) {
-        auto itPlayerId = m_remotePlayerIds.find(address.port());
-        if (itPlayerId == m_remotePlayerIds.end())
-        {
-            // NB we haven't validated that this SPA genuinely belongs to local player. we only know that its not in our list of remotes ...
-            // But if its actually an unlisted remote, there are bigger problems preventing this game from proceeding anyway
-            qInfo() << "[TafnetGameNode::translateMessageFromLocalGame] (on local player SPA translate)"
-                << "this.playerid:" << this->m_tafnetNode->getPlayerId()
-                << "address:" << QHostAddress(address.address()).toString()
-                << "index:" << index
-                << "port:" << address.port();
-            updateGameSenderPortsFromSpaPacket(index == 0 ? address.port() : 0, index == 1 ? address.port() : 0);
-            address.address(this->m_tafnetNode->getPlayerId());
-        }
-        else
-        {
-            address.address(itPlayerId->second);
-        }
-        return true;
-    });
-    tx(data, len);
+    if (!m_localGameTranslater(data, len))
+    {
+        qWarning() << "[TafnetGameNode::translateMessageFromLocalGame] playerId" << m_tafnetNode->getPlayerId() << "malformed dplay message from game. len:" << len;
+    }
+    for (const GameAddressTranslater::UnmatchedAddress& address : m_localGameTranslater.unmatched())
+    {
+        // NB we haven't validated that this SPA genuinely belongs to local player. we only know that its not in our list of remotes ...
+        // But if its actually an unlisted remote, there are bigger problems preventing this game from proceeding anyway
+        qInfo() << "[TafnetGameNode::translateMessageFromLocalGame] (on local player SPA translate)"
+            << "this.playerid:" << this->m_tafnetNode->getPlayerId()
+            << "address:" << QHostAddress(address.address).toString()
+            << "index:" << address.index
+            << "port:" << address.port;
+        updateGameSenderPortsFromSpaPacket(address.index == 0 ? address.port : 0, address.index == 1 ? address.port : 0);
+    }
 }
 
-void TafnetGameNode::handleGameData(QAbstractSocket* receivingSocket, int channelCode, char* data, int len)
+void TafnetGameNode::handleGameData(QAbstractSocket* receivingSocket, int channelCode, const PacketBufferPtr& packet)
 {
     taflib::Watchdog wd("TafnetGameNode::handleGameData", 100);
 
@@ -120,11 +146,13 @@ void TafnetGameNode::handleGameData(QAbstractSocket* receivingSocket, int channe
         return;
     }
 
-    if (!data)
+    if (!packet)
     {
         qWarning() << "[TafnetGameNode::handleGameData] playerId" << m_tafnetNode->getPlayerId() << "encountered null data() on port" << receivingSocket->localPort();
         return;
     }
+    char* data = packet->data();
+    const int len = packet->size();
 
     if (len == 0)
     {
@@ -148,7 +176,7 @@ void TafnetGameNode::handleGameData(QAbstractSocket* receivingSocket, int channe
 
         if (m_packetParser)
         {
-            static const std::set<tapacket::SubPacketCode> protectedSubpaks({
+            static const tapacket::SubPacketCodeSet protectedSubpaks({
                 tapacket::SubPacketCode::CHAT_05,
                 tapacket::SubPacketCode::LOADING_STARTED_08,
                 tapacket::SubPacketCode::GIVE_UNIT_14,
@@ -159,65 +187,73 @@ void TafnetGameNode::handleGameData(QAbstractSocket* receivingSocket, int channe
                 tapacket::SubPacketCode::TEAM_24
             });
 
-            std::set<tapacket::SubPacketCode> parsedSubpaks = m_packetParser->parseGameData(true, data, len);
-            std::vector<tapacket::SubPacketCode> parsedProtectedSubpaks;
-            std::set_intersection(
-                parsedSubpaks.begin(), parsedSubpaks.end(),
-                protectedSubpaks.begin(), protectedSubpaks.end(),
-                std::back_inserter(parsedProtectedSubpaks));
-            protect |= parsedProtectedSubpaks.size() > 0u;
+            protect |= m_packetParser->split(true, data, len, m_parsedGameData).intersects(protectedSubpaks);
         }
 
         if (protect)
         {
             // split/reassemble with ack/resend to ensure delivery to remote TafnetNode, but still delivered to game's UDP port
-            m_tafnetNode->forwardGameData(destNodeId, Payload::ACTION_UDP_PROTECTED, data, len);
+            m_tafnetNode->forwardGameData(destNodeId, Payload::ACTION_UDP_PROTECTED, packet);
         }
         else
         {
-            m_tafnetNode->forwardGameData(destNodeId, Payload::ACTION_UDP_DATA, data, len);
+            m_tafnetNode->forwardGameData(destNodeId, Payload::ACTION_UDP_DATA, packet);
+        }
+
+        // handlers only get to see the packet once it's on its way
+        if (m_packetParser)
+        {
+            dispatchGameData();
         }
     }
 
     else if (channelCode == GameReceiver::CHANNEL_TCP)
     {
-        // our local ports are meaningless to the remote peer
-        // what is important is the playerId that translateMessageFromLocalGame substitutes into the address field
-        static const quint16 dummyports[] = { 0xdead, 0xbeef };
-        translateMessageFromLocalGame(data, len, 0, dummyports);
-        m_tafnetNode->forwardGameData(destNodeId, Payload::ACTION_TCP_DATA, data, len);
+        translateMessageFromLocalGame(data, len);
+        m_tafnetNode->forwardGameData(destNodeId, Payload::ACTION_TCP_DATA, packet);
         if (m_packetParser)
         {
-            m_packetParser->parseGameData(true, data, len);
+            m_packetParser->split(true, data, len, m_parsedGameData);
+            dispatchGameData();
         }
     }
 
     else if (channelCode == GameReceiver::CHANNEL_ENUM)
     {
         qInfo() << "[TafnetGameNode::handleGameData] playerId" << m_tafnetNode->getPlayerId() << "forwarding enum session request to" << destNodeId;
-        m_tafnetNode->forwardGameData(destNodeId, Payload::ACTION_ENUM, data, len);
+        m_tafnetNode->forwardGameData(destNodeId, Payload::ACTION_ENUM, packet);
     }
 }
 
-void TafnetGameNode::translateMessageFromRemoteGame(char* data, int len, std::uint32_t replyAddress, const std::uint16_t replyPorts[])
+void TafnetGameNode::setPacketDispatcher(const std::function<void(tapacket::ParsedGameData&)>& dispatcher)
 {
-    GameAddressTranslater tx(replyAddress, replyPorts, [this, replyAddress, replyPorts](tapacket::DPAddress& address, int index) {
-        // messages from Tafnet have player SP addresses substituted with PlayerId. Here we substitute the local GameReceiver's address/port for that player
-        std::uint32_t remotePlayerId = address.address();
-        auto it = this->m_gameReceivers.find(remotePlayerId);
-        if (it != this->m_gameReceivers.end())
-        {
-            address.address(it->second->getBindAddress().toIPv4Address());
-            address.port(index ? it->second->getUdpListenPort() : it->second->getTcpListenPort());
-        }
-        else
-        {
-            address.address(replyAddress);
-            address.port(replyPorts[index > 0]);
-        }
-        return true;
-    });
-    tx(data, len);
+    m_packetDispatcher = dispatcher;
+}
+
+void TafnetGameNode::dispatchGameData()
+{
+    if (m_packetDispatcher)
+    {
+        m_packetDispatcher(m_parsedGameData);
+    }
+    else
+    {
+        m_packetParser->dispatch(m_parsedGameData);
+    }
+}
+
+void TafnetGameNode::translateMessageFromRemoteGame(std::uint32_t peerPlayerId, char* data, int len)
+{
+    // messages from Tafnet have player SP addresses substituted with PlayerId. Here we substitute the local GameReceiver's address/port for that player
+    auto it = m_remoteGameTranslaters.find(peerPlayerId);
+    if (it == m_remoteGameTranslaters.end())
+    {
+        qWarning() << "[TafnetGameNode::translateMessageFromRemoteGame] playerId" << m_tafnetNode->getPlayerId() << "no translater for peer" << peerPlayerId;
+    }
+    else if (!it->second(data, len))
+    {
+        qWarning() << "[TafnetGameNode::translateMessageFromRemoteGame] playerId" << m_tafnetNode->getPlayerId() << "malformed dplay message from peer" << peerPlayerId << "len:" << len;
+    }
 }
 
 void TafnetGameNode::handleTafnetMessage(std::uint8_t action, std::uint32_t peerPlayerId, char* data, int len)
@@ -244,11 +280,12 @@ void TafnetGameNode::handleTafnetMessage(std::uint8_t action, std::uint32_t peer
         break;
 
     case Payload::ACTION_TCP_DATA:
-        translateMessageFromRemoteGame(data, len, gameReceiver->getBindAddress().toIPv4Address(), replyPorts);
+        translateMessageFromRemoteGame(peerPlayerId, data, len);
         gameSender->sendTcpData(data, len);
         if (m_packetParser)
         {
-            m_packetParser->parseGameData(false, data, len);
+            m_packetParser->split(false, data, len, m_parsedGameData);
+            dispatchGameData();
         }
         break;
 
@@ -257,7 +294,8 @@ void TafnetGameNode::handleTafnetMessage(std::uint8_t action, std::uint32_t peer
         gameSender->sendUdpData(data, len);
         if (m_packetParser)
         {
-            m_packetParser->parseGameData(false, data, len);
+            m_packetParser->split(false, data, len, m_parsedGameData);
+            dispatchGameData();
         }
         break;
 
@@ -289,6 +327,7 @@ TafnetGameNode::TafnetGameNode(
     m_gameTcpPort(0),
     m_gameUdpPort(0),
     m_gameAddress(QHostAddress::SpecialAddress::LocalHost),
+    m_localGameTranslater(0u, LOCAL_GAME_REPLY_PORTS, tafnetNode->getPlayerId()),
     m_gameSenderFactory(gameSenderFactory),
     m_gameReceiverFactory(gameReceiverFactory),
     m_initialOccupiedTcpPorts(probeOccupiedTcpPorts(QHostAddress(QHostAddress::SpecialAddress::LocalHost), GAME_TCP_PORT_BEGIN, GAME_TCP_PORT_PROBE_END, 30)),
@@ -597,7 +636,7 @@ void TafnetGameNode::processPendingEnumRequests()
             bool ok = gameSender->enumSessions(datas.constData(), datas.size());
             if (!ok)
             {
-                qInfo() << "[TafnetGameNode::processPendingEnumRequests] enum port no connection ...";
+                qInfo() << "[TafnetGameNode::processPendingEnumRequests] enum request not yet delivered.  pid:" << peerId;
             }
             else
             {
@@ -7,16 +7,13 @@
 #include <queue>
 
 #include "TafnetNode.h"
+#include "GameAddressTranslater.h"
 #include "GameReceiver.h"
 #include "GameSender.h"
+#include "tapacket/TAPacketParser.h"
 
 class QAbstractSocket;
 
-namespace tapacket
-{
-    class TAPacketParser;
-}
-
 namespace tafnet
 {
 
@@ -29,9 +26,13 @@ namespace tafnet
     {
         TafnetNode* m_tafnetNode;
         tapacket::TAPacketParser* m_packetParser;
+        tapacket::ParsedGameData m_parsedGameData;                              // reused for each packet handed to m_packetParser
+        std::function<void(tapacket::ParsedGameData&)> m_packetDispatcher;      // if not set, m_packetParser->dispatch() is called directly
         std::map<std::uint32_t, std::shared_ptr<GameSender> > m_gameSenders;     // keyed by peer tafnet playerId
         std::map<std::uint32_t, std::shared_ptr<GameReceiver> > m_gameReceivers; // keyed by peer tafnet playerId
         std::map<std::uint16_t, std::uint32_t> m_remotePlayerIds;                // tafnet id keyed by gameReceiver's receive socket port (both tcp and udp)
+        GameAddressTranslater m_localGameTranslater;                            // for tcp data from local game
+        std::map<std::uint32_t, GameAddressTranslater> m_remoteGameTranslaters;  // for tcp data from each peer, keyed by peer tafnet playerId
         std::map<std::uint32_t, QByteArray> m_pendingEnumRequests;               // keyed by peer tafnet playerId
         std::queue<std::uint32_t> m_playerInviteOrder;                      // useful only by host instance. controls order that enum requests are passed to game
         QTimer m_pendingEnumRequestsTimer;
@@ -66,6 +67,10 @@ namespace tafnet
         // useful only by host instance, and only if his tdraw.dll supports the share memory interface
         virtual void setPlayerStartPositions(const std::vector<std::string>& orderedPlayerNames);
 
+        // packets are split on the thread that forwards them.  dispatcher is then given them to pass on to m_packetParser->dispatch(), eg on another thread.
+        // dispatcher may swap parsed for an empty or recycled ParsedGameData
+        virtual void setPacketDispatcher(const std::function<void(tapacket::ParsedGameData&)>& dispatcher);
+
     private:
 
         virtual GameSender* getGameSender(std::uint32_t remoteTafnetId);
@@ -73,10 +78,11 @@ namespace tafnet
         virtual void killGameSender(std::uint32_t remoteTafnetId);
         virtual void killGameReceiver(std::uint32_t remoteTafnetId);
 
-        virtual void handleGameData(QAbstractSocket* receivingSocket, int channelCode, char* data, int len);
+        virtual void handleGameData(QAbstractSocket* receivingSocket, int channelCode, const PacketBufferPtr& packet);
+        virtual void dispatchGameData();
         virtual void handleTafnetMessage(std::uint8_t action, std::uint32_t peerPlayerId, char* data, int len);
-        virtual void translateMessageFromRemoteGame(char* data, int len, std::uint32_t replyAddress, const std::uint16_t replyPorts[]);
-        virtual void translateMessageFromLocalGame(char* data, int len, std::uint32_t replyAddress, const std::uint16_t replyPorts[]);
+        virtual void translateMessageFromRemoteGame(std::uint32_t peerPlayerId, char* data, int len);
+        virtual void translateMessageFromLocalGame(char* data, int len);
         virtual void updateGameSenderPortsFromDplayHeader(const char *data, int len);
         virtual void updateGameSenderPortsFromSpaPacket(quint16 tcp, quint16 udp);
 
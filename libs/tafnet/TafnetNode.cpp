@@ -1,10 +1,17 @@
 #include "TafnetNode.h"
+#include "PacketCapture.h"
 #include "taflib/Watchdog.h"
 
 #include <QtNetwork/qtcpsocket.h>
 #include <QtCore/qdatetime.h>
+#include <QtCore/qdir.h>
+#include <QtCore/qfile.h>
+#include <QtCore/qfileinfo.h>
+#include <QtCore/qstringlist.h>
+#include <QtCore/qtextstream.h>
 
 #include <cstring>
+#include <random>
 
 #ifdef _DEBUG
 #include <tademo/HexDump.h>
@@ -22,6 +29,23 @@ std::uniform_int_distribution<int> distribution(0, 99);
 
 using namespace tafnet;
 
+static_assert(sizeof(TafnetBufferedHeader) <= PacketBuffer::HEADROOM, "PacketBuffer::HEADROOM too small for a tafnet header");
+static_assert(sizeof(TafnetMessageHeader) <= PacketBuffer::HEADROOM, "PacketBuffer::HEADROOM too small for a tafnet header");
+
+static const char HELLO[] = "HELLO";
+static const int HELLO_SIZE = 5;    // followed by our session token
+
+static std::uint64_t newSessionToken()
+{
+    std::random_device rd;
+    std::uint64_t token = 0u;
+    while (token == 0u)
+    {
+        token = std::uint64_t(rd()) << 32 | rd();
+    }
+    return token;
+}
+
 Payload::Payload():
 action(ACTION_INVALID),
 timestamp(0)
@@ -38,7 +62,7 @@ void Payload::set(std::uint8_t _action, const char *data, int len)
         qWarning() << "[Payload::set] attempt to set zero sized payload!";
     }
     action = _action;
-    buf.reset(new QByteArray(data, len));
+    buf = PacketBufferPool::instance().copy(data, len);
     timestamp = QDateTime::currentMSecsSinceEpoch();
     if (!buf)
     {
@@ -46,6 +70,17 @@ void Payload::set(std::uint8_t _action, const char *data, int len)
     }
 }
 
+void Payload::set(std::uint8_t _action, const PacketBufferPtr &packet)
+{
+    if (!packet)
+    {
+        qWarning() << "[Payload::set] attempt to set null payload!";
+    }
+    action = _action;
+    buf = packet;
+    timestamp = QDateTime::currentMSecsSinceEpoch();
+}
+
 DataBuffer::DataBuffer() :
 m_nextPopSeq(1u),
 m_nextPushSeq(1u)
@@ -66,12 +101,26 @@ void DataBuffer::insert(std::uint32_t seq, std::uint8_t action, const char *data
     }
 }
 
+void DataBuffer::insert(std::uint32_t seq, std::uint8_t action, const PacketBufferPtr &packet)
+{
+    if (seq >= m_nextPopSeq)
+    {
+        m_data[seq].set(action, packet);
+    }
+}
+
 std::uint32_t DataBuffer::push_back(std::uint8_t action, const char *data, int len)
 {
     m_data[m_nextPushSeq].set(action, data, len);
     return m_nextPushSeq++;
 }
 
+std::uint32_t DataBuffer::push_back(std::uint8_t action, const PacketBufferPtr &packet)
+{
+    m_data[m_nextPushSeq].set(action, packet);
+    return m_nextPushSeq++;
+}
+
 Payload DataBuffer::pop()
 {
     Payload result;
@@ -218,14 +267,40 @@ ipv4addr(addr.toIPv4Address()),
 port(port)
 { }
 
-bool TafnetNode::HostAndPort::operator< (const HostAndPort& other) const
+bool TafnetNode::HostAndPort::operator== (const HostAndPort& other) const
+{
+    return ipv4addr == other.ipv4addr && port == other.port;
+}
+
+std::size_t TafnetNode::HostAndPort::Hash::operator()(const HostAndPort& hostAndPort) const
 {
-    return (port < other.port) || (port == other.port) && (ipv4addr < other.ipv4addr);
+    return std::hash<std::uint64_t>()(std::uint64_t(hostAndPort.ipv4addr) << 16 | hostAndPort.port);
 }
 
+TafnetNode::PacksizeSearch::PacksizeSearch() :
+    low(MAX_PACKET_SIZE_LOWER_LIMIT),
+    high(MAX_PACKET_SIZE_LOWER_LIMIT + 1u),
+    retrying(false),
+    timestampRoundStart(0),
+    timestampLastSearch(0)
+{ }
+
+TafnetNode::Peer::Peer() :
+    playerId(0u),
+    resendRequestEnabled(true),
+    sessionToken(0u),
+    timestampAwaitingIdentify(0)
+{ }
+
+TafnetNode::UnknownAddress::UnknownAddress() :
+    timestampFirstDatagram(0),
+    timestampLastQuery(0)
+{ }
+
 TafnetNode::TafnetNode(std::uint32_t playerId, bool isHost, QHostAddress bindAddress, quint16 bindPort, bool proactiveResend, std::uint32_t maxPacketSize) :
     m_playerId(playerId),
     m_hostPlayerId(isHost ? playerId : 0u),
+    m_sessionToken(newSessionToken()),
     m_maxPacketSize(maxPacketSize),
     m_proactiveResendEnabled(proactiveResend)
 {
@@ -257,17 +332,30 @@ void TafnetNode::onResendTimer()
     try
     {
         taflib::Watchdog wd("TafnetNode::onResendTimer", 100);
-        for (auto &pairPlayer : m_sendBuffer)
+        for (auto &pairPlayer : m_peers)
         {
             std::uint32_t peerPlayerId = pairPlayer.first;
-            ResendRate& stats = m_resendRates[peerPlayerId];
-            DataBuffer &sendBuffer = pairPlayer.second;
+            ResendRate& stats = pairPlayer.second.resendRate;
+            DataBuffer &sendBuffer = pairPlayer.second.sendBuffer;
             int expectedPing = stats.getSuccessfulPingTime();
             int timeout = expectedPing > 0 ? 11 * expectedPing / 10 + RESEND_TIMEOUT_MARGIN : INITIAL_RESEND_TIMEOUT;
             timeout = std::min(MAX_RESEND_TIMEOUT, timeout);
 
             int maxResendAtOnce = MAX_RESEND_AT_ONCE;
             qint64 tNow = QDateTime::currentMSecsSinceEpoch();
+            if (pairPlayer.second.timestampAwaitingIdentify > 0 && tNow >= pairPlayer.second.timestampAwaitingIdentify + timeout)
+            {
+                pairPlayer.second.timestampAwaitingIdentify = tNow;
+                sendIdentify(peerPlayerId, true);
+            }
+
+            PacksizeSearch &search = pairPlayer.second.packsizeSearch;
+            if (search.timestampRoundStart > 0 && tNow >= search.timestampRoundStart + timeout)
+            {
+                onPacksizeProbeTimeout(pairPlayer.second);
+            }
+
+            bool reprobe = false;
             for (auto &pairPayload : sendBuffer.getAll())
             {
                 std::uint32_t seq = pairPayload.first;
@@ -279,7 +367,10 @@ void TafnetNode::onResendTimer()
                 if (data.buf)
                 {
                     int nRepeats = stats.getResendRate(true);
-                    sendMessage(peerPlayerId, data.action, seq, data.buf->data(), data.buf->size(), nRepeats);
+                    sendMessage(peerPlayerId, data.action, seq, data.buf, nRepeats);
+
+                    // heavy loss of packets bigger than the minimum may mean the path's max packet size has dropped
+                    reprobe |= nRepeats >= PACKSIZE_REPROBE_RESEND_RATE && unsigned(data.buf->size()) > MAX_PACKET_SIZE_LOWER_LIMIT;
                 }
                 if (seq > stats.lastTimeoutSeq)
                 {
@@ -291,6 +382,27 @@ void TafnetNode::onResendTimer()
                     break;
                 }
             }
+
+            if (reprobe && search.timestampRoundStart == 0 && tNow >= search.timestampLastSearch + PACKSIZE_REPROBE_HOLD_OFF_TIME)
+            {
+                qInfo() << "[TafnetNode::onResendTimer] high packet loss to player" << peerPlayerId << ". searching again for max packet size";
+                sendPacksizeTests(peerPlayerId);
+            }
+        }
+
+        const qint64 tNow = QDateTime::currentMSecsSinceEpoch();
+        for (auto it = m_unknownAddresses.begin(); it != m_unknownAddresses.end(); )
+        {
+            if (tNow >= it->second.timestampFirstDatagram + UNKNOWN_ADDRESS_HOLD_TIME)
+            {
+                qInfo() << "[TafnetNode::onResendTimer] ERROR no peer claimed" << it->second.datagrams.size() << "unexpected messages from"
+                    << QHostAddress(it->first.ipv4addr).toString() << ":" << it->first.port;
+                it = m_unknownAddresses.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
         }
     }
     catch (std::exception &e)
@@ -308,9 +420,9 @@ void TafnetNode::onResendReqReenableTimer()
     try
     {
         taflib::Watchdog wd("TafnetNode::onResendReqReenableTimer", 100);
-        for (auto &pair : m_resendRequestEnabled)
+        for (auto &pair : m_peers)
         {
-            pair.second.value = true;
+            pair.second.resendRequestEnabled = true;
         }
     }
     catch (std::exception &e)
@@ -333,198 +445,461 @@ void TafnetNode::onReadyRead()
         while (sender->hasPendingDatagrams())
         {
             taflib::Watchdog wd("TafnetNode::onReadyRead while hasPendingDatagrams()", 100);
-            QByteArray datas;
-            datas.resize(sender->pendingDatagramSize());
+            // read into a pooled buffer which, if it carries buffered data, is kept as is in the receive buffer
+            PacketBufferPtr datas = PacketBufferPool::instance().acquire(int(std::max(qint64(0), sender->pendingDatagramSize())));
             QHostAddress senderAddress;
             quint16 senderPort;
-            sender->readDatagram(datas.data(), datas.size(), &senderAddress, &senderPort);
-            HostAndPort senderHostAndPort(senderAddress, senderPort);
-            if (datas.size() < sizeof(TafnetMessageHeader))
-            {
-                continue;
-            }
+            datas->resize(int(std::max(qint64(0), sender->readDatagram(datas->data(), datas->size(), &senderAddress, &senderPort))));
 
 #ifdef SIM_PACKET_TRUNCATE
-            datas.resize(std::min(datas.size(), SIM_PACKET_TRUNCATE));
+            datas->resize(std::min(datas->size(), SIM_PACKET_TRUNCATE));
 #endif
 
 #ifdef SIM_PACKET_ERROR_LARGER_THAN
-            if (datas.size() > SIM_PACKET_ERROR_LARGER_THAN)
+            if (datas->size() > SIM_PACKET_ERROR_LARGER_THAN)
             {
-                *datas.rbegin() ^= 0xff;
+                datas->data()[datas->size() - 1] ^= 0xff;
             }
 #endif
 
-            const TafnetMessageHeader* tafheader = (TafnetMessageHeader*)datas.data();
-            const TafnetBufferedHeader* tafBufferedHeader = (TafnetBufferedHeader*)datas.data();
+            const HostAndPort hostAndPort(senderAddress, senderPort);
+            PacketCapture& capture = PacketCapture::instance();
+            if (capture.isActive())
+            {
+                auto it = m_peersByAddress.find(hostAndPort);
+                capture.record(PacketCapture::SOURCE_TAFNET, PacketCapture::DIRECTION_RECEIVED, m_playerId, it == m_peersByAddress.end() ? 0u : it->second->playerId,
+                    m_lobbySocket.localAddress().toIPv4Address(), m_lobbySocket.localPort(), hostAndPort.ipv4addr, hostAndPort.port, datas->data(), datas->size());
+            }
+            handleDatagram(hostAndPort, datas);
+        }
+    }
+    catch (std::exception &e)
+    {
+        qWarning() << "[TafnetNode::onReadyRead] exception" << e.what();
+    }
+    catch (...)
+    {
+        qWarning() << "[TafnetNode::onReadyRead] unknown exception";
+    }
+}
 
-            std::uint32_t peerPlayerId = 0;//tafheader->senderId;
+void TafnetNode::handleDatagram(const HostAndPort& sender, const PacketBufferPtr& datas)
+{
+    if (datas->size() < int(sizeof(TafnetMessageHeader)))
+    {
+        return;
+    }
 
-            // we prefer to use m_peerPlayerIds to lookup sender's playerId
-            // but for some reason readDatagram doesn't set senderAddress and senderPort when run on linux using wine ...
-            // seems ok for native linux tho
-            if (true) {
-                auto it = m_peerPlayerIds.find(senderHostAndPort);
-                if (it == m_peerPlayerIds.end())
-                {
-                    qInfo() << "[TafnetNode::onReadyRead] ERROR unexpected message from" << senderAddress.toString() << ":" << senderPort;
-                    continue;
-                }
-                peerPlayerId = it->second;
-            }
+    // we identify the peer by sender's address.
+    // (for some reason readDatagram doesn't set senderAddress and senderPort when run on linux using wine ...
+    // seems ok for native linux tho)
+    auto it = m_peersByAddress.find(sender);
+    if (it == m_peersByAddress.end())
+    {
+        onUnknownAddress(sender, datas);
+        return;
+    }
 
-            DataBuffer &tcpReceiveBuffer = m_receiveBuffer[peerPlayerId];
-            DataBuffer &tcpSendBuffer = m_sendBuffer[peerPlayerId];
-            bool &resendRequestEnabled = m_resendRequestEnabled[peerPlayerId].value;
+    const TafnetMessageHeader* tafheader = (const TafnetMessageHeader*)datas->data();
+    if (tafheader->action >= Payload::ACTION_TCP_DATA && datas->size() < int(sizeof(TafnetBufferedHeader)))
+    {
+        qWarning() << "[TafnetNode::onReadyRead] peer" << it->second->playerId << "action" << tafheader->action << "datagram too short for its header. size=" << datas->size();
+        return;
+    }
+    (this->*datagramHandlers()[tafheader->action])(*it->second, datas);
+}
 
-            if (tafBufferedHeader->action == Payload::ACTION_TCP_ACK)
+const std::array<TafnetNode::DatagramHandler, 256>& TafnetNode::datagramHandlers()
+{
+    struct Handlers
+    {
+        std::array<DatagramHandler, 256> byAction;
+        Handlers()
+        {
+            for (unsigned action = 0u; action < byAction.size(); ++action)
             {
-                taflib::Watchdog wd("TafnetNode::onReadyRead TCP_ACK", 100);
-                if (tcpSendBuffer.ackData(tafBufferedHeader->seq))
-                {
-                    m_resendRates[peerPlayerId].ackCount++;
-                }
+                // all but a few of the buffered actions carry data that requires ACK
+                byAction[action] = action >= Payload::ACTION_TCP_DATA ? &TafnetNode::onBufferedData : &TafnetNode::onUnbufferedData;
             }
+            byAction[Payload::ACTION_TCP_ACK] = &TafnetNode::onTcpAck;
+            byAction[Payload::ACTION_TCP_RESEND] = &TafnetNode::onTcpResend;
+            byAction[Payload::ACTION_PACKSIZE_TEST] = &TafnetNode::onPacksizeTest;
+            byAction[Payload::ACTION_PACKSIZE_ACK] = &TafnetNode::onPacksizeAck;
+            byAction[Payload::ACTION_IDENTIFY] = &TafnetNode::onIdentify;
+        }
+    };
+    static const Handlers handlers;
+    return handlers.byAction;
+}
 
-            else if (tafBufferedHeader->action == Payload::ACTION_TCP_RESEND)
-            {
-                taflib::Watchdog wd("TafnetNode::onReadyRead TCP_RESEND", 100);
-                std::uint32_t seq = tafBufferedHeader->seq;
-                Payload data = tcpSendBuffer.get(seq);
-                if (data.buf)
-                {
-                    taflib::Watchdog wd("TafnetNode::onReadyRead TCP_RESEND data.buf", 100);
-                    ResendRate &stats = m_resendRates[peerPlayerId];
-                    int nRepeats = stats.getResendRate(true);
-                    if (seq > stats.lastResendReqSeq)
-                    {
-                        qInfo() << "[TafnetNode::onReadyRead] peer" << peerPlayerId << "requested resend packet" << seq << "resendrate=" << nRepeats;
-                        stats.lastResendReqSeq = seq;
-                    }
-                    sendMessage(peerPlayerId, data.action, seq, data.buf->data(), data.buf->size(), nRepeats);
-                }
-                else
-                {
-                    qWarning() << "[TafnetNode::onReadyRead] no payload found for seq number" << seq;
-                }
-            }
+void TafnetNode::onTcpAck(Peer& peer, const PacketBufferPtr& datas)
+{
+    taflib::Watchdog wd("TafnetNode::onReadyRead TCP_ACK", 100);
+    const TafnetBufferedHeader* tafBufferedHeader = (const TafnetBufferedHeader*)datas->data();
+    if (peer.sendBuffer.ackData(tafBufferedHeader->seq))
+    {
+        peer.resendRate.ackCount++;
+    }
+}
 
-            else if (tafBufferedHeader->action == Payload::ACTION_PACKSIZE_TEST)
+void TafnetNode::onTcpResend(Peer& peer, const PacketBufferPtr& datas)
+{
+    taflib::Watchdog wd("TafnetNode::onReadyRead TCP_RESEND", 100);
+    const TafnetBufferedHeader* tafBufferedHeader = (const TafnetBufferedHeader*)datas->data();
+    std::uint32_t seq = tafBufferedHeader->seq;
+    Payload data = peer.sendBuffer.get(seq);
+    if (data.buf)
+    {
+        taflib::Watchdog wd("TafnetNode::onReadyRead TCP_RESEND data.buf", 100);
+        ResendRate &stats = peer.resendRate;
+        int nRepeats = stats.getResendRate(true);
+        if (seq > stats.lastResendReqSeq)
+        {
+            qInfo() << "[TafnetNode::onReadyRead] peer" << peer.playerId << "requested resend packet" << seq << "resendrate=" << nRepeats;
+            stats.lastResendReqSeq = seq;
+        }
+        sendMessage(peer.playerId, data.action, seq, data.buf, nRepeats);
+    }
+    else
+    {
+        qWarning() << "[TafnetNode::onReadyRead] no payload found for seq number" << seq;
+    }
+}
+
+void TafnetNode::onPacksizeTest(Peer& peer, const PacketBufferPtr& datas)
+{
+    const TafnetBufferedHeader* tafBufferedHeader = (const TafnetBufferedHeader*)datas->data();
+    const std::uint32_t peerPlayerId = peer.playerId;
+    std::uint32_t testPacketSize = tafBufferedHeader->seq;
+    if (datas->size() == testPacketSize + sizeof(TafnetBufferedHeader))
+    {
+        taflib::Watchdog wd("TafnetNode::onReadyRead PACKSIZE_TEST", 100);
+        const std::uint32_t *testPacketCrc = (std::uint32_t*)(tafBufferedHeader + 1);
+        const unsigned char *testPacketData = (const unsigned char*)(testPacketCrc + 1);
+        const std::uint32_t crc = m_crc32.FullCRC(testPacketData, testPacketSize - sizeof(std::uint32_t));
+        if (crc == *testPacketCrc)
+        {
+            taflib::Watchdog wd("TafnetNode::onReadyRead PACKSIZE_TEST send", 100);
+            if (testPacketSize <= m_maxPacketSize)
             {
-                std::uint32_t testPacketSize = tafBufferedHeader->seq;
-                if (datas.size() == testPacketSize + sizeof(TafnetBufferedHeader))
-                {
-                    taflib::Watchdog wd("TafnetNode::onReadyRead PACKSIZE_TEST", 100);
-                    const std::uint32_t *testPacketCrc = (std::uint32_t*)(tafBufferedHeader + 1);
-                    const unsigned char *testPacketData = (const unsigned char*)(testPacketCrc + 1);
-                    const std::uint32_t crc = m_crc32.FullCRC(testPacketData, testPacketSize - sizeof(std::uint32_t));
-                    if (crc == *testPacketCrc)
-                    {
-                        taflib::Watchdog wd("TafnetNode::onReadyRead PACKSIZE_TEST send", 100);
-                        if (testPacketSize <= m_maxPacketSize)
-                        {
-                            if (testPacketSize > PING_PACKET_SIZE)
-                            {
-                                qInfo() << "[TafnetNode::onReadyRead] ACTION_PACKSIZE_TEST peer=" << peerPlayerId << "packsize = " << testPacketSize;
-                            }
-                            sendMessage(peerPlayerId, Payload::ACTION_PACKSIZE_ACK, tafBufferedHeader->seq, "", 0, 1);
-                        }
-                        else
-                        {
-                            qInfo() << "[TafnetNode::onReadyRead] ACTION_PACKSIZE_TEST peer=" << peerPlayerId << "packsize = " << testPacketSize << " exceeds our maxPacketSize. quietly ignoring ...";
-                        }
-                    }
-                    else
-                    {
-                        qWarning() << "[TafnetNode::onReadyRead] ACTION_PACKSIZE_TEST peer=" << peerPlayerId << "packsize = " << testPacketSize << "crc error";
-                    }
-                }
-                else
+                if (testPacketSize > PING_PACKET_SIZE)
                 {
-                    qWarning() << "[TafnetNode::onReadyRead] ACTION_PACKSIZE_TEST peer=" << peerPlayerId << "packsize=" << testPacketSize << "mismatch. received=" << datas.size();
+                    qInfo() << "[TafnetNode::onReadyRead] ACTION_PACKSIZE_TEST peer=" << peerPlayerId << "packsize = " << testPacketSize;
                 }
+                sendMessage(peerPlayerId, Payload::ACTION_PACKSIZE_ACK, tafBufferedHeader->seq, "", 0, 1);
             }
-
-            else if (tafBufferedHeader->action == Payload::ACTION_PACKSIZE_ACK)
+            else
             {
-                taflib::Watchdog wd("TafnetNode::onReadyRead PACKSIZE_ACK", 100);
-                ResendRate& stats = m_resendRates[peerPlayerId];
-                stats.registerAck();
-                std::uint32_t ackedPacketSize = tafBufferedHeader->seq;
-                if (ackedPacketSize > stats.maxPacketSize)
-                {
-                    qInfo() << "[TafnetNode::onReadyRead] ACTION_PACKSIZE_ACK peer=" << peerPlayerId << "packsize=" << ackedPacketSize << "setting new maximum";
-                    stats.maxPacketSize = ackedPacketSize;
-                }
+                qInfo() << "[TafnetNode::onReadyRead] ACTION_PACKSIZE_TEST peer=" << peerPlayerId << "packsize = " << testPacketSize << " exceeds our maxPacketSize. quietly ignoring ...";
             }
+        }
+        else
+        {
+            qWarning() << "[TafnetNode::onReadyRead] ACTION_PACKSIZE_TEST peer=" << peerPlayerId << "packsize = " << testPacketSize << "crc error";
+        }
+    }
+    else
+    {
+        qWarning() << "[TafnetNode::onReadyRead] ACTION_PACKSIZE_TEST peer=" << peerPlayerId << "packsize=" << testPacketSize << "mismatch. received=" << datas->size();
+    }
+}
 
-            else if (tafBufferedHeader->action >= Payload::ACTION_TCP_DATA)
-            {
-                // received data that requires ACK
-                taflib::Watchdog wd("TafnetNode::onReadyRead >=TCP_DATA", 100);
-                tcpReceiveBuffer.insert(
-                    tafBufferedHeader->seq, tafBufferedHeader->action,
-                    datas.data() + sizeof(TafnetBufferedHeader), datas.size() - sizeof(TafnetBufferedHeader));
+void TafnetNode::onPacksizeAck(Peer& peer, const PacketBufferPtr& datas)
+{
+    taflib::Watchdog wd("TafnetNode::onReadyRead PACKSIZE_ACK", 100);
+    const TafnetBufferedHeader* tafBufferedHeader = (const TafnetBufferedHeader*)datas->data();
+    ResendRate& stats = peer.resendRate;
+    stats.registerAck();
+    std::uint32_t ackedPacketSize = tafBufferedHeader->seq;
+    if (ackedPacketSize > stats.maxPacketSize && ackedPacketSize <= m_maxPacketSize)
+    {
+        qInfo() << "[TafnetNode::onReadyRead] ACTION_PACKSIZE_ACK peer=" << peer.playerId << "packsize=" << ackedPacketSize << "setting new maximum";
+        stats.maxPacketSize = ackedPacketSize;
+    }
+
+    PacksizeSearch &search = peer.packsizeSearch;
+    if (search.timestampRoundStart > 0 && search.outstanding.erase(ackedPacketSize) > 0u)
+    {
+        search.low = std::max(search.low, ackedPacketSize);
+        if (search.outstanding.empty() || *search.outstanding.rbegin() <= search.low)
+        {
+            // nothing bigger left to hear about this round
+            search.outstanding.clear();
+            sendPacksizeProbes(peer, 0u);
+        }
+    }
+}
 
-                int nRepeats = m_resendRates[peerPlayerId].getResendRate(false);
-                sendMessage(peerPlayerId, Payload::ACTION_TCP_ACK, tafBufferedHeader->seq, "", 0, nRepeats);
+void TafnetNode::onBufferedData(Peer& peer, const PacketBufferPtr& datas)
+{
+    // received data that requires ACK
+    taflib::Watchdog wd("TafnetNode::onReadyRead >=TCP_DATA", 100);
+    const std::uint32_t peerPlayerId = peer.playerId;
+    DataBuffer &tcpReceiveBuffer = peer.receiveBuffer;
+    const TafnetBufferedHeader* tafBufferedHeader = (const TafnetBufferedHeader*)datas->data();
+    const std::uint8_t receivedAction = tafBufferedHeader->action;
+    const std::uint32_t receivedSeq = tafBufferedHeader->seq;
+    datas->consume(sizeof(TafnetBufferedHeader));
+    tcpReceiveBuffer.insert(receivedSeq, receivedAction, datas);
+
+    int nRepeats = peer.resendRate.getResendRate(false);
+    sendMessage(peerPlayerId, Payload::ACTION_TCP_ACK, receivedSeq, "", 0, nRepeats);
+
+    QByteArray &reassemblyBuffer = peer.reassemblyBuffer;
+    while (tcpReceiveBuffer.readyRead())
+    {
+        taflib::Watchdog wd("TafnetNode::onReadyRead >=TCP_DATA while tcpReceiveBuffer", 100);
+        peer.resendRequestEnabled = true;    // is also reenabled on a timer
+        // clear receive buffer and acknowledge receipt
+        Payload data = tcpReceiveBuffer.pop();
+        if (data.action != Payload::ACTION_MORE && reassemblyBuffer.isEmpty())
+        {
+            // unfragmented, so handled straight from the buffer it was received into
+            taflib::Watchdog wd("TafnetNode::onReadyRead >=TCP_DATA handleMessage", 100);
+            handleMessage(data.action, peerPlayerId, data.buf->data(), data.buf->size());
+            continue;
+        }
+        reassemblyBuffer.append(data.buf->data(), data.buf->size());
+        if (data.action != Payload::ACTION_MORE)
+        {
+            taflib::Watchdog wd("TafnetNode::onReadyRead >=TCP_DATA handleMessage", 100);
+            handleMessage(data.action, peerPlayerId, reassemblyBuffer.data(), reassemblyBuffer.size());
+            reassemblyBuffer.clear();
+        }
+    }
 
-                QByteArray &reassemblyBuffer = m_reassemblyBuffer[peerPlayerId];
-                while (tcpReceiveBuffer.readyRead())
-                {
-                    taflib::Watchdog wd("TafnetNode::onReadyRead >=TCP_DATA while tcpReceiveBuffer", 100);
-                    resendRequestEnabled = true;    // is also reenabled on a timer
-                    // clear receive buffer and acknowledge receipt
-                    std::uint32_t seq = tcpReceiveBuffer.nextExpectedPopSeq();
-                    Payload data = tcpReceiveBuffer.pop();
-                    reassemblyBuffer += *data.buf;
-                    if (data.action != Payload::ACTION_MORE)
-                    {
-                        taflib::Watchdog wd("TafnetNode::onReadyRead >=TCP_DATA handleMessage", 100);
-                        handleMessage(data.action, peerPlayerId, reassemblyBuffer.data(), reassemblyBuffer.size());
-                        reassemblyBuffer.clear();
-                    }
-                }
+    if (!tcpReceiveBuffer.empty() && peer.resendRequestEnabled)
+    {
+        taflib::Watchdog wd("TafnetNode::onReadyRead >=TCP_DATA !tcpReceiveBuffer.empty", 100);
+        peer.resendRequestEnabled = false;    // is also reenabled on a timer
+        int remainingMaxResend = 10;
+        for (std::uint32_t seq = tcpReceiveBuffer.nextExpectedPopSeq();
+            seq < tcpReceiveBuffer.earliestAvailable() && remainingMaxResend > 0;
+            ++seq, --remainingMaxResend)
+        {
+            qInfo() << "[TafnetNode::onReadyRead] req resend packet" << seq << "from peer" << peerPlayerId;
+            sendMessage(peerPlayerId, Payload::ACTION_TCP_RESEND, seq, "", 0, nRepeats);
+        }
+    }
+}
 
-                if (!tcpReceiveBuffer.empty() && resendRequestEnabled)
-                {
-                    taflib::Watchdog wd("TafnetNode::onReadyRead >=TCP_DATA !tcpReceiveBuffer.empty", 100);
-                    resendRequestEnabled = false;    // is also reenabled on a timer
-                    int remainingMaxResend = 10;
-                    for (std::uint32_t seq = tcpReceiveBuffer.nextExpectedPopSeq();
-                        seq < tcpReceiveBuffer.earliestAvailable() && remainingMaxResend > 0;
-                        ++seq, --remainingMaxResend)
-                    {
-                        qInfo() << "[TafnetNode::onReadyRead] req resend packet" << seq << "from peer" << peerPlayerId;
-                        sendMessage(peerPlayerId, Payload::ACTION_TCP_RESEND, seq, "", 0, nRepeats);
-                    }
-                }
-            }
+void TafnetNode::onUnbufferedData(Peer& peer, const PacketBufferPtr& datas)
+{
+    // received data not requiring ACK
+    taflib::Watchdog wd("TafnetNode::onReadyRead other data", 100);
+    if (!m_udpDuplicateDetection.isLikelyDuplicate(peer.playerId, 0, datas->data(), datas->size()))
+    {
+        taflib::Watchdog wd("TafnetNode::onReadyRead other data not duplicate", 100);
+        const TafnetMessageHeader* tafheader = (const TafnetMessageHeader*)datas->data();
+        handleMessage(tafheader->action, peer.playerId, datas->data() + sizeof(TafnetMessageHeader), datas->size() - sizeof(TafnetMessageHeader));
+    }
+}
 
-            else
-            {
-                // received data not requiring ACK
-                taflib::Watchdog wd("TafnetNode::onReadyRead other data", 100);
-                if (!m_udpDuplicateDetection.isLikelyDuplicate(peerPlayerId, 0, datas.data(), datas.size()))
-                {
-                    taflib::Watchdog wd("TafnetNode::onReadyRead other data not duplicate", 100);
-                    handleMessage(tafheader->action, peerPlayerId, datas.data() + sizeof(TafnetMessageHeader), datas.size() - sizeof(TafnetMessageHeader));
-                }
-            }
+void TafnetNode::onIdentify(Peer& peer, const PacketBufferPtr& datas)
+{
+    taflib::Watchdog wd("TafnetNode::onReadyRead IDENTIFY", 100);
+    TafnetIdentify identify;
+    if (datas->size() < int(sizeof(TafnetBufferedHeader) + sizeof(identify)))
+    {
+        qWarning() << "[TafnetNode::onIdentify] peer" << peer.playerId << "IDENTIFY too short. size=" << datas->size();
+        return;
+    }
+    std::memcpy(&identify, datas->data() + sizeof(TafnetBufferedHeader), sizeof(identify));
+    if (identify.playerId != peer.playerId)
+    {
+        qWarning() << "[TafnetNode::onIdentify] peer" << peer.playerId << "identified as player" << identify.playerId << ". ignoring ...";
+        return;
+    }
+
+    if (identify.replyWanted)
+    {
+        sendIdentify(peer.playerId, false);
+    }
+    if (identify.sessionToken == 0u)
+    {
+        return;     // just asking who we are
+    }
+
+    const bool restarted = peer.sessionToken != 0u && identify.sessionToken != peer.sessionToken;
+    const bool confirmed = peer.sessionToken != 0u && peer.timestampAwaitingIdentify > 0;  // at the address connectToPeer gave
+    peer.sessionToken = identify.sessionToken;
+    peer.timestampAwaitingIdentify = 0;
+    if (restarted)
+    {
+        qInfo() << "[TafnetNode::onIdentify] peer" << peer.playerId << "has started a new session.  Resetting send/receive buffers ...";
+        resetPeerSession(peer);
+    }
+    else if (confirmed)
+    {
+        qInfo() << "[TafnetNode::onIdentify] peer" << peer.playerId << "confirmed at" << QHostAddress(peer.address.ipv4addr).toString() << ":" << peer.address.port;
+        resendUnacked(peer);
+    }
+}
+
+void TafnetNode::onUnknownAddress(const HostAndPort& sender, const PacketBufferPtr& datas)
+{
+    const TafnetMessageHeader* tafheader = (const TafnetMessageHeader*)datas->data();
+    if (tafheader->action == Payload::ACTION_IDENTIFY)
+    {
+        TafnetIdentify identify;
+        if (datas->size() >= int(sizeof(TafnetBufferedHeader) + sizeof(identify)))
+        {
+            std::memcpy(&identify, datas->data() + sizeof(TafnetBufferedHeader), sizeof(identify));
+            migratePeer(sender, identify);
         }
+        // never answered from here, so that our session token only goes to addresses we know
+        return;
     }
-    catch (std::exception &e)
+
+    // only peers that sent a session token can be recognised at a new address
+    bool anySessionTokens = false;
+    for (const auto &pair : m_peers)
     {
-        qWarning() << "[TafnetNode::onReadyRead] exception" << e.what();
+        anySessionTokens |= pair.second.sessionToken != 0u;
     }
-    catch (...)
+    auto it = m_unknownAddresses.find(sender);
+    if (!anySessionTokens || (it == m_unknownAddresses.end() && m_unknownAddresses.size() >= MAX_UNKNOWN_ADDRESSES))
     {
-        qWarning() << "[TafnetNode::onReadyRead] unknown exception";
+        qInfo() << "[TafnetNode::onReadyRead] ERROR unexpected message from" << QHostAddress(sender.ipv4addr).toString() << ":" << sender.port;
+        return;
+    }
+
+    const qint64 tNow = QDateTime::currentMSecsSinceEpoch();
+    if (it == m_unknownAddresses.end())
+    {
+        qInfo() << "[TafnetNode::onUnknownAddress] unexpected message from" << QHostAddress(sender.ipv4addr).toString() << ":" << sender.port << ". asking who it is ...";
+        it = m_unknownAddresses.insert(std::make_pair(sender, UnknownAddress())).first;
+        it->second.timestampFirstDatagram = tNow;
+    }
+    UnknownAddress &unknown = it->second;
+    if (unknown.datagrams.size() < UNKNOWN_ADDRESS_MAX_HELD)
+    {
+        unknown.datagrams.push_back(datas);
+    }
+
+    if (tNow >= unknown.timestampLastQuery + RESEND_TIMER_INTERVAL)
+    {
+        // a peer that moved replies from its new address to ours, which it already knows, with its session token.
+        // the reply comes back as an IDENTIFY from this still unknown address, which the branch above hands to migratePeer
+        unknown.timestampLastQuery = tNow;
+        char query[sizeof(TafnetBufferedHeader) + sizeof(TafnetIdentify)];
+        TafnetBufferedHeader header;
+        header.action = Payload::ACTION_IDENTIFY;
+        header.seq = 0u;
+        TafnetIdentify identify;
+        identify.playerId = m_playerId;
+        identify.sessionToken = 0u;
+        identify.replyWanted = 1u;
+        std::memcpy(query, &header, sizeof(header));
+        std::memcpy(query + sizeof(header), &identify, sizeof(identify));
+        sendDatagramTo(sender, 0u, query, sizeof(query), 1);
+    }
+}
+
+void TafnetNode::migratePeer(const HostAndPort& sender, const TafnetIdentify& identify)
+{
+    Peer* peer = findPeer(identify.playerId);
+    if (peer == NULL || identify.sessionToken == 0u || identify.sessionToken != peer->sessionToken)
+    {
+        qInfo() << "[TafnetNode::migratePeer] ignoring IDENTIFY as player" << identify.playerId << "from" << QHostAddress(sender.ipv4addr).toString() << ":" << sender.port
+            << (peer == NULL ? "not known" : "session token mismatch");
+        return;
+    }
+
+    qInfo() << "[TafnetNode::migratePeer] peer" << peer->playerId << "moved from" << QHostAddress(peer->address.ipv4addr).toString() << ":" << peer->address.port
+        << "to" << QHostAddress(sender.ipv4addr).toString() << ":" << sender.port;
+    unmapPeerAddress(*peer);
+    peer->address = sender;
+    m_peersByAddress[sender] = peer;
+    peer->timestampAwaitingIdentify = 0;
+    if (identify.replyWanted)
+    {
+        sendIdentify(peer->playerId, false);
+    }
+    resendUnacked(*peer);
+
+    // and whatever it sent before we knew it was them
+    auto it = m_unknownAddresses.find(sender);
+    if (it != m_unknownAddresses.end())
+    {
+        std::vector<PacketBufferPtr> held;
+        held.swap(it->second.datagrams);
+        m_unknownAddresses.erase(it);
+        for (const PacketBufferPtr &datagram : held)
+        {
+            handleDatagram(sender, datagram);
+        }
+    }
+}
+
+void TafnetNode::resetPeerSession(Peer& peer)
+{
+    // in place, since m_peersByAddress points to it
+    Peer fresh;
+    fresh.playerId = peer.playerId;
+    fresh.address = peer.address;
+    fresh.sessionToken = peer.sessionToken;
+    peer = std::move(fresh);
+    sendHello(peer.playerId);
+}
+
+void TafnetNode::sendIdentify(std::uint32_t peerPlayerId, bool replyWanted)
+{
+    TafnetIdentify identify;
+    identify.playerId = m_playerId;
+    identify.sessionToken = m_sessionToken;
+    identify.replyWanted = replyWanted ? 1u : 0u;
+    sendMessage(peerPlayerId, Payload::ACTION_IDENTIFY, 0u, (const char*)&identify, sizeof(identify), 1);
+}
+
+void TafnetNode::sendHello(std::uint32_t peerPlayerId)
+{
+    char hello[HELLO_SIZE + sizeof(m_sessionToken)];
+    std::memcpy(hello, HELLO, HELLO_SIZE);
+    std::memcpy(hello + HELLO_SIZE, &m_sessionToken, sizeof(m_sessionToken));
+    forwardGameData(peerPlayerId, Payload::ACTION_HELLO, hello, sizeof(hello));
+}
+
+void TafnetNode::resendUnacked(Peer& peer)
+{
+    // everything that may have gone to the old address, rather than waiting for each to time out
+    const qint64 tNow = QDateTime::currentMSecsSinceEpoch();
+    std::size_t numResent = 0u;
+    for (auto &pairPayload : peer.sendBuffer.getAll())
+    {
+        if (numResent >= MIGRATION_MAX_RESEND)
+        {
+            break;
+        }
+        Payload &data = pairPayload.second;
+        if (data.buf)
+        {
+            sendMessage(peer.playerId, data.action, pairPayload.first, data.buf, 1);
+            data.timestamp = tNow;
+            ++numResent;
+        }
+    }
+    if (numResent > 0u)
+    {
+        qInfo() << "[TafnetNode::resendUnacked] resent" << numResent << "unacked messages to peer" << peer.playerId;
     }
 }
 
 void TafnetNode::handleMessage(std::uint8_t action, std::uint32_t peerPlayerId, char* data, int len)
 {
+    if (action == Payload::ACTION_HELLO)
+    {
+        // peers that predate session tokens send only "HELLO", and won't answer IDENTIFY
+        Peer* peer = findPeer(peerPlayerId);
+        if (peer != NULL && peer->sessionToken == 0u)
+        {
+            if (len >= HELLO_SIZE + int(sizeof(peer->sessionToken)))
+            {
+                std::memcpy(&peer->sessionToken, data + HELLO_SIZE, sizeof(peer->sessionToken));
+            }
+            peer->timestampAwaitingIdentify = 0;
+        }
+    }
     m_handleMessage(action, peerPlayerId, data, len);
 }
 
@@ -545,14 +920,41 @@ std::uint32_t TafnetNode::getHostPlayerId() const
 
 std::uint32_t TafnetNode::maxPacketSizeForPlayerId(std::uint32_t id) const
 {
-    auto it = m_resendRates.find(id);
-    if (it == m_resendRates.end())
+    auto it = m_peers.find(id);
+    if (it == m_peers.end())
     {
         return MAX_PACKET_SIZE_LOWER_LIMIT;
     }
     else
     {
-        return it->second.maxPacketSize;
+        return it->second.resendRate.maxPacketSize;
+    }
+}
+
+TafnetNode::Peer* TafnetNode::findPeer(std::uint32_t peerPlayerId)
+{
+    auto it = m_peers.find(peerPlayerId);
+    return it == m_peers.end() ? NULL : &it->second;
+}
+
+void TafnetNode::erasePeer(std::uint32_t peerPlayerId)
+{
+    auto it = m_peers.find(peerPlayerId);
+    if (it == m_peers.end())
+    {
+        return;
+    }
+    unmapPeerAddress(it->second);
+    m_peers.erase(it);
+}
+
+void TafnetNode::unmapPeerAddress(Peer& peer)
+{
+    // the address may since have been taken over by another peer
+    auto itAddress = m_peersByAddress.find(peer.address);
+    if (itAddress != m_peersByAddress.end() && itAddress->second == &peer)
+    {
+        m_peersByAddress.erase(itAddress);
     }
 }
 
@@ -565,48 +967,46 @@ void TafnetNode::joinGame(QHostAddress peer, quint16 peerPort, std::uint32_t pee
 void TafnetNode::connectToPeer(QHostAddress peer, quint16 peerPort, std::uint32_t peerPlayerId)
 {
     qInfo() << "[TafnetNode::connectToPeer] connecting to" << peer.toString() << ":" << peerPort << peerPlayerId;
-    HostAndPort hostAndPort(peer, peerPort);
-    m_peerAddresses[peerPlayerId] = hostAndPort;
-    m_peerPlayerIds[hostAndPort] = peerPlayerId;
+    const HostAndPort address(peer, peerPort);
+    m_unknownAddresses.erase(address);
 
-    if (m_receiveBuffer.count(peerPlayerId) || m_sendBuffer.count(peerPlayerId))
+    Peer* existing = findPeer(peerPlayerId);
+    if (existing != NULL && existing->sessionToken != 0u)
+    {
+        // either it moved, and carries on where it left off once it confirms its session token,
+        // or it restarted, and its IDENTIFY says so and starts the buffers afresh
+        qInfo() << "[TafnetNode::connectToPeer] keeping send/receive buffers for peerPlayerId=" << peerPlayerId << "until it identifies itself";
+        unmapPeerAddress(*existing);
+        existing->address = address;
+        m_peersByAddress[address] = existing;
+        existing->timestampAwaitingIdentify = QDateTime::currentMSecsSinceEpoch();
+        sendIdentify(peerPlayerId, true);
+        return;
+    }
+    if (existing != NULL)
     {
         qInfo() << "[TafnetNode::connectToPeer] pre-existing send/receive buffers for peerPlayerId=" << peerPlayerId << ".  Cleaning up ...";
+        erasePeer(peerPlayerId);
     }
-    m_receiveBuffer.erase(peerPlayerId);
-    m_sendBuffer.erase(peerPlayerId);
-    m_reassemblyBuffer.erase(peerPlayerId);
-    m_resendRates.erase(peerPlayerId);
-    m_resendRequestEnabled.erase(peerPlayerId);
-    forwardGameData(peerPlayerId, Payload::ACTION_HELLO, "HELLO", 5);
+
+    Peer &newPeer = m_peers[peerPlayerId];
+    newPeer.playerId = peerPlayerId;
+    newPeer.address = address;
+    m_peersByAddress[newPeer.address] = &newPeer;
+    // ahead of HELLO, so that if we've restarted the peer starts its buffers afresh before HELLO arrives
+    newPeer.timestampAwaitingIdentify = QDateTime::currentMSecsSinceEpoch();
+    sendIdentify(peerPlayerId, true);
+    sendHello(peerPlayerId);
 }
 
 void TafnetNode::disconnectFromPeer(std::uint32_t peerPlayerId)
 {
     qInfo() << "[TafnetNode::disconnectFromPeer] disconnecting from" << peerPlayerId;
-    auto it = m_peerAddresses.find(peerPlayerId);
-    if (it != m_peerAddresses.end())
-    {
-        m_peerPlayerIds.erase(it->second);
-    }
-    m_peerAddresses.erase(peerPlayerId);
-    m_receiveBuffer.erase(peerPlayerId);
-    m_sendBuffer.erase(peerPlayerId);
-    m_reassemblyBuffer.erase(peerPlayerId);
-    m_resendRates.erase(peerPlayerId);
-    m_resendRequestEnabled.erase(peerPlayerId);
+    erasePeer(peerPlayerId);
 }
 
 void TafnetNode::sendMessage(std::uint32_t destPlayerId, std::uint32_t action, std::uint32_t seq, const char* data, int len, int nRepeats)
 {
-    auto it = m_peerAddresses.find(destPlayerId);
-    if (it == m_peerAddresses.end())
-    {
-        qInfo() << "[TafnetNode::sendMessage] ERROR peer" << destPlayerId << "not known";
-        return;
-    }
-    HostAndPort& hostAndPort = it->second;
-
     QByteArray buf;
     if (action >= Payload::ACTION_TCP_DATA)
     {
@@ -625,36 +1025,84 @@ void TafnetNode::sendMessage(std::uint32_t destPlayerId, std::uint32_t action, s
         header->action = action;
         std::memcpy(header+1, data, len);
     }
+    sendDatagram(destPlayerId, buf.data(), buf.size(), nRepeats);
+}
 
+void TafnetNode::sendMessage(std::uint32_t destPlayerId, std::uint32_t action, std::uint32_t seq, const PacketBufferPtr& packet, int nRepeats)
+{
+    if (action >= Payload::ACTION_TCP_DATA)
+    {
+        TafnetBufferedHeader* header = (TafnetBufferedHeader*)packet->headroom(sizeof(TafnetBufferedHeader));
+        header->action = action;
+        header->seq = seq;
+        sendDatagram(destPlayerId, (const char*)header, sizeof(TafnetBufferedHeader) + packet->size(), nRepeats);
+    }
+    else
+    {
+        TafnetMessageHeader* header = (TafnetMessageHeader*)packet->headroom(sizeof(TafnetMessageHeader));
+        header->action = action;
+        sendDatagram(destPlayerId, (const char*)header, sizeof(TafnetMessageHeader) + packet->size(), nRepeats);
+    }
+}
+
+void TafnetNode::sendDatagram(std::uint32_t destPlayerId, const char* datagram, int len, int nRepeats)
+{
+    const Peer* peer = findPeer(destPlayerId);
+    if (peer == NULL)
+    {
+        qInfo() << "[TafnetNode::sendDatagram] ERROR peer" << destPlayerId << "not known";
+        return;
+    }
+    sendDatagramTo(peer->address, destPlayerId, datagram, len, nRepeats);
+}
+
+void TafnetNode::sendDatagramTo(const HostAndPort& hostAndPort, std::uint32_t destPlayerId, const char* datagram, int len, int nRepeats)
+{
     if (!m_proactiveResendEnabled)
     {
         nRepeats = 1;
     }
+    PacketCapture& capture = PacketCapture::instance();
     for (int n = 0; n < nRepeats; ++n)
     {
+        if (capture.isActive())
+        {
+            capture.record(PacketCapture::SOURCE_TAFNET, PacketCapture::DIRECTION_SENT, m_playerId, destPlayerId,
+                m_lobbySocket.localAddress().toIPv4Address(), m_lobbySocket.localPort(), hostAndPort.ipv4addr, hostAndPort.port, datagram, len);
+        }
 #ifdef SIM_PACKET_LOSS
         if (distribution(generator) > SIM_PACKET_LOSS)
 #endif
         {
-            m_lobbySocket.writeDatagram(buf.data(), buf.size(), QHostAddress(hostAndPort.ipv4addr), hostAndPort.port);
+            m_lobbySocket.writeDatagram(datagram, len, QHostAddress(hostAndPort.ipv4addr), hostAndPort.port);
             m_lobbySocket.flush();
         }
     }
 }
 
-void TafnetNode::forwardGameData(std::uint32_t destPlayerId, std::uint32_t action, const char* data, int _len)
+void TafnetNode::forwardGameData(std::uint32_t destPlayerId, std::uint32_t action, const char* data, int len)
+{
+    if (m_peers.count(destPlayerId) > 0)
+    {
+        forwardGameData(destPlayerId, action, PacketBufferPool::instance().copy(data, len));
+    }
+}
+
+void TafnetNode::forwardGameData(std::uint32_t destPlayerId, std::uint32_t action, const PacketBufferPtr& packet)
 {
     taflib::Watchdog wd("TafnetNode::forwardGameData", 100);
-    const unsigned len = (unsigned)_len;
-    if (m_peerAddresses.count(destPlayerId) == 0)
+    const char* data = packet->data();
+    const unsigned len = (unsigned)packet->size();
+    Peer* peer = findPeer(destPlayerId);
+    if (peer == NULL)
     {
         return;
     }
 
     if (action >= Payload::ACTION_TCP_DATA)
     {
-        DataBuffer &sendBuffer = m_sendBuffer[destPlayerId];
-        std::uint32_t maxPacketSize = m_resendRates[destPlayerId].maxPacketSize;
+        DataBuffer &sendBuffer = peer->sendBuffer;
+        std::uint32_t maxPacketSize = peer->resendRate.maxPacketSize;
 
         unsigned numFragments = len / (maxPacketSize+1) + 1;
         maxPacketSize = (len+numFragments-1) / numFragments;
@@ -663,64 +1111,184 @@ void TafnetNode::forwardGameData(std::uint32_t destPlayerId, std::uint32_t actio
 
         for (std::uint32_t fragOffset = 0u; fragOffset < len; fragOffset += maxPacketSize)
         {
-            const char *p = data + fragOffset;
             int sz = std::min(maxPacketSize, len - fragOffset);
 
-            int nRepeats = m_resendRates[destPlayerId].getResendRate(true);
-            if (fragOffset + sz >= len)
-            {
-                std::uint32_t seq = sendBuffer.push_back(action, p, sz);
-                sendMessage(destPlayerId, action, seq, p, sz, nRepeats);
-            }
-            else
-            {
-                std::uint32_t seq = sendBuffer.push_back(Payload::ACTION_MORE, p, sz);
-                sendMessage(destPlayerId, Payload::ACTION_MORE, seq, p, sz, nRepeats);
-            }
+            // a fragment's header would overwrite the tail of the preceding fragment, so each gets its own buffer
+            PacketBufferPtr fragment = unsigned(sz) < len ? PacketBufferPool::instance().copy(data + fragOffset, sz) : packet;
+
+            int nRepeats = peer->resendRate.getResendRate(true);
+            std::uint8_t fragAction = fragOffset + sz >= len ? action : Payload::ACTION_MORE;
+            std::uint32_t seq = sendBuffer.push_back(fragAction, fragment);
+            sendMessage(destPlayerId, fragAction, seq, fragment, nRepeats);
         }
     }
     else
     {
-        int nRepeats = m_resendRates[destPlayerId].getResendRate(false);
-        sendMessage(destPlayerId, action, 0, data, len, nRepeats);
+        int nRepeats = peer->resendRate.getResendRate(false);
+        sendMessage(destPlayerId, action, 0, packet, nRepeats);
     }
 }
 
 void TafnetNode::sendPacksizeTests(std::uint32_t peerPlayerId)
 {
     taflib::Watchdog wd("TafnetNode::sendPacksizeTests", 100);
-    std::vector<char> _testData(m_maxPacketSize);
+    Peer* peer = findPeer(peerPlayerId);
+    if (peer == NULL)
+    {
+        qInfo() << "[TafnetNode::sendPacksizeTests] ERROR peer" << peerPlayerId << "not known";
+        return;
+    }
+
+    PacksizeSearch &search = peer->packsizeSearch;
+    search.low = peer->resendRate.maxPacketSize = MAX_PACKET_SIZE_LOWER_LIMIT;
+    search.high = std::max(m_maxPacketSize, MAX_PACKET_SIZE_LOWER_LIMIT) + 1u;
+    search.outstanding.clear();
+    search.timestampLastSearch = QDateTime::currentMSecsSinceEpoch();
+
+    // if last time's size still gets through, the first round finds it
+    auto itCached = m_packsizeCache.find(peerPlayerId);
+    sendPacksizeProbes(*peer, itCached != m_packsizeCache.end() ? itCached->second : 0u);
+    peer->resendRate.timestampLastPing = QDateTime::currentMSecsSinceEpoch();
+}
+
+void TafnetNode::sendPacksizeProbes(Peer& peer, std::uint32_t extraSize)
+{
+    PacksizeSearch &search = peer.packsizeSearch;
+    if (search.high <= search.low + PACKSIZE_RESOLUTION)
+    {
+        qInfo() << "[TafnetNode::sendPacksizeProbes] peer=" << peer.playerId << "max packsize=" << search.low;
+        search.timestampRoundStart = 0;
+        std::uint32_t &cached = m_packsizeCache[peer.playerId];
+        if (cached != search.low)
+        {
+            cached = search.low;
+            savePacksizeCache();
+        }
+        return;
+    }
+
+    // the biggest that might get through, and the rest spread evenly below it
+    std::set<std::uint32_t> sizes;
+    const std::uint32_t range = search.high - 1u - search.low;
+    for (std::uint32_t n = 1u; n <= PACKSIZE_PROBES_PER_ROUND; ++n)
+    {
+        sizes.insert(search.low + range * n / PACKSIZE_PROBES_PER_ROUND);
+    }
+    if (extraSize > search.low && extraSize < search.high)
+    {
+        sizes.insert(extraSize);
+    }
+    sendPacksizeProbeRound(peer, sizes, false);
+}
+
+void TafnetNode::sendPacksizeProbeRound(Peer& peer, std::set<std::uint32_t>& sizes, bool retrying)
+{
+    PacksizeSearch &search = peer.packsizeSearch;
+    const std::uint32_t maxSize = *sizes.rbegin();
+    std::vector<char> _testData(maxSize);
     char* testData = _testData.data();
-    for (unsigned n = 0; n < m_maxPacketSize; ++n)
+    for (unsigned n = 0; n < maxSize; ++n)
     {
         testData[n] = (char)n;
     }
 
-    std::uint32_t sz = m_resendRates[peerPlayerId].maxPacketSize = MAX_PACKET_SIZE_LOWER_LIMIT;
-    for (;;)
+    for (std::uint32_t sz : sizes)
     {
         *(std::uint32_t*)testData = m_crc32.FullCRC((unsigned char*)testData + sizeof(std::uint32_t), sz - sizeof(std::uint32_t));
-        qInfo() << "[TafnetNode::sendPacksizeTests] sending ACTION_PACKSIZE_TEST to peer=" << peerPlayerId << "packsize=" << sz;
-        sendMessage(peerPlayerId, Payload::ACTION_PACKSIZE_TEST, sz, testData, sz, 3);
+        sendMessage(peer.playerId, Payload::ACTION_PACKSIZE_TEST, sz, testData, sz, 3);
+    }
+    qInfo() << "[TafnetNode::sendPacksizeProbeRound]" << (retrying ? "resending" : "sending") << sizes.size() << "ACTION_PACKSIZE_TEST to peer=" << peer.playerId << "packsize=" << *sizes.begin() << "to" << maxSize;
+    search.outstanding.swap(sizes);
+    search.retrying = retrying;
+    search.timestampRoundStart = QDateTime::currentMSecsSinceEpoch();
+}
 
-        if (sz >= m_maxPacketSize)
+void TafnetNode::onPacksizeProbeTimeout(Peer& peer)
+{
+    PacksizeSearch &search = peer.packsizeSearch;
+    auto it = search.outstanding.upper_bound(search.low);
+    if (it != search.outstanding.end())
+    {
+        if (!search.retrying)
         {
-            break;
+            // without proactive resend each probe went out only once.  ask again before concluding anything from the silence
+            std::set<std::uint32_t> unanswered(it, search.outstanding.end());
+            sendPacksizeProbeRound(peer, unanswered, true);
+            return;
         }
-        sz = std::min(1412 * sz / 1000, m_maxPacketSize);
+
+        // unanswered twice, as is everything bigger, so taken not to get through
+        search.high = std::min(search.high, *it);
     }
-    m_resendRates[peerPlayerId].timestampLastPing = QDateTime::currentMSecsSinceEpoch();
+    search.outstanding.clear();
+    sendPacksizeProbes(peer, 0u);
 }
 
-void TafnetNode::resetTcpBuffers()
+void TafnetNode::setPacksizeCacheFile(QString fileName)
+{
+    m_packsizeCacheFileName = fileName;
+    loadPacksizeCache();
+}
+
+void TafnetNode::loadPacksizeCache()
+{
+    m_packsizeCache.clear();
+    if (m_packsizeCacheFileName.isEmpty())
+    {
+        return;
+    }
+
+    // each line: peer player id <tab> max packet size
+    QFile file(m_packsizeCacheFileName);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text))
+    {
+        return;
+    }
+    QTextStream in(&file);
+    while (!in.atEnd())
+    {
+        const QStringList fields = in.readLine().split('\t');
+        bool ok[2] = { false, false };
+        if (fields.size() == 2)
+        {
+            std::uint32_t playerId = fields[0].toUInt(&ok[0]);
+            std::uint32_t packsize = fields[1].toUInt(&ok[1]);
+            if (ok[0] && ok[1] && packsize >= MAX_PACKET_SIZE_LOWER_LIMIT)
+            {
+                m_packsizeCache[playerId] = packsize;
+            }
+        }
+    }
+    qInfo() << "[TafnetNode::loadPacksizeCache]" << m_packsizeCache.size() << "entries from" << m_packsizeCacheFileName;
+}
+
+void TafnetNode::savePacksizeCache()
 {
-    for (auto &buf : m_receiveBuffer)
+    if (m_packsizeCacheFileName.isEmpty())
+    {
+        return;
+    }
+
+    QDir().mkpath(QFileInfo(m_packsizeCacheFileName).absolutePath());
+    QFile file(m_packsizeCacheFileName);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text))
     {
-        buf.second.reset();
+        qWarning() << "[TafnetNode::savePacksizeCache] unable to write" << m_packsizeCacheFileName;
+        return;
     }
-    for (auto &buf : m_sendBuffer)
+    QTextStream out(&file);
+    for (const auto &pair : m_packsizeCache)
     {
-        buf.second.reset();
+        out << pair.first << '\t' << pair.second << '\n';
+    }
+}
+
+void TafnetNode::resetTcpBuffers()
+{
+    for (auto &pair : m_peers)
+    {
+        pair.second.receiveBuffer.reset();
+        pair.second.sendBuffer.reset();
     }
 }
 
@@ -736,10 +1304,10 @@ void TafnetNode::sendPingToPeers()
     *(std::uint32_t*)testData = m_crc32.FullCRC((unsigned char*)testData + sizeof(std::uint32_t), PING_PACKET_SIZE - sizeof(std::uint32_t));
 
     std::set<std::uint32_t> lostPeerIds;
-    for (auto it = m_peerPlayerIds.begin(); it != m_peerPlayerIds.end(); ++it)
+    for (auto it = m_peers.begin(); it != m_peers.end(); ++it)
     {
-        std::uint32_t peerId = it->second;
-        ResendRate& stats = m_resendRates[peerId];
+        std::uint32_t peerId = it->first;
+        ResendRate& stats = it->second.resendRate;
         std::int64_t tNow = QDateTime::currentMSecsSinceEpoch();
         if (stats.timestampLastPingAck > 0 && tNow - stats.timestampLastPingAck > DEAD_PEER_TIMEOUT)
         {
@@ -771,18 +1339,19 @@ void TafnetNode::sendPingToPeers()
 std::map<std::uint32_t, std::int64_t> TafnetNode::getPingToPeers()
 {
     std::map<std::uint32_t, std::int64_t> results;
-    for (auto it = m_resendRates.begin(); it != m_resendRates.end(); ++it)
+    for (auto it = m_peers.begin(); it != m_peers.end(); ++it)
     {
         std::uint32_t peerId = it->first;
-        if (it->second.timestampLastPing > 0)
+        const ResendRate& stats = it->second.resendRate;
+        if (stats.timestampLastPing > 0)
         {
-            if (it->second.timestampLastPingAck < it->second.timestampLastPing)
+            if (stats.timestampLastPingAck < stats.timestampLastPing)
             {
-                results[peerId] = QDateTime::currentMSecsSinceEpoch() - it->second.timestampLastPing;
+                results[peerId] = QDateTime::currentMSecsSinceEpoch() - stats.timestampLastPing;
             }
             else
             {
-                results[peerId] = it->second.timestampLastPingAck - it->second.timestampLastPing;
+                results[peerId] = stats.timestampLastPingAck - stats.timestampLastPing;
             }
         }
     }
@@ -1,12 +1,17 @@
 #pragma once
 
+#include <array>
 #include <cinttypes>
 #include <functional>
+#include <set>
+#include <unordered_map>
+#include <vector>
 #include <QtNetwork/qudpsocket.h>
 #include <QtCore/qtimer.h>
 
 #include "taflib/DuplicateDetection.h"
 #include "taflib/nswfl_crc32.h"
+#include "PacketBuffer.h"
 
 namespace tafnet
 {
@@ -21,6 +26,14 @@ namespace tafnet
     const std::uint32_t PING_PACKET_SIZE = 16;
     const std::int64_t DEAD_PEER_TIMEOUT = 3 * 60 * 1000;    // milliseoncds, until give up pinging and delete their connection
     const std::size_t RECENT_PING_BUFFER_SIZE = 5;      // for estimating expected ping
+    const std::uint32_t PACKSIZE_PROBES_PER_ROUND = 8;  // packet size probes sent at once, spread across the range still in doubt
+    const std::uint32_t PACKSIZE_RESOLUTION = 8;        // bytes. search for max packet size ends once it's known this closely
+    const std::int64_t PACKSIZE_REPROBE_HOLD_OFF_TIME = 10000;  // milliseconds, between searches prompted by packet loss
+    const int PACKSIZE_REPROBE_RESEND_RATE = 3;         // resend rate at which packet loss prompts a new search
+    const std::int64_t UNKNOWN_ADDRESS_HOLD_TIME = 2000; // milliseconds, that datagrams from an unknown address are held for a peer to claim them
+    const std::size_t UNKNOWN_ADDRESS_MAX_HELD = 64;    // datagrams held per unknown address
+    const std::size_t MAX_UNKNOWN_ADDRESSES = 8;        // unknown addresses held at once
+    const std::size_t MIGRATION_MAX_RESEND = 64;        // unacked messages resent at once to a peer found at a new address
 
     struct Payload
     {
@@ -41,13 +54,15 @@ namespace tafnet
         static const unsigned ACTION_PACKSIZE_TEST = 11;
         static const unsigned ACTION_PACKSIZE_ACK = 12;
         static const unsigned ACTION_HELLO = 13;
+        static const unsigned ACTION_IDENTIFY = 14;     // not buffered.  seq is 0, which nodes that don't know it ack and ignore
 
         std::uint8_t action;
-        QSharedPointer<QByteArray> buf;
+        PacketBufferPtr buf;
         qint64 timestamp;
 
         Payload();
         void set(std::uint8_t action, const char *data, int len);
+        void set(std::uint8_t action, const PacketBufferPtr &packet);   // shares packet rather than copying it
     };
 
     class DataBuffer
@@ -60,7 +75,9 @@ namespace tafnet
         DataBuffer();
         void reset();
         void insert(std::uint32_t seq, std::uint8_t action, const char *data, int len);
+        void insert(std::uint32_t seq, std::uint8_t action, const PacketBufferPtr &packet);
         std::uint32_t push_back(std::uint8_t action, const char *data, int len);
+        std::uint32_t push_back(std::uint8_t action, const PacketBufferPtr &packet);
         Payload pop();
         Payload get(std::uint32_t seq);
         std::map<std::uint32_t, Payload > & getAll();
@@ -86,6 +103,15 @@ namespace tafnet
         std::uint8_t action;
         std::uint32_t seq;
     };
+
+    // follows a TafnetBufferedHeader of ACTION_IDENTIFY.
+    // tells a peer which session its datagrams belong to, so they're recognised when they come from a new address
+    struct TafnetIdentify
+    {
+        std::uint32_t playerId;         // of sender
+        std::uint64_t sessionToken;     // of sender.  0 from a node asking an unknown address who it is
+        std::uint8_t replyWanted;
+    };
 #pragma pack(pop)
 
     class TafnetNode : public QObject
@@ -97,27 +123,14 @@ namespace tafnet
 
             HostAndPort();
             HostAndPort(QHostAddress addr, std::uint16_t port);
-            bool operator< (const HostAndPort& other) const;
-        };
+            bool operator== (const HostAndPort& other) const;
 
-        struct BoolDefaultToTrue
-        {
-            bool value = true;
+            struct Hash
+            {
+                std::size_t operator()(const HostAndPort& hostAndPort) const;
+            };
         };
 
-        QTimer m_resendTimer;
-
-        const std::uint32_t m_playerId;
-        std::uint32_t m_hostPlayerId;
-        QUdpSocket m_lobbySocket;                               // send/receive to/from peer TafnetNodes
-        std::map<std::uint32_t, HostAndPort> m_peerAddresses;   // keyed by peer tafnet player id
-        std::map<HostAndPort, std::uint32_t> m_peerPlayerIds;
-        std::function<void(std::uint8_t, std::uint32_t, char*, int)> m_handleMessage; // optional hook for handleMessage
-
-        std::map<std::uint32_t, DataBuffer> m_receiveBuffer;    // keyed by peer tafnet player id
-        std::map<std::uint32_t, DataBuffer> m_sendBuffer;       // keyed by peer tafnet player id
-        std::map<std::uint32_t, QByteArray> m_reassemblyBuffer;
-
         // we maintain stats of how many times a packet is sent before we receive an ACK for it
         // then if we find packet loss is high we start to spam the packets
         // (or maybe more PC we "proactively" resend)
@@ -140,7 +153,71 @@ namespace tafnet
             void registerAck();
             std::int64_t getSuccessfulPingTime();
         };
-        std::map<std::uint32_t, ResendRate> m_resendRates;      // keyed by peer tafnet player id
+
+        // search for the largest packet that gets through to a peer.
+        // each round probes sizes spread evenly between the largest known to get through and the smallest known not to, all at once.
+        // a round ends once the largest probe has been acked or the rest have timed out.
+        // probes that time out are sent once more before they count as not getting through, so that one lost datagram can't shrink the packet size
+        struct PacksizeSearch
+        {
+            std::uint32_t low;                      // largest size acked
+            std::uint32_t high;                     // smallest size known not to get through, or one more than the largest we'd use
+            std::set<std::uint32_t> outstanding;    // sizes probed this round and not yet acked
+            bool retrying;                          // this round resends the last round's unanswered probes
+            std::int64_t timestampRoundStart;       // 0 if no search in progress
+            std::int64_t timestampLastSearch;
+
+            PacksizeSearch();
+        };
+
+        // all we know about a peer TafnetNode, reached from a datagram's source address by a single lookup
+        struct Peer
+        {
+            std::uint32_t playerId;
+            HostAndPort address;
+            DataBuffer receiveBuffer;
+            DataBuffer sendBuffer;
+            QByteArray reassemblyBuffer;
+            ResendRate resendRate;
+            PacksizeSearch packsizeSearch;
+
+            // we disable resend requests after issueing them to avoid spamming.
+            // they're reenabled on a timer
+            bool resendRequestEnabled;
+
+            // identifies the peer's session, from its HELLO or IDENTIFY.  0 until known, and always for peers that predate it.
+            // a peer that sends a different one has restarted
+            std::uint64_t sessionToken;
+            // when we last sent IDENTIFY asking for a reply, while waiting for the peer to confirm a new address.  0 if not waiting
+            std::int64_t timestampAwaitingIdentify;
+
+            Peer();
+        };
+
+        // datagrams from an address no peer is known by, held while we ask it who it is
+        struct UnknownAddress
+        {
+            std::vector<PacketBufferPtr> datagrams;
+            std::int64_t timestampFirstDatagram;
+            std::int64_t timestampLastQuery;
+
+            UnknownAddress();
+        };
+
+        // handles a datagram received from peer, tafnet header and all
+        typedef void (TafnetNode::*DatagramHandler)(Peer& peer, const PacketBufferPtr& datagram);
+
+        QTimer m_resendTimer;
+
+        const std::uint32_t m_playerId;
+        std::uint32_t m_hostPlayerId;
+        QUdpSocket m_lobbySocket;                               // send/receive to/from peer TafnetNodes
+        std::map<std::uint32_t, Peer> m_peers;                  // keyed by peer tafnet player id
+        std::unordered_map<HostAndPort, Peer*, HostAndPort::Hash> m_peersByAddress;
+        std::unordered_map<HostAndPort, UnknownAddress, HostAndPort::Hash> m_unknownAddresses;
+        const std::uint64_t m_sessionToken;                     // random, so peers can tell a restarted node from one that moved
+        std::function<void(std::uint8_t, std::uint32_t, char*, int)> m_handleMessage; // optional hook for handleMessage
+
         const std::uint32_t m_maxPacketSize;                    // upper limit on the otherwise auto-discovered UDP packet size
         const bool m_proactiveResendEnabled;
 
@@ -148,12 +225,14 @@ namespace tafnet
         // (tcp channel takes care of itself)
         taflib::DuplicateDetection m_udpDuplicateDetection;
 
-        // we disable resend requests after issueing them to avoid spamming.
-        // they're reenabled on a timer
-        std::map<std::uint32_t, BoolDefaultToTrue> m_resendRequestEnabled;
         QTimer m_resendReqReenableTimer;
         taflib::CRC32 m_crc32;
 
+        // max packet sizes found by previous searches, keyed by peer tafnet player id.
+        // by id rather than address since peers' addresses (eg ICE adapter's local ports) change from one session to the next
+        std::map<std::uint32_t, std::uint32_t> m_packsizeCache;
+        QString m_packsizeCacheFileName;
+
     public:
         TafnetNode(std::uint32_t playerId, bool isHost, QHostAddress bindAddress, quint16 bindPort, bool proactiveResend, std::uint32_t maxPacketSize);
 
@@ -162,12 +241,18 @@ namespace tafnet
         virtual std::uint32_t getHostPlayerId() const;
         virtual bool isHost() { return getPlayerId() == getHostPlayerId(); }
         virtual std::uint32_t maxPacketSizeForPlayerId(std::uint32_t id) const;
+        // starts a search for the largest packet that gets through to peer, beginning with the size found last time if any
         virtual void sendPacksizeTests(std::uint32_t peerPlayerId);
+        // where max packet sizes are remembered from one session to the next.  empty to not remember them
+        virtual void setPacksizeCacheFile(QString fileName);
 
         virtual void joinGame(QHostAddress peer, quint16 peerPort, std::uint32_t peerPlayerId);
         virtual void connectToPeer(QHostAddress peer, quint16 peerPort, std::uint32_t peerPlayerId);
         virtual void disconnectFromPeer(std::uint32_t peerPlayerId);
         virtual void forwardGameData(std::uint32_t peerPlayerId, std::uint32_t action, const char* data, int len);
+        // as above but, unless it needs fragmenting, packet is sent from and buffered for resend without being copied.
+        // caller must not modify packet afterwards
+        virtual void forwardGameData(std::uint32_t peerPlayerId, std::uint32_t action, const PacketBufferPtr& packet);
 
         virtual void onResendTimer();
         virtual void onResendReqReenableTimer();
@@ -178,8 +263,41 @@ namespace tafnet
 
     private:
         virtual void onReadyRead();
+        virtual void handleDatagram(const HostAndPort& sender, const PacketBufferPtr& datagram);
+        static const std::array<DatagramHandler, 256>& datagramHandlers();  // indexed by action
+        void onTcpAck(Peer& peer, const PacketBufferPtr& datagram);
+        void onTcpResend(Peer& peer, const PacketBufferPtr& datagram);
+        void onPacksizeTest(Peer& peer, const PacketBufferPtr& datagram);
+        void onPacksizeAck(Peer& peer, const PacketBufferPtr& datagram);
+        void onBufferedData(Peer& peer, const PacketBufferPtr& datagram);
+        void onUnbufferedData(Peer& peer, const PacketBufferPtr& datagram);
+        void onIdentify(Peer& peer, const PacketBufferPtr& datagram);
+
+        // a peer whose address changed (NAT rebinding, ICE adapter restarted ...) is recognised by its session token
+        // and keeps its buffers, instead of having its datagrams dropped until connectToPeer starts it afresh
+        void onUnknownAddress(const HostAndPort& sender, const PacketBufferPtr& datagram);
+        void migratePeer(const HostAndPort& sender, const TafnetIdentify& identify);
+        void resetPeerSession(Peer& peer);
+        void sendIdentify(std::uint32_t peerPlayerId, bool replyWanted);
+        void sendHello(std::uint32_t peerPlayerId);
+        void resendUnacked(Peer& peer);
+
+        void sendPacksizeProbes(Peer& peer, std::uint32_t extraSize);
+        void sendPacksizeProbeRound(Peer& peer, std::set<std::uint32_t>& sizes, bool retrying);
+        void onPacksizeProbeTimeout(Peer& peer);
+        void loadPacksizeCache();
+        void savePacksizeCache();
+
+        Peer* findPeer(std::uint32_t peerPlayerId);
+        void erasePeer(std::uint32_t peerPlayerId);
+        void unmapPeerAddress(Peer& peer);
         virtual void handleMessage(std::uint8_t action, std::uint32_t peerPlayerId, char* data, int len);
         virtual void sendMessage(std::uint32_t peerPlayerId, std::uint32_t action, std::uint32_t seq, const char* data, int len, int nRepeats);
+        // header is written into packet's headroom
+        virtual void sendMessage(std::uint32_t peerPlayerId, std::uint32_t action, std::uint32_t seq, const PacketBufferPtr& packet, int nRepeats);
+        virtual void sendDatagram(std::uint32_t peerPlayerId, const char* datagram, int len, int nRepeats);
+        // peerPlayerId only for the capture, 0 if not known
+        void sendDatagramTo(const HostAndPort& hostAndPort, std::uint32_t peerPlayerId, const char* datagram, int len, int nRepeats);
     };
 
 }
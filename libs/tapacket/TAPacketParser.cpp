@@ -7,6 +7,7 @@
 #include <cstring>
 #include <fstream>
 #include <sstream>
+#include <stdexcept>
 
 #include "taflib/HexDump.h"
 #include "taflib/Watchdog.h"
@@ -14,6 +15,7 @@
 using namespace tapacket;
 
 TAPacketParser::TAPacketParser() :
+    m_codeSubscribers(),
     m_progressTicks(0u)
 { }
 
@@ -21,15 +23,52 @@ void TAPacketParser::subscribe(TaPacketHandler* packetHandler)
 {
     if (packetHandler != NULL)
     {
-        m_packetHandlers.push_back(packetHandler);
+        const std::uint32_t handlerBit = addHandler(packetHandler, true);
+        for (std::uint32_t &subscribers : m_codeSubscribers)
+        {
+            subscribers |= handlerBit;
+        }
+    }
+}
+
+void TAPacketParser::subscribe(TaPacketHandler* packetHandler, const std::set<SubPacketCode> &subPacketCodes)
+{
+    if (packetHandler != NULL)
+    {
+        const std::uint32_t handlerBit = addHandler(packetHandler, false);
+        for (SubPacketCode code : subPacketCodes)
+        {
+            m_codeSubscribers[std::uint8_t(code)] |= handlerBit;
+        }
+    }
+}
+
+std::uint32_t TAPacketParser::addHandler(TaPacketHandler* packetHandler, bool wantsAllCodes)
+{
+    if (m_packetHandlers.size() >= MAX_HANDLERS)
+    {
+        throw std::runtime_error("[TAPacketParser::addHandler] too many packet handlers");
     }
+    m_packetHandlers.push_back(packetHandler);
+    m_handlerWantsAllCodes.push_back(wantsAllCodes);
+    return 1u << (m_packetHandlers.size() - 1u);
 }
 
-std::set<SubPacketCode> TAPacketParser::parseGameData(bool isLocalSource, const char *data, int len)
+SubPacketCodeSet TAPacketParser::parseGameData(bool isLocalSource, const char *data, int len)
 {
-    taflib::Watchdog wd("TAPacketParser::parseGameData", 100);
+    ParsedGameData parsed;
+    const SubPacketCodeSet codes = split(isLocalSource, data, len, parsed);
+    dispatch(parsed);
+    return codes;
+}
+
+SubPacketCodeSet TAPacketParser::split(bool isLocalSource, const char *data, int len, ParsedGameData &parsed)
+{
+    taflib::Watchdog wd("TAPacketParser::split", 100);
+    SubPacketCodeSet codes;
+    parsed.clear();
+
     const DPHeader *header = NULL;
-    m_parsedSubPacketCodes.clear();
     for (const char *ptr = data; ptr < data + len; ptr += header->size())
     {
         header = (const DPHeader*)ptr;
@@ -37,20 +76,38 @@ std::set<SubPacketCode> TAPacketParser::parseGameData(bool isLocalSource, const
         {
             std::uint32_t id1 = *(std::uint32_t*)data;
             std::uint32_t id2 = *(std::uint32_t*)(data + 4);
-            parseTaPacket(id1, id2, isLocalSource, data+8, len-8, "no dplay header");
-            return m_parsedSubPacketCodes;
+            splitTaPacket(id1, id2, isLocalSource, data+8, len-8, "no dplay header", parsed, codes);
+            return codes;
         }
 
         if (std::strncmp(header->actionstring, "play", 4) == 0)
         {
-            parseDplayPacket(header, ptr, header->size());
+            parsed.push_back(ParsedMessage());
+            parsed.back().dplay.assign((const std::uint8_t*)ptr, header->size());
         }
         else
         {
-            parseTaPacket(*(std::uint32_t*)header->actionstring, 0, isLocalSource, ptr + sizeof(DPHeader), header->size() - sizeof(DPHeader), "with dplay header");
+            splitTaPacket(*(std::uint32_t*)header->actionstring, 0, isLocalSource, ptr + sizeof(DPHeader), header->size() - sizeof(DPHeader), "with dplay header", parsed, codes);
+        }
+    }
+    return codes;
+}
+
+void TAPacketParser::dispatch(const ParsedGameData &parsed)
+{
+    taflib::Watchdog wd("TAPacketParser::dispatch", 100);
+    for (const ParsedMessage &message : parsed)
+    {
+        if (!message.dplay.empty())
+        {
+            const DPHeader *header = (const DPHeader*)message.dplay.data();
+            parseDplayPacket(header, (const char*)message.dplay.data(), message.dplay.size());
+        }
+        else
+        {
+            dispatchTaPacket(message);
         }
     }
-    return m_parsedSubPacketCodes;
 }
 
 std::uint32_t TAPacketParser::getProgressTicks()
@@ -223,67 +280,112 @@ void TAPacketParser::parseDplayDeletePlayer(const DPHeader *header, const char *
     }
 }
 
-void TAPacketParser::parseTaPacket(std::uint32_t sourceDplayId, std::uint32_t otherDplayId, bool isLocalSource, const char *_payload, int _payloadSize, const std::string & context)
+void TAPacketParser::splitTaPacket(std::uint32_t sourceDplayId, std::uint32_t otherDplayId, bool isLocalSource, const char *_payload, int _payloadSize, const std::string & context,
+    ParsedGameData &parsed, SubPacketCodeSet &codes)
 {
-    taflib::Watchdog wd("TAPacketParser::parseTaPacket", 100);
+    taflib::Watchdog wd("TAPacketParser::splitTaPacket", 100);
     if (m_progressTicks > 0u && otherDplayId == 0u && m_taDuplicateDetection.isLikelyDuplicate(sourceDplayId, otherDplayId, _payload, _payloadSize))
     {
         return;
     }
     bytestring payload((const std::uint8_t*)_payload, _payloadSize);
     {
-        taflib::Watchdog wd2("TAPacketParser::parseTaPacket decrypt", 100);
+        taflib::Watchdog wd2("TAPacketParser::splitTaPacket decrypt", 100);
         std::uint16_t checksum[2];
         TPacket::decrypt(payload, 0u, checksum[0], checksum[1]);
         if (checksum[0] != checksum[1])
         {
-            qWarning() << "[TAPacketParser::parseTaPacket] checksum mismatch! context=" << context.c_str();
+            qWarning() << "[TAPacketParser::splitTaPacket] checksum mismatch! context=" << context.c_str();
             return;
         }
     }
 
     if (PacketCode(payload[0]) == PacketCode::COMPRESSED)
     {
-        taflib::Watchdog wd3("TAPacketParser::parseTaPacket decompress", 100);
+        taflib::Watchdog wd3("TAPacketParser::splitTaPacket decompress", 100);
         payload = TPacket::decompress(payload, 3);
         if (payload[0] != 0x03)
         {
-            //qWarning() << "[TAPacketParser::parseTaPacket] decompression ran out of bytes! context=" << QString::fromStdString(context);
+            //qWarning() << "[TAPacketParser::splitTaPacket] decompression ran out of bytes! context=" << QString::fromStdString(context);
         }
     }
 
+    parsed.push_back(ParsedMessage());
+    ParsedMessage &message = parsed.back();
+    message.sourceDplayId = sourceDplayId;
+    message.otherDplayId = otherDplayId;
+    message.isLocalSource = isLocalSource;
+    message.encrypted.assign((const std::uint8_t*)_payload, _payloadSize);
+    message.payload.swap(payload);
+
+    // subpackets are only located here.  dispatch copies out those that someone subscribed to
+    taflib::Watchdog wd4("TAPacketParser::splitTaPacket unsmartpak", 100);
+    for (SubPacketSplitter splitter(message.payload, true, true); splitter.next(); )
+    {
+        const SubPacketCode code = splitter.code();
+        if (!splitter.isExpectedSize())
+        {
+            std::ostringstream ss;
+            taflib::StrHexDump(message.payload.data(), message.payload.size(), ss);
+            qWarning() << "[TAPacketParser::splitTaPacket] subpacket" << unsigned(code) << "error. expected size:" << TPacket::getExpectedSubPacketSize(splitter.subpacket()) << "actual size:" << splitter.subpacket().size() << "\n" << ss.str().c_str();
+        }
+        else
+        {
+            codes.insert(code);
+            if (code == SubPacketCode::UNIT_STAT_AND_MOVE_2C)
+            {
+                m_progressTicks = std::max(splitter.tick(), m_progressTicks);
+            }
+        }
+
+        if (m_codeSubscribers[std::uint8_t(code)] != 0u)
+        {
+            ParsedMessage::SubPacketSpan span;
+            span.offset = std::uint32_t(splitter.data() - message.payload.data());
+            span.size = splitter.size();
+            span.tick = splitter.tick();
+            span.code = code;
+            message.subpaks.push_back(span);
+        }
+    }
+}
+
+void TAPacketParser::dispatchTaPacket(const ParsedMessage &message)
+{
+    taflib::Watchdog wd("TAPacketParser::dispatchTaPacket", 100);
+
+    // handlers who want every one of the subpackets can be given subpaks as is
     std::vector<bytestring> subpaks;
+    subpaks.reserve(message.subpaks.size());
+    std::uint32_t handlersWantingAll = ~0u;
+    for (const ParsedMessage::SubPacketSpan &span : message.subpaks)
     {
-        taflib::Watchdog wd3("TAPacketParser::parseTaPacket unsmartpak", 100);
-        subpaks = TPacket::unsmartpak(payload, true, true);
+        subpaks.push_back(SubPacketSplitter::expand(message.payload.data() + span.offset, span.size, span.tick));
+        handlersWantingAll &= m_codeSubscribers[std::uint8_t(span.code)];
     }
 
-    for (const tapacket::bytestring& s : subpaks)
+    const char *encrypted = (const char*)message.encrypted.data();
+    const int sizeEncrypted = int(message.encrypted.size());
+    for (std::size_t n = 0u; n < m_packetHandlers.size(); ++n)
     {
-        unsigned expectedSize = TPacket::getExpectedSubPacketSize(s);
-        if (expectedSize == 0u || s.size() != expectedSize)
+        const std::uint32_t handlerBit = 1u << n;
+        if (m_handlerWantsAllCodes[n] || ((handlersWantingAll & handlerBit) && !subpaks.empty()))
         {
-            std::ostringstream ss;
-            taflib::StrHexDump(payload.data(), payload.size(), ss);
-            qWarning() << "[TAPacketParser::parseTaPacket] subpacket" << unsigned(s[0]) << "error. expected size:" << expectedSize << "actual size:" << s.size() << "\n" << ss.str().c_str();
+            m_packetHandlers[n]->onTaPacket(message.sourceDplayId, message.otherDplayId, message.isLocalSource, encrypted, sizeEncrypted, subpaks);
             continue;
         }
-        m_parsedSubPacketCodes.insert(SubPacketCode(s[0]));
 
-        switch (SubPacketCode(s[0]))
+        std::vector<bytestring> handlerSubpaks;
+        for (const bytestring& s : subpaks)
         {
-        case SubPacketCode::UNIT_STAT_AND_MOVE_2C:
+            if (m_codeSubscribers[s[0]] & handlerBit)
+            {
+                handlerSubpaks.push_back(s);
+            }
+        }
+        if (!handlerSubpaks.empty())
         {
-            std::uint32_t tick = *(std::uint32_t*)(&s[3]);
-            m_progressTicks = std::max(tick, m_progressTicks);
+            m_packetHandlers[n]->onTaPacket(message.sourceDplayId, message.otherDplayId, message.isLocalSource, encrypted, sizeEncrypted, handlerSubpaks);
         }
-        default:
-            break;
-        };
-    }
-
-    for (auto handler : m_packetHandlers)
-    {
-        handler->onTaPacket(sourceDplayId, otherDplayId, isLocalSource, _payload, _payloadSize, subpaks);
     }
 }
@@ -2,6 +2,7 @@
 
 #include <cinttypes>
 #include <set>
+#include <vector>
 
 #include <taflib/DuplicateDetection.h>
 
@@ -12,9 +13,47 @@ namespace tapacket
 
     struct DPHeader;
 
+    // one message from a game datagram, as left by TAPacketParser::split for TAPacketParser::dispatch.
+    // each stage's output is kept so that every handler shares the one copy
+    struct ParsedMessage
+    {
+        struct SubPacketSpan
+        {
+            std::uint32_t offset;   // into payload, as found in the packet (ie before any smartpak expansion)
+            std::uint32_t size;
+            std::uint32_t tick;     // see SubPacketSplitter::tick
+            SubPacketCode code;
+        };
+
+        // dplay system message (eg create player), decoded at dispatch.  empty for a TA packet
+        bytestring dplay;
+
+        // TA packet
+        std::uint32_t sourceDplayId;
+        std::uint32_t otherDplayId;
+        bool isLocalSource;
+        bytestring encrypted;                   // as received
+        bytestring payload;                     // decrypted and decompressed
+        std::vector<SubPacketSpan> subpaks;     // split.  only those with subscribers
+
+        ParsedMessage() : sourceDplayId(0u), otherDplayId(0u), isLocalSource(false) { }
+    };
+    typedef std::vector<ParsedMessage> ParsedGameData;
+
+    // packets go through the stages decrypt -> decompress -> split -> dispatch.
+    // split() runs the first three and tells the caller which subpacket codes the data holds (eg to choose how to forward it)
+    // dispatch() copies out subscribed subpackets and calls the handlers.
+    // dispatch() doesn't touch any state split() uses, so it may be deferred or run on another thread provided calls to each are serialised
     class TAPacketParser
     {
+        static const int MAX_HANDLERS = 32;
+
         std::vector<TaPacketHandler*> m_packetHandlers;
+        std::vector<bool> m_handlerWantsAllCodes;   // by m_packetHandlers index
+
+        // dispatch table.  bit n of m_codeSubscribers[code] is set if m_packetHandlers[n] subscribed to that SubPacketCode.
+        // subpackets nobody subscribed to are never copied out of the packet
+        std::uint32_t m_codeSubscribers[256];
 
         // TA sends the same packets once to each player
         // The parser sees each copy
@@ -22,19 +61,35 @@ namespace tapacket
         // and echoing resulting GameEventData multiple times
         taflib::DuplicateDetection m_taDuplicateDetection;
 
-        std::set<SubPacketCode> m_parsedSubPacketCodes;
         std::uint32_t m_progressTicks;
 
     public:
         TAPacketParser();
 
+        // handler receives every subpacket
         virtual void subscribe(TaPacketHandler* packetHandler);
-        virtual std::set<SubPacketCode> parseGameData(bool isLocalSource, const char *data, int len);
+
+        // handler receives only subpackets with the given codes and isn't called for packets containing none of them.
+        // smartpak'd subpackets are delivered expanded, ie as UNIT_STAT_AND_MOVE_2C
+        virtual void subscribe(TaPacketHandler* packetHandler, const std::set<SubPacketCode> &subPacketCodes);
+        // split() and dispatch() in one go
+        // @return codes of all well formed subpackets in data
+        virtual SubPacketCodeSet parseGameData(bool isLocalSource, const char *data, int len);
+
+        // @param parsed replaced by the messages in data that handlers are to see
+        // @return codes of all well formed subpackets in data
+        virtual SubPacketCodeSet split(bool isLocalSource, const char *data, int len, ParsedGameData &parsed);
+        virtual void dispatch(const ParsedGameData &parsed);
         virtual std::uint32_t getProgressTicks();
 
     private:
+        // @return handler's bit in m_codeSubscribers
+        virtual std::uint32_t addHandler(TaPacketHandler* packetHandler, bool wantsAllCodes);
+
         virtual void parseDplayPacket(const DPHeader *header, const char *data, int len);
-        virtual void parseTaPacket(std::uint32_t sourceDplayId, std::uint32_t otherDplayId, bool isLocalSource, const char *data, int len, const std::string &context);
+        virtual void splitTaPacket(std::uint32_t sourceDplayId, std::uint32_t otherDplayId, bool isLocalSource, const char *data, int len, const std::string &context,
+            ParsedGameData &parsed, SubPacketCodeSet &codes);
+        virtual void dispatchTaPacket(const ParsedMessage &message);
         virtual void parseDplaySuperEnumReply(const DPHeader *header, const char *data, int len);
         virtual void parseDplayCreateOrForwardPlayer(const DPHeader *header, const char *data, int len);
         virtual void parseDplayDeletePlayer(const DPHeader *header, const char *data, int len);
@@ -502,66 +502,16 @@ std::vector<bytestring> TPacket::slowUnsmartpak(const bytestring &_c, bool hasTi
 
 std::vector<bytestring> TPacket::unsmartpak(const bytestring &_c, bool hasTimestamp, bool hasChecksum)
 {
-    const std::uint8_t *ptr = _c.data();;
-    const std::uint8_t *end = ptr + _c.size();
-
     bytestring buffer;
     if (_c[0] == 0x04)
     {
         buffer = decompress(_c, hasChecksum ? 3 : 1);
-        ptr = buffer.data();
-        end = ptr + buffer.size();
     }
 
-    ++ptr;
-    if (hasChecksum) ptr += 2;
-    if (hasTimestamp) ptr += 4;
-
     std::vector<bytestring> ut;
-    std::uint32_t packnum = 0u;
-    while (ptr < end)
+    for (SubPacketSplitter splitter(buffer.empty() ? _c : buffer, hasTimestamp, hasChecksum); splitter.next(); )
     {
-        unsigned subpakLen = getExpectedSubPacketSize(ptr, end-ptr);
-        if (subpakLen == 0 || ptr+subpakLen > end)
-        {
-            subpakLen = end - ptr;
-        }
-
-        switch (SubPacketCode(ptr[0]))
-        {
-        case SubPacketCode::SMARTPAK_TICK_START_FE:
-        {
-            packnum = *(std::uint32_t*)(&ptr[1]);
-            break;
-        }
-
-        case SubPacketCode::SMARTPAK_TICK_FF:
-        {
-            bytestring tmp({ ',', 0x0b, 0, 'x', 'x', 'x', 'x', 0xff, 0xff, 1, 0 });
-            *(std::uint32_t*)(&tmp[3]) = packnum;
-            ++packnum;
-            ut.push_back(tmp);
-            break;
-        }
-
-        case SubPacketCode::SMARTPAK_TICK_OTHER_FD:
-        {
-            ut.push_back(bytestring());
-            bytestring &tmp = ut.back();
-            tmp.reserve(subpakLen + 4);
-            tmp.append(ptr, 3);
-            tmp.append((std::uint8_t*)&packnum, 4);
-            tmp.append(ptr + 3, subpakLen - 3);
-            ++packnum;
-            tmp[0] = 0x2c;
-            break;
-        }
-
-        default:
-            ut.push_back(bytestring());
-            ut.back().append(ptr, subpakLen);
-        };
-        ptr += subpakLen;
+        ut.push_back(splitter.subpacket());
     }
     return ut;
 }
@@ -606,6 +556,125 @@ bytestring SmartPaker::operator()(const bytestring& subpak)
     return result;
 }
 
+SubPacketSplitter::SubPacketSplitter(const bytestring& uncompressed, bool hasTimestamp, bool hasChecksum) :
+    m_ptr(uncompressed.data()),
+    m_end(uncompressed.data() + uncompressed.size()),
+    m_size(0u),
+    m_packnum(0u),
+    m_tick(0u)
+{
+    ++m_ptr;
+    if (hasChecksum) m_ptr += 2;
+    if (hasTimestamp) m_ptr += 4;
+}
+
+bool SubPacketSplitter::next()
+{
+    for (m_ptr += m_size; m_ptr < m_end; m_ptr += m_size)
+    {
+        m_size = TPacket::getExpectedSubPacketSize(m_ptr, m_end - m_ptr);
+        if (m_size == 0 || m_ptr + m_size > m_end)
+        {
+            m_size = m_end - m_ptr;
+        }
+
+        switch (SubPacketCode(m_ptr[0]))
+        {
+        case SubPacketCode::SMARTPAK_TICK_START_FE:
+            if (m_size >= 5u)
+            {
+                m_packnum = *(std::uint32_t*)(&m_ptr[1]);
+            }
+            continue;
+
+        case SubPacketCode::SMARTPAK_TICK_FF:
+        case SubPacketCode::SMARTPAK_TICK_OTHER_FD:
+            m_tick = m_packnum++;
+            return true;
+
+        default:
+            return true;
+        };
+    }
+    m_size = 0u;
+    return false;
+}
+
+SubPacketCode SubPacketSplitter::code() const
+{
+    switch (SubPacketCode(m_ptr[0]))
+    {
+    case SubPacketCode::SMARTPAK_TICK_FF:
+    case SubPacketCode::SMARTPAK_TICK_OTHER_FD:
+        return SubPacketCode::UNIT_STAT_AND_MOVE_2C;
+    default:
+        return SubPacketCode(m_ptr[0]);
+    };
+}
+
+std::uint32_t SubPacketSplitter::tick() const
+{
+    switch (SubPacketCode(m_ptr[0]))
+    {
+    case SubPacketCode::SMARTPAK_TICK_FF:
+    case SubPacketCode::SMARTPAK_TICK_OTHER_FD:
+        return m_tick;
+    default:
+        return m_size >= 7u ? *(std::uint32_t*)(&m_ptr[3]) : 0u;
+    };
+}
+
+bool SubPacketSplitter::isExpectedSize() const
+{
+    switch (SubPacketCode(m_ptr[0]))
+    {
+    case SubPacketCode::SMARTPAK_TICK_FF:
+        return true;
+    case SubPacketCode::SMARTPAK_TICK_OTHER_FD:
+        // expands by the 4 byte tick
+        return m_size >= 3u && *(std::uint16_t*)(&m_ptr[1]) == m_size + 4u;
+    default:
+    {
+        const unsigned expectedSize = TPacket::getExpectedSubPacketSize(m_ptr, m_size);
+        return expectedSize != 0u && expectedSize == m_size;
+    }
+    };
+}
+
+bytestring SubPacketSplitter::subpacket() const
+{
+    return expand(m_ptr, m_size, m_tick);
+}
+
+bytestring SubPacketSplitter::expand(const std::uint8_t* data, unsigned size, std::uint32_t tick)
+{
+    switch (SubPacketCode(data[0]))
+    {
+    case SubPacketCode::SMARTPAK_TICK_FF:
+    {
+        bytestring tmp({ ',', 0x0b, 0, 'x', 'x', 'x', 'x', 0xff, 0xff, 1, 0 });
+        *(std::uint32_t*)(&tmp[3]) = tick;
+        return tmp;
+    }
+
+    case SubPacketCode::SMARTPAK_TICK_OTHER_FD:
+        if (size >= 3u)
+        {
+            bytestring tmp;
+            tmp.reserve(size + 4);
+            tmp.append(data, 3);
+            tmp.append((const std::uint8_t*)&tick, 4);
+            tmp.append(data + 3, size - 3);
+            tmp[0] = 0x2c;
+            return tmp;
+        }
+        return bytestring(data, size);
+
+    default:
+        return bytestring(data, size);
+    };
+}
+
 bytestring TPacket::createChatSubpacket(const std::string& message)
 {
     char chatMessage[65];
@@ -2,6 +2,7 @@
 
 #include <string>
 #include <cstdint>
+#include <initializer_list>
 #include <vector>
 
 namespace tapacket
@@ -67,6 +68,35 @@ namespace tapacket
         SMARTPAK_TICK_FF  = 0xff
     };
 
+    // set of SubPacketCodes held as a 256 bit bitmap.  no allocation, and membership tests are a mask AND
+    class SubPacketCodeSet
+    {
+        std::uint64_t m_bits[4];
+
+    public:
+        SubPacketCodeSet() { clear(); }
+        SubPacketCodeSet(std::initializer_list<SubPacketCode> codes)
+        {
+            clear();
+            for (SubPacketCode code : codes)
+            {
+                insert(code);
+            }
+        }
+
+        void clear() { m_bits[0] = m_bits[1] = m_bits[2] = m_bits[3] = 0u; }
+        void insert(SubPacketCode code) { m_bits[std::uint8_t(code) >> 6] |= bit(code); }
+        bool contains(SubPacketCode code) const { return (m_bits[std::uint8_t(code) >> 6] & bit(code)) != 0u; }
+        bool empty() const { return (m_bits[0] | m_bits[1] | m_bits[2] | m_bits[3]) == 0u; }
+        bool intersects(const SubPacketCodeSet &other) const
+        {
+            return ((m_bits[0] & other.m_bits[0]) | (m_bits[1] & other.m_bits[1]) | (m_bits[2] & other.m_bits[2]) | (m_bits[3] & other.m_bits[3])) != 0u;
+        }
+
+    private:
+        static std::uint64_t bit(SubPacketCode code) { return std::uint64_t(1u) << (std::uint8_t(code) & 0x3f); }
+    };
+
     class TPing
     {
     public:
@@ -238,6 +268,43 @@ namespace tapacket
         bytestring operator() (const bytestring& subpak); 
     };
 
+    /// @brief walk the subpackets of an uncompressed packet in place, as TPacket::unsmartpak would split them,
+    /// without copying any of them unless asked to
+    class SubPacketSplitter
+    {
+        const std::uint8_t* m_ptr;
+        const std::uint8_t* m_end;
+        unsigned m_size;            // of current subpacket as found in the packet (ie before any smartpak expansion)
+        std::uint32_t m_packnum;    // tick implied by smartpak subpackets
+        std::uint32_t m_tick;       // tick of current subpacket if it was smartpak'd
+
+    public:
+        SubPacketSplitter(const bytestring& uncompressed, bool hasTimestamp, bool hasChecksum);
+
+        // advance to next subpacket.  SMARTPAK_TICK_START_FE only sets the tick so is never visited
+        // @return false if there are no more
+        bool next();
+
+        // SMARTPAK_TICK_FF and SMARTPAK_TICK_OTHER_FD are reported as UNIT_STAT_AND_MOVE_2C
+        SubPacketCode code() const;
+
+        // UNIT_STAT_AND_MOVE_2C only
+        std::uint32_t tick() const;
+
+        // whether subpacket is the size TPacket::getExpectedSubPacketSize says it should be once expanded
+        bool isExpectedSize() const;
+
+        // copy of the subpacket, with smartpak'd 0x2c expanded
+        bytestring subpacket() const;
+
+        // the subpacket as found in the packet.  valid while the packet is
+        const std::uint8_t* data() const { return m_ptr; }
+        unsigned size() const { return m_size; }
+
+        // as subpacket(), given data(), size() and tick() recorded earlier
+        static bytestring expand(const std::uint8_t* data, unsigned size, std::uint32_t tick);
+    };
+
     struct DPAddress;
     class TaPacketHandler
     {
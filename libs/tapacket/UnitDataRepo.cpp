@@ -1,28 +1,60 @@
 #include "UnitDataRepo.h"
 
+#include <algorithm>
+#include <cstring>
+
 using namespace tapacket;
 
-UnitDataRepo::UnitDataRepo()
+static const std::uint32_t SY_UNIT_ID = 0x92549357;
+
+std::uint32_t UnitDataRepo::Record::id() const
+{
+    std::uint32_t id;
+    std::memcpy(&id, bytes + 6, sizeof(id));
+    return id;
+}
+
+static bool keyLess(const UnitDataRepo::Record& record, const UnitDataRepo::SubAndId& key)
+{
+    return record.key() < key;
+}
+
+UnitDataRepo::UnitDataRepo() :
+    m_hashVersion(0u)
 {
 }
 
 void UnitDataRepo::clear()
 {
     m_unitData.clear();
+    m_enabledUnits.clear();
+    ++m_hashVersion;
 }
 
-const std::map<UnitDataRepo::SubAndId, bytestring>& UnitDataRepo::get() const
+const std::vector<UnitDataRepo::Record>& UnitDataRepo::get() const
 {
     return m_unitData;
 }
 
+const UnitDataRepo::Record* UnitDataRepo::find(std::uint8_t sub, std::uint32_t id) const
+{
+    const SubAndId key(sub, id);
+    auto it = std::lower_bound(m_unitData.begin(), m_unitData.end(), key, keyLess);
+    return it != m_unitData.end() && it->key() == key ? &*it : NULL;
+}
+
+UnitDataRepo::Record* UnitDataRepo::find(std::uint8_t sub, std::uint32_t id)
+{
+    return const_cast<Record*>(static_cast<const UnitDataRepo*>(this)->find(sub, id));
+}
+
 void UnitDataRepo::add(const bytestring& packetData)
 {
     if (packetData.empty() || packetData[0] != std::uint8_t(SubPacketCode::UNIT_DATA_1A))
     {
         return;
     }
-    if (packetData.size() != TPacket::getExpectedSubPacketSize(packetData))
+    if (packetData.size() != TPacket::getExpectedSubPacketSize(packetData) || packetData.size() != RECORD_SIZE)
     {
         return;
     }
@@ -34,20 +66,30 @@ void UnitDataRepo::add(const bytestring& pd, const TUnitData& ud)
 {
     if (ud.sub == 2 || ud.sub == 3 || ud.sub == 9)
     {
-        auto it = m_unitData.find(SubAndId(ud.sub, ud.id));
-        if (3 == ud.sub && it != m_unitData.end())
+        Record* record = find(ud.sub, ud.id);
+        if (3 == ud.sub && record != NULL)
         {
             // hack to be removed once clients are on >= 0.14.3
-            bytestring& bs = it->second;
-            tapacket::TUnitData oldUd(bs);
+            tapacket::TUnitData oldUd(record->subpacket());
             if (oldUd.u.statusAndLimit[0] != 0x0101)
             {
-                bs = pd;
+                std::memcpy(record->bytes, pd.data(), RECORD_SIZE);
             }
         }
+        else if (record != NULL)
+        {
+            std::memcpy(record->bytes, pd.data(), RECORD_SIZE);
+        }
         else
         {
-            m_unitData[SubAndId(ud.sub, ud.id)] = pd;
+            Record newRecord;
+            std::memcpy(newRecord.bytes, pd.data(), RECORD_SIZE);
+            m_unitData.insert(std::lower_bound(m_unitData.begin(), m_unitData.end(), newRecord.key(), keyLess), newRecord);
+        }
+
+        if (ud.sub != 9)
+        {
+            updateEnabledUnit(ud.id);
         }
     }
     else if (ud.sub == 0)
@@ -56,21 +98,50 @@ void UnitDataRepo::add(const bytestring& pd, const TUnitData& ud)
     }
 }
 
-void UnitDataRepo::hash(std::function<void(std::uint32_t)> f) const
+void UnitDataRepo::updateEnabledUnit(std::uint32_t id)
 {
-    const std::uint32_t SY_UNIT_ID = 0x92549357;
-    for (auto it = m_unitData.begin(); it != m_unitData.end(); ++it)
+    // enabled if status says so and we also have the unit's crc
+    const Record* record03 = find(0x03, id);
+    const Record* record02 = find(0x02, id);
+    const bool isEnabled =
+        record03 != NULL &&
+        record02 != NULL &&
+        SY_UNIT_ID != id &&
+        0x0101 == TUnitData(record03->subpacket()).u.statusAndLimit[0];
+
+    auto it = std::lower_bound(m_enabledUnits.begin(), m_enabledUnits.end(), std::make_pair(id, std::uint32_t(0u)));
+    const bool wasEnabled = it != m_enabledUnits.end() && it->first == id;
+    if (isEnabled)
     {
-        TUnitData ud(it->second);
-        auto it02 = m_unitData.find(SubAndId(0x02, ud.id));
-        if (0x03 == ud.sub &&
-            0x0101 == ud.u.statusAndLimit[0] &&
-            SY_UNIT_ID != ud.id &&
-            it02 != m_unitData.end())
+        TUnitData ud02(record02->subpacket());
+        const std::uint32_t datum = ud02.id + ud02.u.crc;
+        if (!wasEnabled)
         {
-            TUnitData ud02(it02->second);
-            f(ud02.id + ud02.u.crc);
+            m_enabledUnits.insert(it, std::make_pair(id, datum));
+            ++m_hashVersion;
         }
+        else if (it->second != datum)
+        {
+            it->second = datum;
+            ++m_hashVersion;
+        }
+    }
+    else if (wasEnabled)
+    {
+        m_enabledUnits.erase(it);
+        ++m_hashVersion;
     }
 }
 
+void UnitDataRepo::hash(std::function<void(std::uint32_t)> f) const
+{
+    for (const auto& enabledUnit : m_enabledUnits)
+    {
+        f(enabledUnit.second);
+    }
+}
+
+std::uint32_t UnitDataRepo::hashVersion() const
+{
+    return m_hashVersion;
+}
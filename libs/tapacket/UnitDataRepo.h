@@ -4,7 +4,7 @@
 
 #include <cinttypes>
 #include <functional>
-#include <map>
+#include <vector>
 
 namespace tapacket
 {
@@ -13,18 +13,41 @@ namespace tapacket
     {
     public:
         typedef std::pair <std::uint8_t, std::uint32_t> SubAndId;
+        static const unsigned RECORD_SIZE = 14u;    // of a UNIT_DATA_1A subpacket
+
+        // one UNIT_DATA_1A subpacket, as received
+        struct Record
+        {
+            std::uint8_t bytes[RECORD_SIZE];
+
+            std::uint8_t sub() const { return bytes[1]; }
+            std::uint32_t id() const;
+            SubAndId key() const { return SubAndId(sub(), id()); }
+            bytestring subpacket() const { return bytestring(bytes, RECORD_SIZE); }
+        };
 
         UnitDataRepo();
         void clear();
         void add(const bytestring& packetData);
 
-        const std::map<SubAndId, bytestring>& get() const;
+        // sorted by sub,id
+        const std::vector<Record>& get() const;
+        const Record* find(std::uint8_t sub, std::uint32_t id) const;
+
+        // data identifying the enabled units, in unit id order. O(number of enabled units)
         void hash(std::function<void(std::uint32_t)> f) const;
 
+        // changes whenever the data hash() reports changes, so that digests of it can be cached
+        std::uint32_t hashVersion() const;
+
     private:
-        std::map<SubAndId, bytestring> m_unitData;      // keyed by sub,id
+        std::vector<Record> m_unitData;
+        std::vector<std::pair<std::uint32_t, std::uint32_t> > m_enabledUnits;   // (id, datum reported by hash()) sorted by id.  maintained by add()
+        std::uint32_t m_hashVersion;
 
         void add(const bytestring& pd, const TUnitData& unitData);
+        Record* find(std::uint8_t sub, std::uint32_t id);
+        void updateEnabledUnit(std::uint32_t id);
     };
 
-}
\ No newline at end of file
+}
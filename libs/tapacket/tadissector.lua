@@ -17,12 +17,13 @@ local get_action_name =
   [5] = "TCP_DATA",
   [6] = "TCP_ACK",
   [7] = "TCP_RESEND",
-  [8] = "TCP_SEQ_REBASE",
-  [9] = "ENUM"
+  [8] = "MORE",
+  [9] = "ENUM",
   [10] = "UDP_PROTECTED",
   [11] = "PACKSIZE_TEST",
   [12] = "PACKSIZE_ACK",
-  [13] = "HELLO"
+  [13] = "HELLO",
+  [14] = "IDENTIFY"
 }
 
 -- create a function to dissect it
@@ -32,16 +33,30 @@ function tafnet_proto.dissector(buffer,pinfo,tree)
     local subtree = tree:add(tafnet_proto,buffer(),"Tafnet Protocol")
     
     local action_number = buffer(0,1):uint()
-    local action_name = get_action_name[action_number]
-    subtree:add(ACTION, action_number):append_text(" (" .. action_name .. ")")
+    local action_name = get_action_name[action_number] or "UNKNOWN"
+    subtree:add(ACTION, buffer(0,1)):append_text(" (" .. action_name .. ")")
+    pinfo.cols.info = action_name
 
-    if action_number >= 6 then
-        subtree:add_le( SEQ, buffer(4,4) )
-        subtree:add( DATA, buffer(8, length-8) )
-    else
+    -- TafnetBufferedHeader: action, then seq
+    if action_number >= 5 and length >= 5 then
+        subtree:add_le( SEQ, buffer(1,4) )
+        pinfo.cols.info:append(" seq=" .. buffer(1,4):le_uint())
+        if length > 5 then
+            subtree:add( DATA, buffer(5, length-5) )
+        end
+    elseif length > 1 then
         subtree:add( DATA, buffer(1, length-1) )
     end
 end
 
+-- 6112 is the usual lobby port.  TafnetNodes bound elsewhere (eg in captures from gpgnet4ta --capture) can be added here
+tafnet_proto.prefs.ports = Pref.range("UDP ports", "6112", "UDP ports carrying tafnet", 65535)
+
 udp_table = DissectorTable.get("udp.port")
-udp_table:add(6112,tafnet_proto)
+udp_table:add(tafnet_proto.prefs.ports, tafnet_proto)
+udp_table:add_for_decode_as(tafnet_proto)
+
+function tafnet_proto.prefs_changed()
+    udp_table:remove_all(tafnet_proto)
+    udp_table:add(tafnet_proto.prefs.ports, tafnet_proto)
+end
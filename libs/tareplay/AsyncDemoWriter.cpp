@@ -0,0 +1,195 @@
+#include "AsyncDemoWriter.h"
+
+#include <QtCore/qdebug.h>
+#include <QtCore/qfileinfo.h>
+
+#include <set>
+
+#ifdef WIN32
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+using namespace tareplay;
+
+AsyncDemoWriter::File::File(QString fileName) :
+    m_fileName(fileName),
+    m_bytesQueued(0u)
+{ }
+
+AsyncDemoWriter::AsyncDemoWriter(int commitIntervalMs) :
+    m_commitIntervalMs(commitIntervalMs),
+    m_stopping(false)
+{
+    qInfo() << "[AsyncDemoWriter::AsyncDemoWriter] starting writer thread. commit interval (ms):" << commitIntervalMs;
+    start();
+}
+
+AsyncDemoWriter::~AsyncDemoWriter()
+{
+    {
+        QMutexLocker lock(&m_mutex);
+        m_stopping = true;
+        m_wakeUp.wakeAll();
+    }
+    wait();
+}
+
+std::shared_ptr<AsyncDemoWriter::File> AsyncDemoWriter::open(QString fileName)
+{
+    std::shared_ptr<File> file(new File(fileName));
+    Entry entry;
+    entry.op = Op::OPEN;
+    entry.file = file;
+    enqueue(std::move(entry));
+    return file;
+}
+
+void AsyncDemoWriter::write(const std::shared_ptr<File>& file, const std::string& data)
+{
+    if (!file || data.empty())
+    {
+        return;
+    }
+    file->m_bytesQueued += data.size();
+
+    Entry entry;
+    entry.op = Op::WRITE;
+    entry.file = file;
+    entry.data = data;
+    enqueue(std::move(entry));
+}
+
+void AsyncDemoWriter::close(const std::shared_ptr<File>& file, QString renameTo)
+{
+    if (!file)
+    {
+        return;
+    }
+    Entry entry;
+    entry.op = Op::CLOSE;
+    entry.file = file;
+    entry.renameTo = renameTo;
+    enqueue(std::move(entry));
+}
+
+void AsyncDemoWriter::enqueue(Entry&& entry)
+{
+    QMutexLocker lock(&m_mutex);
+    m_queue.push_back(std::move(entry));
+}
+
+void AsyncDemoWriter::run()
+{
+    std::vector<Entry> entries;
+    bool stopping = false;
+    while (!stopping)
+    {
+        {
+            // writers don't wake us. records accumulate until the commit interval elapses
+            QMutexLocker lock(&m_mutex);
+            if (!m_stopping)
+            {
+                m_wakeUp.wait(&m_mutex, m_commitIntervalMs);
+            }
+            entries.swap(m_queue);
+            stopping = m_stopping;
+        }
+
+        try
+        {
+            commit(entries);
+        }
+        catch (const std::exception & e)
+        {
+            qWarning() << "[AsyncDemoWriter::run] exception:" << e.what();
+        }
+        catch (...)
+        {
+            qWarning() << "[AsyncDemoWriter::run] general exception:";
+        }
+        entries.clear();
+    }
+}
+
+void AsyncDemoWriter::commit(std::vector<Entry>& entries)
+{
+    std::set<File*> dirtyFiles;
+    for (Entry& entry : entries)
+    {
+        QFile& file = entry.file->m_file;
+        switch (entry.op)
+        {
+        case Op::OPEN:
+            file.setFileName(entry.file->m_fileName);
+            if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+            {
+                qWarning() << "[AsyncDemoWriter::commit] unable to open" << entry.file->m_fileName << file.errorString();
+            }
+            break;
+
+        case Op::WRITE:
+            if (file.isOpen())
+            {
+                file.write(entry.data.data(), entry.data.size());
+                dirtyFiles.insert(entry.file.get());
+            }
+            break;
+
+        case Op::CLOSE:
+            dirtyFiles.erase(entry.file.get());
+            if (file.isOpen())
+            {
+                file.flush();
+                if (!syncFile(file))
+                {
+                    qWarning() << "[AsyncDemoWriter::commit] unable to sync" << entry.file->m_fileName;
+                }
+                file.close();
+            }
+            if (entry.renameTo.isEmpty())
+            {
+                QFile::remove(entry.file->m_fileName);
+            }
+            else if (QFile::rename(entry.file->m_fileName, entry.renameTo))
+            {
+                syncDirectory(QFileInfo(entry.renameTo).absolutePath());
+            }
+            else
+            {
+                qWarning() << "[AsyncDemoWriter::commit] unable to rename" << entry.file->m_fileName << "to" << entry.renameTo;
+            }
+            break;
+        }
+    }
+
+    // one flush per file per commit interval, regardless of how many records arrived
+    for (File* file : dirtyFiles)
+    {
+        file->m_file.flush();
+    }
+}
+
+bool AsyncDemoWriter::syncFile(QFile& file)
+{
+#ifdef WIN32
+    return _commit(file.handle()) == 0;
+#else
+    return ::fsync(file.handle()) == 0;
+#endif
+}
+
+void AsyncDemoWriter::syncDirectory(QString path)
+{
+#ifndef WIN32
+    // make the rename itself durable
+    int fd = ::open(path.toStdString().c_str(), O_RDONLY);
+    if (fd >= 0)
+    {
+        ::fsync(fd);
+        ::close(fd);
+    }
+#endif
+}
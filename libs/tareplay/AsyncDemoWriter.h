@@ -0,0 +1,67 @@
+#pragma once
+
+#include <QtCore/qfile.h>
+#include <QtCore/qmutex.h>
+#include <QtCore/qstring.h>
+#include <QtCore/qthread.h>
+#include <QtCore/qwaitcondition.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace tareplay {
+
+    // Moves demo file IO off the network thread.
+    // Records are queued by the owning thread and group-committed by a background thread every commitIntervalMs
+    class AsyncDemoWriter : public QThread
+    {
+    public:
+        class File
+        {
+            friend class AsyncDemoWriter;
+            QString m_fileName;
+            QFile m_file;                   // only touched by the writer thread
+            std::uint64_t m_bytesQueued;    // only touched by the queueing thread
+
+        public:
+            File(QString fileName);
+            QString fileName() const { return m_fileName; }
+            std::uint64_t bytesQueued() const { return m_bytesQueued; }
+        };
+
+        AsyncDemoWriter(int commitIntervalMs);
+        ~AsyncDemoWriter();     // commits everything outstanding before returning
+
+        // file is created/truncated by the writer thread
+        std::shared_ptr<File> open(QString fileName);
+        void write(const std::shared_ptr<File>& file, const std::string& data);
+
+        // flush, sync and close the file. then durably rename it to renameTo, or remove it if renameTo is empty
+        void close(const std::shared_ptr<File>& file, QString renameTo);
+
+    private:
+        enum class Op { OPEN, WRITE, CLOSE };
+        struct Entry
+        {
+            Op op;
+            std::shared_ptr<File> file;
+            std::string data;
+            QString renameTo;
+        };
+
+        void enqueue(Entry&& entry);
+        void run() override;
+        void commit(std::vector<Entry>& entries);
+        static bool syncFile(QFile& file);
+        static void syncDirectory(QString path);
+
+        const int m_commitIntervalMs;
+        QMutex m_mutex;
+        QWaitCondition m_wakeUp;
+        std::vector<Entry> m_queue;     // guarded by m_mutex. swapped out wholesale by the writer thread
+        bool m_stopping;                // guarded by m_mutex
+    };
+
+}
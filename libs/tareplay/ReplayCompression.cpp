@@ -0,0 +1,72 @@
+#include "ReplayCompression.h"
+
+#include <zlib.h>
+
+using namespace tareplay;
+
+static const int MAX_UNCOMPRESSED_SIZE = 1024 * 1024; // far more than a chunk, so a bad size prefix can't make us allocate much
+
+QByteArray ReplayCompression::compress(const QByteArray& data)
+{
+    const QByteArray& dict = dictionary();
+    z_stream stream = {};
+    if (deflateInit(&stream, Z_BEST_COMPRESSION) != Z_OK)
+    {
+        return QByteArray();
+    }
+    deflateSetDictionary(&stream, (const Bytef*)dict.data(), uInt(dict.size()));
+
+    QByteArray result(4 + int(deflateBound(&stream, uLong(data.size()))), '\0');
+    const quint32 size = quint32(data.size());
+    result[0] = char(size >> 24);
+    result[1] = char(size >> 16);
+    result[2] = char(size >> 8);
+    result[3] = char(size);
+
+    stream.next_in = (Bytef*)data.data();
+    stream.avail_in = uInt(data.size());
+    stream.next_out = (Bytef*)result.data() + 4;
+    stream.avail_out = uInt(result.size() - 4);
+    const int status = deflate(&stream, Z_FINISH);
+    result.truncate(4 + int(stream.total_out));
+    deflateEnd(&stream);
+    return status == Z_STREAM_END ? result : QByteArray();
+}
+
+QByteArray ReplayCompression::uncompress(const QByteArray& data)
+{
+    if (data.size() < 4)
+    {
+        return QByteArray();
+    }
+    const quint32 size = quint32(quint8(data[0])) << 24 | quint32(quint8(data[1])) << 16 | quint32(quint8(data[2])) << 8 | quint32(quint8(data[3]));
+    if (size > quint32(MAX_UNCOMPRESSED_SIZE))
+    {
+        return QByteArray();
+    }
+
+    z_stream stream = {};
+    if (inflateInit(&stream) != Z_OK)
+    {
+        return QByteArray();
+    }
+    QByteArray result(int(size), '\0');
+    stream.next_in = (Bytef*)data.data() + 4;
+    stream.avail_in = uInt(data.size() - 4);
+    stream.next_out = (Bytef*)result.data();
+    stream.avail_out = uInt(result.size());
+
+    int status = inflate(&stream, Z_FINISH);
+    if (status == Z_NEED_DICT)
+    {
+        const QByteArray& dict = dictionary();
+        if (stream.adler == adler32(adler32(0L, Z_NULL, 0), (const Bytef*)dict.data(), uInt(dict.size())) &&
+            inflateSetDictionary(&stream, (const Bytef*)dict.data(), uInt(dict.size())) == Z_OK)
+        {
+            status = inflate(&stream, Z_FINISH);
+        }
+    }
+    const bool ok = status == Z_STREAM_END && stream.total_out == size;
+    inflateEnd(&stream);
+    return ok ? result : QByteArray();
+}
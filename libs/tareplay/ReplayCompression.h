@@ -0,0 +1,25 @@
+#pragma once
+
+#include <QtCore/qbytearray.h>
+
+namespace tareplay {
+
+    // zlib with a preset dictionary, for TaReplayServerStatus::OK_COMPRESSED data.
+    // demo chunks are compressed independently so that each can be cached and shared by every subscriber,
+    // which leaves deflate little history to find matches in.  the dictionary makes up for that with typical .tad move records
+    class ReplayCompression
+    {
+    public:
+        // @return 4 byte big endian uncompressed size, as qCompress, followed by a zlib stream that requires dictionary()
+        static QByteArray compress(const QByteArray& data);
+
+        // @return empty if data is malformed, too big, or was compressed with a different dictionary
+        static QByteArray uncompress(const QByteArray& data);
+
+        // dictionary version 1, fixed data in ReplayCompressionDictionary.cpp.  the server only compresses for a client whose
+        // TaReplayServerSubscribe flags include FLAG_COMPRESSION_DICT_V1, and the zlib stream carries the dictionary's checksum,
+        // so a mismatch is detected rather than misread
+        static const QByteArray& dictionary();
+    };
+
+}
@@ -0,0 +1,1039 @@
+#include "ReplayCompression.h"
+
+using namespace tareplay;
+
+// dictionary version 1, as advertised by TaReplayServerSubscribe::FLAG_COMPRESSION_DICT_V1.
+// tapacket::TestPackets td1..td38 filtered into moves as TaDemoCompilerClient would and written as TADemoWriter's packet records,
+// keeping the last 32kB.  adler32 0x4ea64cb2, which is what zlib streams made with it carry.
+// NB server and client must have exactly these bytes.  never change them; add a new dictionary with its own subscribe flag instead
+static const char DICTIONARY_V1[] =
+    "\x82\x1a\x00\xaa\x01\x00\x00\x00\x66\x66\x01\x00\x00\x0b\x2d\x04" "\x4e\x02\x87\x00\x69\x01\x10\xc4\x00\x05\x00\x02\x2d\x3b\x00\x00" \
+    "\xc5\x08\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x0d\x53\x0a\x42" "\x0c\x65\xe4\x48\x00\xd3\xb9\x48\x10\x01\x00\x20\x0c\x99\xb9\x3c" \
+    "\x00\xf1\x75\x55\x11\x34\x00\x00\x7b\xeb\x07\x67\x04\x74\x02\x00" "\xfd\x47\x01\xca\x00\xd9\x8c\x8d\x80\xbc\x80\x87\x80\xc2\x80\x77" \
+    "\x80\xc2\x40\x0d\x90\xcd\xe8\x0a\x98\x0d\xe8\x0a\x88\x0d\x38\x0b" "\x38\x0d\x79\x01\xd9\x8c\x87\x80\xb2\x80\x87\x80\xba\x80\x75\x80" \
+    "\xcc\xa0\x17\x90\xed\x38\x08\xb8\x0a\xe8\x06\xb8\x0a\x98\x06\x68" "\x0a\x8a\x01\xd9\xd0\x1d\x90\xcd\xf8\x07\x08\x0b\x98\x07\x08\x0b" \
+    "\x48\x07\x58\x0b\xf4\x01\xd9\x8c\xb6\x80\x07\x81\xb6\x80\x05\x81" "\xac\x80\xfb\x10\x23\x90\xcd\x08\x08\xf8\x0d\xf8\x07\x08\x0e\xf8" \
+    "\x07\x58\x0e\x32\x02\xd9\x8e\xe3\x80\xe6\x80\xe8\x80\xe6\x80\xe8" "\x80\xeb\x30\x23\x90\x2d\x34\x02\xd9\x02\x27\x90\xed\xf8\x06\x68" \
+    "\x0e\xd8\x06\x88\x0e\xd8\x06\xd8\x0e\x7e\x02\xd9\x8c\x82\x80\xaf" "\x80\x7a\x80\xaf\x80\x6e\x80\xbb\xc0\x2d\x90\xed\x18\x07\x78\x0b" \
+    "\x78\x07\xd8\x0b\x28\x07\x28\x0c\x0c\x03\xd9\x8c\x79\x80\xc0\x80" "\x74\x80\xc0\x80\x73\x80\xc1\x10\x33\x90\xed\x98\x0c\x98\x0f\x38" \
+    "\x0c\x98\x0f\xe8\x0b\xe8\x0f\x48\x03\xd9\x8c\xe5\x80\xe9\x80\xe2" "\x80\xe9\x80\xe0\x80\xeb\x60\x37\x90\xcd\x08\x0d\x48\x0f\x98\x0c" \
+    "\xb8\x0f\x48\x0c\xb8\x0f\x8e\x03\xd9\x8e\xe4\x80\xf7\x80\xe1\x80" "\xf4\x80\xd0\x80\xf4\x30\x39\x90\xed\xe8\x0d\x68\x0f\x98\x0d\x18" \
+    "\x0f\x68\x0d\x48\x0f\xbb\x03\xd9\x8c\x70\x80\x05\x81\x7a\x80\xfb" "\x80\x80\x80\x01\xf1\xff\x3f\x1b\xf0\x01\x00\x40\x02\x00\xa0\x19" \
+    "\x00\x00\x6f\x00\xfe\xff\xdf\x1c\x00\xc0\x00\x00\x00\x00\x66\x66" "\x01\x00\x00\x0b\x2d\x04\x87\x03\x87\x00\x95\x01\x0b\x2d\x04\x06" \
+    "\x01\x87\x00\x8d\x01\x0a\xc1\x03\x00\x00\xff\x01\x12\xc1\x03\x96" "\x00\x10\x96\x00\x0b\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00" \
+    "\x00\x00\x00\x00\x00\x00\x00\x10\x98\x00\x0b\x00\x00\x00\x00\x00" "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x10\xf5\x01" \
+    "\x05\x00\x02\xec\x5f\x00\x00\xf5\x06\x00\x00\x00\x00\x00\x00\x00" "\x00\x00\x00\x10\x02\x02\x05\x00\x02\x31\x44\x00\x00\x78\x03\x00" \
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x10\x74\x02\x05\x00\x02\xa7" "\x5b\x00\x00\x0f\x08\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x10" \
+    "\xac\x02\x05\x00\x02\x78\x6b\x00\x00\xda\x07\x00\x00\x00\x00\x00" "\x00\x00\x00\x00\x00\xfd\x80\x01\x29\x00\xd9\x8e\xaa\x80\xff\x80" \
+    "\xa1\x80\xff\x80\x9c\x80\xfa\x00\x07\x50\x10\x95\x00\x05\x71\x09" "\x50\x10\xb8\x00\xd9\x8c\x91\x80\xbc\x80\x8c\x80\xbc\x80\x87\x80" \
+    "\xc1\x80\x14\x90\x8d\x08\x08\x58\x0f\x58\x08\x58\x0f\x53\x01\xd9" "\x8e\x7b\x80\xc9\x80\x7b\x80\xc4\x80\x66\x80\xc4\xb0\x16\x90\xed" \
+    "\x28\x07\x38\x0b\x28\x07\x88\x0b\x78\x07\xd8\x0b\x7e\x01\xd9\x8c" "\xd1\x80\xe9\x80\xd1\x80\xe4\x80\xd6\x80\xdf\x80\x18\x90\x0d\xa5" \
+    "\x01\xd9\x8c\x81\x80\xc4\x80\x7b\x80\xc4\x80\x71\x80\xce\x50\x23" "\x90\xed\x28\x0a\xb8\x0a\x28\x0a\x68\x0a\x78\x0c\x68\x0a\x36\x02" \
+    "\xd9\x8e\xb5\x80\xb3\x80\xbb\x80\xad\x80\xce\x80\xad\x70\x23\x90" "\xcd\xb8\x06\x28\x0d\xa8\x06\x28\x0d\x48\x06\x88\x0d\x38\x02\xd9" \
+    "\x8c\x52\x80\xdc\x80\x4d\x80\xe1\x80\x4d\x80\xee\x90\x23\x90\xed" "\xc8\x07\xc8\x0d\xc8\x07\xf8\x0d\xf8\x07\x28\x0e\x3a\x02\xd9\x8e" \
+    "\x93\x80\xb9\x80\x93\x80\xb7\x80\x98\x80\xb2\xb0\x2d\x90\xed\x38" "\x07\x18\x0f\x98\x07\x78\x0f\x98\x07\xc8\x0f\x00\x03\xd9\x8e\x8f" \
+    "\x80\xd2\x80\x9e\x80\xd2\x80\x9f\x80\xd1\xb0\x31\x90\xed\xa8\x0e" "\xd8\x0e\xc8\x0e\xf8\x0e\xc8\x0e\x88\x0f\x31\x03\xd9\x8c\xc9\x80" \
+    "\xf9\x80\xc3\x80\xf9\x80\xbe\x80\xfe\xc0\x35\x90\xcd\x58\x11\x38" "\x08\xe8\x0f\x38\x08\x98\x0f\x88\x08\x75\x03\xd9\x8e\x54\x80\xdf" \
+    "\x80\x54\x80\xe4\x80\x59\x80\xe9\xa0\x38\x90\xcd\x58\x05\x48\x0e" "\xe8\x05\xd8\x0e\x18\x06\xd8\x0e\xc0\x03\xd9\xf8\x0a\x61\x3a\x80" \
+    "\x99\x80\xe8\xa0\x3d\x90\xcd\xc8\x0d\x18\x0d\x98\x0d\x48\x0d\x38" "\x0d\xe8\x0c\xff\xff\xb3\x01\x1f\x00\x00\x04\x78\x48\x2b\x02\x00" \
+    "\x30\x07\x80\x07\xb5\x06\xe1\xc4\x0b\x47\xbf\x22\xdf\xcc\x2c\x00" "\x00\x3d\x04\x00\x00\x01\x03\x07\x1a\x04\x00\x00\x00\x00\x00\x00" \
+    "\x00\x00\x37\x02\x00\x00\x1a\x04\x00\x00\x00\x00\x00\x00\x00\x00" "\x37\x02\x00\x00\x1a\x04\x00\x00\x00\x00\x00\x00\x00\x00\x37\x02" \
+    "\x00\x00\x1a\x04\x00\x00\x00\x00\x00\x00\x00\x00\x37\x02\x00\x00" "\x1a\x04\x00\x00\x00\x00\x00\x00\x00\x00\x37\x02\x00\x00\x1a\x04" \
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x37\x02\x00\x00\x1a\x04\x00\x00" "\x00\x00\x00\x00\x00\x00\x37\x02\x00\x00\x1a\x04\x00\x00\x00\x00" \
+    "\x00\x00\x00\x00\x37\x02\x00\x00\x1a\x04\x00\x00\x00\x00\x00\x00" "\x00\x00\x37\x02\x00\x00\x1a\x04\x00\x00\x00\x00\x00\x00\x00\x00" \
+    "\x37\x02\x00\x00\x1a\x04\x00\x00\x00\x00\x00\x00\x00\x00\x37\x02" "\x00\x00\x1a\x04\x00\x00\x00\x00\x00\x00\x00\x00\x37\x02\x00\x00" \
+    "\x1a\x04\x00\x00\x00\x00\x00\x00\x00\x00\x37\x02\x00\x00\x1a\x04" "\x00\x00\x00\x00\x00\x00\x00\x00\x37\x02\x00\x00\x1a\x04\x00\x00" \
+    "\x00\x00\x00\x00\x00\x00\x37\x02\x00\x00\x1a\x04\x00\x00\x00\x00" "\x00\x00\x00\x00\x37\x02\x00\x00\x1a\x04\x00\x00\x00\x00\x00\x00" \
+    "\x00\x00\x37\x02\x00\x00\x1a\x04\x00\x00\x00\x00\x00\x00\x00\x00" "\x37\x02\x00\x00\x1a\x04\x00\x00\x00\x00\x00\x00\x00\x00\x37\x02" \
+    "\x00\x00\x1a\x04\x00\x00\x00\x00\x00\x00\x00\x00\x37\x02\x00\x00" "\x1a\x04\x00\x00\x00\x00\x00\x00\x00\x00\x37\x02\x00\x00\x1a\x04" \
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x37\x02\x00\x00\x1a\x04\x00\x00" "\x00\x00\x00\x00\x00\x00\x37\x02\x00\x00\x1a\x04\x00\x00\x00\x00" \
+    "\x00\x00\x00\x00\x37\x02\x00\x00\x1a\x04\x00\x00\x00\x00\x00\x00" "\x00\x00\x37\x02\x00\x00\x1a\x04\x00\x00\x00\x00\x00\x00\x00\x00" \
+    "\x37\x02\x00\x00\x1a\x04\x00\x00\x00\x00\x00\x00\x00\x00\x37\x02" "\x00\x00\x1a\x04\x00\x00\x00\x00\x00\x00\x00\x00\x37\x02\x00\x00" \
+    "\x1a\x04\x00\x00\x00\x00\x00\x00\x00\x00\x37\x02\x00\x00\x1a\x04" "\x00\x00\x00\x00\x00\x00\x00\x00\x37\x02\x00\x00\x1a\x04\x00\x00" \
+    "\x00\x00\x00\x00\x00\x00\x37\x02\x00\x00\x1a\x04\x00\x00\x00\x00" "\x00\x00\x00\x00\x37\x02\x00\x00\x1a\x04\x00\x00\x00\x00\x00\x00" \
+    "\x00\x00\x37\x02\x00\x00\x1a\x04\x00\x00\x00\x00\x00\x00\x00\x00" "\x37\x02\x00\x00\x1a\x04\x00\x00\x00\x00\x00\x00\x00\x00\x37\x02" \
+    "\x00\x00\x1a\x04\x00\x00\x00\x00\x00\x00\x00\x00\x37\x02\x00\x00" "\x1a\x04\x00\x00\x00\x00\x00\x00\x00\x00\x37\x02\x00\x00\x1a\x04" \
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x37\x02\x00\x00\x1a\x04\x00\x00" "\x00\x00\x00\x00\x00\x00\x37\x02\x00\x00\x1a\x04\x00\x00\x00\x00" \
+    "\x00\x00\x00\x00\x37\x02\x00\x00\x1a\x04\x00\x00\x00\x00\x00\x00" "\x00\x00\x37\x02\x00\x00\x1a\x04\x00\x00\x00\x00\x00\x00\x00\x00" \
+    "\x37\x02\x00\x00\x1a\x04\x00\x00\x00\x00\x00\x00\x00\x00\x37\x02" "\x00\x00\x1a\x04\x00\x00\x00\x00\x00\x00\x00\x00\x37\x02\x00\x00" \
+    "\x1a\x04\x00\x00\x00\x00\x00\x00\x00\x00\x37\x02\x00\x00\x1a\x04" "\x00\x00\x00\x00\x00\x00\x00\x00\x37\x02\x00\x00\x1a\x04\x00\x00" \
+    "\x00\x00\x00\x00\x00\x00\x37\x02\x00\x00\x1a\x04\x00\x00\x00\x00" "\x00\x00\x00\x00\x37\x02\x00\x00\x1a\x04\x00\x00\x00\x00\x00\x00" \
+    "\x00\x00\x37\x02\x00\x00\x1a\x04\x00\x00\x00\x00\x00\x00\x00\x00" "\x37\x02\x00\x00\x1a\x04\x00\x00\x00\x00\x00\x00\x00\x00\x37\x02" \
+    "\x00\x00\x1a\x04\x00\x00\x00\x00\x00\x00\x00\x00\x37\x02\x00\x00" "\x1a\x04\x00\x00\x00\x00\x00\x00\x00\x00\x37\x02\x00\x00\x1a\x04" \
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x37\x02\x00\x00\x1a\x04\x00\x00" "\x00\x00\x00\x00\x00\x00\x37\x02\x00\x00\x1a\x04\x00\x00\x00\x00" \
+    "\x00\x00\x00\x00\x37\x02\x00\x00\x1a\x04\x00\x00\x00\x00\x00\x00" "\x00\x00\x37\x02\x00\x00\x1a\x04\x00\x00\x00\x00\x00\x00\x00\x00" \
+    "\x37\x02\x00\x00\x1a\x04\x00\x00\x00\x00\x00\x00\x00\x00\x37\x02" "\x00\x00\x1a\x04\x00\x00\x00\x00\x00\x00\x00\x00\x37\x02\x00\x00" \
+    "\x1a\x04\x00\x00\x00\x00\x00\x00\x00\x00\x37\x02\x00\x00\x1a\x04" "\x00\x00\x00\x00\x00\x00\x00\x00\x37\x02\x00\x00\x1a\x04\x00\x00" \
+    "\x00\x00\x00\x00\x00\x00\x37\x02\x00\x00\x1a\x04\x00\x00\x00\x00" "\x00\x00\x00\x00\x37\x02\x00\x00\x1a\x04\x00\x00\x00\x00\x00\x00" \
+    "\x00\x00\x37\x02\x00\x00\x1a\x04\x00\x00\x00\x00\x00\x00\x00\x00" "\x37\x02\x00\x00\x1a\x04\x00\x00\x00\x00\x00\x00\x00\x00\x37\x02" \
+    "\x00\x00\x1a\x04\x00\x00\x00\x00\x00\x00\x00\x00\x37\x02\x00\x00" "\x1a\x04\x00\x00\x00\x00\x00\x00\x00\x00\x37\x02\x00\x00\x1a\x04" \
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x37\x02\x00\x00\x1a\x04\x00\x00" "\x00\x00\x00\x00\x00\x00\x37\x02\x00\x00\x1a\x04\x00\x00\x00\x00" \
+    "\x00\x00\x00\x00\x37\x02\x00\x00\x1a\x04\x00\x00\x00\x00\x00\x00" "\x00\x00\x37\x02\x00\x00\x1a\x04\x00\x00\x00\x00\x00\x00\x00\x00" \
+    "\x37\x02\x00\x00\x1a\x04\x00\x00\x00\x00\x00\x00\x00\x00\x37\x02" "\x00\x00\x1a\x04\x00\x00\x00\x00\x00\x00\x00\x00\x37\x02\x00\x00" \
+    "\x1a\x04\x00\x00\x00\x00\x00\x00\x00\x00\x37\x02\x00\x00\x68\x04" "\x00\x00\x01\x03\x0d\xff\x23\xc1\x07\x83\xa5\x49\x00\x19\x02\x7b" \
+    "\x0f\x5c\x4b\x2d\x06\x13\x9a\x3e\x00\xaf\x49\xc0\x0e\x68\xfe\x1d" "\x10\x6b\x00\x0e\x00\x35\x0a\x00\x10\x1c\x0b\x05\x00\x02\x0f\x2d" \
+    "\x00\x00\x60\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x0d\x18" "\xd0\xe6\x07\xb4\xa2\x49\x00\x3b\x50\x26\x10\xf3\x90\x1a\x06\x13" \
+    "\x9a\x3e\x00\x6f\x78\xcc\x0e\x68\xfe\x29\x20\x72\xff\x0e\x00\x2b" "\x0b\x00\xfe\xe7\xde\x02\x00\xfd\x50\x01\x4e\x00\x66\x30\x05\x60" \
+    "\x06\x6d\x00\x66\xe2\x08\x60\x06\x95\x00\x66\x10\x0a\x60\x06\xa9" "\x00\x66\x00\x0b\x60\x26\xc6\x00\x66\x60\x0d\x40\x20\x18\x40\x00" \
+    "\x00\xca\xc7\x07\x00\x80\x54\x00\x00\xd3\xf9\x0b\x05\x02\xcc\xc0" "\x20\xc0\x0c\x76\x02\xcc\x80\x27\xc0\x0c\x88\x02\xcc\x84\x2a\xc0" \
+    "\x0c\xd2\x02\xcc\x20\x2f\xc0\x0c\x0e\x03\xcc\x00\x33\xc0\x0c\x98" "\x03\xcc\x40\x3a\xc0\x0c\xfe\x03\xcc\xe0\x43\xc0\x0c\x60\x04\xcc" \
+    "\xc0\x48\xc0\x0c\xba\x04\xcc\xc0\x4d\xc0\x0c\xe0\x04\xcc\x40\x4e" "\xc0\x0c\xec\x04\xcc\x40\x51\xc0\x0c\x66\x05\xcc\xc0\x59\xc0\x0c" \
+    "\xc6\x05\xcc\x00\x5d\xc0\x0c\xde\x05\xcc\xc0\x62\xc0\x0c\x6e\x06" "\xcc\x18\xe1\x00\x29\x02\xf7\x00\x13\x02\xf7\x00\x09\xc2\x6e\xc0" \
+    "\x0c\x00\x07\xcc\x20\x71\xc0\x0c\x26\x07\xcc\x20\x75\xc0\x0c\x58" "\x07\xcc\x80\x76\xc0\x0c\xc4\x07\xcc\x80\x7e\xc0\x0c\x06\x08\xcc" \
+    "\x1c\xf1\x00\xf9\x01\xdb\x00\x0f\x02\xdb\x00\x55\xa2\x82\xc0\x0c" "\x2c\x08\xcc\xe0\x82\xc0\x4c\x52\x08\xcc\xc0\x86\xc0\x0c\x7c\x08" \
+    "\xcc\xa4\x8a\xc0\x0c\x4a\x09\xcc\xe0\x94\xc0\x4c\x88\x09\xcc\x60" "\x9d\xc0\x4c\xea\x09\xcc\x1c\x0f\x01\xf7\x01\x01\x01\xe9\x01\xe3" \
+    "\x00\xe9\xc1\xa2\xc0\x0c\x40\x0a\xcc\x18\x2d\x02\x11\x02\x2d\x02" "\x51\x02\xff\x01\x7f\xe2\xa9\xc0\x8c\xf1\x0e\x10\x1f\xb0\x0d\x10" \
+    "\x1f\x50\x0b\x70\x21\xfe\xff\x9b\x51\x14\x00\x00\xc8\x2f\x07\xb2" "\x03\x00\xe0\x0d\x40\xa3\xe9\xb1\x84\x58\x3c\x00\x00\x00\x00\x00" \
+    "\x00\x00\x00\x10\x35\x0a\x05\x00\x02\xe2\x12\x00\x00\x45\xff\x00" "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x10\x2b\x0b\x05\x00\x02\x8d" \
+    "\xcb\x00\x00\x71\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xfd" "\x4e\x01\x32\x00\x04\x82\x01\x04\x00\x10\xec\x10\x00\x00\x38\x04" \
+    "\x00\x40\xa4\xd9\xd0\x09\xc0\x0c\xa6\x00\xcc\xe0\x0b\xc0\x0c\xc0" "\x00\xcc\xa4\x0d\xc0\x4c\x1c\x01\xcc\x40\x15\xc0\x0c\xd0\x01\xcc" \
+    "\x44\x1e\xc0\x0c\xfc\x01\xcc\x40\x20\xc0\x0c\x0c\x02\xcc\xe0\x27" "\xc0\x0c\x88\x02\xcc\x24\x2b\xc0\x0c\xd2\x02\xcc\xe0\x34\xc0\x0c" \
+    "\x58\x03\xcc\x20\x37\xc0\x0c\x98\x03\xcc\x40\x3a\xc0\x0c\xfe\x03" "\xcc\xe0\x43\xc0\x0c\x8c\x04\xcc\xc0\x49\xc0\x0c\xdc\x04\xcc\xa0" \
+    "\x50\xc0\x0c\x26\x05\xcc\xa0\x55\xc0\x0c\x66\x05\xcc\xc0\x59\xc0" "\x0c\x9e\x05\xcc\x04\x5d\xc0\x0c\xea\x05\xcc\x00\x5f\xc0\x0c\x38" \
+    "\x06\xcc\x60\x69\xc0\x0c\xd8\x06\xcc\x20\x71\xc0\x0c\x52\x07\xcc" "\x80\x75\xc0\x0c\xde\x07\xcc\x84\x7e\xc0\x0c\x52\x08\xcc\xc0\x86" \
+    "\xc0\x0c\x7a\x08\xcc\xa0\x8a\xc0\x0c\xc4\x08\xcc\x40\x92\xc0\x0c" "\x4e\x09\xcc\xe4\xa4\xc0\x8c\xf1\x12\xb0\x2a\x30\x13\xf0\x2a\x70" \
+    "\x16\xf0\x2a\xc2\x0a\xcc\x1c\x1b\x02\xc3\x01\x1b\x02\x63\x02\xff" "\x01\x7f\x02\xad\xc0\x8c\x51\x0e\xd0\x23\xd0\x0e\x50\x23\xd0\x0e" \
+    "\x30\x20\x18\x0b\xcc\x18\x05\x01\xf1\x01\xc7\x00\x2f\x02\xc7\x00" "\x4d\x02\xb5\xc0\xcc\x31\x21\x90\x21\x30\x21\xf0\x20\xd0\x21\x50" \
+    "\x20\x66\x0b\xcc\xc0\xb6\xc0\x0c\x82\x0b\xcc\x18\xbd\x00\x1b\x02" "\xc7\x00\x25\x02\xdb\x00\x25\x42\xb9\xc0\x0c\xfe\xff\x9b\x51\x14" \
+    "\x00\x00\x08\xea\x26\x22\x02\x00\xe0\x0d\xc0\x55\x3e\x6a\x84\xd3" "\x25\x00\x00\x00\x00\x00\x00\x00\x00\x0d\xfa\x26\xfd\x05\x17\x9d" \
+    "\x49\x00\x8e\x9b\x9e\x10\x37\xf7\x31\x06\x37\xe5\x3e\x00\x83\xff" "\xb1\x0e\x68\xfe\x4d\x00\xde\xfe\x0e\x00\xd8\x09\x00\xfd\x1d\x01" \
+    "\x4f\x00\x66\xf0\x05\x60\x06\x60\x00\x66\xa2\x06\x60\x06\x90\x00" "\x66\xa0\x0a\x60\x06\xe8\x00\x66\x22\x0f\x60\x06\xfe\x00\x66\xf0" \
+    "\x13\x60\x06\x59\x01\x66\xf0\x17\x60\x06\xa7\x01\x66\xc0\x1a\x60" "\x06\xb9\x01\x66\xf0\x1b\x60\x06\xc3\x01\x66\x60\x1f\x60\x06\x00" \
+    "\x02\x66\xc0\x20\x60\x06\x10\x02\x66\xe0\x24\x60\x06\x85\x02\x66" "\x30\x29\x60\x06\xad\x02\x66\xf0\x2c\x60\x26\xf5\x02\x66\x80\x2f" \
+    "\x60\x06\x1c\x03\x66\xb0\x34\x60\x06\x6c\x03\x66\x30\x38\x60\x06" "\x8c\x03\x66\x20\x3d\x60\x06\xef\x03\x66\xb2\x3f\x60\xc6\xf8\x05" \
+    "\x88\x10\xf8\x05\x28\x11\xd8\x06\x08\x12\xfc\x03\x66\xe0\x3f\x60" "\x06\x3d\x04\x66\xa0\x45\x60\xe6\x28\x10\x28\x10\x38\x10\x28\x10" \
+    "\x68\x10\x58\x10\x5c\x04\x66\x20\x46\x60\x06\x67\x04\x66\x10\x47" "\x60\x06\x7f\x04\x66\xd0\x48\x60\x06\x92\x04\x66\xe0\x4a\x60\x26" \
+    "\xb8\x04\x66\x10\x4c\x60\x06\x10\x05\x66\x80\x57\x60\x06\x8d\x05" "\x66\x8c\x7b\x80\x4d\x81\x6c\x80\x3e\x81\x6c\x80\x20\xf1\x58\x60" \
+    "\xe6\x68\x10\x68\x10\xb8\x10\x68\x10\xd8\x10\x88\x10\xb3\x05\x66" "\x60\x5b\x60\x06\xca\x05\x66\xf0\xff\xdf\xcc\x1e\x00\x00\x40\x92" \
+    "\xf4\x6f\x16\x00\x00\x6f\x00\xe0\x95\x90\x1f\xba\x04\x01\x00\x00" "\x00\x00\x00\x00\x00\x00\xb9\x04\x00\x00\x01\x03\xfe\x3d\xc3\x00" \
+    "\x00\xfd\xd4\x00\x33\x00\x66\xb0\x07\x60\x26\x95\x00\x66\x20\x0a" "\x60\x06\xb5\x00\x66\x90\x0b\x60\x06\xc8\x00\x66\x40\x11\x60\x06" \
+    "\x1e\x01\x66\xc0\x13\x60\xc6\xf8\x0c\xb8\x0b\xa8\x0c\xb8\x0b\x48" "\x0b\x58\x0a\x03\x02\x66\x50\x21\x60\xe6\xe8\x0d\xf8\x0c\x38\x0e" \
+    "\xa8\x0c\x38\x0e\x58\x0c\x2c\x02\x66\x8e\xdd\x80\xdb\x80\xdd\x80" "\xe0\x80\xe2\x80\xe0\x90\x24\x60\xe6\xd8\x0c\x68\x0c\xb8\x0c\x68" \
+    "\x0c\xa8\x0c\x58\x0c\x55\x02\x66\x8e\xbb\x80\xf2\x80\xbb\x80\xf7" "\x80\xba\x80\xf8\x30\x26\x60\xc6\xa8\x0b\x08\x10\xa8\x09\x08\x10" \
+    "\xc8\x08\x28\x0f\x67\x02\x66\x8e\xc1\x80\xfc\x80\xc1\x80\xee\x80" "\xc9\x80\xe6\xb0\x26\x60\xc6\xd8\x0b\xe8\x0f\x68\x0b\x78\x0f\x18" \
+    "\x09\x78\x0f\x74\x02\x66\x8c\xe4\x80\xf5\x80\xe4\x80\xe5\x80\xdd" "\x80\xde\xf0\xff\xdf\x8c\xa2\x00\x00\x40\x78\xce\x1b\x1c\x00\x00" \
+    "\x6f\x00\x08\x0c\x15\x1b\x9c\xae\x01\x00\x00\x00\xa0\xf0\x02\x00" "\x00\x10\x11\x00\x05\x00\x02\x30\xa8\x00\x00\x42\xff\x00\x00\x00" \
+    "\x00\x00\x00\x00\x00\x00\x00\x0d\xd2\xd6\xcf\x0a\xd8\x9e\x49\x00" "\x6f\xff\xbe\x0b\x4f\x57\xd2\x09\x37\xe5\x3e\x00\x50\x97\x19\x0a" \
+    "\x68\xfe\xe3\x15\x4f\xff\xf3\x05\x76\x00\x00\x0d\xd2\x9d\x9d\x07" "\xf1\x96\x49\x00\xb0\xf7\x33\x0c\x2f\x4f\x37\x07\x37\xe5\x3e\x00" \
+    "\x9d\xbd\x38\x0b\x68\xfe\xa2\x12\x1d\xff\x58\x06\x12\x01\x00\x0d" "\x70\xd5\x65\x0b\xb0\xa5\x49\x00\xe1\x49\xc0\x0b\x71\xef\x67\x0b" \
+    "\x97\x80\x3e\x00\x49\xfc\xc4\x09\x68\xfe\x27\x01\x01\x01\x3e\x06" "\x30\x01\x00\x10\x4c\x01\x05\x00\x02\x02\x71\x00\x00\x56\xff\x00" \
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x10\x6c\x01\x05\x00\x02\x0f" "\xbd\x00\x00\x5c\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x10" \
+    "\x77\x01\x05\x00\x02\x95\x52\x00\x00\x57\xff\x00\x00\x00\x00\x00" "\x00\x00\x00\x00\x00\x10\x34\x02\x05\x00\x02\xe2\xf9\x00\x00\x5d" \
+    "\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x10\x40\x02\x05\x00" "\x02\xc5\x16\x00\x00\x6a\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00" \
+    "\x00\xfd\xfb\x00\x1c\x00\x04\x70\x11\xc0\xcc\xb1\x19\x30\x19\xb0" "\x19\xd0\x19\x50\x19\x30\x1a\x48\x01\xcc\xc0\x15\xc0\x0c\xbc\x01" \
+    "\xcc\x60\x27\xc0\x0c\x94\x02\xcc\x1c\xa9\x01\xa1\x01\xa9\x01\x97" "\x01\xb9\x01\x97\x81\x2a\xc0\x0c\xf6\x02\xcc\x18\x93\x01\xf5\x01" \
+    "\x29\x01\xf5\x01\x19\x01\xe5\x41\x36\xc0\xcc\x91\x10\xb0\x18\xf0" "\x0f\xb0\x18\xf0\x0f\x50\x19\x72\x03\xcc\x1c\x95\x01\x85\x01\x99" \
+    "\x01\x85\x01\x9b\x01\x87\x01\x3c\xc0\x0c\xda\x03\xcc\x1c\xaf\x01" "\xd1\x01\xa5\x01\xd1\x01\xa1\x01\xcd\x61\x40\xc0\x0c\x1e\x04\xcc" \
+    "\x1c\x1f\x01\xe7\x01\x15\x01\xe7\x01\x15\x01\xdd\x41\x43\xc0\xcc" "\x91\x14\xb0\x1f\xd0\x13\xf0\x1e\x30\x12\xf0\x1e\x66\x04\xcc\x18" \
+    "\xfd\x00\xa1\x01\x01\x01\x9d\x01\x0d\x01\x9d\xa1\x47\xc0\xcc\x11" "\x19\x50\x1e\x70\x18\xf0\x1e\x30\x12\xf0\x1e\x94\x04\xcc\x1c\xbb" \
+    "\x01\x99\x01\xb1\x01\x8f\x01\xa7\x01\x8f\xe1\x4c\xc0\x8c\x31\x18" "\x90\x1f\x30\x18\xd0\x1d\x30\x19\xd0\x1c\xfe\xff\x9b\x51\x14\x00" \
+    "\x00\x48\xfa\xb3\x39\x03\x00\xe0\x0d\x40\x00\x00\x70\x03\xd9\x3f" "\x00\x00\x00\x00\x00\x30\x00\x00\x10\x1d\x00\x08\x00\x01\x00\x85" \
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x0a\xa5" "\x02\x00\x00\xff\x01\x12\xa5\x02\x2f\x00\x10\x2f\x00\x09\x00\x00" \
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00" "\x10\x30\x00\x09\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00" \
+    "\x00\x00\x00\x00\x00\x00\x10\x32\x00\x09\x00\x00\x00\x00\x00\x00" "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x10\x76\x00\x05" \
+    "\x00\x02\x45\xbf\x00\x00\x58\xff\x00\x00\x00\x00\x00\x00\x00\x00" "\x00\x00\x10\x12\x01\x05\x00\x02\xf6\x2f\x00\x00\xd4\xfe\x00\x00" \
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x10\x30\x01\x05\x00\x02\xb4\xaf" "\x00\x00\x49\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x0d\xd5" \
+    "\x28\x13\x08\x09\xa6\x49\x00\x76\xc5\x4b\x0d\x2f\x4f\x37\x07\x37" "\xe5\x3e\x00\x9d\xbd\x38\x0b\x68\xfe\x17\x16\x3f\xfc\x58\x06\x7b" \
+    "\x01\x00\x0d\xb4\x8a\x9e\x09\xef\xa3\x49\x00\x6a\x93\xb9\x0b\x4f" "\x57\xd2\x09\x37\xe5\x3e\x00\x50\x97\x19\x0a\x68\xfe\x69\xfd\x67" \
+    "\xff\xf3\x05\xd8\x01\x00\xfd\x0d\x01\x2e\x00\x04\x82\x01\x04\x00" "\x30\x28\x20\x00\x00\x38\x04\x00\xd0\x7b\xd8\xf0\x05\x80\x40\x30" \
+    "\x80\x00\x00\x84\xb0\x02\x00\x00\x87\x00\x00\xf6\x5b\x1b\xc6\x00" "\x10\x08\x06\x10\x00\x40\x04\x43\x00\x00\xe0\x10\x00\x80\x5f\x2f" \
+    "\xc3\x3d\x00\x33\xa9\x04\x30\x03\x51\x00\x33\x20\x05\x30\x83\x53" "\x00\x33\x70\x05\x30\x83\x5c\x00\x33\x30\x06\x30\x03\x64\x00\x33" \
+    "\xf0\x06\x30\x83\x74\x00\x33\x10\x08\x30\x63\x04\x05\xa4\x05\x04" "\x05\x7c\x05\x2c\x05\x7c\x05\x8a\x00\x33\xf0\x08\x30\x83\x9d\x00" \
+    "\x33\xf8\x0a\x30\x83\xc1\x00\x33\x47\x42\x40\x72\xc0\x47\x40\x72" "\xc0\x48\x40\x73\x40\x0c\x30\x83\xec\x00\x33\xc6\x4e\xc0\x5a\xc0" \
+    "\x4e\x40\x58\xc0\x51\x40\x58\x48\x10\x30\x63\xd4\x04\xac\x05\xfc" "\x04\x84\x05\x24\x05\x84\x05\x27\x01\x33\x47\x6d\xc0\x66\xc0\x6f" \
+    "\x40\x64\xc0\x6f\xc0\x60\x88\x13\x30\x63\x94\x06\xb4\x07\x94\x06" "\x8c\x07\x6c\x06\x64\x87\x3b\x01\x33\xc7\x6d\x40\x72\xc0\x6d\x40" \
+    "\x76\x40\x70\xc0\x78\x20\x15\x30\x43\x90\x01\x13\x0d\x94\x01\x84" "\x8d\xff\xff\x66\xc4\x04\x00\x00\x42\xa0\x36\x8e\x00\x00\x78\x03" \
+    "\xc0\x77\xec\xcc\xc0\x28\x08\x00\x00\x00\x40\x81\x15\x00\x00\xb4" "\x04\x00\x00\x01\x03\x10\x65\x00\x05\x00\x02\xd6\xbd\x00\x00\x36" \
+    "\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x10\x27\x05\x05\x00" "\x02\x1d\x3e\x00\x00\x53\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00" \
+    "\x00\xfe\x00\x87\x12\x00\xfd\xf2\x00\x31\x00\x04\x82\x01\x04\x00" "\x80\x8c\xa8\x00\x00\x20\x06\x00\xb0\xd4\xbc\xf0\x32\xc0\x8c\xb1" \
+    "\x15\xd0\x26\xf0\x14\xd0\x26\x30\x14\x90\x27\xba\x05\xcc\x1c\x55" "\x01\x8d\x02\x51\x01\x91\x02\x29\x01\x91\xa2\x6c\xc0\xcc\xb1\x20" \
+    "\xf0\x23\x90\x20\xd0\x23\x50\x20\xd0\x23\xf6\x06\xcc\x1c\xd7\x01" "\x8d\x02\xd7\x01\x91\x02\xc5\x01\xa3\xe2\x72\xc0\x8c\x31\x24\x30" \
+    "\x21\x90\x24\x30\x21\x30\x25\x90\x20\x42\x07\xcc\x1c\x15\x01\x55" "\x02\x0b\x01\x55\x02\xf1\x00\x3b\x82\x75\xc0\xcc\xb1\x13\x10\x23" \
+    "\xb0\x13\xf0\x21\xd0\x13\xd0\x21\x5a\x07\xcc\x1c\x33\x01\xdb\x01" "\x1f\x01\xdb\x01\x01\x01\xbd\x41\x79\xc0\xcc\x51\x14\x90\x27\xb0" \
+    "\x13\x90\x27\xb0\x13\x70\x27\x5e\x08\xcc\x1c\xcb\x01\xad\x02\xc1" "\x01\xb7\x02\x57\x01\xb7\xe2\x87\xc0\x8c\x11\x16\xf0\x26\xf0\x15" \
+    "\xf0\x26\xd0\x15\xd0\x26\xf4\x08\xcc\x1c\xdb\x01\x81\x02\xe7\x01" "\x8d\x02\x07\x02\x8d\xe2\xff\xbf\x99\x20\x01\x00\x80\x04\x00\x80" \
+    "\x21\x00\x00\xde\x00\x04\x00\x00\x38\xec\x9a\x00\x00\x00\x00\x00" "\x00\x03\x00\x00\x0d\x2a\x21\xf4\x0c\x64\x1b\x48\x00\xf0\x41\x5f" \
+    "\x0d\x15\x50\xf7\x0d\x37\xe5\x3e\x00\x52\x8a\x03\x0c\x68\xfe\x6a" "\xe8\xe1\xff\x21\x06\xeb\x04\x00\xfd\x0f\x01\x13\x00\x04\x50\x04" \
+    "\x80\x40\x30\x80\x00\x00\x56\xc3\x15\x00\x00\x93\x00\x00\x76\x8b" "\x19\x0e\x03\x98\x39\x2a\x04\x86\x03\x46\x04\x86\x03\x6e\x04\xae" \
+    "\x83\x44\x80\x19\xa3\x41\x20\x4f\x20\x41\xa0\x4e\x20\x41\x20\x4a" "\xd4\x06\x98\x39\x7a\x02\x72\x04\x7a\x02\x46\x04\x52\x02\x1e\x44" \
+    "\xb7\x80\x19\xa3\x2a\xa0\x51\x20\x2a\x20\x52\x20\x25\x20\x52\x1c" "\x0c\x98\x31\xe6\x03\x4a\x05\xb2\x03\x7e\x05\xae\x02\x7e\x45\xc6" \
+    "\x80\x19\xe3\x2d\x20\x55\x20\x28\x20\x55\xe0\x17\xe0\x44\x48\x0e" "\x98\x01\xe6\x80\x19\x68\x0e\x98\x81\xf9\x80\x19\xe3\x2e\xa0\x2f" \
+    "\xe0\x2e\x60\x31\xa0\x2d\xa0\x32\x58\x10\x98\x31\x4e\x04\x9e\x04" "\x62\x04\x8a\x04\x86\x04\x8a\xc4\x2d\x81\x99\xa3\x27\x60\x47\xa0" \
+    "\x27\x60\x46\x20\x27\xe0\x45\x1c\x13\x98\x39\x62\x02\x5e\x04\x76" "\x02\x4a\x04\x76\x02\x3a\xc4\x4b\x81\x19\x63\x44\xe0\x4a\x60\x44" \
+    "\x60\x49\x20\x42\x20\x47\x58\x16\x98\x31\x4e\x04\xb6\x04\x3a\x04" "\xa2\x04\x3a\x04\x82\xc4\x73\x81\x19\xe3\x40\xe0\x4f\xe0\x40\xa0" \
+    "\x4c\xa0\x3f\x60\x4b\xfc\xff\x37\xa3\x28\x00\x00\x90\xff\xff\x57" "\x08\x00\x40\x1e\x80\xff\xff\x37\x07\x2c\xc6\xe3\x01\xe5\x03\x00" \
+    "\x60\x00\x00\x10\xeb\x04\x05\x00\x02\x2b\x25\x00\x00\x5a\xff\x00" "\x00\x00\x00\x00\x00\x00\x00\x00\x00\xfd\xa3\x00\x13\x00\x04\x82" \
+    "\x01\x04\x00\x00\xd9\x9f\x00\x00\x38\x04\x00\xe0\x9d\xbe\x10\x06" "\x80\x40\x30\x80\x00\x00\x70\x6e\x14\x00\x00\x87\x00\x00\x6a\x05" \
+    "\x1a\x46\x07\x98\x31\xee\x01\xb6\x03\x1a\x02\x8a\x03\x5a\x02\x8a" "\x83\x82\x80\x19\xe3\x26\x20\x3c\xe0\x26\xe0\x3a\x20\x27\xa0\x3a" \
+    "\xd4\x0d\x98\x21\x26\x04\x52\x04\x22\x04\x4e\x44\xde\x80\x19\xa2" "\x38\xa0\x50\xe0\x37\xa0\x50\xa4\x0e\x98\x31\x1a\x02\x8e\x03\x06" \
+    "\x02\x8e\x03\xf2\x01\x7a\x03\xee\x80\x19\x54\x0f\x98\x31\x16\x03" "\x06\x05\xfa\x02\xea\x04\xda\x02\xea\xc4\xff\x7f\x33\x56\x02\x00" \
+    "\x00\x01\x96\xc0\x61\x00\x00\xbc\x01\xe0\x75\xbf\x72\x80\x0f\x03" "\x00\x00\x00\x00\x00\x00\x00\x00\x10\xef\x00\x05\x00\x02\x10\x61" \
+    "\x00\x00\x4a\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x0d\x6a" "\xe0\x64\x0d\x9e\x9d\x49\x00\x79\xb7\xb5\x0d\x15\x50\xf7\x0d\x37" \
+    "\xe5\x3e\x00\x52\x0a\x05\x0c\x68\xfe\x25\xf0\xf9\xfb\x21\x06\x81" "\x03\x00\x10\x86\x03\x05\x00\x02\x8c\x30\x00\x00\x6b\xff\x00\x00" \
+    "\x00\x00\x00\x00\x00\x00\x00\x00\xfd\x8c\x00\x12\x00\x04\x82\x01" "\x04\x00\x10\x31\x9c\x00\x00\x08\x06\x00\x60\x73\xc8\xb0\x48\xc0" \
+    "\xcc\x71\x14\x70\x1a\xb0\x14\x30\x1a\x50\x15\x30\x1a\xd0\x04\xcc" "\x18\x47\x01\xad\x01\x47\x01\xa1\x01\x4b\x01\x9d\x61\x52\xc0\x8c" \
+    "\x71\x16\x90\x19\xd0\x15\x30\x1a\xd0\x15\xd0\x1a\x3a\x06\xcc\x18" "\x17\x01\x39\x02\x0d\x01\x2f\x02\x03\x01\x39\x62\x74\xc0\x0c\xb4" \
+    "\x07\xcc\x04\x86\xc0\xcc\xf1\x22\xd0\x23\xb0\x24\xd0\x23\xb0\x26" "\xd0\x21\xfe\xff\x9b\x51\x14\x00\x00\x48\xff\xfa\x89\x02\x00\xe0" \
+    "\x0d\x80\x1d\x98\xf6\x83\xf7\x1f\x00\x00\x00\x00\x00\x00\x00\x00" "\x10\x36\x01\x05\x00\x02\xdc\x7b\x00\x00\x3d\xff\x00\x00\x00\x00" \
+    "\x00\x00\x00\x00\x00\x00\x10\x81\x03\x05\x00\x02\x12\xb2\x00\x00" "\x4c\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xfd\xab\x00\x2b" \
+    "\x00\x04\x82\x01\x04\x00\x10\x3e\xad\x00\x00\x20\x06\x00\xb0\x9a" "\xbf\x50\x40\xc0\xcc\xd1\x11\x30\x21\xd0\x11\xd0\x21\xf0\x11\xf0" \
+    "\x21\xea\x05\xcc\x18\x3d\x01\x7f\x02\x3d\x01\x89\x02\x33\x01\x93" "\x02\x64\xc0\xcc\xf1\x12\xf0\x20\xf0\x12\x90\x21\xb0\x12\x90\x21" \
+    "\x08\x07\xcc\xa0\x70\xc0\x8c\x51\x1f\xd0\x1a\x50\x1f\xb0\x1a\x10" "\x1f\x70\x1a\x1a\x07\xcc\xe0\x71\xc0\x8c\xf1\x22\x10\x22\x10\x23" \
+    "\xf0\x21\xb0\x23\xf0\x21\xb6\x07\xcc\xa0\x7d\xc0\x0c\xb1\x21\x30" "\x20\x10\x21\x30\x20\x7e\x08\xcc\x18\x5f\x01\x6f\x02\x5d\x01\x6d" \
+    "\x02\x5d\x01\x63\xe2\xff\xbf\x19\x45\x01\x00\x80\x7c\xe9\x20\x2a" "\x00\x00\xde\x00\x94\x3f\x58\x48\x6c\x8e\x00\x00\x00\x00\x00\x00" \
+    "\x00\x00\x00\x88\x04\x00\x00\x01\x03\x0d\x87\x6d\xc1\x0d\x83\xa5" "\x49\x00\x91\xbc\x41\x0e\xa8\x49\x22\x0e\x37\xe5\x3e\x00\x5f\x98" \
+    "\x0f\x0c\x68\xfe\x0c\xfa\xa1\xfe\x21\x06\x29\x02\x00\x10\x72\x02" "\x05\x00\x02\x94\x0c\x00\x00\x2a\xff\x00\x00\x00\x00\x00\x00\x00" \
+    "\x00\x00\x00\x10\x6f\x04\x05\x00\x02\xd6\xe8\x00\x00\x57\xff\x00" "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x10\xba\x04\x05\x00\x02\x05" \
+    "\x7d\x00\x00\x38\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xfe" "\x21\xad\x10\x00\xfd\xfe\x00\x13\x00\x04\x82\x01\x04\x00\xb0\xff" \
+    "\xaf\x00\x00\x20\x06\x00\x70\x60\xc6\x10\x16\x80\x40\x30\x80\x00" "\x00\x6a\x75\x17\x00\x00\x87\x00\x00\x90\x11\x11\x96\x07\x98\x31" \
+    "\x3a\x04\xe6\x03\x26\x04\xd2\x03\x1e\x04\xd2\x43\xad\x80\x19\xe2" "\x2e\xe0\x37\x60\x30\xe0\x37\x48\x0c\x98\x39\xf2\x02\x02\x05\x12" \
+    "\x03\x22\x05\x12\x03\x36\x45\xc8\x80\x19\xe3\x43\xa0\x39\xa0\x44" "\xe0\x38\xa0\x44\x60\x36\x78\x0d\x98\x31\xd6\x02\x1e\x05\xee\x02" \
+    "\x36\x05\xee\x02\x4e\xc5\x02\x81\x19\x68\x10\x98\x21\x12\x03\x6a" "\x03\x12\x03\x72\xc3\x15\x81\x99\x23\x27\xe0\x38\x60\x28\xa0\x37" \
+    "\xa0\x2a\xe0\x39\x78\x11\x98\x41\x22\x81\x19\x23\x34\xe0\x53\x60" "\x33\xa0\x54\xe0\x2a\xa0\x54\xa8\x14\x98\x39\x1a\x04\xd6\x04\x1e" \
+    "\x04\xd2\x04\x1e\x04\xce\xc4\x4a\x81\x19\xb0\x14\x98\x49\x4b\x81" "\x19\xb8\x14\x98\x31\x1e\x03\xa6\x05\x3a\x03\x8a\x05\x32\x03\x82" \
+    "\x85\x69\x81\x19\x23\x30\x60\x36\x60\x31\x60\x36\x60\x31\x20\x35" "\xfc\xff\x37\xc3\x0b\x00\x00\x90\xce\x19\xa6\x05\x00\xc0\x1b\x00" \
+    "\x8c\xf8\x2b\x87\xc3\x3f\x00\x00\x00\x00\x00\x00\x00\x00\x0d\x8f" "\x10\x10\x10\xa2\xa4\x49\x00\x2c\x4b\xfb\x0c\x4c\x6f\x22\x0e\x37" \
+    "\xe5\x3e\x00\x5a\xff\x0f\x0c\x68\xfe\x5d\x2e\x66\xff\x21\x06\xa2" "\x01\x00\x10\x29\x02\x05\x00\x02\xde\x29\x00\x00\x6f\xff\x00\x00" \
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x10\xa0\x03\x05\x00\x02\x7c\xa8" "\x00\x00\x3e\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xfd\x56" \
+    "\x01\xa5\x00\x04\x82\x01\x04\x00\xd0\xaa\xb4\x00\x00\x38\x04\x00" "\xd0\x5c\x7c\x50\x60\xc0\xcc\xb1\x13\x90\x2a\xd0\x13\xb0\x2a\x70" \
+    "\x15\xb0\x2a\xa2\x06\xcc\x18\xb1\x01\xa7\x01\xb5\x01\xa3\x01\xb5" "\x01\x99\xe1\x6a\xc0\xcc\x51\x10\x90\x22\x70\x10\x70\x22\x70\x10" \
+    "\xd0\x21\x62\x07\xcc\x1c\x09\x02\x9f\x02\x09\x02\xab\x02\xfb\x01" "\xb9\x62\x77\xc0\xcc\xb1\x0e\xf0\x1c\x50\x10\x90\x1e\x30\x11\x90" \
+    "\x1e\xd4\x07\xcc\x1c\x93\x01\xb9\x02\x89\x01\xaf\x02\x39\x01\xaf" "\xe2\x85\xc0\xcc\x31\x18\x50\x26\x30\x18\x70\x27\x90\x17\x10\x28" \
+    "\x86\x08\xcc\x18\x15\x02\x57\x02\x2b\x02\x57\x02\x49\x02\x39\xc2" "\x89\xc0\x0c\x20\x09\xcc\x18\x27\x01\x45\x02\x31\x01\x45\x02\x39" \
+    "\x01\x3d\x22\x9c\xc0\x8c\xb1\x1d\x70\x28\xb0\x1d\x70\x27\xb0\x1e" "\x70\x26\xc4\x09\xcc\x18\xd9\x01\xaf\x02\xd3\x01\xa9\x02\xe7\x01" \
+    "\x95\x62\x9f\xc0\xcc\x11\x10\x30\x23\x70\x10\xd0\x22\x70\x10\xd0" "\x21\x5e\x0a\xcc\x1c\x15\x02\x2f\x02\x1f\x02\x39\x02\x2f\x02\x39" \
+    "\x02\xa6\xc0\xcc\xf1\x1b\xf0\x28\xf0\x1b\x90\x29\xd0\x1d\x90\x29" "\x62\x0a\xcc\x44\xa6\xc0\xcc\x51\x12\xb0\x24\x50\x12\x10\x25\x90" \
+    "\x12\x50\x25\x66\x0a\xcc\x1c\x0f\x01\x83\x02\x0b\x01\x83\x02\x09" "\x01\x81\x82\xa6\xc0\x8c\x91\x15\x90\x29\xd0\x14\xd0\x28\xf0\x12" \
+    "\xd0\x28\x86\x0b\xcc\x1c\x05\x01\x09\x02\x01\x01\x05\x02\xf3\x00" "\x05\xe2\xff\xbf\x19\x45\x01\x00\x80\xfc\xff\xbf\x29\x00\x00\xde" \
+    "\x00\xa8\x46\x60\x48\x68\x01\x03\x00\x00\x00\x00\x00\x00\x00\x00" "\x0b\x21\x06\x24\x03\x28\x00\x99\x01\x10\xa2\x01\x05\x00\x02\xfd" \
+    "\x00\x00\x00\x69\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x10" "\x44\x03\x05\x00\x02\x44\x24\x00\x00\x72\xff\x00\x00\x00\x00\x00" \
+    "\x00\x00\x00\x00\x00\xfd\x4a\x01\xd8\x01\x66\x8c\xdc\x80\xcd\x80" "\xd9\x80\xd0\x80\xdd\x80\xd4\xd0\x25\x60\xe6\x88\x07\xc8\x11\x88" \
+    "\x07\x58\x12\xf8\x07\xc8\x12\x0e\x03\x66\x8e\x1c\x81\x20\x81\x17" "\x81\x25\x81\x17\x81\x26\x91\x34\x60\xc6\x48\x0c\xe8\x14\x48\x0c" \
+    "\x88\x14\xe8\x0b\x28\x14\x7c\x03\x66\x8c\xf1\x80\x42\x81\xf1\x80" "\x3d\x81\xe9\x80\x35\x01\x39\x60\xc6\x68\x10\xb8\x0f\x38\x10\xe8" \
+    "\x0f\x28\x10\xd8\x0f\xb4\x03\x66\x8e\x8d\x80\x37\x81\x8d\x80\x44" "\x81\x8c\x80\x45\x71\x43\x60\x06\x45\x04\x66\x8c\x8a\x80\x2a\x81" \
+    "\x8f\x80\x2a\x81\x8f\x80\x30\x51\x4b\x60\xc6\x88\x0b\x18\x0d\x68" "\x0b\x18\x0d\xd8\x0a\xa8\x0d\xc5\x04\x66\x88\xf2\x80\x45\x81\xf0" \
+    "\x80\x45\xb1\x4e\x60\xc6\x08\x08\x68\x12\x08\x08\xb8\x12\xb8\x07" "\xb8\x12\x35\x05\x66\x60\x53\x60\xc6\x38\x11\x78\x13\x28\x11\x78" \
+    "\x13\xa8\x10\xf8\x12\x37\x05\x66\x8e\x88\x80\x27\x81\x89\x80\x26" "\x81\x89\x80\x25\x81\x53\x60\xe6\x18\x0e\x28\x14\xf8\x0d\x08\x14" \
+    "\xf8\x0d\xb8\x13\x39\x05\x66\xa0\x53\x60\xe6\xc8\x08\x78\x12\xe8" "\x08\x98\x12\xf8\x08\x88\x12\x3b\x05\x66\x8c\xc9\x80\x45\x81\xc6" \
+    "\x80\x48\x81\xba\x80\x48\xc1\x53\x60\x26\x3d\x05\x66\xe0\x53\x60" "\xc6\x08\x11\x38\x12\x08\x11\xe8\x11\x58\x11\xe8\x11\x4a\x05\x66" \
+    "\x8c\xbc\x80\xd2\x80\xb5\x80\xcb\x80\xb5\x80\xb8\xf0\xff\xdf\x4c" "\x08\x00\x00\x40\xf2\xf5\x3c\x1d\x00\x00\x6f\x00\x76\xfe\x90\x19" \
+    "\xfa\x80\x01\x00\x00\x00\x00\x00\x03\x00\x00\x25\x04\x00\x00\x01" "\x03\x10\xa9\x00\x08\x00\x01\x73\xf9\x00\x00\x00\x00\x00\x00\x00" \
+    "\x00\x00\x00\x00\x00\x00\x00\xfe\xb8\x12\x10\x00\xfd\xa2\x00\x5c" "\x00\x66\x90\x09\x40\x00\x3d\x01\xcc\x00\x14\xc0\x0c\x42\x01\xcc" \
+    "\x60\x18\xc0\x8c\xb1\x22\x90\x24\x70\x23\x50\x25\x70\x23\x70\x29" "\xdc\x01\xcc\x1c\x4b\x01\x4b\x02\x4b\x01\x77\x02\x55\x01\x81\x42" \
+    "\x20\xc0\x0c\x32\x03\xcc\x18\x2d\x01\x53\x02\x3f\x01\x53\x02\x45" "\x01\x59\x22\x42\xc0\x0c\x24\x04\xcc\x60\x42\xc0\xcc\x71\x11\x50" \
+    "\x1e\x90\x11\x70\x1e\x90\x11\xd0\x1e\x28\x04\xcc\x60\xa9\xc0\x8c" "\xb1\x1a\x50\x2b\x30\x1a\xd0\x2a\x50\x1a\xb0\x2a\xc6\x0a\xcc\x1c" \
+    "\x2d\x01\xb1\x01\x0b\x01\xb1\x01\x01\x01\xbb\xe1\xff\xbf\x19\x45" "\x01\x00\x80\xbc\x05\xa0\x2e\x00\x00\xde\x00\xf0\x3e\xdd\x46\x64" \
+    "\x02\x00\x00\x00\x00\x00\x00\x00\x00\x00\x10\x9a\x00\x08\x00\x01" "\xc1\xd8\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00" \
+    "\xfd\xf7\x00\x0e\x00\x04\x82\x01\x04\x00\x70\xb0\xa3\x00\x00\x20" "\x06\x00\x60\xc5\xbc\x10\x02\x80\x40\x30\x80\x00\x00\x9e\x2c\x14" \
+    "\x00\x00\x87\x00\x00\x10\xec\x19\x9e\x00\x10\x08\x06\x10\x00\x40" "\x5f\x7b\x02\x00\xe0\x10\x00\xc0\x10\xfe\x42\x1c\x00\x33\xf8\x01" \
+    "\x30\x83\x44\x00\x33\xf8\x04\x30\x83\x56\x00\x02\x18\x0c\x60\x26" "\xda\x00\x66\x80\x0e\x60\x06\x01\x01\x66\x50\x21\x60\xe6\x48\x08" \
+    "\x88\x13\x28\x08\x88\x13\xd8\x07\xd8\x13\x16\x02\x66\x8e\xcf\x80" "\x3f\x81\xca\x80\x3a\x81\xc9\x80\x3a\x71\x21\x60\x06\x18\x02\x66" \
+    "\x92\x21\x60\x06\x1a\x02\x66\xb0\x21\x60\xe6\x08\x09\x78\x0e\x18" "\x09\x78\x0e\x38\x09\x58\x0e\x21\x02\x66\x8c\x8e\x80\x49\x81\x8e" \
+    "\x80\x47\x81\x8c\x80\x45\xf1\x4b\x60\xe6\x08\x0f\x08\x13\x78\x0f" "\x78\x13\x78\x0f\xe8\x13\xf6\x04\x66\x8e\xcc\x80\x5a\x81\xc7\x80" \
+    "\x55\x81\xc9\x80\x53\xe1\x4f\x60\xe6\x98\x09\xc8\x0f\x18\x09\x48" "\x10\x18\x09\x68\x11\xff\xff\xcd\x28\x0a\x00\x00\xa4\x92\xe7\xc8" \
+    "\x01\x00\xf0\x06\x80\x6b\xfe\x54\xa2\x8c\x07\x00\x00\x00\x00\x00" "\x00\x00\x00\x10\xae\x00\x08\x00\x01\x15\x46\x00\x00\x00\x00\x00" \
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\xfd\x0c\x01\x24\x00\x04\x82" "\x01\x04\x00\xa0\xec\xaf\x00\x00\x38\x04\x00\x90\x46\xc5\x10\x09" \
+    "\xc0\x0c\xd6\x00\xcc\xa0\x0d\xc0\x0c\xf2\x00\xcc\x00\x1a\xc0\x0c" "\xb2\x01\xcc\xe0\x21\xc0\x0c\x38\x04\xcc\x1c\x95\x01\x8f\x02\x95" \
+    "\x01\x83\x02\x99\x01\x7f\xa2\x43\xc0\x0c\x3c\x04\xcc\xe0\x43\xc0" "\x0c\x40\x04\xcc\x24\x44\xc0\x8c\xd1\x11\x30\x29\xb0\x10\x50\x2a" \
+    "\xb0\x10\x50\x2c\x44\x04\xcc\x1c\x59\x01\x65\x02\x59\x01\x63\x02" "\x5b\x01\x61\x62\x44\xc0\x0c\x48\x04\xcc\x14\xcd\x01\xc7\x02\xcd" \
+    "\x01\xc3\xa2\x44\xc0\x0c\x4c\x04\xcc\x1c\x85\x01\xbf\x02\x85\x01" "\xe9\x02\x89\x01\xed\x82\x92\xc0\x8c\x11\x1f\xd0\x26\xf0\x1e\xf0" \
+    "\x26\xf0\x1e\xd0\x27\x58\x09\xcc\x18\xd5\x00\x6f\x02\xd5\x00\x8f" "\x02\xdf\x00\x99\x22\x9c\xc0\xcc\x71\x17\xd0\x28\x70\x17\xd0\x29" \
+    "\xf0\x17\x50\x2a\xac\x0a\xcc\x1c\xfb\x01\xc5\x02\x03\x02\xbd\x02" "\xf7\x01\xb1\x62\xac\xc0\x8c\xd1\x12\x10\x1b\xb0\x10\x10\x1b\x10" \
+    "\x10\xb0\x1b\xd0\x0a\xcc\x18\x81\x01\xc7\x02\x81\x01\xe1\x02\x8d" "\x01\xed\xe2\xff\xbf\x19\x45\x01\x00\x80\x40\x1a\x59\x3e\x00\x00" \
+    "\xde\x00\x94\x20\x1f\x43\x98\xe9\x34\xfc\x03\x00\x00\x00\x00\x00" "\x00\xfd\x17\x01\x33\x00\x04\x82\x01\x04\x00\xb0\x3f\xac\x00\x00" \
+    "\x20\x06\x00\x40\xb1\xbe\x30\x09\xc0\x0c\xe6\x00\xcc\x00\x17\x80" "\x00\x9a\x03\x98\x41\x3a\x80\x19\xe0\x03\x98\x81\x42\x80\x19\x30" \
+    "\x04\x98\x01\x47\x80\x19\x8c\x04\x98\x81\x49\x80\x19\x48\x05\x98" "\x39\x0e\x04\x9a\x05\xfa\x03\x9a\x05\xee\x03\xa6\xc5\x89\x80\x99" \
+    "\xe3\x40\xe0\x49\xe0\x43\xe0\x49\xe0\x45\xe0\x4b\xa0\x08\x98\x41" "\x8a\x80\x19\xa8\x08\x98\x41\xa9\x80\x99\x23\x2e\x20\x57\x20\x30" \
+    "\x20\x57\xe0\x30\xe0\x57\x90\x0f\x98\x31\x72\x03\x3e\x05\x6a\x03" "\x46\x05\x6a\x03\x5a\xc5\x12\x81\x19\x63\x1b\xe0\x3f\xe0\x18\xe0" \
+    "\x3f\xa0\x16\x20\x42\x44\x11\x98\x31\xda\x02\x16\x05\xee\x02\x2a" "\x05\xda\x02\x3e\x45\x19\x81\x19\x63\x3f\x20\x4c\xe0\x3d\xa0\x4d" \
+    "\xe0\x3d\xa0\x4f\x10\x12\x98\x31\xae\x01\x0e\x04\x9a\x01\xfa\x03" "\x86\x01\xfa\x83\x3a\x81\x19\xe3\x1e\xe0\x42\x20\x1c\x20\x40\xa0" \
+    "\x18\x20\x40\xf0\x15\x98\x39\x02\x02\x12\x04\x02\x02\xfe\x03\xfa" "\x01\xf6\x03\x6b\x81\x99\x63\x25\xe0\x53\x20\x23\xe0\x53\x20\x20" \
+    "\xe0\x56\x60\x17\x98\xc1\xff\x7f\x33\x20\x01\x00\x00\x51\xa4\x41" "\x5f\x00\x00\xbc\x01\x48\x16\xc3\x7b\x98\xbe\x04\x00\x00\x00\x00" \
+    "\x00\x00\x00\x00\x10\xb9\x00\x08\x00\x01\x1d\xcf\x00\x00\x00\x00" "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x10\xc9\x03\x05\x00\x02" \
+    "\x2d\xb0\x00\x00\x1e\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00" "\xbe\x04\x00\x00\x01\x03\x0b\x1d\x06\x23\x05\x28\x00\x45\x01\x10" \
+    "\x88\x03\x05\x00\x02\xcb\xd5\x00\x00\x54\xff\x00\x00\x00\x00\x00" "\x00\x00\x00\x00\x00\x0d\xcd\xb6\xa2\x07\x48\xa4\x49\x00\xbe\x00" \
+    "\x1e\x10\xeb\x08\x90\x05\x97\xc4\x3e\x00\xbf\x94\xbc\x10\x68\x00" "\x26\x49\x45\xff\x13\x0c\x89\x05\x00\x10\xb0\x05\x05\x00\x02\x9b" \
+    "\xf2\x00\x00\x76\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xfe" "\xf6\x10\x06\x00\xfd\xec\x00\xb9\x00\x04\x10\x30\xc0\xcc\x31\x21" \
+    "\xd0\x1a\x90\x1e\x30\x18\x90\x1e\x30\x17\x42\x03\xcc\x60\x34\xc0" "\x0c\x70\x03\xcc\x60\x3b\xc0\x0c\xf4\x03\xcc\x1c\xfb\x00\x03\x02" \
+    "\xfb\x00\xfd\x01\x01\x01\xf7\x21\x42\xc0\x0c\x58\x04\xcc\xe0\x48" "\xc0\xcc\x31\x10\xd0\x27\x30\x10\x70\x27\x10\x11\x90\x26\x06\x05" \
+    "\xcc\x60\x61\xc0\x8c\x31\x1b\x90\x2b\x90\x1a\x30\x2c\x90\x1a\xd0" "\x2c\x5c\x06\xcc\x1c\x3d\x02\x2f\x02\x3b\x02\x31\x02\x3b\x02\x4b" \
+    "\xa2\x72\xc0\x8c\xd1\x23\xd0\x20\xd0\x23\xd0\x21\x70\x24\x70\x22" "\x50\x07\xcc\x1c\x67\x01\x81\x02\x67\x01\xbb\x02\x6d\x01\xc1\x62" \
+    "\x7d\xc0\xcc\x51\x24\x10\x1d\x50\x24\xd0\x11\x30\x24\xb0\x11\x28" "\x0b\xcc\x18\x2f\x01\x67\x02\x37\x01\x5f\x02\x45\x01\x5f\x42\xba" \
+    "\xc0\x8c\xd1\x21\x10\x20\x90\x20\xd0\x1e\x90\x20\xd0\x1d\xae\x0b" "\xcc\x18\xd9\x01\x71\x01\xcf\x01\x67\x01\xb1\x01\x67\xe1\xff\xbf" \
+    "\x99\x57\x00\x00\x80\x8c\x47\x22\x2d\x00\x00\xde\x00\x94\xb1\x62" "\x3f\x90\x6f\x02\x00\x00\x00\x00\x00\x00\x00\x00\x0d\x79\x5d\x68" \
+    "\x0d\x59\x98\x49\x00\xf6\x1f\x78\x0a\x38\x1f\x32\x0f\x49\xc4\x3e" "\x00\x12\xc2\x8c\x09\x68\xfe\x16\xea\x3e\x02\x1e\x06\xaa\x02\x00" \
+    "\x0d\x35\x72\x68\x0e\xf7\x71\x49\x00\x20\x10\x83\x0a\x7f\x31\xa3" "\x0e\x37\xe5\x3e\x00\x8f\x35\x1c\x0a\x68\xfe\x03\xe9\xdb\xfc\x1d" \
+    "\x06\xf7\x03\x00\x0d\x22\xb5\x64\x07\x99\xa0\x49\x00\xe7\x1c\x3a" "\x10\x3d\x59\x1d\x05\x37\xe5\x3e\x00\x86\xa5\x30\x10\x68\xfe\x0f" \
+    "\x48\x51\xff\x03\x0c\x7b\x04\x00\x0d\x0b\x0e\x46\x0f\xb0\xa5\x49" "\x00\x49\x5d\x25\x0c\xd2\x91\xa9\x0e\x37\xe5\x3e\x00\x3d\xd5\x15" \
+    "\x0a\x68\xfe\x86\x0b\xe0\xfe\x1d\x06\xa5\x04\x00\x10\x89\x05\x05" "\x00\x02\x37\xe6\x00\x00\x59\xff\x00\x00\x00\x00\x00\x00\x00\x00" \
+    "\x00\x00\xfd\x00\x01\x99\x01\x66\x8e\x1a\x81\xfa\x80\x1a\x81\xf2" "\x80\x15\x81\xed\xb0\x1e\x60\x86\x68\x0f\x18\x12\x58\x0f\x08\x12" \
+    "\x05\x02\x66\x80\x20\x60\xc6\x08\x12\x68\x0d\x18\x12\x58\x0d\x18" "\x12\x18\x0d\x2a\x02\x66\x80\x25\x60\xe6\x08\x0b\x18\x0d\x98\x0a" \
+    "\x88\x0d\xa8\x0a\x98\x0d\x7f\x02\x66\xe0\x28\x60\xc6\x28\x0e\x18" "\x14\x38\x0e\x28\x14\x48\x0e\x28\x14\x29\x03\x66\x8c\x95\x80\x40" \
+    "\x81\x94\x80\x3f\x81\x8f\x80\x3f\x41\x34\x60\xe6\x48\x10\x38\x10" "\x48\x11\x38\x0f\x98\x11\x38\x0f\x45\x03\x66\x8c\x95\x80\x03\x81" \
+    "\x95\x80\x0e\x81\x93\x80\x10\x61\x34\x60\x06\x47\x03\x66\x82\x34" "\x60\xc6\x78\x11\x98\x11\x78\x11\xb8\x11\xd8\x11\x18\x12\xb9\x03" \
+    "\x66\x8c\x9a\x80\xfc\x80\x99\x80\xfb\x80\x99\x80\xfa\xb0\x4e\x60" "\xe6\x18\x10\xb8\x11\xd8\x10\xb8\x11\x28\x11\x08\x12\x41\x05\x66" \
+    "\x8e\x8b\x80\x0f\x81\x90\x80\x0f\x81\x92\x80\x0d\x01\x56\x60\xe6" "\xe8\x0f\xc8\x12\x38\x10\x18\x13\x48\x11\x18\x13\xcd\x05\x66\xf0" \
+    "\xff\xdf\x8c\xa2\x00\x00\x40\x72\x15\x10\x1d\x00\x00\x6f\x00\xac" "\x6c\xb2\x1d\xc4\x01\x01\x00\x00\x00\x00\x00\x00\x00\x00\x0b\x06" \
+    "\x0c\xaf\x05\x28\x00\x7c\x01\x0d\x98\xb4\x87\x07\x5f\x9f\x49\x00" "\xf8\x0b\x50\x10\xeb\x08\x90\x05\x97\xc4\x3e\x00\xd9\x8f\xbc\x10" \
+    "\x68\x00\x02\x55\xe4\x00\x13\x0c\xff\x01\x00\x10\xaa\x02\x05\x00" "\x02\x20\x2f\x00\x00\x4a\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00" \
+    "\x00\x10\xf7\x03\x05\x00\x02\xa3\x33\x00\x00\x60\xfd\x00\x00\x00" "\x00\x00\x00\x00\x00\x00\x00\x10\x7b\x04\x05\x00\x02\x99\x9f\x00" \
+    "\x00\x72\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x10\xa5\x04" "\x05\x00\x02\x21\xcc\x00\x00\x6a\xff\x00\x00\x00\x00\x00\x00\x00" \
+    "\x00\x00\x00\xfd\x4f\x01\x29\x00\x04\x82\x01\x04\x00\x10\xc2\xab" "\x00\x00\x38\x04\x00\x20\xad\xce\x30\x2b\xc0\x8c\x71\x0e\x70\x20" \
+    "\x70\x0e\x90\x1f\xf0\x0e\x10\x1f\xca\x02\xcc\x18\x97\x01\x99\x01" "\xa5\x01\xa7\x01\xa5\x01\xa9\x21\x39\xc0\x0c\x94\x03\xcc\x1c\xd1" \
+    "\x01\x6d\x02\xd1\x01\x63\x02\xc7\x01\x63\x82\x3e\xc0\x4c\xfe\x03" "\xcc\x40\x46\xc0\x4c\x84\x04\xcc\x18\xf3\x01\x3d\x02\xef\x01\x41" \
+    "\x02\xeb\x01\x41\x62\x4c\xc0\x4c\xc8\x04\xcc\xe0\x4c\xc0\x0c\x14" "\x05\xcc\x1c\x2d\x01\x7b\x02\x39\x01\x6f\x02\x2b\x01\x61\x42\x53" \
+    "\xc0\x0c\xac\x05\xcc\x18\x31\x01\xc3\x01\x37\x01\xc9\x01\x41\x01" "\xbf\x21\x69\xc0\xcc\xf1\x14\x70\x25\x50\x14\x70\x25\x50\x14\x10" \
+    "\x26\xea\x06\xcc\x18\x8f\x01\x85\x02\x8f\x01\x73\x02\x83\x01\x67" "\xa2\x6f\xc0\xcc\xf1\x20\xd0\x24\x50\x20\x70\x25\x50\x20\x10\x28" \
+    "\x8c\x07\xcc\x18\x87\x01\x81\x02\x8f\x01\x79\x02\x8f\x01\x6f\x42" "\x7c\xc0\xcc\x51\x17\xd0\x29\xb0\x16\xd0\x29\x10\x16\x30\x29\x8c" \
+    "\x08\xcc\x18\x87\x01\x8d\x02\x8f\x01\x85\x02\x87\x01\x7d\xe2\x9e" "\xc0\x8c\x11\x1d\xf0\x29\x10\x1d\x10\x2b\x90\x1b\x90\x2c\x28\x0a" \
+    "\xcc\x18\x35\x02\xb1\x01\x23\x02\xc3\x01\x1d\x02\xbd\xe1\xaf\xc0" "\x0c\x5e\x0b\xcc\x18\x13\x02\x7f\x01\xfd\x01\x7f\x01\xfb\x01\x7d" \
+    "\x01\xb8\xc0\x8c\x51\x24\x90\x23\x50\x24\x90\x22\x10\x24\x50\x22" "\xfe\xff\x9b\xa1\x06\x00\x00\x88\x4d\x02\x5e\x03\x00\xe0\x0d\xc0" \
+    "\x27\xfb\x29\x44\x90\x3f\x00\x00\x00\x00\x00\x00\x00\x00\x32\x04" "\x00\x00\x01\x03\x0d\xa3\x6f\x5e\x10\x6c\xa0\x49\x00\x23\xb7\xf5" \
+    "\x0c\x9c\xe5\x4e\x0f\x43\xaf\x3e\x00\xca\xc2\x07\x0b\x68\xfe\x53" "\x1a\x53\xff\x15\x06\x6d\x02\x00\x0d\x0f\xdc\x24\x0d\x99\xa0\x49" \
+    "\x00\xc2\x34\x4d\x0c\x3f\xcd\xfd\x0b\x37\xe5\x3e\x00\xc7\x09\xe0" "\x0a\x68\xfe\xbb\x16\x4b\x00\x1f\x06\x89\x02\x00\x10\xe4\x02\x05" \
+    "\x00\x02\x40\xab\x00\x00\x65\xff\x00\x00\x00\x00\x00\x00\x00\x00" "\x00\x00\x10\xb2\x04\x05\x00\x02\x29\xbe\x00\x00\x54\xff\x00\x00" \
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x10\x3d\x05\x05\x00\x02\xc8\x5a" "\x00\x00\x5c\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x0d\x0b" \
+    "\x03\x0f\x0d\x23\xf6\x43\x00\xff\x9d\xec\x0c\x3f\xcd\xfd\x0b\x37" "\xe5\x3e\x00\xc7\x09\xe0\x0a\x68\xfe\xc5\x0f\x85\x02\x1f\x06\xa7" \
+    "\x05\x00\xfe\xd4\x20\x06\x00\xfd\xe9\x00\xb9\x00\x04\x82\x01\x04" "\x00\x70\x69\xb0\x00\x00\x38\x04\x00\x80\xdf\x8f\xf0\x4a\xc0\xcc" \
+    "\xf1\x14\x90\x23\x50\x15\x30\x23\x90\x15\x70\x23\x8e\x09\xcc\x18" "\x37\x01\x05\x02\x23\x01\xf1\x01\x1d\x01\xf1\x21\x9e\xc0\x8c\x71" \
+    "\x18\x30\x28\x90\x18\x10\x28\xb0\x18\x10\x28\xf4\x09\xcc\x1c\xf9" "\x00\xf9\x01\x01\x01\x01\x02\x01\x01\x17\x22\xa7\xc0\x0c\x9c\x0a" \
+    "\xcc\x18\x05\x01\x4f\x02\x09\x01\x4b\x02\x0f\x01\x51\x62\xae\xc0" "\x8c\xd1\x12\x30\x25\xd0\x12\xd0\x25\x70\x12\xd0\x25\xf2\x0a\xcc" \
+    "\x1c\x19\x01\x4f\x02\x13\x01\x49\x02\x11\x01\x49\x82\xb3\xc0\x8c" "\x31\x21\x10\x18\x90\x20\xb0\x18\xd0\x1f\xf0\x17\x76\x0b\xcc\x18" \
+    "\x1b\x02\xa7\x01\x15\x02\xa1\x01\x15\x02\x97\x81\xb7\xc0\x8c\xd1" "\x21\x30\x18\xf0\x20\x10\x19\xd0\x1f\xf0\x17\x7a\x0b\xcc\xc0\xb7" \
+    "\xc0\xcc\x91\x14\xd0\x2a\x90\x14\x70\x2b\x10\x14\x70\x2b\xfe\xff" "\x9b\x41\x14\x00\x00\x08\x63\x7d\x05\x03\x00\xe0\x0d\x00\x3c\xc3" \
+    "\x2a\x43\x8c\x14\x00\x00\x00\x80\x21\x4a\x00\x00\x10\x6d\x02\x05" "\x00\x02\xc7\xf4\x00\x00\x5c\xff\x00\x00\x00\x00\x00\x00\x00\x00" \
+    "\x00\x00\x10\x89\x02\x05\x00\x02\x54\x3b\x00\x00\x50\xff\x00\x00" "\x00\x00\x00\x00\x00\x00\x00\x00\x10\x8a\x04\x05\x00\x02\x5c\xee" \
+    "\x00\x00\x0a\xfe\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x10\xa0" "\x04\x05\x00\x02\xa2\x88\x00\x00\x6c\xff\x00\x00\x00\x00\x00\x00" \
+    "\x00\x00\x00\x00\x10\xc3\x04\x05\x00\x02\x7e\x61\x00\x00\x6c\xfe" "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x10\xa7\x05\x05\x00\x02" \
+    "\x8b\x07\x00\x00\xcc\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00" "\xfd\x16\x01\x7d\x00\x04\x82\x01\x04\x00\xf0\xf5\xa8\x00\x00\x38" \
+    "\x04\x00\xb0\x46\x8a\xf0\x15\x80\x40\x30\x80\x00\x00\x7e\x52\x17" "\x00\x00\x87\x00\x00\x78\x1b\x10\xe2\x02\x10\x08\x06\x10\x00\x80" \
+    "\xdb\xbc\x02\x00\x20\x13\x00\x00\x95\xf1\x41\xb9\x00\x33\x47\x89" "\xc0\x93\xc0\x8b\x40\x91\xc0\x8e\x40\x94\xc0\x17\x30\x63\x54\x03" \
+    "\x2c\x08\x54\x03\x54\x08\x5c\x03\x5c\x88\xc3\x01\x33\xc6\x5f\xc0" "\x63\x40\x60\x40\x63\x40\x63\x40\x63\x10\x22\x30\x63\xf4\x03\x44" \
+    "\x09\x0c\x04\x2c\x09\x0c\x04\x14\x89\x42\x02\x33\x47\x53\x40\x72" "\xc0\x54\xc0\x70\xc0\x54\x40\x6d\x28\x25\x30\x73\xb4\x06\x2c\x0a" \
+    "\x5c\x06\x84\x0a\x5c\x06\xec\x8a\x55\x02\x33\x46\x83\x40\x7c\x40" "\x7f\x40\x78\xc0\x7e\xc0\x78\x50\x27\x30\x73\x7c\x04\xd4\x07\x2c" \
+    "\x04\x84\x07\xf4\x03\x84\x87\x77\x02\x33\x46\x84\xc0\x93\xc0\x81" "\xc0\x93\x40\x7f\x40\x96\x00\x2a\x30\x93\xac\x02\x33\x47\x5c\x40" \
+    "\x95\x40\x5c\xc0\x96\xc0\x5c\x40\x97\xb0\x2b\x30\x43\x4c\x05\x04" "\x0a\x4c\x05\xfc\x89\xdf\x02\x33\xc7\x61\x40\xaa\xc0\x5e\x40\xad" \
+    "\xc0\x4f\x40\xad\xf8\xff\x6f\x46\x51\x00\x00\x20\x2b\x85\x5d\x0f" "\x00\x80\x37\x00\x71\x35\x2e\x14\x65\xa1\x00\x00\x00\x00\xdc\x79" \
+    "\x01\x00\xfd\x02\x01\x1c\x02\x66\x8e\x13\x81\x24\x81\x13\x81\x20" "\x81\x0f\x81\x1c\xe1\x2c\x60\xe6\xf8\x0a\xb8\x0c\x48\x0b\xb8\x0c" \
+    "\x78\x0b\x88\x0c\x3b\x03\x66\x8c\xa8\x80\x43\x81\xab\x80\x40\x81" "\xb0\x80\x45\x41\x36\x60\xe6\x98\x0f\x78\x12\x98\x0f\x38\x12\x68" \
+    "\x0f\x08\x12\xb6\x03\x66\x8c\x0b\x81\xea\x80\x18\x81\xea\x80\x1a" "\x81\xec\x70\x3f\x60\xe6\x08\x0d\x38\x14\x08\x0d\x88\x14\x58\x0d" \
+    "\xd8\x14\x38\x04\x66\x8e\x81\x80\x30\x81\x86\x80\x30\x81\x8d\x80" "\x29\x51\x4e\x60\xc6\x08\x0c\x68\x13\xb8\x0b\xb8\x13\xb8\x0b\x08" \
+    "\x14\xf7\x04\x66\x8c\xdf\x80\x46\x81\xdf\x80\x4b\x81\xe4\x80\x50" "\x81\x51\x60\xc6\x88\x0b\xb8\x13\x88\x0b\x08\x14\x18\x0b\x08\x14" \
+    "\x47\x05\x66\x8e\x03\x81\x1c\x81\xfc\x80\x15\x81\xfc\x80\x0c\x01" "\x5c\x60\x26\xc1\x05\x66\x8e\xe8\x80\xce\x80\xe4\x80\xca\x80\xe4" \
+    "\x80\xc4\x20\x5c\x60\xe6\x38\x11\x08\x0d\xe8\x10\x08\x0d\xf8\x0f" "\x18\x0c\xc8\x05\x66\x8c\xa7\x80\x4b\x81\xa9\x80\x49\x81\xa7\x80" \
+    "\x47\xf1\xff\xdf\x8c\xa2\x00\x00\x40\x42\xbb\x23\x18\x00\x00\x6f" "\x00\xd2\x38\x02\x26\xba\x40\x00\x00\x00\x00\x08\x7f\x02\x00\x00" \
+    "\x3d\x04\x00\x00\x01\x03\x0b\x1b\x06\xd1\x03\x28\x00\x72\x01\x0d" "\xad\x2f\x40\x0c\x78\x97\x49\x00\x5f\x2c\x7b\x0c\xdd\xdc\xc8\x0d" \
+    "\x37\xe5\x3e\x00\x58\x98\xf8\x0b\x68\xfe\x48\xc8\xe2\xfe\x1b\x06" "\xe4\x04\x00\xfe\xeb\x3d\x06\x00\xfd\x80\x01\x77\x00\x04\x82\x01" \
+    "\x04\x00\xb0\x1a\xab\x00\x00\x58\x04\x00\xf0\xc1\x7e\x10\x17\x80" "\x40\x30\x80\x00\x00\x24\x7f\x17\x00\x00\x87\x00\x00\x8e\xd7\x10" \
+    "\x4a\x05\x98\x39\xda\x03\x16\x05\xda\x03\x02\x05\xce\x03\xf6\xc4" "\x9b\x80\x99\xa3\x43\xa0\x36\x20\x42\xa0\x36\xa0\x41\x20\x37\xf4" \
+    "\x0a\x98\x39\xce\x02\x66\x03\xba\x02\x52\x03\xba\x02\x3e\x43\xb8" "\x80\x99\x63\x41\xe0\x4c\xa0\x42\x20\x4e\xe0\x43\xe0\x4c\xc0\x0e" \
+    "\x98\x31\xe6\x01\x6e\x04\xe6\x01\x9e\x04\x02\x02\xba\x84\xfc\x80" "\x19\x23\x42\xa0\x45\xa0\x42\x20\x45\xa0\x42\xa0\x44\xf4\x0f\x98" \
+    "\x39\xbe\x01\xe6\x03\xda\x01\x02\x04\xe2\x01\xfa\xc3\x11\x81\x19" "\xa3\x34\x20\x32\xa0\x34\xe0\x31\x20\x35\x60\x31\x5c\x11\x98\x31" \
+    "\x62\x02\x6a\x03\x5a\x02\x6a\x03\x56\x02\x66\x03\x20\x81\x19\x23" "\x47\xa0\x34\x20\x46\xa0\x33\xe0\x44\xe0\x34\xc0\x13\x98\x39\x36" \
+    "\x02\x76\x04\x16\x02\x76\x04\x02\x02\x8a\x84\x3c\x81\x99\xcc\x13" "\x98\x39\xa6\x02\x52\x03\xce\x02\x7a\x03\xda\x02\x7a\x03\x3d\x81" \
+    "\x99\x63\x33\x60\x55\xe0\x33\x60\x55\x60\x34\xe0\x55\xd4\x13\x98" "\x39\x06\x04\xd2\x03\x0e\x04\xca\x03\x46\x04\xca\x83\x3d\x81\x99" \
+    "\x22\x21\x60\x43\x60\x21\x60\x43\xdc\x13\x98\x39\xbe\x02\x72\x05" "\xae\x02\x62\x05\xa6\x02\x62\x85\x59\x81\x19\xa3\x34\xe0\x32\x60" \
+    "\x33\xa0\x31\x60\x33\xa0\x2d\xa8\x15\x98\x31\x1a\x02\x06\x04\x32" "\x02\x06\x04\x3a\x02\x0e\xc4\x5c\x81\x19\x23\x29\xe0\x55\x20\x2c" \
+    "\xe0\x58\xe0\x2d\xe0\x58\x9c\x16\x98\x31\xf6\x02\x52\x03\xf6\x02" "\x26\x03\xee\x02\x1e\xc3\xff\x7f\x33\x8a\x02\x00\x00\xb1\xf1\xd5" \
+    "\x5d\x00\x00\xbc\x01\x10\x10\x10\xae\x68\xf6\x06\x00\x00\x00\x00" "\x00\x0c\x00\x00\x0d\x7f\x67\x3c\x0c\x2f\x5b\x48\x00\x20\x70\x54" \
+    "\x0d\xab\xb0\xc9\x0d\x37\xe5\x3e\x00\x26\x6c\xf9\x0b\x68\xfe\x65" "\xfa\x7f\xfe\x1b\x06\xae\x01\x00\x0d\x4f\xc0\xf8\x0c\x68\xa2\x45" \
+    "\x00\xef\xfd\x26\x0d\xab\xb0\xc9\x0d\x37\xe5\x3e\x00\x26\x6c\xf9" "\x0b\x68\xfe\x51\xd6\x5e\xff\x1b\x06\xe7\x02\x00\x10\x8e\x03\x05" \
+    "\x00\x02\x65\xb0\x00\x00\x50\xff\x00\x00\x00\x00\x00\x00\x00\x00" "\x00\x00\x0d\x1c\x5a\x2c\x0d\xf6\x7a\x49\x00\xa2\x8b\x82\x0c\xd3" \
+    "\x32\xd1\x0d\x37\xe5\x3e\x00\x4e\xee\x00\x0c\x68\xfe\x58\xf6\xad" "\xff\x1b\x06\x48\x04\x00\x10\xe4\x04\x05\x00\x02\x0d\xf7\x00\x00" \
+    "\x39\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xfd\x5d\x01\x90" "\x00\x04\x82\x01\x04\x00\x50\x24\xbb\x00\x00\x38\x04\x00\x80\x0d" \
+    "\x8a\x70\x16\x80\x40\x30\x80\x00\x00\x78\x9b\x15\x00\x00\x87\x00" "\x00\x7e\xd2\x11\x1e\x05\x98\x29\xae\x02\x86\x04\xc6\x02\x86\xc4" \
+    "\x73\x80\x99\x23\x23\xe0\x3a\xe0\x21\x20\x3c\xa0\x1f\x20\x3c\xd4" "\x09\x98\x31\xe6\x01\x86\x03\xe6\x01\x9a\x03\xfe\x01\xb2\x43\xa2" \
+    "\x80\x99\x63\x41\x60\x35\x20\x40\xa0\x36\xe0\x3e\xa0\x36\x9c\x0a" "\x98\x31\xc6\x01\x0e\x04\xda\x01\xfa\x03\xde\x01\xfe\x03\xd3\x80" \
+    "\x99\x23\x31\xa0\x4b\xe0\x2f\xe0\x4c\xe0\x2e\xe0\x4c\xb8\x0d\x98" "\x31\xca\x01\xd2\x03\xca\x01\xb6\x03\xde\x01\xa2\x03\xed\x80\x19" \
+    "\xe3\x2f\x60\x36\x60\x31\x60\x36\x60\x33\x60\x34\x88\x0f\x98\x31" "\x22\x02\xc2\x04\x52\x02\x92\x04\x56\x02\x92\x84\x14\x81\x99\xe3" \
+    "\x40\x20\x33\xe0\x3d\x20\x36\xa0\x3c\x20\x36\xe0\x13\x98\x31\xa6" "\x02\x9a\x04\xae\x02\x92\x04\x96\x02\x7a\x44\x3e\x81\x99\xa3\x26" \
+    "\x60\x43\x20\x25\xe0\x41\xe0\x23\xe0\x41\xe8\x13\x98\x39\xf2\x01" "\xae\x03\xf2\x01\xca\x03\xee\x01\xce\xc3\x3e\x81\x99\x23\x1f\xe0" \
+    "\x4a\x20\x1f\x20\x48\xa0\x1e\xa0\x47\x3c\x15\x98\x31\xee\x02\x5e" "\x03\xfa\x02\x5e\x03\x02\x03\x66\x43\x56\x81\x99\xe3\x30\xa0\x4c" \
+    "\x20\x2e\xa0\x4c\x60\x2b\x60\x4f\x88\x16\x98\x39\x2a\x04\x82\x03" "\x12\x04\x6a\x03\xe2\x03\x6a\xc3\x6d\x81\x19\x23\x2c\x60\x54\xa0" \
+    "\x2b\xe0\x53\x60\x2b\xe0\x53\xfc\xff\x37\xa3\x28\x00\x00\x90\x45" "\xa9\x2f\x09\x00\x40\x1d\x00\x13\x31\x36\x88\xdd\x86\x49\x03\x00" \
+    "\x00\x61\x44\x00\x00\x0d\x27\xee\xf2\x0c\x09\xa6\x49\x00\x25\xea" "\x22\x0e\xe8\x03\xe1\x0d\x37\xe5\x3e\x00\x63\xbf\x10\x0c\x68\xfe" \
+    "\xd8\xee\x29\xff\x1b\x06\x5c\x01\x00\x10\xae\x01\x05\x00\x02\x60" "\xa9\x00\x00\x64\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x0d" \
+    "\x9a\xd4\xb2\x0e\xab\x9e\x49\x00\xe6\x39\x03\x0d\xe7\x89\xca\x0d" "\x37\xe5\x3e\x00\x62\x45\xfa\x0b\x68\xfe\xa9\x1e\x49\xff\x1b\x06" \
+    "\x54\x02\x00\x10\xe7\x02\x05\x00\x02\xa8\xd9\x00\x00\x90\xff\x00" "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x0d\x2a\x8d\xc5\x0c\x36\xa6" \
+    "\x49\x00\x53\x23\xf7\x0d\xb9\x14\xe0\x0d\x37\xe5\x3e\x00\x34\xd0" "\x0f\x0c\x68\xfe\x25\xed\x37\xff\x1b\x06\xc8\x03\x00\xd6\x04\x00" \
+    "\x00\x01\x03\x10\xaf\x04\x05\x00\x02\x01\x02\x00\x00\x91\x00\x00" "\x00\x00\x00\x00\x00\x00\x00\x00\x00\xfe\xf3\x9e\x08\x00\xfd\xb4" \
+    "\x00\xac\x00\x04\x82\x01\x04\x00\xa0\xf6\xbb\x00\x00\x38\x04\x00" "\xb0\xdb\x86\x10\x26\xc0\x8c\x31\x1d\x30\x28\x50\x1c\x30\x28\xb0" \
+    "\x1b\xd0\x28\xe2\x04\xcc\x1c\x25\x02\xc1\x01\x25\x02\xcf\x01\x27" "\x02\xd1\x61\x7c\xc0\xcc\xf1\x1b\x70\x18\x70\x1b\xf0\x18\xb0\x1b" \
+    "\x30\x19\x94\x08\xcc\x1c\x1b\x01\xff\x01\x01\x01\xff\x01\xf9\x00" "\x07\xe2\x8b\xc0\xcc\x71\x1f\xb0\x1a\x70\x1f\x10\x1a\x10\x20\x70" \
+    "\x19\x0a\x0a\xcc\x18\xf7\x01\x43\x02\xf7\x01\x4d\x02\xed\x01\x4d" "\x42\xa4\xc0\xcc\xb1\x16\x10\x27\x10\x16\xb0\x27\xf0\x15\x90\x27" \
+    "\x9a\x0b\xcc\x18\xeb\x00\x07\x02\xf5\x00\x11\x02\xf7\x00\x0f\xe2" "\xff\xbf\x19\x45\x01\x00\x80\xfc\xff\x7f\x25\x00\x00\xde\x00\xfc" \
+    "\xff\xbf\x38\x00\x80\x02\x00\x00\x00\x00\x00\x03\x00\x00\x10\xeb" "\x04\x05\x00\x02\x22\x75\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00" \
+    "\x00\x00\x00\x00\xfd\xbb\x00\x10\x00\x04\x50\x05\x80\x40\x30\x80" "\x00\x00\x3a\x0e\x14\x00\x00\x87\x00\x00\xf2\xc5\x17\xae\x00\x10" \
+    "\x08\x06\x10\x00\x00\xc5\x78\x02\x00\xe0\x10\x00\x40\x01\x01\xc3" "\x16\x00\x02\xc1\x00\x02\x00\x80\x05\x50\x00\x00\x1c\x02\x00\x20" \
+    "\x44\x67\x18\x03\x40\x20\x18\x40\x00\x00\x6a\x9b\x0a\x00\x80\x43" "\x00\x00\x8e\xfc\x0c\x65\x00\x08\x04\x03\x08\x00\x20\x14\x5e\x01" \
+    "\x00\x70\x08\x00\x60\x8d\x95\x61\x21\x00\x81\x60\x00\x01\x00\x74" "\xf0\x2e\x00\x00\x0e\x01\x00\x3c\x0c\x22\x04\x24\x30\x63\x5c\x07" \
+    "\x24\x0a\x64\x07\x2c\x0a\x64\x07\x74\x8a\x91\x02\x33\x47\x4c\x40" "\x79\xc0\x4b\x40\x79\x40\x4b\xc0\x78\x68\x2c\x30\x83\xff\xff\x66" \
+    "\x14\x05\x00\x00\xf2\xff\xff\xa5\x00\x00\x78\x03\x00\xbf\x45\x48" "\x61\x1c\x0e\x00\x00\x00\x00\x00\x0c\x00\x00\xfd\x40\x01\x0e\x00" \
+    "\x04\x82\x01\x04\x00\x30\x1a\xa7\x00\x00\x38\x04\x00\x60\x70\xd0" "\x10\x02\x80\x40\x30\x80\x00\x00\x2e\xe7\x14\x00\x00\x87\x00\x00" \
+    "\x94\x0d\x1a\xa6\x00\x10\x08\x06\x10\x00\xc0\x3b\xbf\x02\x00\xe0" "\x10\x00\x80\x32\x12\x43\x48\x00\x02\xc1\x00\x02\x00\xc8\x15\x58" \
+    "\x00\x00\x3c\x02\x00\x70\xea\x47\xd8\x27\x60\xc6\x48\x0a\x68\x0f" "\x68\x09\x88\x0e\x68\x09\x38\x0e\xc2\x02\x66\x8e\x82\x80\xe6\x80" \
+    "\x87\x80\xe6\x80\x87\x80\xe5\x30\x2f\x60\xc6\x28\x09\x28\x0f\x78" "\x09\x78\x0f\xd8\x08\x18\x10\xcc\x03\x66\x8e\x99\x80\x37\x81\xa3" \
+    "\x80\x2d\x81\xa8\x80\x2d\x31\x44\x60\xc6\x48\x10\xb8\x0f\x48\x10" "\xf8\x0f\x38\x10\x08\x10\xb1\x04\x66\x8c\xc7\x80\x61\x81\xd4\x80" \
+    "\x61\x81\xdc\x80\x59\x91\x4d\x60\x06\xda\x04\x66\x8e\xf2\x80\x3b" "\x81\xf4\x80\x3d\x81\xf4\x80\x41\xc1\x51\x60\x86\xa8\x0b\x28\x13" \
+    "\xe8\x0b\xe8\x12\x24\x05\x66\x8c\x98\x80\x07\x81\x98\x80\x09\x81" "\x99\x80\x0a\x51\x52\x60\xe6\xa8\x11\xb8\x12\xa8\x11\x98\x13\x68" \
+    "\x10\xd8\x14\x26\x05\x66\x70\x52\x60\x26\x28\x05\x66\x8e\xfb\x80" "\x39\x81\xf8\x80\x3c\x81\xf2\x80\x3c\x91\x52\x60\xc6\xc8\x0c\x68" \
+    "\x15\x28\x0d\x08\x15\x28\x0d\x28\x14\xd4\x05\x66\x8c\xfb\x80\x28" "\x81\xfb\x80\x25\x81\xfc\x80\x24\xf1\xff\xdf\x8c\xa2\x00\x00\x40" \
+    "\x02\x00\xe0\x1b\x00\x00\x6f\x00\x14\xf4\x07\x28\x98\x84\x00\x00" "\x00\x00\x00\x80\x01\x00\x00\x0b\x1b\x06\xec\x03\x28\x00\x7e\x01" \
+    "\xfd\x76\x00\x8b\x02\x66\x8c\xd0\x80\xd6\x80\xd2\x80\xd6\x80\xd3" "\x80\xd7\xe0\x39\x60\xe6\xa8\x10\xe8\x0e\x58\x10\xe8\x0e\x48\x10" \
+    "\xf8\x0e\xc3\x04\x66\x8c\xbb\x80\x35\x81\xbe\x80\x32\x81\xbe\x80" "\x2e\x01\x4f\x60\x06\x1d\x05\x66\x8c\xef\x80\x2e\x81\xeb\x80\x2e" \
+    "\x81\xea\x80\x2d\x91\x52\x60\xc6\xc8\x0c\x68\x15\x58\x0c\x68\x15" "\x08\x0c\xb8\x15\xff\xff\xcd\x28\x0a\x00\x00\xe4\xff\xff\x11\x02" \
+    "\x00\xf0\x06\xe0\xff\xff\x3f\xe2\x92\x12\x00\x00\x00\x00\x00\x18" "\x00\x00\x10\xe3\x03\x05\x00\x02\x87\xb4\x00\x00\x16\xff\x00\x00" \
+    "\x00\x00\x00\x00\x00\x00\x00\x00\xfd\x95\x00\x7a\x00\x04\x82\x01" "\x04\x00\x50\xa0\xa8\x00\x00\xd0\x04\x00\x20\x84\x82\x70\x33\xc0" \
+    "\xcc\x71\x11\xd0\x1e\x10\x12\xd0\x1e\x50\x12\x10\x1f\xee\x03\xcc" "\x1c\xd9\x01\xb7\x01\xd9\x01\xad\x01\xe3\x01\xa3\x61\x42\xc0\x8c" \
+    "\x71\x18\x50\x2a\x70\x18\xb0\x29\xf0\x19\x30\x28\x36\x04\xcc\x1c" "\x1d\x01\xa9\x01\x2b\x01\xb7\x01\x2b\x01\xb9\xc1\x48\xc0\x8c\x71" \
+    "\x18\x50\x2a\x70\x18\xb0\x29\xf0\x19\x30\x28\xd8\x05\xcc\x1c\xfd" "\x01\x3b\x02\xfd\x01\x47\x02\xfb\x01\x49\xe2\xff\xbf\x19\x45\x01" \
+    "\x00\x80\xdc\x8a\xce\x44\x00\x00\xde\x00\x1c\x9b\x0f\x36\x84\x7f" "\x00\x00\x00\x00\x00\x00\x06\x00\x00\x0d\x4f\x57\xd4\x0c\x7d\x88" \
+    "\x3e\x00\x7b\xf8\xf3\x0c\xe5\xab\x24\x0e\x37\xe5\x3e\x00\x9d\x8e" "\x33\x0b\x68\xfe\xd5\xe3\x4d\xfe\x1b\x06\x43\x04\x00\xfd\xba\x00" \
+    "\x7f\x00\x04\x82\x01\x04\x00\xf0\xa7\xab\x00\x00\xc8\x04\x00\xf0" "\x44\x7e\xd0\x11\x80\x40\x30\x80\x00\x00\xc2\x27\x17\x00\x00\x87" \
+    "\x00\x00\x56\xe3\x0f\xba\x02\x10\x08\x06\x10\x00\x40\xed\xef\x02" "\x00\xe0\x10\x00\x80\x73\x1a\xc2\x8e\x01\x33\x46\x49\x40\x74\xc0" \
+    "\x46\x40\x74\x40\x44\xc0\x76\x40\x22\x30\x63\xfc\x08\xdc\x08\xe4" "\x08\xc4\x08\xbc\x08\xec\x08\x52\x02\x33\x47\x4f\x40\xa4\xc0\x4c" \
+    "\xc0\xa1\xc0\x4c\x40\xa1\x70\x26\x30\x73\x64\x04\xb4\x08\x24\x04" "\xb4\x08\xfc\x03\xdc\x08\x95\x02\x33\x47\x42\x40\x7a\xc0\x3f\xc0" \
+    "\x77\xc0\x3f\xc0\x6c\x58\x29\x30\x73\xfc\x03\x34\x08\xd4\x03\x0c" "\x08\xd4\x03\xf4\x86\xff\xff\x66\xf2\x04\x00\x00\x12\x00\x00\xbb" \
+    "\x00\x00\x78\x03\x10\x00\x00\xe5\x00\x00\x02\x00\x00\x00\x00\x00" "\x00\x00\x00\x72\x04\x00\x00\x01\x03\x10\x7f\x03\x05\x00\x02\xcc" \
+    "\x50\x00\x00\x3a\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x0d" "\xa4\xb0\x41\x0d\x68\xa3\x49\x00\xfa\x37\xfa\x0d\xdb\xc2\x12\x0e" \
+    "\x37\xe5\x3e\x00\x83\xf0\x13\x0c\x68\xfe\xe6\xea\xb2\xff\x19\x06" "\x5f\x04\x00\xfe\x00\xe4\x08\x00\xfd\x31\x01\x15\x00\x04\x82\xe1" \
+    "\x01\x48\xd5\xfc\xa5\x00\x00\x38\x04\x10\x10\x30\xc6\xd0\x24\xc0" "\x0c\x4e\x02\xcc\x00\x25\xc0\x0c\x52\x02\xcc\x40\x25\xc0\x0c\x56" \
+    "\x02\xcc\x80\x25\xc0\x0c\x5a\x02\xcc\xc0\x25\xc0\x0c\x5e\x02\xcc" "\x00\x26\xc0\xcc\xf1\x16\x70\x29\xf0\x16\x10\x2a\x90\x16\x70\x2a" \
+    "\x62\x02\xcc\x40\x26\xc0\x0c\x66\x02\xcc\x80\x26\xc0\x0c\x6a\x02" "\xcc\xc0\x26\xc0\x0c\x6e\x02\xcc\x00\x27\xc0\x0c\x72\x02\xcc\x40" \
+    "\x27\xc0\x0c\x76\x02\xcc\x80\x27\xc0\xcc\xb1\x11\xd0\x28\xb0\x11" "\xd0\x27\x30\x10\x50\x26\x7a\x02\xcc\xc0\x27\xc0\x0c\x7e\x02\xcc" \
+    "\x00\x28\xc0\x0c\x82\x02\xcc\x44\x28\xc0\x0c\x86\x02\xcc\x80\x28" "\xc0\x0c\x8a\x02\xcc\xc0\x28\xc0\x4c\x8e\x02\xcc\x1c\x15\x01\xfd" \
+    "\x01\x0b\x01\xfd\x01\x01\x01\xf3\x01\x29\xc0\x0c\x00\x05\xcc\x10" "\xbb\x01\x79\x02\xb5\x01\x73\xa2\x5e\xc0\xcc\x91\x11\x10\x26\xf0" \
+    "\x11\xb0\x25\xb0\x12\xb0\x25\x4e\x07\xcc\x1c\x09\x01\x45\x02\x09" "\x01\x65\x02\x13\x01\x6f\xa2\x91\xc0\x0c\x44\x09\xcc\x20\x95\xc0" \
+    "\x8c\x51\x1e\xd0\x28\xf0\x1e\xd0\x28\x90\x1f\x70\x29\x80\x09\xcc" "\x80\x99\xc0\x0c\x4c\x0a\xcc\x60\xad\xc0\x8c\xb1\x1e\xb0\x2b\xd0" \
+    "\x1f\x90\x2a\xf0\x1f\x90\x2a\xfe\xff\x9b\x51\x14\x00\x00\x08\x5e" "\x01\xee\x03\x00\xe0\x0d\x40\x11\x38\xf6\x83\x19\x20\x00\x00\x00" \
+    "\x00\x00\x00\x00\x00\x10\x5f\x04\x05\x00\x02\x1d\x6f\x00\x00\x65" "\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x0d\x60\x81\x63\x0e" \
+    "\xf1\x96\x49\x00\x51\xc4\x84\x0d\xc8\x90\x1f\x0e\x37\xe5\x3e\x00" "\x27\x0a\x26\x0c\x68\xfe\x94\x04\xd6\xfe\x19\x06\xc2\x05\x00\xfd" \
+    "\x27\x01\x1e\x00\x04\x82\xe1\x01\x48\xd5\xfc\xa5\x00\x00\x20\x06" "\x10\x10\x30\xc6\x50\x04\x80\x40\x30\x3c\x00\xa9\x9a\xbf\x14\x00" \
+    "\x00\x87\x00\x02\x02\xc6\x18\xae\x00\x10\x08\x86\x07\x20\x55\xf3" "\x97\x02\x00\x80\x16\x40\x40\xc0\x18\xc3\xa4\x00\x33\x47\x5c\xc0" \
+    "\xa2\xc0\x5c\x40\xa2\x40\x5f\x40\xa2\x50\x0a\x30\x83\xa5\x00\x33" "\x60\x0a\x30\x73\xd4\x06\xc4\x0a\xc4\x06\xd4\x0a\xc4\x06\xfc\x8a" \
+    "\xa6\x00\x33\x70\x0a\x30\x83\xa7\x00\x33\x80\x0a\x30\x83\xa8\x00" "\x33\x90\x0a\x30\x73\x5c\x07\x7c\x0a\x5c\x07\x8c\x0a\x64\x07\x94" \
+    "\x8a\xcb\x00\x33\x46\x45\x40\xa6\xc0\x40\xc0\xa1\xc0\x40\xc0\x9a" "\x10\x10\x30\x73\x0c\x07\x64\x0a\xdc\x06\x94\x0a\xdc\x06\xd4\x8a" \
+    "\x47\x02\x33\x47\x4b\xc0\x7f\x40\x4e\xc0\x82\x40\x4e\xc0\x83\x40" "\x25\x30\x63\x9c\x08\x54\x09\xb4\x08\x54\x09\xbc\x08\x4c\x89\x63" \
+    "\x02\x33\x47\x55\xc0\xa8\x40\x52\xc0\xab\x40\x4f\xc0\xab\x80\x26" "\x30\x83\x71\x02\x33\x08\x2a\x30\x73\x0c\x06\xc4\x04\xe4\x05\xec" \
+    "\x04\xc4\x05\xec\x04\xa3\x02\x33\xc6\x82\x40\x9e\xc0\x84\x40\x9e" "\x40\x87\xc0\x9b\x30\x2b\x30\x73\x1c\x04\xdc\x08\xe4\x03\xa4\x08" \
+    "\xe4\x03\x24\x88\xff\xff\x66\x14\x05\x00\x00\x72\x74\x8f\xdf\x00" "\x00\x78\x03\x20\xd0\x90\x60\xb1\xbc\x08\x00\x00\x00\xc0\xcc\x10" \
+    "\x00\x00\x0b\x1b\x06\x5f\x05\x28\x00\x86\x01\x10\x22\x02\x05\x00" "\x02\xbd\x8c\x00\x00\x1c\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00" \
+    "\x00\x0d\x34\xe4\xab\x0f\xe6\x9f\x49\x00\x36\x7d\x47\x0d\x98\x48" "\xad\x0e\x37\xe5\x3e\x00\x9b\x85\xdd\x0b\x68\xfe\x97\x17\xc1\xff" \
+    "\x15\x06\x6a\x04\x00\x10\xc2\x05\x05\x00\x02\x0c\xca\x00\x00\x1b" "\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xfd\x4e\x01\x20\x00" \
+    "\x04\x82\xe1\x01\x48\xd5\xfc\xa5\x00\x00\x38\x04\x10\x10\x30\xc6" "\xf0\x04\x80\x40\x30\x3c\x00\xa9\x9a\xbf\x14\x00\x00\x87\x00\x02" \
+    "\x02\xc6\x18\x4e\x05\x98\x01\x55\x80\x19\x54\x05\x98\x81\x55\x80" "\x19\x63\x50\xe0\x65\x60\x4d\xe0\x62\x60\x4d\x60\x62\x5c\x05\x98" \
+    "\x01\x56\x80\x99\x64\x05\x98\x39\x1e\x04\xce\x03\x1a\x04\xd2\x03" "\x16\x04\xd2\x83\x56\x80\x19\x6c\x05\x98\x09\x57\x80\x19\x74\x05" \
+    "\x98\x81\x57\x80\x19\x7c\x05\x98\x01\x58\x80\x19\x84\x05\x98\x81" "\x58\x80\x19\x8c\x05\x98\x01\x59\x80\x19\x94\x05\x98\x39\x86\x03" \
+    "\x52\x05\x72\x03\x52\x05\x6e\x03\x56\xc5\x6e\x80\x19\xa3\x46\x60" "\x43\x20\x49\xe0\x40\x20\x49\xe0\x39\x14\x0c\x98\x39\x52\x02\x06" \
+    "\x05\x52\x02\xda\x04\x66\x02\xc6\x04\xc7\x80\x19\xa3\x24\xe0\x3f" "\xa0\x24\x20\x3e\x20\x26\xa0\x3c\xc0\x11\x98\x09\x25\x81\x19\xb4" \
+    "\x12\x98\x31\xba\x02\x5a\x03\xce\x02\x46\x03\xa6\x02\x1e\x03\x2e" "\x81\x99\x23\x25\x60\x4f\x20\x25\xe0\x4e\xa0\x24\x60\x4e\xe8\x12" \
+    "\x98\x39\xda\x02\x5a\x03\xa2\x02\x22\x03\x92\x02\x22\xc3\x30\x81" "\x19\x38\x13\x98\x31\xa2\x02\x4a\x03\xb6\x02\x36\x03\xa2\x02\x22" \
+    "\x03\x38\x81\x99\x90\x14\x98\x01\x4b\x81\x19\xa3\x29\x60\x35\x60" "\x2a\xa0\x34\x60\x2a\x60\x34\x08\x15\x98\x31\x62\x04\x3e\x04\x66" \
+    "\x04\x42\x04\x66\x04\xb6\xc4\xff\x7f\x33\x8a\x02\x00\x00\xd9\x90" "\x3d\x7b\x00\x00\xdc\x01\x30\x06\xbf\x87\x40\x88\xc9\xe1\x77\x1f" \
+    "\x00\x00\x00\x00\x00\x9f\x05\x00\x00\x01\x03\x0d\x0e\x5a\xba\x0e" "\x11\x96\x49\x00\x7f\x37\xf6\x0d\x6d\x0d\x20\x0e\x37\xe5\x3e\x00" \
+    "\x61\x57\xbc\x0c\x68\xfe\x71\x12\x18\xff\x17\x06\xda\x04\x00\xfe" "\x00\xf1\x08\x00\xfd\x16\x01\x20\x00\x04\x82\xe1\x01\x48\xd5\xfc" \
+    "\xa5\x00\x00\x38\x04\x10\x10\x30\xc6\xd0\x38\xc0\x0c\x9c\x03\xcc" "\x24\x40\xc0\x4c\x16\x04\xcc\x84\x41\xc0\x4c\x52\x04\xcc\x1c\x0b" \
+    "\x02\x99\x02\xf9\x01\x99\x02\xdd\x01\xb5\x22\x50\xc0\x8c\xf1\x14" "\x90\x1b\x30\x15\xd0\x1b\x30\x15\x30\x1d\x06\x05\xcc\x80\x5d\xc0" \
+    "\xcc\x31\x21\x70\x20\x10\x22\x90\x1f\x10\x22\x90\x1d\x0a\x06\xcc" "\x1c\xfb\x00\x4d\x02\xfb\x00\x43\x02\xf1\x00\x39\xe2\x63\xc0\x0c" \
+    "\x40\x06\xcc\x1c\xff\x00\x25\x02\xf5\x00\x25\x02\xe5\x00\x15\x22" "\x64\xc0\xcc\xd1\x11\x50\x27\xd0\x11\xb0\x26\x30\x10\xb0\x26\x62" \
+    "\x07\xcc\x18\xef\x01\x93\x01\xd5\x01\xad\x01\xdb\x01\xb3\x61\x7a" "\xc0\x4c\x91\x15\xb0\x1b\x90\x15\x90\x1c\xd6\x07\xcc\x18\x15\x02" \
+    "\xc1\x01\x09\x02\xb5\x01\xfd\x01\xb5\x21\x8d\xc0\x8c\x51\x1f\xd0" "\x18\x50\x1d\xd0\x1a\xb0\x1d\x30\x1b\x10\x09\xcc\x18\xab\x01\xb7" \
+    "\x02\xa3\x01\xaf\x02\xab\x01\xa7\x02\x99\xc0\x8c\x51\x1d\x90\x28" "\x30\x1d\x70\x28\xf0\x1c\x70\x28\xa2\x09\xcc\x18\xf9\x00\xd5\x01" \
+    "\x01\x01\xd5\x01\x05\x01\xd1\xe1\xff\xbf\x99\x3c\x01\x00\x80\x04" "\x00\xc0\x2e\x00\x00\xde\x00\x04\x00\x40\x39\x00\x80\x00\x00\x00" \
+    "\x00\x00\x00\x00\x00\x00\x0d\x2d\xfa\xc9\x0d\x95\xa3\x49\x00\x8a" "\xd6\xc6\x0e\x6d\x0d\x20\x0e\x37\xe5\x3e\x00\x61\x57\xbc\x0c\x68" \
+    "\xfe\x4c\xf9\xad\xfd\x17\x06\xc5\x00\x00\x10\xc5\x01\x05\x00\x02" "\xbf\x0b\x00\x00\x57\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00" \
+    "\x10\x0d\x02\x05\x00\x02\xd7\x63\x00\x00\x36\xff\x00\x00\x00\x00" "\x00\x00\x00\x00\x00\x00\x0d\x34\x34\x1e\x0f\x0e\xa3\x49\x00\xb3" \
+    "\x47\x83\x0e\x6d\x0d\x20\x0e\x37\xe5\x3e\x00\x61\x57\xbc\x0c\x68" "\xfe\xf4\x13\x20\xff\x17\x06\x25\x02\x00\x10\x43\x02\x05\x00\x02" \
+    "\x86\xdc\x00\x00\xc5\xfe\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00" "\x0d\x3b\x9a\x3a\x0c\x29\xa5\x49\x00\xfd\x74\x21\x0c\x99\x95\x18" \
+    "\x0e\x37\xe5\x3e\x00\x61\x7c\xd9\x0b\x68\xfe\x32\xc3\xf0\xff\x1a" "\x06\x99\x03\x00\x10\xbd\x04\x05\x00\x02\xb9\x9f\x00\x00\x49\xff" \
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x10\xda\x04\x05\x00\x02" "\x86\xd2\x00\x00\x16\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00" \
+    "\x0d\x80\xd6\xea\x0e\xf8\x9d\x49\x00\x25\x39\xed\x0d\x6d\x0d\x20" "\x0e\x37\xe5\x3e\x00\x61\x57\xbc\x0c\x68\xfe\xde\x11\x45\xff\x17" \
+    "\x06\x22\x05\x00\xfd\x52\x01\x7f\x00\x04\xd0\x34\xc0\x0c\x62\x03" "\xcc\x18\xa7\x01\x87\x02\x9d\x01\x7d\x02\x73\x01\x7d\xe2\x36\xc0" \
+    "\x0c\xac\x03\xcc\xc0\x48\xc0\x8c\xd1\x1a\xb0\x28\xb0\x1a\x90\x28" "\x10\x1a\x90\x28\xac\x04\xcc\x1c\x4d\x01\xd1\x01\x51\x01\xd5\x01" \
+    "\x55\x01\xd5\xc1\x4e\xc0\x0c\xfc\x04\xcc\x40\x51\xc0\x8c\x51\x10" "\x10\x23\x70\x11\xf0\x21\x30\x13\xf0\x21\x22\x06\xcc\x18\x81\x01" \
+    "\x7f\x02\x6d\x01\x7f\x02\x69\x01\x83\x42\x64\xc0\x0c\x46\x06\xcc" "\x80\x64\xc0\x0c\x4a\x06\xcc\xc0\x64\xc0\x4c\x51\x16\x50\x27\x50" \
+    "\x16\x10\x27\x4e\x06\xcc\x20\x65\xc0\x4c\x54\x06\xcc\x1c\x35\x01" "\x93\x02\x35\x01\x89\x02\x1b\x01\x89\x62\x65\xc0\x0c\x4e\x07\xcc" \
+    "\x1c\x1f\x01\x21\x02\x29\x01\x17\x02\x29\x01\x09\xc2\x75\xc0\x8c" "\xb1\x23\x90\x21\xb0\x23\x50\x23\x50\x23\xb0\x23\x98\x07\xcc\x18" \
+    "\x45\x01\x3d\x02\x45\x01\x47\x02\x4b\x01\x4d\x62\x7a\xc0\x0c\x91" "\x15\xb0\x1b\x90\x15\x90\x1c\x90\x08\xcc\x1c\x15\x02\xd1\x01\x15" \
+    "\x02\xc1\x01\x09\x02\xb5\x01\xa1\xc0\x8c\xd1\x18\x90\x27\x10\x18" "\x50\x28\x10\x18\xf0\x28\x52\x0a\xcc\x18\x87\x01\x73\x02\x87\x01" \
+    "\x7d\x02\x79\x01\x7d\x82\xaf\xc0\x8c\x31\x12\x50\x29\xd0\x12\xb0" "\x28\x70\x12\x50\x28\x40\x0b\xcc\x1c\x81\x01\x7d\x02\x47\x01\x7d" \
+    "\x02\x43\x01\x81\x82\xb5\xc0\x8c\xb1\x1f\x10\x27\x70\x1f\x50\x27" "\x70\x1f\xd0\x29\xfe\xff\x9b\x69\x0e\x00\x00\x88\x93\x02\x2a\x03" \
+    "\x00\xe0\x0d\xc0\x92\x97\x7e\x43\x19\x20\x00\x00\x00\x00\x00\x00" "\x00\x00\x10\xc5\x00\x05\x00\x02\xee\x78\x00\x00\x64\xff\x00\x00" \
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x10\x25\x02\x05\x00\x02\xa6\xd0" "\x00\x00\x62\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x10\x99" \
+    "\x03\x05\x00\x02\xef\x05\x00\x00\x55\xff\x00\x00\x00\x00\x00\x00" "\x00\x00\x00\x00\x0d\x54\x0a\x7d\x0c\x48\xa4\x49\x00\xdb\x4d\x02" \
+    "\x0e\x6d\x0d\x20\x0e\x37\xe5\x3e\x00\x61\x57\xbc\x0c\x68\xfe\xf2" "\xda\x6a\xff\x17\x06\x71\x04\x00\x10\x22\x05\x05\x00\x02\x2e\xb1" \
+    "\x00\x00\x20\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xfd\x9a" "\x01\x33\x00\x04\xf0\x0f\x80\x40\x30\x80\x00\x00\x90\x29\x15\x00" \
+    "\x00\x87\x00\x00\x44\x22\x10\x6e\x03\x98\x31\x2a\x03\xf6\x04\x92" "\x02\xf6\x04\x7e\x02\x0a\x85\x3b\x80\x99\xe3\x41\x60\x4b\xe0\x41" \
+    "\xa0\x48\x20\x43\x60\x47\x74\x06\x98\x81\x6b\x80\x99\xe3\x34\xe0" "\x56\x60\x30\x60\x52\x20\x2b\x60\x52\x00\x07\x98\x81\x72\x80\x19" \
+    "\xa0\x07\x98\x89\x8a\x80\x19\x04\x09\x98\xc1\x90\x80\x19\xb0\x09" "\x98\x39\xa2\x03\xfe\x04\xa2\x03\x26\x05\x9a\x03\x2e\xc5\x9d\x80" \
+    "\x99\x4c\x0a\x98\x31\x6a\x02\xca\x03\x5a\x02\xba\x03\x5a\x02\x9a" "\x43\xa5\x80\x19\xa3\x22\x60\x3b\x20\x23\xe0\x3b\x20\x23\x20\x3d" \
+    "\x24\x0b\x98\x39\xae\x02\x9e\x04\x96\x02\xb6\x04\x96\x02\xca\x84" "\xb2\x80\x19\x63\x37\x60\x52\x60\x3c\x60\x52\xa0\x3d\xa0\x53\x9c" \
+    "\x0b\x98\x31\x3a\x04\x3a\x04\x26\x04\x3a\x04\x26\x04\x0a\x04\xcb" "\x80\x99\xe3\x2a\xe0\x4d\xe0\x2a\x20\x4f\xe0\x28\x20\x51\xb4\x0c" \
+    "\x98\x81\xcb\x80\x99\x23\x3c\x60\x4c\x60\x3b\x60\x4c\x20\x3b\x20" "\x4c\xbc\x0c\x98\x01\xcc\x80\x99\xc4\x0c\x98\x89\xcc\x80\x19\xcc" \
+    "\x0c\x98\x01\xcd\x80\x19\xd4\x0c\x98\x39\xe2\x02\x72\x05\xc2\x02" "\x92\x05\xae\x02\x92\x85\xcd\x80\x19\xdc\x0c\x98\x01\xce\x80\x19" \
+    "\xe4\x0c\x98\x81\xce\x80\x19\xec\x0c\x98\x01\xcf\x80\x19\xf4\x0c" "\x98\x81\xcf\x80\x19\xfc\x0c\x98\x01\xd0\x80\x19\xe3\x3c\x20\x53" \
+    "\xe0\x3c\x60\x55\xe0\x3a\x60\x57\x30\x0e\x98\x31\x62\x02\xde\x03" "\x76\x02\xca\x03\x76\x02\xa2\x83\xee\x80\x99\xa3\x42\x20\x43\xa0" \
+    "\x42\x60\x47\x60\x44\x20\x49\x28\x11\x98\x39\x72\x02\x76\x03\x72" "\x02\x36\x03\x86\x02\x22\x43\x2a\x81\x99\x63\x41\xa0\x4d\x60\x40" \
+    "\xa0\x4c\x20\x3c\xe0\x50\xfc\xff\x37\xa3\x28\x00\x00\x90\x00\x00" "\x00\x05\x00\xc0\x1b\x80\x00\x00\x80\x87\x5d\x13\x00\x00\x00\x00" \
+    "\x00\x60\x00\x00\xd8\x04\x00\x00\x01\x03\x0d\x83\xf2\x2e\x0f\x83" "\xa5\x49\x00\x35\xfb\x40\x0d\x0d\xbd\xc9\x0d\x37\xe5\x3e\x00\x0c" \
+    "\xb7\x7a\x0b\x68\xfe\x79\x19\x70\xff\x20\x06\x27\x04\x00\x0d\xf1" "\xd7\xba\x0c\x35\x0d\x49\x00\x20\x75\x78\x0d\x0d\xbd\xc9\x0d\x37" \
+    "\xe5\x3e\x00\x0c\xb7\x7a\x0b\x68\xfe\xa7\xd2\x69\xff\x20\x06\xae" "\x04\x00\xfe\xa0\x08\x09\x00\xfd\x13\x01\x1c\x00\x04\x82\x01\x04" \
+    "\x00\xe0\x57\xa0\x00\x00\x20\x06\x00\x10\x41\xbe\xd0\x36\xc0\x0c" "\x6e\x03\xcc\x00\x37\xc0\x0c\xcc\x03\xcc\x1c\x31\x01\x85\x02\x25" \
+    "\x01\x79\x02\x25\x01\x4f\xe2\x4d\xc0\xcc\x31\x22\xd0\x1e\x30\x22" "\x50\x1b\xd0\x1d\xf0\x16\x34\x07\xcc\x1c\xc9\x01\x93\x02\xc9\x01" \
+    "\x9d\x02\xab\x01\xbb\x02\x7c\xc0\xcc\xb1\x0f\xd0\x21\x30\x0f\x50" "\x21\xd0\x0e\x50\x21\x20\x09\xcc\x1c\x2f\x01\x6d\x02\x21\x01\x7b" \
+    "\x02\x21\x01\x95\xc2\x9b\xc0\x8c\x71\x20\xf0\x1d\xf0\x1f\x70\x1d" "\xb0\x1f\xb0\x1d\xc0\x09\xcc\x1c\x67\x01\xbd\x01\x6b\x01\xc1\x01" \
+    "\x6b\x01\xc5\x81\xaf\xc0\x8c\xb1\x12\xb0\x29\x10\x10\x10\x27\x10" "\x10\xd0\x25\x06\x0b\xcc\x80\xb0\xc0\x0c\x1e\x0b\xcc\x18\x15\x02" \
+    "\x29\x02\x0f\x02\x23\x02\x07\x02\x2b\x42\xb2\xc0\x8c\x51\x13\x70" "\x1c\x90\x13\x70\x1c\x30\x14\xd0\x1b\x28\x0b\xcc\x18\x53\x01\x9b" \
+    "\x02\x5f\x01\xa7\x02\x5f\x01\xb1\xa2\xb9\xc0\x8c\x31\x13\xf0\x1b" "\x30\x13\x70\x1b\xd0\x14\xd0\x19\xb4\x0b\xcc\x1c\x47\x01\xad\x02" \
+    "\x51\x01\xb7\x02\x5f\x01\xb7\xe2\xff\xbf\x19\x45\x01\x00\x80\x1c" "\x5d\x1f\x3f\x00\x00\xde\x00\x50\x7f\xdc\x47\x74\x27\x00\x00\x00" \
+    "\x00\x38\xcb\x00\x00\x00\x10\x27\x04\x05\x00\x02\x5a\x96\x00\x00" "\x71\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x0d\x85\x71\x7b" \
+    "\x0c\x3b\xa3\x49\x00\x89\x5a\xff\x0d\x27\x44\x87\x0d\x0d\xe5\x3e" "\x00\xba\x05\xf0\x0b\x68\xfe\xd5\xec\x66\xff\x14\x06\x71\x04\x00" \
+    "\x10\xae\x04\x05\x00\x02\xb0\xcb\x00\x00\x82\xff\x00\x00\x00\x00" "\x00\x00\x00\x00\x00\x00\x0d\x96\x99\x62\x0d\x68\xa3\x49\x00\xd0" \
+    "\x96\x42\x0e\x27\x44\x87\x0d\x0d\xe5\x3e\x00\xba\x05\xf0\x0b\x68" "\xfe\xbb\xfe\x01\xfd\x14\x06\xed\x04\x00\xfd\xb7\x01\x75\x00\x04" \
+    "\x90\x1d\xc0\x8c\x91\x14\xb0\x27\x90\x15\xb0\x28\x90\x15\x50\x29" "\xf8\x02\xcc\x18\xf9\x00\xf7\x01\xf9\x00\xf1\x01\xf5\x00\xed\x21" \
+    "\x37\xc0\xcc\x31\x17\x70\x1a\x90\x16\x70\x1a\xd0\x15\xb0\x19\x74" "\x03\xcc\x60\x37\xc0\xcc\xb1\x21\xb0\x1d\x70\x21\xf0\x1d\xf0\x20" \
+    "\x70\x1d\x78\x03\xcc\xa0\x37\xc0\x0c\x7c\x03\xcc\xe0\x37\xc0\x0c" "\x80\x03\xcc\x20\x38\xc0\x0c\x84\x03\xcc\x60\x38\xc0\xcc\x51\x11" \
+    "\x90\x23\xb0\x10\x30\x24\xb0\x10\xd0\x26\x88\x03\xcc\xa0\x38\xc0" "\x0c\x8c\x03\xcc\xe0\x38\xc0\xcc\xf1\x11\x50\x1a\x90\x12\xf0\x1a" \
+    "\xb0\x12\xd0\x1a\xdc\x03\xcc\x18\x0b\x01\xe9\x01\x17\x01\xe9\x01" "\x31\x01\x03\x02\x47\xc0\x8c\x91\x13\xb0\x1b\x50\x13\xf0\x1b\x70" \
+    "\x12\xf0\x1b\xae\x08\xcc\x1c\x2b\x01\xd3\x01\x23\x01\xcb\x01\x23" "\x01\xc3\xe1\x8c\xc0\x8c\x91\x21\xf0\x27\xf0\x23\x90\x25\xf0\x23" \
+    "\xd0\x24\x0c\x09\xcc\x18\x0f\x02\xdf\x01\x07\x02\xdf\x01\xff\x01" "\xd7\x01\x93\xc0\x8c\x71\x12\x10\x22\x50\x12\xf0\x21\xb0\x11\xf0" \
+    "\x21\xf4\x09\xcc\x1c\x55\x01\xb5\x01\x5d\x01\xbd\x01\x67\x01\xbd" "\x21\xa1\xc0\x8c\x31\x19\xf0\x26\x50\x1a\x10\x28\x50\x1a\x30\x29" \
+    "\x14\x0a\xcc\x1c\x7d\x01\x75\x01\x7d\x01\x7f\x01\x87\x01\x89\x61" "\xa3\xc0\x8c\xf1\x18\xd0\x2a\xf0\x19\xd0\x2b\x90\x1a\xd0\x2b\x6e" \
+    "\x0a\xcc\x1c\x73\x01\x49\x01\x73\x01\x3f\x01\x77\x01\x3b\xe1\xaa" "\xc0\x8c\x71\x20\xf0\x25\x10\x21\xf0\x25\x50\x21\xb0\x25\xb2\x0a" \
+    "\xcc\x18\xf9\x01\x7f\x02\x15\x02\x7f\x02\x1f\x02\x89\x42\xab\xc0" "\x0c\x26\x0b\xcc\x18\x75\x01\x7d\x02\x57\x01\x7d\x02\x2f\x01\xa5" \
+    "\xc2\xb2\xc0\x8c\x51\x1e\x30\x19\xf0\x1e\x30\x19\xf0\x1e\x90\x18" "\x56\x0b\xcc\x1c\x37\x02\x67\x02\x45\x02\x59\x02\x45\x02\x4b\xa2" \
+    "\xb8\xc0\xcc\x51\x13\x70\x1a\x30\x14\x70\x1a\xd0\x14\xd0\x19\xfe" "\xff\x9b\x51\x14\x00\x00\x08\xcb\x01\xae\x02\x00\xe0\x0d\xc0\x76" \
+    "\x01\x62\x04\x70\x3c\x00\x00\x00\x00\x00\x00\x00\x00\x10\x71\x04" "\x05\x00\x02\xa6\x2c\x00\x00\x74\xff\x00\x00\x00\x00\x00\x00\x00" \
+    "\x00\x00\x00\x10\xed\x04\x05\x00\x02\xa3\xdd\x00\x00\x75\xff\x00" "\x00\x00\x00\x00\x00\x00\x00\x00\x00\xfd\x27\x01\x75\x00\x04\x82" \
+    "\x01\x04\x00\x30\x2e\xa9\x00\x00\x38\x04\x00\xe0\xb6\x8a\xd0\x2a" "\xc0\xcc\x51\x20\xb0\x29\xf0\x20\x10\x29\xd0\x21\x10\x29\x8e\x03" \
+    "\xcc\x18\x1f\x01\xa5\x01\x29\x01\xaf\x01\x2b\x01\xad\x01\x39\xc0" "\x0c\x92\x03\xcc\x40\x39\xc0\xcc\xd1\x12\xd0\x1f\x10\x13\x10\x20" \
+    "\x50\x12\xd0\x20\x68\x04\xcc\x1c\x41\x02\x47\x02\x41\x02\x51\x02" "\x35\x02\x5d\x22\x62\xc0\xcc\xb1\x19\xf0\x29\x50\x1a\x90\x2a\x70" \
+    "\x1a\x90\x2a\x48\x07\xcc\x18\x05\x01\x07\x02\x1d\x01\xef\x01\x1d" "\x01\xed\xe1\x87\xc0\x8c\xd1\x17\x50\x27\x70\x17\xb0\x27\xb0\x16" \
+    "\xb0\x27\x08\x09\xcc\x18\x1f\x01\xb5\x01\x1f\x01\xa9\x01\x2f\x01" "\x99\x21\x95\xc0\xcc\x71\x1f\x10\x26\x70\x1f\x70\x25\x50\x1f\x50" \
+    "\x25\x2a\x0a\xcc\x10\x39\x01\x0f\x02\x3d\x01\x0f\xe2\xa2\xc0\x8c" "\xd1\x16\x10\x26\x30\x16\x10\x26\x90\x15\xb0\x26\x52\x0a\xcc\x18" \
+    "\x7b\x01\x73\x02\x6d\x01\x81\x02\x6d\x01\x99\xc2\xa6\xc0\xcc\x91" "\x1e\xf0\x29\xd0\x1e\xf0\x29\x70\x1f\x90\x2a\x9e\x0a\xcc\x18\x0d" \
+    "\x02\x57\x02\x11\x02\x57\x02\x15\x02\x53\x22\xaa\xc0\x0c\xa8\x0b" "\xcc\x1c\xf7\x01\x67\x02\xf7\x01\x5d\x02\xf5\x01\x5b\xe2\xff\xbf" \
+    "\x19\x45\x01\x00\x80\xfc\xff\xff\x44\x00\x00\xde\x00\xb4\x4c\x2a" "\x4b\x48\x05\x03\x00\x00\x00\x00\x00\x03\x00\x00\xdb\x04\x00\x00" \
+    "\x01\x03\x10\x3e\x00\x05\x00\x02\xc6\x2c\x00\x00\x66\xff\x00\x00" "\x00\x00\x00\x00\x00\x00\x00\x00\x0d\x50\x68\x9a\x0d\x6c\xa0\x49" \
+    "\x00\x73\xc0\xd6\x0d\xbc\xfb\xaf\x0d\x37\xe5\x3e\x00\xc0\x0c\xb0" "\x0b\x68\xfe\x0d\xfc\xaa\x01\x23\x06\x35\x01\x00\x10\x08\x03\x05" \
+    "\x00\x02\x80\x40\x00\x00\x74\xff\x00\x00\x00\x00\x00\x00\x00\x00" "\x00\x00\x0d\xc7\x92\x4b\x0c\x24\x9e\x48\x00\xa1\xc4\x63\x0d\xbc" \
+    "\xfb\xaf\x0d\x37\xe5\x3e\x00\xc0\x0c\xb0\x0b\x68\xfe\x87\xf6\x38" "\xff\x23\x06\x1f\x05\x00\xfe\xe9\x1e\x09\x00\xfd\xab\x01\x12\x00" \
+    "\x04\x82\x01\x04\x00\xd0\xc1\xaf\x00\x00\x38\x04\x00\x10\x4f\xc4" "\x10\x08\xc0\x4c\x4d\x24\x3e\x25\x10\x1c\xb0\x22\x50\x02\xcc\xe0" \
+    "\x27\xc0\x0c\xce\x02\xcc\x60\x30\xc0\x0c\x22\x04\xcc\x1c\x3d\x01" "\x23\x02\x33\x01\x23\x02\x33\x01\x27\x62\x43\xc0\x0c\xa2\x04\xcc" \
+    "\x18\xe3\x01\x7f\x02\x0d\x02\x7f\x02\x1b\x02\x71\xa2\x4b\xc0\x8c" "\xd1\x12\x50\x1b\x10\x13\x90\x1b\x90\x13\x90\x1b\xe6\x05\xcc\x18" \
+    "\x4d\x01\xbf\x01\x4b\x01\xbf\x01\x49\x01\xbd\xe1\x63\xc0\xcc\xb1" "\x13\x70\x26\x30\x13\x70\x26\x90\x12\x10\x27\x40\x06\xcc\x1c\x1b" \
+    "\x01\xe7\x01\x1f\x01\xeb\x01\x29\x01\xeb\x21\x64\xc0\xcc\x11\x16" "\x30\x28\xd0\x15\x30\x28\xb0\x15\x50\x28\x44\x06\xcc\x18\x57\x01" \
+    "\x37\x02\x51\x01\x3d\x02\x51\x01\x43\x62\x64\xc0\x0c\x48\x06\xcc" "\xa0\x64\xc0\x0c\x4c\x06\xcc\x1c\x63\x01\xa5\x02\x63\x01\x9b\x02" \
+    "\x67\x01\x97\xe2\x64\xc0\x0c\x50\x06\xcc\x1c\x33\x02\x5b\x02\x33" "\x02\x55\x02\x1b\x02\x3d\x22\x65\xc0\xcc\xf1\x17\xb0\x29\x10\x1a" \
+    "\xb0\x29\x70\x1a\x10\x2a\x54\x06\xcc\x1c\x4b\x01\x5d\x02\x45\x01" "\x5d\x02\x3b\x01\x67\x62\x65\xc0\x0c\x58\x06\xcc\x1c\x73\x01\x69" \
+    "\x02\x65\x01\x69\x02\x51\x01\x7d\x62\x75\xc0\x8c\xb1\x21\x90\x27" "\x70\x22\xd0\x26\x70\x22\x30\x26\x6e\x07\xcc\x18\x7b\x01\xab\x01" \
+    "\x8d\x01\x99\x01\x97\x01\x99\x21\x77\xc0\x0c\xee\x08\xcc\x18\x6d" "\x01\x81\x01\x55\x01\x81\x01\x4f\x01\x87\x01\x9c\xc0\x0c\xf1\x15" \
+    "\xf0\x1c\xf0\x15\x50\x1d\x66\x0a\xcc\x18\xf7\x00\xed\x01\xf7\x00" "\xe1\x01\x01\x01\xd7\x41\xa7\xc0\xcc\x31\x16\x10\x19\xd0\x15\x70" \
+    "\x19\xd0\x15\x50\x1a\x36\x0b\xcc\x1c\x33\x01\x31\x02\x33\x01\x25" "\x02\x35\x01\x23\xa2\xb4\xc0\xcc\x91\x15\x10\x27\xd0\x15\x10\x27" \
+    "\x30\x16\x70\x27\xfe\xff\x9b\x51\x14\x00\x00\x88\xe1\xbd\x38\x04" "\x00\xe0\x0d\x00\xc7\x3d\x53\x43\x15\x07\x00\x00\x00\x00\x00\x60" \
+    "\x00\x00\x10\x35\x01\x05\x00\x02\x32\x83\x00\x00\x6a\xff\x00\x00" "\x00\x00\x00\x00\x00\x00\x00\x00\x10\x1f\x05\x05\x00\x02\x4c\xe2" \
+    "\x00\x00\x6e\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x0d\x37" "\xd4\x5d\x0e\xe6\x9f\x49\x00\x92\xdb\xb1\x0d\xbc\xfb\xaf\x0d\x37" \
+    "\xe5\x3e\x00\xc0\x0c\xb0\x0b\x68\xfe\xe2\x0d\x50\xff\x23\x06\xae" "\x05\x00\xfd\x56\x01\x71\x00\x66\x8c\x1f\x81\x22\x81\x24\x81\x1d" \
+    "\x81\x24\x81\x17\xc1\x15\x60\x06\x6f\x01\x66\xa0\x17\x60\x06\x88" "\x01\x66\x8c\x05\x81\x09\x81\x06\x81\x08\x81\x06\x81\x04\x11\x1a" \
+    "\x60\x06\xa2\x01\x66\xe0\x1a\x60\xc6\xe8\x0c\xd8\x14\x78\x0d\x48" "\x14\x08\x0e\x48\x14\xaf\x01\x66\x80\x1b\x60\x06\xc6\x01\x66\xb0" \
+    "\x1f\x60\x06\x1f\x02\x66\x50\x25\x60\x06\x68\x02\x66\x8c\x1a\x81" "\x17\x81\x1a\x81\x16\x81\x17\x81\x13\x31\x27\x60\x06\x2d\x03\x66" \
+    "\xe0\x32\x60\xe6\x48\x0f\x08\x15\xd8\x0e\x08\x15\x68\x0e\x98\x14" "\x2f\x03\x66\x8c\x84\x80\xd7\x80\x8c\x80\xdf\x80\x91\x80\xdf\x00" \
+    "\x33\x60\x26\x31\x03\x66\x8e\xa8\x80\x2b\x81\xa9\x80\x2a\x81\xab" "\x80\x2a\x21\x33\x60\xe6\x88\x11\xb8\x10\x88\x11\x48\x10\x98\x11" \
+    "\x38\x10\x8e\x03\x66\x8c\x89\x80\xde\x80\x8d\x80\xe2\x80\x8d\x80" "\xe4\x90\x3b\x60\x86\x0f\x12\x67\x17\x28\x0d\x68\x10\xc0\x03\x66" \
+    "\x8c\x17\x81\x18\x81\x27\x81\x08\x81\x27\x81\x00\xc1\x51\x60\xc6" "\xe8\x08\xa8\x11\xb8\x08\xa8\x11\xa8\x08\xb8\x11\x34\x05\x66\x8e" \
+    "\xac\x80\x34\x81\xa0\x80\x34\x81\x94\x80\x28\x31\x56\x60\xe6\xc8" "\x0c\xd8\x13\x28\x0c\x38\x13\x18\x0c\x38\x13\x95\x05\x66\x8c\xaa" \
+    "\x80\xd5\x80\xaf\x80\xd0\x80\xae\x80\xcf\xc0\x59\x60\xe6\x48\x0f" "\xb8\x13\x48\x0f\x18\x14\x08\x0f\x58\x14\xa6\x05\x66\x8a\x0e\x81" \
+    "\xf5\x80\x0d\x81\xf5\xf0\xff\xdf\x8c\xa2\x00\x00\x40\x34\x9a\x4e" "\x1a\x00\x00\x73\x00\xa6\x49\xed\x24\x94\x29\xca\x03\xc0\xfa\x01" \
+    "\x00\x00\x00\x00\x10\xae\x05\x05\x00\x02\x86\xbe\x00\x00\x68\xff" "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xfd\x01\x01\x74\x01\x66" \
+    "\xb0\x17\x60\xc6\x18\x0a\xb8\x11\x08\x0a\xa8\x11\xd8\x09\xa8\x11" "\x98\x01\x66\x8e\x14\x81\x29\x81\x19\x81\x24\x81\x1e\x81\x24\x21" \
+    "\x1d\x60\x06\x24\x02\x66\x70\x2a\x60\xe6\x38\x11\x28\x11\xa8\x11" "\x28\x11\xc8\x11\x48\x11\x33\x03\x66\x8c\xd8\x80\x40\x81\xe2\x80" \
+    "\x36\x81\xe2\x80\x33\x41\x33\x60\x06\x35\x03\x66\x8e\xaa\x80\x2e" "\x81\xab\x80\x2d\x81\xab\x80\x2a\x61\x33\x60\x06\x37\x03\x66\x80" \
+    "\x33\x60\x06\x39\x03\x66\xa0\x33\x60\x06\x3b\x03\x66\xc0\x33\x60" "\x06\x3d\x03\x66\xe0\x33\x60\x06\x3f\x03\x66\x00\x34\x60\xc6\xf8" \
+    "\x0b\x98\x15\x48\x0c\x48\x15\x08\x0c\x08\x15\x41\x03\x66\x8e\x96" "\x80\x31\x81\x96\x80\x36\x81\x91\x80\x36\x21\x34\x60\xe6\xe8\x07" \
+    "\x88\x0f\x28\x08\xc8\x0f\x78\x08\xc8\x0f\x5c\x05\x66\x8e\xac\x80" "\xd2\x80\xae\x80\xd0\x80\xae\x80\xcb\x00\x58\x60\xc6\xe8\x0e\x58" \
+    "\x15\xb8\x0e\x28\x15\xb8\x0e\xd8\x14\xaa\x05\x66\x8e\x9e\x80\x1a" "\x81\xa3\x80\x1a\x81\xa5\x80\x18\xf1\xff\xdf\x8c\xa2\x00\x00\x40" \
+    "\xfe\xff\x7f\x22\x00\x00\x6f\x00\xfe\xff\x3f\x26\x52\x78\x01\x00" "\x00\x00\x00\x80\x01\x00\x00\x36\x04\x00\x00\x01\x03\xfe\x0a\x19" \
+    "\x0a\x00\xfd\x00\x02\x32\x00\x04\x82\x01\x04\x00\xd0\xf3\xaf\x00" "\x00\x98\x04\x00\xf0\x7a\xc7\x70\x0c\xc0\x0c\xdc\x00\xcc\xc0\x19" \
+    "\xc0\x0c\xa8\x01\xcc\x00\x1c\xc0\x0c\x94\x02\xcc\x60\x2a\xc0\x0c" "\xde\x02\xcc\x20\x30\xc0\x0c\x18\x03\xcc\x20\x39\xc0\x0c\x98\x03" \
+    "\xcc\x1c\x0b\x01\x07\x02\x0b\x01\xfb\x01\x01\x01\xf1\xa1\x42\xc0" "\x8c\xb1\x22\x90\x1e\x70\x22\xd0\x1e\x50\x22\xd0\x1e\xa8\x05\xcc" \
+    "\x18\x3d\x01\xd9\x01\x4d\x01\xe9\x01\x45\x01\xf1\x61\x61\xc0\x8c" "\x11\x14\x30\x1d\x10\x14\x70\x1d\x30\x14\x90\x1d\xc6\x06\xcc\x1c" \
+    "\x0f\x01\x87\x02\x21\x01\x75\x02\x2b\x01\x75\x62\x77\xc0\xcc\xf1" "\x15\xd0\x1a\x10\x16\xb0\x1a\x10\x16\x10\x1a\x78\x07\xcc\x18\x15" \
+    "\x02\x25\x02\x15\x02\x2f\x02\x19\x02\x2f\xa2\x77\xc0\x8c\xd1\x13" "\xf0\x19\xb0\x14\xd0\x1a\xb0\x13\xd0\x1b\x7c\x07\xcc\x1c\xe1\x00" \
+    "\x1f\x02\xe1\x00\x15\x02\xd7\x00\x0b\xe2\x77\xc0\x8c\xd1\x19\x50" "\x27\xd0\x19\x10\x27\xf0\x19\xf0\x26\x80\x07\xcc\x1c\xb7\x01\xbd" \
+    "\x02\xd5\x01\xbd\x02\xdf\x01\xb3\x22\x78\xc0\x8c\xf1\x17\xf0\x29" "\xb0\x18\x30\x29\x50\x19\x30\x29\x84\x07\xcc\x1c\x1f\x01\x63\x02" \
+    "\x2d\x01\x71\x02\x2d\x01\x7d\x62\x78\xc0\xcc\xd1\x1a\x70\x2b\xb0" "\x1a\x50\x2b\xb0\x1a\x30\x2b\x88\x07\xcc\x1c\xcd\x01\x87\x02\xdf" \
+    "\x01\x87\x02\xe5\x01\x81\xa2\x78\xc0\x8c\x11\x21\x90\x25\xb0\x22" "\x90\x25\x50\x23\xf0\x24\x8c\x07\xcc\xe0\x78\xc0\xcc\xb1\x22\x30" \
+    "\x23\x50\x22\xd0\x22\xb0\x21\xd0\x22\x90\x07\xcc\x1c\x23\x01\x37" "\x02\x23\x01\x2f\x02\x2b\x01\x27\x22\x8d\xc0\x8c\x11\x22\x50\x1d" \
+    "\xd0\x21\x90\x1d\x70\x21\x90\x1d\x10\x09\xcc\x18\x39\x01\x5f\x02" "\x33\x01\x65\x02\x25\x01\x65\x82\x93\xc0\x8c\xd1\x22\x10\x1d\x30" \
+    "\x22\x10\x1d\x10\x22\x30\x1d\x90\x09\xcc\x1c\xf1\x00\xf1\x01\xf1" "\x00\xe9\x01\x01\x01\xd9\x01\xa3\xc0\xcc\x91\x1d\x90\x27\x10\x1d" \
+    "\x90\x27\xf0\x1c\x70\x27\x3e\x0a\xcc\x18\x57\x01\x6b\x02\x67\x01" "\x7b\x02\x67\x01\x9f\x42\xac\xc0\xcc\x51\x20\x30\x27\x90\x20\x70" \
+    "\x27\x30\x21\x70\x27\x34\x0b\xcc\x10\x4b\x01\xf9\x01\x4b\x01\xfb" "\xa1\xb6\xc0\xcc\x31\x13\xb0\x26\x10\x13\x90\x26\x30\x11\x90\x26" \
+    "\xfe\xff\x9b\x51\x14\x00\x00\x48\x00\x00\xdc\x02\x00\xe0\x0d\x00" "\xa5\xe2\x43\xc5\xec\x0e\x00\x00\x00\x00\x00\x30\x00\x00\xfd\xf1" \
+    "\x01\x29\x00\x04\x82\x01\x04\x00\xb0\x1a\xae\x00\x00\x20\x06\x00" "\x50\xa4\xc0\xb0\x10\x80\x00\x56\x02\x10\xc0\x4c\x00\x02\xc8\x0a" \
+    "\x40\x00\x75\x01\xcc\x40\x21\xc0\x0c\x20\x02\xcc\x00\x2e\xc0\x0c" "\x14\x03\xcc\x18\xcb\x01\x8f\x02\xd3\x01\x8f\x02\xdd\x01\x85\xc2" \
+    "\x34\xc0\x0c\x70\x03\xcc\xa0\x37\xc0\x0c\x90\x03\xcc\xc0\x3a\xc0" "\x0c\xf0\x03\xcc\x20\x3f\xc0\x0c\xf4\x03\xcc\xe4\x40\xc0\x4c\x22" \
+    "\x04\xcc\x18\x31\x01\x1b\x02\x3b\x01\x1b\x02\x3d\x01\x19\x22\x44" "\xc0\xcc\xb1\x22\xd0\x21\xb0\x22\x90\x21\x70\x22\x50\x21\x5c\x04" \
+    "\xcc\x20\x46\xc0\x8c\xd1\x21\x10\x24\xb0\x21\xf0\x23\x70\x21\x30" "\x24\x66\x04\xcc\x1c\x9f\x01\xc9\x02\x8b\x01\xc9\x02\x77\x01\xb5" \
+    "\xc2\x4c\xc0\x8c\xb1\x22\x50\x20\xb0\x22\xb0\x1f\x10\x23\x50\x1f" "\xdc\x05\xcc\x18\x95\x01\xa5\x02\x95\x01\x9b\x02\x9f\x01\x9b\xe2" \
+    "\x78\xc0\x8c\xb1\x22\x30\x23\x50\x22\xd0\x22\xb0\x21\xd0\x22\x92" "\x07\xcc\x40\x79\xc0\xcc\xd1\x1c\x10\x2a\xd0\x1c\x30\x29\xb0\x1d" \
+    "\x50\x28\x96\x07\xcc\x80\x79\xc0\x0c\x9a\x07\xcc\x18\x75\x01\x83" "\x02\x79\x01\x7f\x02\x83\x01\x7f\xc2\x79\xc0\xcc\x91\x0f\xd0\x22" \
+    "\x50\x0f\xd0\x22\x10\x0f\x90\x22\x9e\x07\xcc\x04\x7a\xc0\x4c\xa2" "\x07\xcc\x1c\x1b\x01\x4f\x02\xf7\x00\x4f\x02\xdb\x00\x33\x42\x7a" \
+    "\xc0\xcc\x91\x23\xb0\x1f\xb0\x24\xd0\x20\xb0\x24\xb0\x21\xa6\x07" "\xcc\x1c\x27\x02\x51\x02\x19\x02\x51\x02\x15\x02\x55\x82\x7a\xc0" \
+    "\xcc\xf1\x1b\x90\x27\x30\x1b\xd0\x26\x10\x1b\xd0\x26\xaa\x07\xcc" "\x1c\x1f\x01\x5d\x02\x1f\x01\x63\x02\x2d\x01\x71\xc2\x7a\xc0\xcc" \
+    "\x51\x21\x30\x1f\x50\x21\x70\x1f\xf0\x20\xd0\x1f\xae\x07\xcc\x1c" "\x01\x02\x49\x02\xfd\x01\x45\x02\xf7\x01\x4b\x02\x7b\xc0\x0c\xb2" \
+    "\x07\xcc\x1c\x1f\x02\x33\x02\x21\x02\x33\x02\x2b\x02\x29\x62\x7b" "\xc0\x8c\x91\x1b\x30\x2c\xf0\x1a\x30\x2c\x30\x1a\xf0\x2c\x54\x09" \
+    "\xcc\x1c\x37\x01\xc9\x01\x41\x01\xbf\x01\x47\x01\xc5\x01\xa8\xc0" "\x8c\xb1\x15\x30\x28\xb0\x15\x90\x28\x50\x16\x30\x29\x9a\x0b\xcc" \
+    "\x18\x11\x01\xe7\x01\x11\x01\xe3\x01\x1b\x01\xd9\xe1\xff\xbf\x19" "\x45\x01\x00\x80\x54\xea\xde\x36\x00\x00\xde\x00\xc0\x25\xd9\x44" \
+    "\x90\x17\x00\x00\x00\x00\x00\x00\x00\x00\x00\x10\x86\x00\x08\x00" "\x01\xdf\x65\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00" \
+    "\x00\x10\x96\x00\x08\x00\x01\x41\x22\x00\x00\x00\x00\x00\x00\x00" "\x00\x00\x00\x00\x00\x00\x00\x10\x9a\x00\x08\x00\x01\xb9\xc5\x00" \
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xe4\x04\x00" "\x00\x01\x03\x0b\x1f\x06\x51\x03\x00\x00\x91\x01\x10\xd3\x02\x05" \
+    "\x00\x02\xe7\x02\x00\x00\x4b\xff\x00\x00\x00\x00\x00\x00\x00\x00" "\x00\x00\x10\x26\x03\x05\x00\x02\x23\x06\x00\x00\xa3\xfe\x00\x00" \
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x0d\x4f\xdc\xf8\x0f\x11\x96\x49" "\x00\x2c\x94\x32\x0d\x76\x4b\xb7\x0f\x37\xe5\x3e\x00\x36\x2c\xb6" \
+    "\x0b\x68\xfe\x62\xf4\x18\xff\x1f\x06\x80\x05\x00\xfe\x9d\x4c\x0b" "\x00\xfd\xc3\x01\x5e\x00\x04\x82\x01\x04\x00\x80\x5e\xb5\x00\x00" \
+    "\x38\x04\x00\xb0\x95\x7c\x90\x11\xc0\x8c\x91\x11\xd0\x1e\x90\x11" "\x90\x1e\xd0\x12\x50\x1d\x4c\x01\xcc\x18\xf3\x01\x7d\x02\xf5\x01" \
+    "\x7f\x02\x13\x02\x7f\x62\x18\xc0\x8c\x11\x20\x30\x26\x30\x20\x30" "\x26\x30\x24\x30\x22\x8e\x01\xcc\x18\x1d\x02\xef\x01\x13\x02\xef" \
+    "\x01\x13\x02\xe5\x81\x22\xc0\xcc\xd1\x1e\xb0\x29\x70\x1f\x10\x29" "\x90\x1f\x10\x29\xea\x02\xcc\x18\xe9\x01\xa1\x01\x1b\x02\xa1\x01" \
+    "\x21\x02\xa7\x81\x2f\xc0\xcc\x51\x10\x30\x23\x50\x10\x90\x22\x90" "\x0f\xd0\x21\x26\x03\xcc\x1c\x65\x01\xa1\x02\x6b\x01\x9b\x02\x75" \
+    "\x01\x9b\x62\x33\xc0\xcc\x51\x12\xf0\x24\x50\x12\xf0\x25\xb0\x11" "\x90\x26\x38\x03\xcc\xa0\x33\xc0\x0c\x3c\x03\xcc\xe0\x33\xc0\x4c" \
+    "\x40\x03\xcc\x20\x34\xc0\x0c\x44\x03\xcc\x60\x34\xc0\x0c\x48\x03" "\xcc\x1c\x2d\x01\x1b\x02\x2d\x01\x25\x02\x23\x01\x25\x42\x44\xc0" \
+    "\xcc\xd1\x10\xd0\x20\x70\x0f\x30\x22\x70\x0f\x50\x26\xa2\x04\xcc" "\x1c\x17\x02\x65\x02\x27\x02\x75\x02\x31\x02\x75\x22\x55\xc0\x8c" \
+    "\xd1\x10\xf0\x22\x90\x10\x30\x23\xf0\x0f\x30\x23\xb0\x05\xcc\x18" "\xeb\x01\xa9\x01\xeb\x01\x9d\x01\xfd\x01\x8b\x81\x5e\xc0\x8c\x91" \
+    "\x23\x30\x20\x90\x23\x70\x20\x70\x23\x90\x20\x3c\x06\xcc\xe0\x67" "\xc0\xcc\xd1\x0f\x50\x22\x70\x0f\xb0\x22\x70\x0f\x30\x25\x86\x06" \
+    "\xcc\x1c\x95\x01\x77\x02\x8f\x01\x71\x02\x91\x01\x6f\xa2\x6a\xc0" "\xcc\x91\x10\xf0\x21\x90\x10\x50\x21\xf0\x0f\xb0\x20\xb2\x06\xcc" \
+    "\x18\xd9\x01\xab\x01\xe3\x01\xab\x01\xed\x01\xa1\xa1\x74\xc0\xcc" "\x11\x22\x90\x24\x10\x22\xf0\x23\x90\x22\x70\x23\xa8\x09\xcc\x18" \
+    "\x7f\x01\x89\x01\x7f\x01\x93\x01\x85\x01\x99\xe1\x9d\xc0\x8c\x71" "\x11\x30\x25\x70\x11\x70\x28\x30\x12\x30\x29\x04\x0a\xcc\x20\xa6" \
+    "\xc0\x0c\xbc\x0a\xcc\x1c\xad\x01\x9b\x02\xad\x01\xa7\x02\xb1\x01" "\xab\xe2\xff\xbf\x19\x45\x01\x00\x80\x04\x00\x80\x2a\x00\x00\xde" \
+    "\x00\x94\x03\x9b\x41\x24\x03\x01\x00\x00\x00\x00\x00\x00\x00\x00" "\x0d\xc2\x26\x55\x10\xc2\xa3\x49\x00\x9e\x66\x46\x0d\x76\x4b\xb7" \
+    "\x0f\x37\xe5\x3e\x00\x36\xac\xc0\x0b\x68\xfe\x23\xf2\x66\xff\x1f" "\x06\xf3\x00\x00\x0d\x90\xa9\x21\x10\xef\x9b\x49\x00\xad\x0d\x6c" \
+    "\x0d\x76\x4b\xb7\x0f\x37\xe5\x3e\x00\x36\xac\xc0\x0b\x68\xfe\x9c" "\x08\x69\xff\x1f\x06\xe7\x02\x00\x10\x80\x05\x05\x00\x02\xfc\x60" \
+    "\x00\x00\x26\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x10\xbc" "\x05\x05\x00\x02\x1b\xe8\x00\x00\xc0\xfe\x00\x00\x00\x00\x00\x00" \
+    "\x00\x00\x00\x00\xfd\x28\x01\x1b\x00\x04\x82\x01\x04\x00\x10\x58" "\xac\x00\x00\x38\x04\x00\x10\x3b\xce\xb0\x24\xc0\x8c\x71\x20\x10" \
+    "\x27\x70\x20\xf0\x25\x30\x24\x30\x22\x4a\x03\xcc\x18\x0b\x01\x4b" "\x02\x0f\x01\x47\x02\x13\x01\x47\xc2\x34\xc0\x0c\x4e\x03\xcc\x1c" \
+    "\x19\x02\xc5\x01\x23\x02\xbb\x01\x23\x02\xa9\x01\x35\xc0\x0c\x52" "\x03\xcc\x40\x35\xc0\xcc\xb1\x21\xd0\x1a\xd0\x21\xb0\x1a\xd0\x21" \
+    "\x30\x1a\x56\x03\xcc\x80\x35\xc0\x0c\x5a\x03\xcc\x1c\x75\x01\xa9" "\x02\x6b\x01\x9f\x02\x55\x01\x9f\xc2\x57\xc0\x8c\x11\x11\xb0\x24" \
+    "\x10\x11\x50\x25\x70\x10\xf0\x25\xc6\x05\xcc\x18\x0d\x01\x0f\x02" "\xf7\x00\x25\x02\xf7\x00\x53\x42\x88\xc0\x0c\xb1\x14\xf0\x24\x10" \
+    "\x15\xf0\x24\xe8\x08\xcc\x18\xb9\x01\x97\x02\xf1\x01\x97\x02\xf7" "\x01\x91\x22\x92\xc0\x4c\xf1\x1f\x10\x24\xf0\x1f\x70\x23\x68\x09" \
+    "\xcc\x18\xed\x00\xef\x01\xed\x00\xe5\x01\x01\x01\xd1\x41\xa9\xc0" "\x4c\xb4\x0a\xcc\x40\xac\xc0\x8c\xf1\x19\xb0\x29\xf0\x19\x70\x29" \
+    "\xb0\x19\x30\x29\xc6\x0a\xcc\xa0\xac\xc0\x0c\xe4\x0a\xcc\x18\x4f" "\x01\x67\x02\x4b\x01\x67\x02\x49\x01\x69\xa2\xb1\xc0\xcc\xb1\x1d" \
+    "\x50\x29\x30\x1e\x50\x29\x30\x1f\x50\x28\xfe\xff\x9b\x51\x14\x00" "\x00\x08\x97\xff\x79\x03\x00\xe0\x0d\x40\x3b\x01\xbe\x44\x99\x04" \
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x10\xf3\x00\x05\x00\x02\x71\x4b" "\x00\x00\x3c\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x10\xe7" \
+    "\x02\x05\x00\x02\xce\xa8\x00\x00\x2e\xff\x00\x00\x00\x00\x00\x00" "\x00\x00\x00\x00\xfd\x01\x01\x2a\x00\x04\xf0\x0f\x80\x40\x30\x80" \
+    "\x00\x00\xd8\x34\x17\x00\x00\x87\x00\x00\x04\x8e\x11\x2e\x02\x10" "\x08\x06\x10\x00\xc0\xb6\xbf\x02\x00\xe0\x10\x00\x80\xde\xf0\x41" \
+    "\x54\x00\x02\xc1\x00\x02\x00\x50\x7e\x5d\x00\x00\x1c\x02\x00\x98" "\xce\x40\x78\x19\x60\xe6\x48\x09\xc8\x13\xf8\x08\xc8\x13\xd8\x08" \
+    "\xe8\x13\xae\x01\x66\x8e\x08\x81\x21\x81\x0b\x81\x21\x81\x18\x81" "\x14\xf1\x1a\x60\x06\xb0\x01\x66\x10\x1b\x60\xc6\x08\x11\x28\x0d" \
+    "\xc8\x10\xe8\x0c\x78\x10\xe8\x0c\xb2\x01\x66\x8c\x21\x81\x24\x81" "\x18\x81\x1b\x81\x21\x81\x12\x31\x1b\x60\x06\xb4\x01\x66\xb0\x2f" \
+    "\x60\xc6\x68\x11\xe8\x11\x38\x11\xb8\x11\x08\x11\xb8\x11\xe9\x03" "\x66\x8c\xbc\x80\x51\x81\xab\x80\x51\x81\xaa\x80\x52\xd1\x4b\x60" \
+    "\x06\xd9\x04\x66\x8e\x0d\x81\x2f\x81\x07\x81\x29\x81\x0b\x81\x25" "\x91\x4f\x60\xe6\x18\x0c\x78\x14\x68\x0c\x78\x14\x88\x0c\x98\x14" \
+    "\x86\x05\x66\x92\x58\x60\xc6\x58\x11\xc8\x10\x28\x11\x98\x10\xd8" "\x10\x98\x10\xff\xff\xcd\x28\x0a\x00\x00\x24\x50\x37\x48\x01\x00" \
+    "\xf0\x06\x80\x33\xd5\x64\xe2\x0d\x1a\x00\x00\x00\x80\xb7\x10\x00" "\x00\xa2\x04\x00\x00\x01\x03\x10\x9c\x02\x05\x00\x02\xb0\xf7\x00" \
+    "\x00\x40\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x0d\x01\x6b" "\xa1\x0b\x75\xa4\x49\x00\x07\xf6\x75\x0c\xc9\x36\xbd\x0d\x37\xe5" \
+    "\x3e\x00\x41\xe9\x52\x0c\x68\xfe\xd9\xc2\x6a\xff\x23\x06\x56\x04" "\x00\xfe\x47\x03\x0c\x00\xfd\x08\x01\x24\x00\x04\x82\xe1\x01\x48" \
+    "\xd5\xfc\xa5\x00\x00\x38\x04\x10\x10\x30\xc6\xb0\x57\xc0\xcc\x91" "\x1f\x70\x29\x90\x1f\xd0\x28\xb0\x1f\xd0\x28\x98\x05\xcc\x18\x27" \
+    "\x01\xb3\x01\x21\x01\xb9\x01\x21\x01\xc5\xe1\x75\xc0\x8c\x51\x1c" "\xd0\x26\xf0\x1c\xd0\x26\x70\x1d\x50\x26\xfc\x07\xcc\x1c\x87\x01" \
+    "\xa9\x01\x8f\x01\xb1\x01\x95\x01\xab\xa1\x88\xc0\xcc\xb1\x11\x70" "\x1f\x10\x11\x70\x1f\x10\x11\xd0\x1e\xe6\x08\xcc\x18\x17\x02\xe1" \
+    "\x01\x23\x02\xe1\x01\x25\x02\xdf\x21\x93\xc0\xcc\x11\x23\x90\x25" "\x70\x23\x30\x25\x70\x23\x70\x22\x7c\x09\xcc\x18\x2d\x02\x4f\x02" \
+    "\x37\x02\x4f\x02\x37\x02\x23\xe2\x98\xc0\xcc\x71\x12\x70\x21\xb0" "\x12\xb0\x21\xb0\x12\xd0\x21\x90\x09\xcc\x20\x99\xc0\x0c\x94\x09" \
+    "\xcc\x1c\x13\x02\x5d\x02\x03\x02\x4d\x02\xfd\x01\x53\xa2\xb1\xc0" "\xcc\x71\x1e\xf0\x28\x70\x1c\xf0\x28\x30\x1c\x30\x29\x54\x0b\xcc" \
+    "\x1c\x2b\x01\xfd\x01\x0d\x01\xfd\x01\x01\x01\x09\xa2\xb7\xc0\xcc" "\x11\x15\xf0\x27\x70\x14\x50\x27\x30\x15\x90\x26\xfe\xff\x9b\x51" \
+    "\x14\x00\x00\x48\x00\x00\x58\x02\x00\xe0\x0d\xc0\x70\x01\x26\xc4" "\xf8\x0f\x00\x00\x00\x00\x00\x30\x00\x00\x0d\xa0\x09\x7c\x0c\x09" \
+    "\xa6\x49\x00\x0e\x90\x34\x0e\xc9\x36\xbd\x0d\x37\xe5\x3e\x00\x41" "\xe9\x52\x0c\x68\xfe\x70\xe5\xa7\x01\x23\x06\xd0\x03\x00\x10\x56" \
+    "\x04\x05\x00\x02\xb4\x81\x00\x00\x68\xff\x00\x00\x00\x00\x00\x00" "\x00\x00\x00\x00\x0d\x98\xf6\x02\x0d\x36\xa6\x49\x00\x42\xd4\x7e" \
+    "\x0e\xc9\x36\xbd\x0d\x37\xe5\x3e\x00\x41\xe9\x52\x0c\x68\xfe\x34" "\xf3\x39\xfe\x23\x06\xf3\x04\x00\xfd\x01\x01\xb3\x00\x04\x82\x01" \
+    "\x04\x00\x90\xe8\xbb\x00\x00\x38\x04\x00\x60\x58\x87\x90\x1d\xc0" "\x8c\xb1\x17\x90\x18\x90\x12\x90\x18\x10\x10\x10\x1b\x9e\x04\xcc" \
+    "\x18\xbf\x01\x6f\x02\xcf\x01\x6f\x02\xd9\x01\x65\x82\x5c\xc0\xcc" "\x31\x20\x70\x23\x90\x20\x70\x23\x10\x21\xf0\x22\xcc\x05\xcc\x1c" \
+    "\x43\x02\x41\x02\x1d\x02\x1b\x02\x13\x02\x25\xc2\x61\xc0\xcc\x31" "\x21\x90\x21\x50\x20\x90\x21\x10\x20\xd0\x21\xe4\x08\xcc\x18\xcf" \
+    "\x01\x99\x02\xc9\x01\x99\x02\xbf\x01\x8f\x62\x91\xc0\x8c\x31\x20" "\x30\x28\x30\x20\x90\x27\xd0\x1f\x30\x27\x30\x09\xcc\x18\x61\x01" \
+    "\xb7\x01\x61\x01\xbb\x01\x5b\x01\xc1\x61\x99\xc0\xcc\x71\x13\x30" "\x24\x10\x14\x30\x24\x50\x14\x70\x24\x98\x09\xcc\x1c\xef\x01\x81" \
+    "\x02\xd5\x01\x67\x02\xd9\x01\x63\xa2\x99\xc0\xcc\x51\x0f\x90\x20" "\x50\x0f\xb0\x1f\xd0\x0f\x30\x1f\x9c\x09\xcc\x1c\xb1\x01\x69\x02" \
+    "\xa9\x01\x69\x02\xa3\x01\x6f\xe2\x99\xc0\xcc\x51\x23\xd0\x20\x50" "\x23\x30\x20\xb0\x23\xd0\x1f\xfe\xff\x9b\x51\x14\x00\x00\xc8\x86" \
+    "\xec\xe9\x03\x00\xe0\x0d\x80\xce\x07\xc6\x03\xbe\x13\x00\x00\x00" "\x00\x00\x00\x00\x00\x0d\xff\x23\x14\x0e\xef\xa3\x49\x00\x93\xa3" \
+    "\x66\x0e\xc7\x36\xbd\x0d\xdf\x98\x3e\x00\x40\xe9\x52\x0c\x68\xfe" "\xc5\x04\xfd\x00\x23\x06\xbd\x02\x00\x10\xd8\x02\x05\x00\x02\x7d" \
+    "\x5e\x00\x00\x24\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x10" "\xd0\x03\x05\x00\x02\x0a\xaa\x00\x00\x60\xff\x00\x00\x00\x00\x00" \
+    "\x00\x00\x00\x00\x00\x10\xf3\x04\x05\x00\x02\xbe\x31\x00\x00\x62" "\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x0d\x22\x94\x4b\x10" \
+    "\x23\xd1\x48\x00\xb7\xeb\xa1\x0d\xc7\x50\xb9\x0f\x37\xe5\x3e\x00" "\x44\xe1\x89\x0b\x68\xfe\xbd\x05\x5a\xff\x15\x06\x67\x05\x00\xfd" \
+    "\x78\x01\xae\x00\x04\x82\x01\x04\x00\xf0\x3d\xac\x00\x00\x38\x04" "\x00\xe0\xd2\x7d\x70\x32\xc0\xcc\x91\x23\x50\x23\x90\x22\x50\x22" \
+    "\x50\x22\x90\x22\x94\x03\xcc\x18\x03\x01\xeb\x01\x03\x01\xf9\x01" "\xf9\x00\x03\x82\x4e\xc0\x8c\x71\x22\x10\x1a\xd0\x22\x70\x1a\xd0" \
+    "\x22\x10\x1b\xb2\x06\xcc\x18\x01\x01\x77\x02\x09\x01\x6f\x02\x13" "\x01\x6f\xe2\x6c\xc0\x8c\x11\x1f\x10\x25\xd0\x1f\xd0\x25\x50\x21" \
+    "\xd0\x25\xda\x06\xcc\x1c\x1b\x01\xad\x01\x09\x01\xad\x01\xef\x00" "\xc7\x81\x6f\xc0\x8c\x51\x12\x30\x1c\x50\x12\xd0\x1c\x10\x13\x90" \
+    "\x1d\x72\x07\xcc\x1c\xd5\x01\x7f\x02\xd5\x01\x75\x02\xcf\x01\x6f" "\xa2\x80\xc0\x8c\xf1\x13\xb0\x20\xb0\x13\xb0\x20\x50\x13\x10\x21" \
+    "\x10\x08\xcc\x18\xbb\x01\x61\x02\xbb\x01\x6d\x02\xc5\x01\x77\xe2" "\x83\xc0\x8c\x51\x0f\xf0\x1c\xd0\x0f\x70\x1d\x70\x10\xd0\x1c\x94" \
+    "\x08\xcc\x18\x27\x01\xdf\x01\x21\x01\xe5\x01\x09\x01\xe5\xe1\x89" "\xc0\x8c\xd1\x12\xb0\x20\x10\x13\xf0\x20\x10\x13\xf0\x21\x1a\x09" \
+    "\xcc\x18\xc9\x01\x61\x02\xe5\x01\x61\x02\xe7\x01\x63\x02\x9a\xc0" "\x0c\xa2\x09\xcc\x40\x9a\xc0\xcc\xd1\x11\x10\x1c\x30\x12\xb0\x1b" \
+    "\x30\x12\x70\x1b\xa6\x09\xcc\x1c\x27\x01\x65\x02\x1d\x01\x6f\x02" "\x13\x01\x6f\x82\x9a\xc0\xcc\xd1\x11\x70\x1c\x10\x12\x70\x1c\x30" \
+    "\x12\x50\x1c\xaa\x09\xcc\xc4\x9a\xc0\xcc\x51\x15\xf0\x1a\xb0\x15" "\x90\x1a\x50\x16\x90\x1a\xae\x09\xcc\x18\x37\x02\x4b\x02\x37\x02" \
+    "\x33\x02\x2d\x02\x29\x02\xb7\xc0\x8c\x91\x1d\xd0\x25\x70\x1d\xb0" "\x25\x90\x1c\xb0\x25\xfe\xff\x9b\x51\x14\x00\x00\x48\x3c\x02\xa2" \
+    "\x02\x00\xe0\x0d\x40\xa8\x81\x5d\x84\xb9\x3f\x00\x00\x00\x00\x00" "\x00\x00\x00\x31\x05\x00\x00\x01\x03\x10\x8d\x00\x05\x00\x02\x07" \
+    "\x52\x00\x00\x05\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x0d" "\x15\x77\xb5\x0e\x86\x98\x49\x00\x7c\x47\xf2\x0d\x08\x69\x63\x0f" \
+    "\x37\xe5\x3e\x00\x5c\xfd\x6f\x0c\x68\xfe\x54\xee\x26\xff\x22\x06" "\x90\x05\x00\xfe\x0a\xa3\x0d\x00\xfd\x45\x01\x64\x00\x66\x8c\xae" \
+    "\x80\xd8\x80\xae\x80\xca\x80\xa8\x80\xc4\xc0\x17\x60\x26\xb8\x01" "\x66\xd0\x1b\x60\x06\xc5\x01\x66\x00\x1d\x60\x06\xfd\x01\x66\x90" \
+    "\x20\x60\xc6\xf8\x0b\x28\x0d\xc8\x0b\x58\x0d\x58\x0b\x58\x0d\x99" "\x02\x66\x8e\xcf\x80\x5f\x81\xc7\x80\x5f\x81\xc6\x80\x60\xa1\x29" \
+    "\x60\x06\x9b\x02\x66\x8e\xeb\x80\x4c\x81\xf3\x80\x4c\x81\xf8\x80" "\x51\xf1\x2d\x60\xe6\x68\x0a\xf8\x14\xa8\x0a\xf8\x14\xc8\x0a\xd8" \
+    "\x14\xed\x03\x66\x8c\x80\x80\x22\x81\x80\x80\x24\x81\x85\x80\x29" "\x51\x40\x60\xc6\x58\x0c\x38\x0d\xe8\x0b\x38\x0d\x28\x0b\xf8\x0d" \
+    "\x12\x04\x66\x8c\x9f\x80\xdd\x80\x9e\x80\xdc\x80\x99\x80\xdc\x20" "\x45\x60\xe6\x18\x0f\xb8\x15\x68\x0f\x68\x15\x58\x0f\x58\x15\x9c" \
+    "\x04\x66\x8c\x7c\x80\x23\x81\x81\x80\x28\x81\x84\x80\x25\xb1\x4a" "\x60\xc6\x18\x0a\x28\x0e\x18\x0a\xd8\x0d\xc8\x09\x88\x0d\x5e\x05" \
+    "\x66\x8e\xf3\x80\x5b\x81\xf8\x80\x56\x81\xf7\x80\x55\x91\x58\x60" "\xc6\xd8\x11\xe8\x10\x88\x11\x38\x11\x58\x11\x08\x11\x9d\x05\x66" \
+    "\x8c\x07\x81\x43\x81\x06\x81\x43\x81\xfb\x80\x38\x01\x5a\x60\xe6" "\x48\x0b\x78\x0c\x98\x0b\x78\x0c\x98\x0b\x28\x0c\xa5\x05\x66\x8c" \
+    "\x9b\x80\x37\x81\xa6\x80\x42\x81\xa9\x80\x42\xa1\x5d\x60\xc6\x58" "\x0c\x68\x0d\x28\x0c\x38\x0d\xd8\x0b\x38\x0d\xff\xff\xcd\x28\x0a" \
+    "\x00\x00\x04\x7e\xc9\x2a\x01\x00\xf0\x06\x60\x21\x42\x2f\xa2\x0f" "\x09\x00\x00\x00\xc0\x31\x1d\x00\x00\x10\xd2\x02\x05\x00\x02\x97" \
+    "\xa4\x00\x00\xa3\xfd\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x10" "\x90\x05\x05\x00\x02\xf5\xce\x00\x00\x3e\xff\x00\x00\x00\x00\x00" \
+    "\x00\x00\x00\x00\x00\x0d\x8d\x39\x02\x11\x48\xa4\x49\x00\x23\x54" "\xe7\x0d\xb5\xe7\x63\x0f\x37\xe5\x3e\x00\x5c\xfd\x6f\x0c\x68\xfe" \
+    "\x36\x21\x69\xff\x22\x06\xda\x05\x00\xfd\xfb\x00\x15\x00\x04\x82" "\x01\x04\x00\xd0\xd1\xae\x00\x00\x38\x04\x00\x20\xc9\xc1\x70\x28" \
+    "\xc0\x0c\xd8\x02\xcc\xc0\x2d\xc0\x4c\x7c\x03\xcc\x20\x39\xc0\x0c" "\x98\x03\xcc\x18\xeb\x00\x07\x02\xf3\x00\xff\x01\x01\x01\x0d\xe2" \
+    "\x3c\xc0\x0c\x14\x04\xcc\x1c\xe9\x01\xb7\x02\xe7\x01\xb5\x02\xe7" "\x01\xad\x42\x48\xc0\x8c\xb1\x11\xb0\x1a\x90\x10\xb0\x1a\xf0\x0f" \
+    "\x50\x1b\xa2\x04\xcc\x18\x01\x02\x1f\x02\xff\x01\x1d\x02\xff\x01" "\x19\x82\x53\xc0\x4c\x3a\x05\xcc\x1c\xa7\x01\xaf\x02\xb1\x01\xaf" \
+    "\x02\xbb\x01\xb9\xc2\x53\xc0\xcc\xb1\x1f\xb0\x13\xb0\x1f\x70\x13" "\x90\x1f\x50\x13\xd0\x06\xcc\x1c\x01\x02\xa1\x02\xcd\x01\xd5\x02" \
+    "\xbb\x01\xd5\x42\x81\xc0\x8c\x51\x14\x90\x23\xb0\x13\x30\x24\xb0" "\x12\x30\x24\x4c\x08\xcc\x18\x11\x02\x47\x02\xfd\x01\x33\x02\xfd" \
+    "\x01\x2b\x42\xb1\xc0\x8c\x51\x1f\xb0\x2a\xb0\x1e\x10\x2a\xb0\x1e" "\xf0\x28\x94\x0b\xcc\x18\x27\x01\x67\x02\x29\x01\x67\x02\x3d\x01" \
+    "\x7b\xe2\xff\xbf\x19\x45\x01\x00\x80\x94\x22\xe1\x2a\x00\x00\xde" "\x00\x4c\xa3\x5f\x45\x7c\x3a\x03\x00\x00\x00\x00\x00\x00\x00\x00" \
+    "\x10\xda\x05\x05\x00\x02\x6e\x5e\x00\x00\x6d\xff\x00\x00\x00\x00" "\x00\x00\x00\x00\x00\x00\xfd\xdc\x00\x3e\x01\x66\x80\x14\x60\x06" \
+    "\x74\x01\x66\x10\x18\x60\x06\x8f\x01\x66\x8c\x01\x81\x1f\x81\x07" "\x81\x25\x81\x12\x81\x25\x41\x19\x60\x06\x9d\x01\x66\x10\x1a\x60" \
+    "\x06\xdb\x01\x66\x40\x24\x60\xc6\x78\x08\x48\x0f\xb8\x08\x08\x0f" "\xb8\x08\x68\x0e\x9f\x02\x66\x8e\xfd\x80\x36\x81\xfb\x80\x34\x81" \
+    "\xfb\x80\x32\x41\x3a\x60\xc6\xb8\x0f\x08\x12\x28\x10\x08\x12\x88" "\x10\xa8\x11\x1c\x04\x66\x8e\x92\x80\x18\x81\x92\x80\x24\x81\x91" \
+    "\x80\x25\x81\x44\x60\xc6\x08\x09\x78\x13\x28\x09\x78\x13\x78\x09" "\xc8\x13\xc7\x04\x66\x8c\xfe\x80\x4f\x81\xe3\x80\x6a\x81\xca\x80" \
+    "\x6a\xd1\x4c\x60\xe6\xd8\x09\x18\x12\xe8\x08\x18\x12\x88\x08\x78" "\x12\x1e\x05\x66\x8e\x00\x81\xcb\x80\x00\x81\xc4\x80\xfb\x80\xbf" \
+    "\x20\x53\x60\xe6\x68\x10\xe8\x13\x98\x10\xb8\x13\x88\x10\xa8\x13" "\xff\xff\xcd\x28\x0a\x00\x00\xe4\xff\xff\x75\x01\x00\xf0\x06\x20" \
+    "\x00\x00\xaa\x62\x3f\x1d\x00\x00\x00\x00\x00\x18\x00\x00\xfd\x7a" "\x01\x10\x00\x04\x82\x01\x04\x00\x50\x12\xad\x00\x00\x98\x04\x00" \
+    "\x50\x92\xcd\x30\x0e\xc0\xcc\x71\x19\xd0\x2c\x10\x19\xd0\x2c\x70" "\x18\x30\x2c\x4a\x02\xcc\x1c\x61\x01\xb1\x01\x61\x01\x9d\x01\x4d" \
+    "\x01\x89\xc1\x26\xc0\x0c\x88\x02\xcc\x1c\x09\x01\xaf\x01\xff\x00" "\xb9\x01\xff\x00\xc5\x61\x2c\xc0\x0c\x0e\x04\xcc\x84\x41\xc0\x8c" \
+    "\x71\x19\x90\x28\x30\x1a\x90\x28\x90\x1a\xf0\x28\x24\x04\xcc\x00" "\x54\xc0\xcc\x91\x1f\x30\x27\x90\x1f\x90\x27\xd0\x1e\x50\x28\x42" \
+    "\x05\xcc\x40\x54\xc0\x4c\x46\x05\xcc\x80\x54\xc0\xcc\x71\x1f\x30" "\x29\x90\x1e\x50\x28\x30\x1f\xb0\x27\x4a\x05\xcc\x1c\x23\x02\x9f" \
+    "\x01\x25\x02\x9f\x01\x29\x02\xa3\xc1\x54\xc0\x0c\x4e\x05\xcc\x1c" "\x35\x01\xd1\x01\x3f\x01\xd1\x01\x41\x01\xd3\x01\x55\xc0\xcc\x31" \
+    "\x13\x50\x1a\x30\x13\xb0\x19\x90\x15\x50\x17\x9a\x05\xcc\x1c\xf1" "\x01\xad\x02\xfb\x01\xa3\x02\xef\x01\x97\x62\x5e\xc0\xcc\x31\x13" \
+    "\xb0\x20\x30\x12\xb0\x1f\x50\x0f\xb0\x1f\xb6\x06\xcc\x18\xff\x01" "\xa3\x02\xf3\x01\xa3\x02\xe9\x01\xad\x02\x78\xc0\xcc\x31\x17\xf0" \
+    "\x18\x50\x15\xf0\x18\xb0\x14\x50\x18\x30\x08\xcc\x1c\x23\x02\x49" "\x02\x19\x02\x49\x02\xff\x01\x2f\x22\x98\xc0\xcc\x51\x10\xf0\x1c" \
+    "\x30\x11\x10\x1c\xd0\x11\x10\x1c\xac\x09\xcc\x1c\x77\x01\x79\x01" "\x6b\x01\x85\x01\x61\x01\x85\xc1\xa9\xc0\xcc\xd1\x21\xf0\x24\xf0" \
+    "\x20\x10\x24\xf0\x20\xf0\x23\xb2\x0a\xcc\x1c\xbb\x01\xcb\x02\xa9" "\x01\xb9\x02\xa9\x01\xb7\x02\xb3\xc0\xcc\x91\x11\x90\x26\xf0\x10" \
+    "\x90\x26\xb0\x10\xd0\x26\xfe\xff\x9b\x51\x14\x00\x00\x48\x89\xf5" "\xf9\x03\x00\xe0\x0d\x40\x0b\xf7\xf5\x83\xf8\x07\x00\x00\x00\x00" \
+    "\x00\x00\x00\x00\x08\x05\x00\x00\x01\x03\x0b\x1d\x06\x69\x04\x2a" "\x00\x83\x01\x0d\x48\xa4\xf0\x0d\xcf\xa4\x49\x00\xdc\xec\xc7\x0a" \
+    "\xb1\xd9\x3e\x0f\x37\xe5\x3e\x00\x58\x48\xd1\x09\x68\xfe\xdf\xcf" "\xfc\xff\x1b\x06\xe7\x01\x00\x0d\xd6\xe3\xdf\x0b\x94\x99\x49\x00" \
+    "\x3a\xbd\x94\x0c\xcc\xae\xa2\x0c\x37\xe5\x3e\x00\x7d\x27\x61\x0b" "\x68\xfe\x71\xec\xe1\xfe\x1d\x06\x26\x04\x00\xfe\xbe\xfe\x0d\x00" \
+    "\xfd\x78\x00\x29\x00\x04\x82\x01\x04\x00\xe0\x7b\xa9\x00\x00\x38" "\x04\x00\x50\x20\xbd\xd0\x1f\xc0\x0c\x2e\x02\xcc\x00\x28\xc0\x0c" \
+    "\x96\x02\xcc\x40\x30\xc0\x0c\x70\x03\xcc\x00\x3d\xc0\x4c\xd2\x03" "\xcc\x00\x3e\xc0\x0c\x2e\x04\xcc\xa0\x44\xc0\x0c\x7c\x04\xcc\xa4" \
+    "\x5b\xc0\x0c\xbc\x05\xcc\xc0\x99\xc0\xcc\x11\x24\xb0\x20\x90\x23" "\x30\x21\x90\x23\x90\x21\xfe\xff\x9b\x51\x14\x00\x00\xc8\x03\x25" \
+    "\xda\x03\x00\xa0\x0f\x40\xec\xb1\x26\x84\x8c\x4c\xac\x3d\xbd\x3d" "\x00\x00\x00\x00\x10\xe7\x01\x05\x00\x02\x6f\x2f\x00\x00\x39\xff" \
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x10\x52\x02\x05\x00\x02" "\x2f\xc6\x00\x00\x3e\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00" \
+    "\x10\x26\x04\x05\x00\x02\xf7\xae\x00\x00\x1e\xff\x00\x00\x00\x00" "\x00\x00\x00\x00\x00\x00\xfd\xa9\x01\x26\x00\x04\x82\x01\x04\x00" \
+    "\xf0\x61\xae\x00\x00\x38\x04\x00\x10\x0c\xc1\x90\x1c\xc0\x0c\x64" "\x02\xcc\x80\x2b\xc0\x0c\x32\x03\xcc\x80\x33\xc0\x0c\xc0\x03\xcc" \
+    "\x80\x3f\xc0\x0c\x0e\x04\xcc\x44\x46\xc0\xcc\x11\x10\x90\x23\x10" "\x11\x90\x22\x10\x13\x90\x22\xb2\x04\xcc\xe4\x59\xc0\x4c\x11\x14" \
+    "\x70\x23\x10\x15\x70\x23\xb8\x05\xcc\x1c\x1f\x02\x65\x02\x1f\x02" "\x5b\x02\x23\x02\x57\xe2\x5b\xc0\xcc\x31\x15\x70\x2a\x50\x13\x90" \
+    "\x28\x30\x11\x90\x28\xc0\x05\xcc\x20\x5c\xc0\x4c\x91\x17\x50\x26" "\x90\x17\x30\x26\xc4\x05\xcc\x60\x5c\xc0\xcc\x51\x14\x50\x28\xb0" \
+    "\x13\xf0\x28\x90\x11\xf0\x28\xc8\x05\xcc\xa0\x5c\xc0\x0c\xcc\x05" "\xcc\xe0\x5c\xc0\x4c\x51\x1a\xd0\x2b\x50\x1a\x10\x2b\xd0\x05\xcc" \
+    "\x20\x5d\xc0\x0c\xd4\x05\xcc\x1c\x25\x02\x65\x02\x19\x02\x65\x02" "\xfd\x01\x81\x82\x60\xc0\x8c\x11\x1d\xf0\x18\x10\x1d\x70\x1a\x50" \
+    "\x1d\xb0\x1a\x38\x06\xcc\x1c\x4b\x01\x9f\x02\x5b\x01\x8f\x02\x63" "\x01\x8f\x42\x6a\xc0\xcc\xd1\x13\xd0\x25\xb0\x14\xd0\x25\x30\x15" \
+    "\x50\x26\x22\x07\xcc\x1c\xef\x00\xfb\x01\x01\x01\x0d\x02\x0b\x01" "\x0d\xa2\x75\xc0\x8c\x31\x11\x30\x23\x30\x11\xf0\x21\x90\x10\x50" \
+    "\x21\xca\x07\xcc\x18\x2d\x02\xf7\x01\x2f\x02\xf7\x01\x31\x02\xf5" "\x41\x7f\xc0\xcc\x11\x13\x50\x19\xb0\x11\xb0\x1a\x10\x11\xb0\x1a" \
+    "\x92\x08\xcc\x18\x8f\x01\x9d\x01\x8b\x01\x99\x01\x83\x01\x99\x81" "\x96\xc0\x8c\xd1\x21\x70\x28\xf0\x20\x70\x28\x30\x20\xb0\x27\xbe" \
+    "\x09\xcc\x18\x8b\x01\x6b\x02\x89\x01\x69\x02\x7f\x01\x69\xc2\xa1" "\xc0\xcc\x51\x1e\xf0\x28\x50\x1e\x50\x28\xd0\x1d\xd0\x27\x3a\x0a" \
+    "\xcc\x1c\x2d\x01\x9d\x01\x29\x01\xa1\x01\x29\x01\xbb\x81\xb9\xc0" "\xcc\xf1\x10\x50\x24\x50\x10\x50\x24\xb0\x0f\xf0\x24\xfe\xff\x9b" \
+    "\x51\x14\x00\x00\xc8\x9f\x69\xb6\x02\x00\xe0\x0d\x00\x94\x23\x3e" "\x44\x99\x2c\x00\x00\x00\x00\x00\x00\x00\x00\x0b\x15\x06\x67\x02" \
+    "\x28\x00\xec\x01\xfd\x0b\x01\x27\x01\x66\xb0\x12\x60\x06\x6f\x01" "\x66\x10\x18\x60\x06\x8e\x01\x66\xc0\x1a\x60\x06\xd7\x01\x66\xb0" \
+    "\x20\x60\x06\x80\x02\x66\x8c\xf3\x80\xdc\x80\xf9\x80\xdc\x80\xfa" "\x80\xdd\xb0\x2e\x60\xe6\x18\x08\xf8\x0e\x28\x08\x08\x0f\x78\x08" \
+    "\x08\x0f\x18\x03\x66\x8c\xa2\x80\x4a\x81\xa5\x80\x4a\x81\xa7\x80" "\x48\xe1\x31\x60\xc6\x48\x0f\x08\x0d\x98\x0f\x08\x0d\xe8\x0f\x58" \
+    "\x0d\x7a\x03\x66\x8e\xe5\x80\x5a\x81\xe5\x80\x55\x81\xdb\x80\x4b" "\xf1\x43\x60\xc6\x78\x0a\x68\x12\x78\x0a\x18\x13\x28\x0b\xc8\x13" \
+    "\x40\x04\x66\x8e\x9f\x80\xea\x80\xa6\x80\xf1\x80\xa6\x80\xf2\x30" "\x44\x60\xe6\xb8\x0a\xc8\x12\x68\x0a\x18\x13\xb8\x0a\x68\x13\x87" \
+    "\x04\x66\x8e\x99\x80\x33\x81\xa5\x80\x27\x81\xa7\x80\x29\x11\x4e" "\x60\xe6\x48\x0f\x48\x14\xe8\x0e\xe8\x13\xe8\x0e\x78\x13\x39\x05" \
+    "\x66\x8c\x09\x81\x15\x81\x06\x81\x12\x81\x00\x81\x18\x11\x57\x60" "\xc6\xd8\x09\xe8\x10\xc8\x09\xd8\x10\xc8\x09\x68\x10\xa8\x05\x66" \
+    "\x8c\x13\x81\xed\x80\x18\x81\xe8\x80\x23\x81\xf3\xf0\xff\xdf\x8c" "\xa2\x00\x00\x40\x38\xa7\x50\x16\x00\x00\x6f\x00\xd0\xcf\x8f\x24" \
+    "\xc4\x93\x01\x00\x00\x00\x00\x00\x00\x00\x00\x10\x87\x01\x05\x00" "\x02\xe7\x4f\x00\x00\x6c\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00" \
+    "\x00\xfd\x2f\x01\xfc\x00\x66\xe0\x12\x60\x06\x44\x01\x66\x8e\xb4" "\x80\xc7\x80\xaf\x80\xcc\x80\xaf\x80\xd5\xb0\x15\x60\x06\x84\x01" \
+    "\x66\x8e\xfe\x80\x43\x81\x03\x81\x43\x81\x03\x81\x48\xb1\x1b\x60" "\xe6\xa8\x10\x98\x13\x58\x10\x98\x13\x58\x10\x48\x14\xc4\x01\x66" \
+    "\x8e\x80\x80\xf2\x80\x82\x80\xf0\x80\xa4\x80\xf0\x80\x1d\x60\xc6" "\x98\x0f\x98\x13\x48\x0f\xe8\x13\x48\x0f\x38\x14\x2e\x02\x66\x00" \
+    "\x23\x60\x06\x87\x02\x66\x8c\xbb\x80\xc5\x80\xbb\x80\xb8\x80\xc0" "\x80\xb3\x50\x2c\x60\xc6\xe8\x08\x48\x11\xc8\x07\x48\x11\x58\x07" \
+    "\xd8\x10\xec\x02\x66\x8c\x13\x81\x40\x81\x11\x81\x42\x81\x11\x81" "\x51\x61\x2f\x60\xc6\xc8\x09\x68\x14\x08\x0a\x28\x14\x08\x0a\xd8" \
+    "\x13\x22\x03\x66\x8c\xb9\x80\xd8\x80\xb7\x80\xda\x80\xa5\x80\xda" "\x10\x35\x60\xe6\x18\x0a\x38\x15\xd8\x0a\x78\x14\x18\x0b\x78\x14" \
+    "\xc2\x03\x66\x8e\x17\x81\x2b\x81\x17\x81\x3a\x81\x13\x81\x3e\xd1" "\x3f\x60\xe6\x18\x08\x08\x12\x18\x08\xb8\x11\x38\x08\x98\x11\xee" \
+    "\x04\x66\x8c\x94\x80\xe3\x80\x9d\x80\xda\x80\x9d\x80\xd9\xe0\x58" "\x60\xe6\x18\x0c\xe8\x13\x18\x0c\x48\x14\xa8\x0c\xd8\x14\x98\x05" \
+    "\x66\x8c\x7e\x80\x33\x81\x79\x80\x2e\x81\x79\x80\x29\xf1\xff\xdf" "\x8c\xa2\x00\x00\x40\xfe\xff\xdf\x21\x00\x00\x6f\x00\x02\x00\x00" \
+    "\x24\x36\xcf\x01\x00\x00\x00\x0c\xff\x00\x00\x00\x21\x05\x00\x00" "\x01\x03\x0b\x25\x06\xa4\x03\x28\x00\x71\x01\x0b\x1c\x06\xc3\x03" \
+    "\x19\x00\x93\x01\x10\x93\x00\x08\x00\x01\xa1\x7d\x00\x00\x00\x00" "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x10\xaf\x00\x08\x00\x01" \
+    "\x0a\xaf\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00" "\x0d\x3e\x83\x67\x0d\xcd\x8d\x49\x00\x26\xd2\xb1\x0c\x02\x76\x92" \
+    "\x0e\x37\xe5\x3e\x00\x4f\x32\x98\x0c\x68\xfe\x04\xcf\x6c\x00\x25" "\x06\xa5\x01\x00\x0d\xbb\x8d\x93\x0f\x44\x9d\x49\x00\x64\x9b\xb8" \
+    "\x0d\x13\xaf\x90\x0e\x37\xe5\x3e\x00\x68\x90\x83\x0c\x68\xfe\x53" "\x1c\xab\xfe\x25\x06\x2c\x03\x00\x0d\xfc\x3b\xb7\x0e\x6b\x96\x49" \
+    "\x00\xf9\xbb\x54\x0e\x95\xc9\xb3\x0e\x37\xe5\x3e\x00\xc8\xbe\x05" "\x0c\x68\xfe\x2d\x03\x6c\xff\x22\x06\x0d\x04\x00\xfe\xdc\x77\x0e" \
+    "\x00\xfd\xae\x01\x95\x00\x04\x70\x19\xc0\xcc\x51\x22\x70\x25\x30" "\x21\x50\x24\x30\x21\xb0\x23\xc2\x01\xcc\x18\x39\x01\xe7\x01\x39" \
+    "\x01\xbf\x01\x45\x01\xb3\xc1\x2c\xc0\x8c\xd1\x12\xf0\x20\x30\x12" "\xf0\x20\x10\x12\xd0\x20\xc4\x03\xcc\x1c\x61\x01\x97\x02\x57\x01" \
+    "\x8d\x02\x5b\x01\x89\x22\x53\xc0\x8c\xd1\x12\xb0\x21\xd0\x12\x10" "\x21\xb0\x12\xf0\x20\x66\x05\xcc\x18\x49\x01\x37\x02\x33\x01\x37" \
+    "\x02\x1f\x01\x23\x82\x59\xc0\x8c\x91\x16\x50\x28\x10\x17\xd0\x27" "\x10\x17\x30\x27\x80\x06\xcc\x1c\x0b\x02\x1d\x02\x0b\x02\x17\x02" \
+    "\xff\x01\x0b\x22\x6f\xc0\xcc\x91\x15\x90\x18\x90\x15\x70\x17\xf0" "\x14\xd0\x16\x32\x07\xcc\x18\x79\x01\xa1\x01\x75\x01\x9d\x01\x6b" \
+    "\x01\x9d\x01\x75\xc0\x4c\x2a\x08\xcc\x60\x87\xc0\x0c\x36\x09\xcc" "\x1c\x8b\x01\xcb\x02\x75\x01\xcb\x02\x6b\x01\xc1\xc2\x94\xc0\x8c" \
+    "\xd1\x0f\x10\x1e\x30\x10\x70\x1e\x30\x10\x10\x1f\xf6\x09\xcc\x1c" "\x53\x01\x47\x02\x49\x01\x47\x02\x3f\x01\x51\x82\x9f\xc0\xcc\x31" \
+    "\x0e\xb0\x21\x70\x0e\x70\x21\x10\x0f\x10\x22\xfa\x09\xcc\xc0\x9f" "\xc0\xcc\xd1\x1a\x30\x29\x30\x1a\x30\x29\x90\x19\xd0\x29\xfe\x09" \
+    "\xcc\x1c\x5d\x01\xc3\x01\x5d\x01\xc5\x01\x53\x01\xcf\x01\xa0\xc0" "\x0c\x02\x0a\xcc\x1c\x0b\x01\x27\x02\x07\x01\x27\x02\x03\x01\x2b" \
+    "\x42\xa0\xc0\xcc\x31\x12\xf0\x28\xb0\x12\x70\x28\x30\x13\xf0\x28" "\x06\x0a\xcc\x1c\x5f\x01\x69\x02\x5f\x01\x6d\x02\x61\x01\x6f\x82" \
+    "\xa0\xc0\xcc\x91\x19\xf0\x2b\x90\x19\x50\x2b\xf0\x19\xf0\x2a\x14" "\x0a\xcc\x18\xf7\x00\xe7\x01\x01\x01\xdd\x01\x01\x01\xc7\x01\xa3" \
+    "\xc0\x8c\x31\x13\xf0\x20\x10\x13\xf0\x20\xd0\x12\x30\x21\x30\x0b" "\xcc\x18\xf1\x00\xe7\x01\xf3\x00\xe9\x01\xf5\x00\xe9\xc1\xb4\xc0" \
+    "\xcc\xf1\x14\x10\x18\xd0\x16\x10\x18\xf0\x16\xf0\x17\xfe\xff\x9b" "\xe1\x09\x00\x00\xc8\xff\xff\x3f\x03\x00\xe0\x0d\x80\x66\x02\x1a" \
+    "\x84\x02\x30\x00\x00\x00\x00\x00\x00\x00\x00\x0b\x14\x06\x6b\x03" "\x28\x00\x58\x01\x10\x96\x00\x08\x00\x01\xdb\x9a\x00\x00\x00\x00" \
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x0a\xab\x01\x00\x00\xff" "\x01\x12\xab\x01\xb7\x00\x10\xb7\x00\x09\x00\x00\x00\x00\x00\x00" \
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x10\xba\x00\x09" "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00" \
+    "\x00\x00\x10\xa5\x01\x05\x00\x02\xb7\xa3\x00\x00\xf0\xfe\x00\x00" "\x00\x00\x00\x00\x00\x00\x00\x00\x10\x59\x02\x05\x00\x02\x6f\x80" \
+    "\x00\x00\x5a\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x10\x64" "\x02\x05\x00\x02\x81\x81\x00\x00\x6d\xff\x00\x00\x00\x00\x00\x00" \
+    "\x00\x00\x00\x00\x0d\x28\x4b\xdf\x0c\x7a\xee\x44\x00\x24\xdb\x42" "\x0d\xfe\x13\x26\x0c\x49\xc4\x3e\x00\xfa\x99\x8a\x0b\x68\xfe\xd3" \
+    "\x0c\x80\xfd\x26\x06\xcb\x02\x00\x10\x2c\x03\x05\x00\x02\xd7\x5f" "\x00\x00\x34\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x10\x0d" \
+    "\x04\x05\x00\x02\xac\xc0\x00\x00\x74\xff\x00\x00\x00\x00\x00\x00" "\x00\x00\x00\x00\x0d\x22\x4b\x70\x0d\xdc\x8e\x49\x00\xbc\x7a\x60" \
+    "\x0d\x07\xd0\x90\x0e\x37\xe5\x3e\x00\x00\x0f\x85\x0c\x68\xfe\x8c" "\xd4\x73\xff\x25\x06\x89\x05\x00\xfd\xb9\x01\x33\x00\x04\x82\x01" \
+    "\x04\x00\xc0\xf7\x9d\x00\x00\x38\x04\x00\x00\x75\xcc\x70\x0b\xc0" "\x8c\x31\x14\xd0\x27\x10\x15\xd0\x27\x90\x18\x50\x2b\xf6\x00\x08" \
+    "\xa0\x2d\x00\x81\x60\x00\x01\x00\x3c\xd2\x2a\x00\x00\x0e\x01\x00" "\x38\x5a\x23\xcc\x05\x20\x10\x0c\x20\x00\x80\xf0\xc9\x05\x00\xc0" \
+    "\x21\x00\x80\xd5\xf8\x83\xaa\x01\x66\x08\x64\x61\x0b\x81\x64\x81" "\x1c\x21\x23\x60\xe6\xc8\x09\x78\x0e\xc8\x09\xe8\x0d\x28\x0a\x88" \
+    "\x0d\xa5\x02\x66\x8e\xb4\x80\x5c\x81\xaf\x80\x5c\x81\xac\x80\x59" "\x71\x2d\x60\xc6\x58\x0a\xd8\x13\x98\x0a\xd8\x13\xf8\x0a\x78\x13" \
+    "\x6f\x03\x66\x8c\xc4\x80\xda\x80\xc4\x80\xd5\x80\xc9\x80\xd5\x20" "\x37\x60\xe6\x88\x0a\x28\x13\xb8\x0a\x58\x13\xb8\x0a\x08\x14\x8d" \
+    "\x03\x66\x8c\xa9\x80\xcd\x80\xab\x80\xcd\x80\xb0\x80\xc8\x50\x3b" "\x60\xc6\xc8\x07\x48\x11\xd8\x07\x58\x11\xd8\x07\x88\x13\xba\x03" \
+    "\x66\x8e\xec\x80\x5b\x81\xed\x80\x5c\x81\xed\x80\x63\x91\x3c\x60" "\xc6\xe8\x0c\x88\x14\xd8\x0c\x78\x14\xd8\x0c\x28\x14\xcf\x03\x66" \
+    "\x32\x3e\x60\xc6\x78\x0b\x58\x14\x78\x0b\x28\x14\x68\x0b\x18\x14" "\xf0\x03\x66\x72\x42\x60\xc6\x78\x0f\x18\x0f\xc8\x0f\x18\x0f\xd8" \
+    "\x0f\x28\x0f\x77\x04\x66\x8e\x96\x80\x11\x81\x8e\x80\x09\x81\x88" "\x80\x09\x81\x48\x60\xe6\x28\x0b\x78\x13\xa8\x0b\x78\x13\xf8\x0b" \
+    "\x28\x13\x04\x05\x66\x8e\xcc\x80\x5b\x81\xcd\x80\x5b\x81\xd2\x80" "\x60\x51\x50\x60\xe6\x18\x0a\x28\x11\x08\x0a\x38\x11\x08\x0a\x88" \
+    "\x11\x06\x05\x66\x8c\x77\x80\x02\x81\x72\x80\x07\x81\x72\x80\x09" "\x71\x50\x60\xe6\xf8\x0d\xf8\x14\xf8\x0d\xc8\x15\x48\x0e\x18\x16" \
+    "\x08\x05\x66\x8e\x18\x81\x02\x81\x18\x81\xef\x80\x19\x81\xee\x90" "\x50\x60\xe6\x28\x09\x78\x0e\x08\x09\x78\x0e\xe8\x08\x98\x0e\xcc" \
+    "\x05\x66\x8e\x82\x80\xfa\x80\x85\x80\xfd\x80\x86\x80\xfd\xf0\xff" "\xdf\x8c\xa2\x00\x00\x40\xb6\x38\xae\x1b\x00\x00\x6f\x00\x70\x6f" \
+    "\x2e\x21\xc4\x43\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3d\x04\x00" "\x00\x01\x03\x0b\x1e\x06\x66\x04\x28\x00\x89\x01\x0b\x1d\x06\x0f" \
+    "\x01\x28\x00\x21\x01\x0d\xad\x5c\x39\x0d\x6c\xa0\x49\x00\x0d\x9f" "\x99\x0d\x3b\x09\x30\x0e\x37\xe5\x3e\x00\xf0\x2b\x25\x0c\x68\xfe" \
+    "\x58\xe9\x0b\xfe\x18\x06\xd1\x02\x00\x0d\x78\xb0\xb9\x0e\x86\x98" "\x49\x00\x63\x58\x5f\x0d\x3b\x09\x30\x0e\x37\xe5\x3e\x00\xf0\x2b" \
+    "\x25\x0c\x68\xfe\x9a\x0e\xde\xfe\x18\x06\x3f\x04\x00\x10\x1e\x05" "\x05\x00\x02\xf9\xa3\x00\x00\x56\xff\x00\x00\x00\x00\x00\x00\x00" \
+    "\x00\x00\x00\xfe\xaf\x64\x0f\x00\xfd\x9f\x01\x3d\x00\x66\x8e\xab" "\x80\x2f\x81\xa5\x80\x2f\x81\xa0\x80\x2a\x01\x05\x60\x06\x59\x00" \
+    "\x04\x50\x29\xc0\x0c\xc6\x02\xcc\xa0\x2f\xc0\x0c\x6a\x03\xcc\x18" "\x87\x01\x8f\x02\x7d\x01\x99\x02\x73\x01\x99\x42\x4f\xc0\x0c\x28" \
+    "\x05\xcc\x1c\x1f\x02\xe5\x01\x19\x02\xeb\x01\x13\x02\xe5\xe1\x52" "\xc0\x8c\xb1\x14\xd0\x22\x10\x14\x70\x23\x50\x13\x70\x23\x38\x05" \
+    "\xcc\x18\x21\x02\xff\x01\x1d\x02\xff\x01\x1b\x02\xfd\x81\x55\xc0" "\x8c\x71\x0f\xb0\x20\xb0\x0f\xf0\x20\xf0\x0f\xb0\x20\x40\x06\xcc" \
+    "\x18\xc7\x01\x9f\x01\xc7\x01\x9b\x01\xc9\x01\x99\x41\x64\xc0\x8c" "\xf1\x0f\x70\x1d\xf0\x0f\xd0\x1c\xd0\x0f\xd0\x1c\x48\x06\xcc\x18" \
+    "\x19\x02\x53\x02\x19\x02\x45\x02\x2d\x02\x31\x42\x65\xc0\x8c\x31" "\x21\xb0\x20\x70\x21\xb0\x20\xb0\x21\xf0\x20\xdc\x06\xcc\x18\x3d" \
+    "\x02\xe7\x01\x31\x02\xdb\x01\x31\x02\xb9\xe1\x6d\xc0\xcc\x91\x19" "\x90\x29\x90\x1a\x90\x29\xf0\x1b\xf0\x2a\xe0\x06\xcc\x1c\x49\x01" \
+    "\x57\x02\x55\x01\x63\x02\x55\x01\x7d\x62\x7b\xc0\x8c\x71\x1f\x30" "\x1b\x70\x1f\x90\x1a\x30\x1d\x50\x18\xc8\x07\xcc\x18\x6f\x01\x7d" \
+    "\x02\x6f\x01\x81\x02\x6d\x01\x83\xc2\x83\xc0\x8c\x11\x1e\x90\x26" "\xb0\x1e\x90\x26\x10\x1f\xf0\x26\xb0\x08\xcc\x1c\x19\x01\xa5\x01" \
+    "\x09\x01\xb5\x01\xff\x00\xb5\xe1\x8f\xc0\x8c\x91\x0f\x30\x20\x90" "\x0f\x70\x21\xf0\x0f\xd0\x21\x4a\x09\xcc\x18\xbf\x01\x9d\x01\xc5" \
+    "\x01\x97\x01\xcf\x01\x97\xe1\x9b\xc0\x8c\xd1\x0e\x70\x20\xb0\x0f" "\x70\x20\xf0\x0f\xb0\x20\x30\x0a\xcc\x18\xf7\x00\xfb\x01\x01\x01" \
+    "\x05\x02\x01\x01\x29\x82\xa3\xc0\xcc\x71\x22\x50\x1e\xd0\x21\x50" "\x1e\xd0\x21\x90\x1e\xe8\x0a\xcc\x18\x0d\x01\xb5\x01\x01\x01\xb5" \
+    "\x01\xf7\x00\xbf\xe1\xff\xbf\x19\x45\x01\x00\x80\xf0\xc4\xa8\x43" "\x00\x00\xde\x00\xcc\xa7\x7c\x36\xc8\x0e\x03\x00\x00\x00\xe8\x51" \
+    "\x04\x00\x00\x10\x5a\x00\x08\x00\x01\x9b\x58\x00\x00\x00\x00\x00" "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x0d\x8b\x31\x32\x0d\xbf\x48" \
+    "\x49\x00\xb5\x5b\x03\x0c\xce\xe6\x8f\x0d\x49\xc4\x3e\x00\xb4\x7b" "\xbc\x0b\x68\xfe\x1e\xbd\xc9\xfd\x1d\x06\x28\x02\x00\x10\x99\x02" \
+    "\x05\x00\x02\x7d\x13\x00\x00\x9c\xff\x00\x00\x00\x00\x00\x00\x00" "\x00\x00\x00\x10\xd1\x02\x05\x00\x02\x93\x47\x00\x00\x48\xff\x00" \
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x0d\x3a\xbd\x42\x11\x83\xa5" "\x49\x00\x85\x64\xf4\x0c\x94\x5a\x8d\x0f\x37\xe5\x3e\x00\xb0\x16" \
+    "\x8b\x0b\x68\xfe\xad\x2d\x70\xff\x1e\x06\x2d\x03\x00\x10\x3f\x04" "\x05\x00\x02\x38\x48\x00\x00\x60\xff\x00\x00\x00\x00\x00\x00\x00" \
+    "\x00\x00\x00\xfd\x01\x01\xa7\x01\x66\x8c\xc1\x80\xd1\x80\xc1\x80" "\xd6\x80\xd0\x80\xd6\xa0\x1b\x60\x06\xd2\x01\x66\x40\x1d\x60\x26" \
+    "\xe4\x01\x66\x10\x20\x60\x26\x62\x02\x66\x70\x28\x60\x06\x8b\x02" "\x66\x8c\xa8\x80\x18\x81\xa6\x80\x1a\x81\x9b\x80\x1a\xc1\x28\x60" \
+    "\x06\x93\x02\x66\x72\x2a\x60\x06\xae\x02\x66\x8c\xac\x80\x4c\x81" "\xa8\x80\x48\x81\xa0\x80\x48\xe1\x32\x60\xc6\xa8\x0e\x48\x14\xf8" \
+    "\x0e\x98\x14\x08\x11\x98\x14\x56\x03\x66\x8c\xeb\x80\x41\x81\xeb" "\x80\x3f\x81\xee\x80\x3c\xd1\x35\x60\xc6\x88\x0e\x08\x15\xb8\x0e" \
+    "\xd8\x14\x88\x0f\xd8\x14\x71\x03\x66\x8e\x1c\x81\x26\x81\x1b\x81" "\x25\x81\x16\x81\x25\x21\x37\x60\x06\x73\x03\x66\x40\x37\x60\x26" \
+    "\x75\x03\x66\x8e\x0a\x81\x2d\x81\x0b\x81\x2d\x81\x0c\x81\x2c\x61" "\x37\x60\x06\x0a\x05\x66\x8c\xe9\x80\x53\x81\xec\x80\x50\x81\xf8" \
+    "\x80\x50\xb1\x59\x60\xe6\xc8\x0e\x28\x0d\xc8\x0e\xd8\x0c\x38\x0f" "\xd8\x0c\xc9\x05\x66\x8e\xf8\x80\x4a\x81\xf8\x80\x4f\x81\xe3\x80" \
+    "\x64\xf1\xff\xdf\x4c\x16\x00\x00\x40\x02\x00\x40\x1c\x00\x00\x6f" "\x00\x2e\xdc\xaf\x1d\xb6\x80\x00\x00\x00\x00\x00\x00\x00\x00\x00" \
+    "\x10\x28\x02\x05\x00\x02\x1e\x30\x00\x00\xf3\xfc\x00\x00\x00\x00" "\x00\x00\x00\x00\x00\x00\x0d\xd7\x28\x20\x0f\xfc\xa4\x49\x00\xa9" \
+    "\x30\xf3\x0d\x3b\x09\x30\x0e\x37\xe5\x3e\x00\xfb\x97\x24\x0c\x68" "\xfe\x4c\x10\x25\xff\x18\x06\xd4\x02\x00\x10\x2d\x03\x05\x00\x02" \
+    "\xf1\x03\x00\x00\x6f\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00" "\x10\x6a\x04\x05\x00\x02\x9b\x52\x00\x00\x60\xff\x00\x00\x00\x00" \
+    "\x00\x00\x00\x00\x00\x00\x0d\xe3\x6d\xca\x0e\x71\x9d\x49\x00\xed" "\x53\x26\x0d\x8c\x3a\x01\x0f\x37\xe5\x3e\x00\x56\x9a\x8d\x0b\x68" \
+    "\xfe\x36\xe9\x67\x00\x17\x06\x9c\x05\x00\x4c\x04\x00\x00\x01\x03" "\x10\x83\x00\x08\x00\x01\xe2\xfc\x00\x00\x00\x00\x00\x00\x00\x00" \
+    "\x00\x00\x00\x00\x00\x00\x10\xc2\x02\x05\x00\x02\xa7\x49\x00\x00" "\x6c\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x10\x22\x03\x05" \
+    "\x00\x02\xde\xcc\x00\x00\x27\xff\x00\x00\x00\x00\x00\x00\x00\x00" "\x00\x00\xfe\xdb\xaa\x0f\x00\xfd\x8c\x01\x32\x00\x04\x82\x01\x04" \
+    "\x00\x00\xd9\x9f\x00\x00\x38\x04\x00\x20\x62\xce\x70\x07\xc0\x0c" "\xdc\x01\xcc\x1c\x7b\x01\x69\x02\x67\x01\x69\x02\x65\x01\x67\x02" \
+    "\x2b\xc0\x4c\xc2\x02\xcc\xa0\x2d\xc0\x0c\xe0\x02\xcc\x00\x34\xc0" "\x0c\x8a\x03\xcc\xc0\x38\xc0\x0c\x00\x04\xcc\x18\x39\x01\x99\x02" \
+    "\x25\x01\x99\x02\x1d\x01\x91\x82\x40\xc0\x0c\x1e\x04\xcc\xe4\x50" "\xc0\x8c\x11\x22\xf0\x1b\x90\x21\x70\x1b\x90\x21\xd0\x1a\x10\x05" \
+    "\xcc\x18\x47\x01\xeb\x01\x47\x01\xef\x01\x45\x01\xf1\x41\x51\xc0" "\x8c\x71\x13\xb0\x1d\xd0\x13\xb0\x1d\xf0\x13\xd0\x1d\x9c\x05\xcc" \
+    "\x1c\x39\x02\x8d\x02\x3d\x02\x8d\x02\x3f\x02\x8b\xe2\x59\xc0\xcc" "\x91\x13\xd0\x1c\x90\x13\xf0\x1c\x30\x14\x90\x1d\xa0\x05\xcc\x20" \
+    "\x5a\xc0\xcc\x91\x22\x10\x20\x30\x23\x10\x20\x30\x24\x10\x1f\xa4" "\x05\xcc\x1c\x13\x02\xdd\x01\x13\x02\xe1\x01\x1d\x02\xeb\x61\x5a" \
+    "\xc0\x8c\xb1\x22\xf0\x2c\x50\x20\x90\x2a\x50\x20\x70\x2a\x42\x06" "\xcc\x18\xeb\x01\x73\x01\xe5\x01\x79\x01\xe5\x01\x83\x41\x68\xc0" \
+    "\x8c\x11\x14\xf0\x26\x50\x13\x30\x26\x50\x11\x30\x26\x92\x07\xcc" "\x1c\x05\x01\xfb\x01\x0f\x01\x05\x02\x17\x01\xfd\xe1\x7d\xc0\xcc" \
+    "\xd1\x13\x10\x22\x50\x12\x10\x22\x30\x12\xf0\x21\xf6\x0a\xcc\x1c" "\xf7\x00\x01\x02\xf7\x00\xe7\x01\x01\x01\xdd\x61\xb1\xc0\x8c\xd1" \
+    "\x20\xb0\x23\x70\x20\x10\x24\x70\x20\x50\x24\x18\x0b\xcc\x18\x31" "\x01\x79\x02\x31\x01\x6d\x02\x13\x01\x4f\xe2\xb2\xc0\x8c\x51\x16" \
+    "\xd0\x27\x50\x15\xd0\x26\x70\x13\xd0\x26\x56\x0b\xcc\x10\xd7\x01" "\xb7\x01\xd7\x01\xc5\x21\xba\xc0\x0c\x31\x10\x70\x21\x30\x10\x50" \
+    "\x21\xfe\xff\x9b\x51\x14\x00\x00\x48\x10\xd7\x5d\x04\x00\xe0\x0d" "\x40\xed\x0d\xde\xc3\x17\x30\x00\x00\x00\x00\x00\x00\x00\x00\x10" \
+    "\xbd\x05\x05\x00\x02\x23\xc1\x00\x00\xeb\xfe\x00\x00\x00\x00\x00" "\x00\x00\x00\x00\x00\xfd\x0f\x01\x25\x00\x04\x82\x01\x04\x00\x30" \
+    "\xa3\xaf\x00\x00\x38\x04\x00\xd0\x2a\xc9\xb0\x29\xc0\x0c\x24\x03" "\xcc\x20\x34\xc0\x0c\x58\x03\xcc\xe0\x4a\xc0\xcc\x91\x17\x70\x1b" \
+    "\x30\x17\x10\x1b\xf0\x16\x10\x1b\x4a\x05\xcc\x18\x2b\x02\x25\x02" "\x2d\x02\x23\x02\x37\x02\x23\xa2\x57\xc0\xcc\xd1\x0e\x50\x22\xb0" \
+    "\x0d\x30\x21\xb0\x0d\x70\x20\xa8\x05\xcc\x1c\x21\x01\x65\x02\x21" "\x01\x79\x02\x17\x01\x83\xa2\x5a\xc0\x0c\xac\x05\xcc\x14\x0f\x02" \
+    "\x03\x02\x0b\x02\x03\xe2\x5a\xc0\x8c\xb1\x17\x70\x18\xb0\x17\x90" "\x18\x50\x17\xf0\x18\xb0\x05\xcc\x1c\xfd\x00\x5d\x02\x15\x01\x45" \
+    "\x02\x0b\x01\x3b\x02\x64\xc0\xcc\xd1\x1c\x90\x27\xd0\x1c\x70\x29" "\xb0\x1a\x90\x2b\xf0\x06\xcc\x18\x5b\x01\x85\x02\x63\x01\x7d\x02" \
+    "\x63\x01\x7b\x22\x78\xc0\xcc\xb1\x16\x50\x1a\xb0\x16\x10\x1b\x50" "\x17\xb0\x1b\x86\x08\xcc\x18\x67\x01\x83\x02\x55\x01\x83\x02\x53" \
+    "\x01\x81\xc2\x88\xc0\xcc\x31\x21\x70\x23\x50\x20\x70\x23\x70\x1f" "\x50\x24\x10\x09\xcc\x1c\x29\x01\x2f\x02\x35\x01\x23\x02\x3d\x01" \
+    "\x2b\xe2\xff\xbf\x19\x31\x01\x00\x80\x30\xdb\xa4\x33\x00\x00\xde" "\x00\x3c\x1b\x46\x31\x84\x02\x00\x00\x00\x00\x00\x00\x06\x00\x00" \
+    "\x10\x65\x00\x05\x00\x02\xd1\x27\x00\x00\x06\xff\x00\x00\x00\x00" "\x00\x00\x00\x00\x00\x00\xfd\x0a\x01\x29\x00\x04\x82\x01\x04\x00" \
+    "\x90\x1f\xa6\x00\x00\x38\x04\x00\xb0\x7f\xd0\x90\x31\xc0\x0c\x48" "\x03\xcc\x18\xe3\x01\xad\x01\xdf\x01\xad\x01\xd5\x01\xb7\x41\x38" \
+    "\xc0\x0c\x0a\x04\xcc\xc0\x42\xc0\x8c\xd1\x20\x50\x22\x30\x24\xf0" "\x1e\x30\x24\xd0\x1d\x92\x04\xcc\x18\xf5\x01\x7f\x02\xf9\x01\x7f" \
+    "\x02\x07\x02\x8d\xc2\x4a\xc0\x8c\xb1\x22\xb0\x26\xb0\x23\xb0\x25" "\xb0\x24\xb0\x25\x7a\x05\xcc\x18\xed\x00\x25\x02\xdb\x00\x13\x02" \
+    "\xdb\x00\x07\x22\x5b\xc0\x0c\xb4\x05\xcc\x60\x5b\xc0\x0c\xb8\x05" "\xcc\x1c\x09\x01\x15\x02\xfb\x00\x15\x02\xf7\x00\x11\xa2\x5b\xc0" \
+    "\xcc\x31\x1f\xf0\x28\x30\x1f\x10\x29\x50\x1f\x30\x29\xbc\x05\xcc" "\x00\x79\xc0\xcc\x91\x15\xf0\x17\x30\x14\xf0\x17\x90\x13\x90\x18" \
+    "\x9c\x07\xcc\x1c\x53\x02\x57\x02\x53\x02\x4f\x02\x49\x02\x45\xc2" "\xa2\xc0\xcc\xf1\x13\x50\x1c\x90\x14\xb0\x1b\xb0\x14\xd0\x1b\xb0" \
+    "\x0a\xcc\x18\x03\x02\x97\x01\x01\x02\x95\x01\xf9\x01\x95\x61\xb7" "\xc0\x8c\x91\x13\x50\x20\x30\x13\xf0\x1f\x90\x12\xf0\x1f\xfe\xff" \
+    "\x9b\x51\x14\x00\x00\x48\x45\x2a\x11\x03\x00\xe0\x0d\xc0\x09\x02" "\x6e\x85\xf7\x0f\x00\x00\x00\x00\x0a\x47\x00\x00\x10\x0d\x02\x05" \
+    "\x00\x02\xde\xe3\x00\x00\x61\xff\x00\x00\x00\x00\x00\x00\x00\x00" "\x00\x00\x0d\xf6\x51\xc5\x0d\x48\xa4\x49\x00\x90\x20\x06\x0e\x47" \
+    "\xfd\xcf\x0d\x37\xe5\x3e\x00\x9d\x6c\xe2\x0b\x68\xfe\x4c\x01\xba" "\x01\x18\x06\x6a\x02\x00\x5c\x04\x00\x00\x01\x03\x10\x22\x00\x08" \
+    "\x00\x01\xd5\xb2\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00" "\x00\x00\x10\x26\x00\x08\x00\x01\xa5\x60\x00\x00\x00\x00\x00\x00" \
+    "\x00\x00\x00\x00\x00\x00\x00\x00\xfe\x07\xeb\x0f\x00\xfd\xb6\x01" "\x24\x00\x04\x30\x2b\xc0\x8c\x71\x1d\xb0\x26\x30\x1d\x70\x26\x10" \
+    "\x1e\x90\x25\xb4\x02\xcc\x60\x2b\xc0\x8c\xb1\x14\x50\x26\x30\x15" "\xd0\x25\x30\x15\x30\x25\xb8\x02\xcc\xa0\x2b\xc0\x0c\xbc\x02\xcc" \
+    "\xe0\x2b\xc0\x0c\xc0\x02\xcc\x14\x09\x02\x6b\x02\x07\x02\x6b\x22" "\x2c\xc0\x0c\xc4\x02\xcc\x60\x2c\xc0\x0c\xc8\x02\xcc\xa0\x2c\xc0" \
+    "\x8c\x51\x17\x10\x29\x50\x18\x10\x28\xf0\x17\xb0\x27\xcc\x02\xcc" "\x18\xf1\x00\x07\x02\xf1\x00\xd9\x01\x05\x01\xc5\xe1\x2c\xc0\x0c" \
+    "\xd0\x02\xcc\x20\x2d\xc0\x4c\xd4\x02\xcc\x60\x2d\xc0\x0c\xd8\x02" "\xcc\xa0\x2d\xc0\x0c\xdc\x02\xcc\xe4\x2d\xc0\x0c\xe0\x02\xcc\x20" \
+    "\x2e\xc0\x0c\xe4\x02\xcc\x60\x2e\xc0\x0c\xe8\x02\xcc\xa0\x2e\xc0" "\xcc\x51\x1d\x90\x2a\xd0\x1c\x90\x2a\x50\x1c\x10\x2b\xba\x04\xcc" \
+    "\x1c\x7f\x01\xd3\x02\x7f\x01\xc7\x02\x7b\x01\xc3\x62\x56\xc0\x8c" "\x71\x22\x50\x24\x30\x23\x50\x24\x90\x23\xf0\x23\xd8\x06\xcc\x1c" \
+    "\xfb\x01\x89\x02\xdf\x01\xa5\x02\xdf\x01\xb9\xe2\x6f\xc0\x8c\x31" "\x15\xf0\x19\xd0\x15\x50\x19\xd0\x15\xb0\x18\x74\x07\xcc\x1c\xbd" \
+    "\x01\x67\x02\xb5\x01\x67\x02\xb3\x01\x69\x82\x78\xc0\xcc\x91\x1e" "\x50\x27\x30\x1f\xb0\x26\x30\x1f\x70\x26\x90\x07\xcc\x1c\x25\x01" \
+    "\xd7\x01\x25\x01\xcf\x01\x2f\x01\xc5\x81\x83\xc0\xcc\x31\x12\xd0" "\x1a\xd0\x12\x30\x1a\x10\x14\x70\x1b\xfe\x09\xcc\x1c\xf7\x00\x2b" \
+    "\x02\x09\x01\x19\x02\x0d\x01\x1d\x22\xab\xc0\x8c\x11\x0f\xb0\x25" "\x70\x0f\xb0\x25\x10\x10\x10\x25\xc8\x0a\xcc\xe0\xad\xc0\xcc\x91" \
+    "\x14\x70\x26\x90\x14\x10\x28\xf0\x13\xb0\x28\x30\x0b\xcc\x18\x49" "\x01\x43\x02\x31\x01\x43\x02\x2d\x01\x47\xa2\xb3\xc0\x0c\x42\x0b" \
+    "\xcc\x18\x89\x01\x8d\x02\x81\x01\x8d\x02\x7b\x01\x87\x42\xb4\xc0" "\x0c\x76\x0b\xcc\x18\x2f\x01\xcf\x01\x39\x01\xc5\x01\x39\x01\xbb" \
+    "\xe1\xff\xbf\x19\x45\x01\x00\x80\xf8\x8e\xa6\x29\x00\x00\xde\x00" "\x04\x00\x00\x53\xc0\x03\x00\x00\x00\x00\x00\x00\x03\x00\x00\x10" \
+    "\x25\x00\x08\x00\x01\x12\x75\x00\x00\x00\x00\x00\x00\x00\x00\x00" "\x00\x00\x00\x00\x00\xfd\x41\x01\x1e\x00\x04\xd0\x2e\xc0\x4c\xee" \
+    "\x02\xcc\x04\x2f\xc0\x0c\xf2\x02\xcc\x40\x2f\xc0\x0c\xf6\x02\xcc" "\x1c\x9b\x01\xa5\x02\x9b\x01\x93\x02\x95\x01\x8d\x02\x40\xc0\x8c" \
+    "\x11\x15\x70\x26\x90\x15\xf0\x25\x90\x15\x50\x25\xba\x04\xcc\x18" "\x7f\x01\xd3\x02\x7f\x01\xc7\x02\x7b\x01\xc3\x22\x4e\xc0\x0c\xf1" \
+    "\x1d\xf0\x1a\xb0\x1d\xf0\x1a\x40\x05\xcc\x1c\x31\x02\x95\x02\x13" "\x02\xb3\x02\x09\x02\xb3\x82\x59\xc0\x8c\xb1\x1f\xb0\x1a\xd0\x1f" \
+    "\x90\x1a\x30\x21\x90\x1a\x0e\x07\xcc\x18\x11\x01\x53\x02\x15\x01" "\x4f\x02\x15\x01\x4d\x82\x71\xc0\x8c\x51\x22\xb0\x29\x50\x22\x70" \
+    "\x2a\x70\x21\x50\x2b\xca\x08\xcc\x18\xdd\x01\x8f\x02\xdd\x01\x81" "\x02\xe3\x01\x7b\xa2\x91\xc0\xcc\x51\x11\xb0\x1f\xf0\x10\x50\x1f" \
+    "\x50\x10\x50\x1f\x9e\x09\xcc\x1c\x71\x01\x97\x02\x7b\x01\x8d\x02" "\x89\x01\x8d\xc2\xa1\xc0\xcc\x91\x0e\x90\x25\xf0\x0e\xf0\x25\x30" \
+    "\x0f\xb0\x25\x42\x0a\xcc\x18\xeb\x00\x37\x02\xeb\x00\x2b\x02\xf3" "\x00\x23\xc2\xaa\xc0\x8c\xd1\x1e\xb0\x27\x30\x1e\xb0\x27\x90\x1d" \
+    "\x50\x28\x5c\x0b\xcc\x64\xb6\xc0\xcc\xd1\x20\xd0\x20\x70\x20\x30" "\x21\x70\x20\x70\x23\x74\x0b\xcc\x18\x1b\x02\xa3\x01\x17\x02\xa3" \
+    "\x01\x0d\x02\x99\x81\xb7\xc0\x8c\x51\x18\x90\x2c\xb0\x18\x30\x2c" "\xb0\x18\x90\x2b\xfe\xff\x9b\x11\x13\x00\x00\x48\x00\x00\x34\x02" \
+    "\x00\xe0\x0d\xc0\xff\xff\xbb\x03\x00\x18\x00\x00\x00\x00\x00\x30" "\x00\x00\x10\x1f\x00\x08\x00\x01\xc2\xda\x00\x00\x00\x00\x00\x00" \
+    "\x00\x00\x00\x00\x00\x00\x00\x00\xfd\x0e\x01\xc6\x00\x66\x8e\x0a" "\x81\x11\x81\x0b\x81\x12\x81\x0b\x81\x17\x41\x12\x60\xc6\x48\x0b" \
+    "\x08\x14\x48\x0b\xe8\x13\xe8\x0a\x88\x13\xea\x01\x66\x8e\xc5\x80" "\x45\x81\xbd\x80\x3d\x81\xa1\x80\x3d\x61\x2b\x60\xc6\x18\x08\x38" \
+    "\x0f\x08\x08\x28\x0f\xb8\x07\x28\x0f\x38\x03\x66\x8c\x81\x80\xf9" "\x80\x81\x80\xf5\x80\x8c\x80\xea\x80\x3c\x60\xc6\x28\x09\xb8\x0e" \
+    "\x28\x09\x78\x0e\x78\x09\x28\x0e\xf3\x03\x66\x8e\xf1\x80\x3a\x81" "\xf3\x80\x3a\x81\xf9\x80\x34\x91\x3f\x60\xc6\x68\x08\xd8\x11\x68" \
+    "\x08\x68\x11\x18\x08\x18\x11\x3d\x04\x66\x8e\x01\x81\x3b\x81\x06" "\x81\x40\x81\x06\x81\x4d\xf1\x43\x60\xe6\x98\x09\xc8\x12\x98\x09" \
+    "\xf8\x12\xb8\x09\x18\x13\x5d\x04\x66\x8c\x1b\x81\x06\x81\x1b\x81" "\x1f\x81\x21\x81\x25\xa1\x4a\x60\xc6\x78\x0b\xf8\x15\x48\x0b\xc8" \
+    "\x15\x58\x0a\xc8\x15\x48\x05\x66\x8e\xd9\x80\x49\x81\xd7\x80\x49" "\x81\xd5\x80\x47\xd1\x54\x60\xc6\xa8\x08\x08\x0f\xb8\x08\x18\x0f" \
+    "\xc8\x08\x18\x0f\xad\x05\x66\x8c\x7f\x80\x22\x81\x82\x80\x22\x81" "\x83\x80\x23\xf1\xff\xdf\x8c\xa2\x00\x00\x40\xfe\xff\x5f\x20\x00" \
+    "\x00\x6f\x00\xae\x20\x50\x26\xa6\x80\x01\x00\x00\x00\x00\x80\x01" "\x00\x00\x25\x04\x00\x00\x01\x03\x10\xa9\x00\x08\x00\x01\x73\xf9" \
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xfe\xb8" "\x12\x10\x00\xfd\xa2\x00\x5c\x00\x66\x90\x09\x40\x00\x3d\x01\xcc" \
+    "\x00\x14\xc0\x0c\x42\x01\xcc\x60\x18\xc0\x8c\xb1\x22\x90\x24\x70" "\x23\x50\x25\x70\x23\x70\x29\xdc\x01\xcc\x1c\x4b\x01\x4b\x02\x4b" \
+    "\x01\x77\x02\x55\x01\x81\x42\x20\xc0\x0c\x32\x03\xcc\x18\x2d\x01" "\x53\x02\x3f\x01\x53\x02\x45\x01\x59\x22\x42\xc0\x0c\x24\x04\xcc" \
+    "\x60\x42\xc0\xcc\x71\x11\x50\x1e\x90\x11\x70\x1e\x90\x11\xd0\x1e" "\x28\x04\xcc\x60\xa9\xc0\x8c\xb1\x1a\x50\x2b\x30\x1a\xd0\x2a\x50" \
+    "\x1a\xb0\x2a\xc6\x0a\xcc\x1c\x2d\x01\xb1\x01\x0b\x01\xb1\x01\x01" "\x01\xbb\xe1\xff\xbf\x19\x45\x01\x00\x80\xbc\x05\xa0\x2e\x00\x00" \
+    "\xde\x00\xf0\x3e\xdd\x46\x64\x02\x00\x00\x00\x00\x00\x00\x00\x00" "\x00\x10\x9a\x00\x08\x00\x01\xc1\xd8\x00\x00\x00\x00\x00\x00\x00" \
+    "\x00\x00\x00\x00\x00\x00\x00\xfd\xf7\x00\x0e\x00\x04\x82\x01\x04" "\x00\x70\xb0\xa3\x00\x00\x20\x06\x00\x60\xc5\xbc\x10\x02\x80\x40" \
+    "\x30\x80\x00\x00\x9e\x2c\x14\x00\x00\x87\x00\x00\x10\xec\x19\x9e" "\x00\x10\x08\x06\x10\x00\x40\x5f\x7b\x02\x00\xe0\x10\x00\xc0\x10" \
+    "\xfe\x42\x1c\x00\x33\xf8\x01\x30\x83\x44\x00\x33\xf8\x04\x30\x83" "\x56\x00\x02\x18\x0c\x60\x26\xda\x00\x66\x80\x0e\x60\x06\x01\x01" \
+    "\x66\x50\x21\x60\xe6\x48\x08\x88\x13\x28\x08\x88\x13\xd8\x07\xd8" "\x13\x16\x02\x66\x8e\xcf\x80\x3f\x81\xca\x80\x3a\x81\xc9\x80\x3a" \
+    "\x71\x21\x60\x06\x18\x02\x66\x92\x21\x60\x06\x1a\x02\x66\xb0\x21" "\x60\xe6\x08\x09\x78\x0e\x18\x09\x78\x0e\x38\x09\x58\x0e\x21\x02" \
+    "\x66\x8c\x8e\x80\x49\x81\x8e\x80\x47\x81\x8c\x80\x45\xf1\x4b\x60" "\xe6\x08\x0f\x08\x13\x78\x0f\x78\x13\x78\x0f\xe8\x13\xf6\x04\x66" \
+    "\x8e\xcc\x80\x5a\x81\xc7\x80\x55\x81\xc9\x80\x53\xe1\x4f\x60\xe6" "\x98\x09\xc8\x0f\x18\x09\x48\x10\x18\x09\x68\x11\xff\xff\xcd\x28" \
+    "\x0a\x00\x00\xa4\x92\xe7\xc8\x01\x00\xf0\x06\x80\x6b\xfe\x54\xa2" "\x8c\x07\x00\x00\x00\x00\x00\x00\x00\x00\x10\xae\x00\x08\x00\x01" \
+    "\x15\x46\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00" "\xfd\x0c\x01\x24\x00\x04\x82\x01\x04\x00\xa0\xec\xaf\x00\x00\x38" \
+    "\x04\x00\x90\x46\xc5\x10\x09\xc0\x0c\xd6\x00\xcc\xa0\x0d\xc0\x0c" "\xf2\x00\xcc\x00\x1a\xc0\x0c\xb2\x01\xcc\xe0\x21\xc0\x0c\x38\x04" \
+    "\xcc\x1c\x95\x01\x8f\x02\x95\x01\x83\x02\x99\x01\x7f\xa2\x43\xc0" "\x0c\x3c\x04\xcc\xe0\x43\xc0\x0c\x40\x04\xcc\x24\x44\xc0\x8c\xd1" \
+    "\x11\x30\x29\xb0\x10\x50\x2a\xb0\x10\x50\x2c\x44\x04\xcc\x1c\x59" "\x01\x65\x02\x59\x01\x63\x02\x5b\x01\x61\x62\x44\xc0\x0c\x48\x04" \
+    "\xcc\x14\xcd\x01\xc7\x02\xcd\x01\xc3\xa2\x44\xc0\x0c\x4c\x04\xcc" "\x1c\x85\x01\xbf\x02\x85\x01\xe9\x02\x89\x01\xed\x82\x92\xc0\x8c" \
+    "\x11\x1f\xd0\x26\xf0\x1e\xf0\x26\xf0\x1e\xd0\x27\x58\x09\xcc\x18" "\xd5\x00\x6f\x02\xd5\x00\x8f\x02\xdf\x00\x99\x22\x9c\xc0\xcc\x71" \
+    "\x17\xd0\x28\x70\x17\xd0\x29\xf0\x17\x50\x2a\xac\x0a\xcc\x1c\xfb" "\x01\xc5\x02\x03\x02\xbd\x02\xf7\x01\xb1\x62\xac\xc0\x8c\xd1\x12" \
+    "\x10\x1b\xb0\x10\x10\x1b\x10\x10\xb0\x1b\xd0\x0a\xcc\x18\x81\x01" "\xc7\x02\x81\x01\xe1\x02\x8d\x01\xed\xe2\xff\xbf\x19\x45\x01\x00" \
+    "\x80\x40\x1a\x59\x3e\x00\x00\xde\x00\x94\x20\x1f\x43\x98\xe9\x34" "\xfc\x03\x00\x00\x00\x00\x00\x00\xfd\x17\x01\x33\x00\x04\x82\x01" \
+    "\x04\x00\xb0\x3f\xac\x00\x00\x20\x06\x00\x40\xb1\xbe\x30\x09\xc0" "\x0c\xe6\x00\xcc\x00\x17\x80\x00\x9a\x03\x98\x41\x3a\x80\x19\xe0" \
+    "\x03\x98\x81\x42\x80\x19\x30\x04\x98\x01\x47\x80\x19\x8c\x04\x98" "\x81\x49\x80\x19\x48\x05\x98\x39\x0e\x04\x9a\x05\xfa\x03\x9a\x05" \
+    "\xee\x03\xa6\xc5\x89\x80\x99\xe3\x40\xe0\x49\xe0\x43\xe0\x49\xe0" "\x45\xe0\x4b\xa0\x08\x98\x41\x8a\x80\x19\xa8\x08\x98\x41\xa9\x80" \
+    "\x99\x23\x2e\x20\x57\x20\x30\x20\x57\xe0\x30\xe0\x57\x90\x0f\x98" "\x31\x72\x03\x3e\x05\x6a\x03\x46\x05\x6a\x03\x5a\xc5\x12\x81\x19" \
+    "\x63\x1b\xe0\x3f\xe0\x18\xe0\x3f\xa0\x16\x20\x42\x44\x11\x98\x31" "\xda\x02\x16\x05\xee\x02\x2a\x05\xda\x02\x3e\x45\x19\x81\x19\x63" \
+    "\x3f\x20\x4c\xe0\x3d\xa0\x4d\xe0\x3d\xa0\x4f\x10\x12\x98\x31\xae" "\x01\x0e\x04\x9a\x01\xfa\x03\x86\x01\xfa\x83\x3a\x81\x19\xe3\x1e" \
+    "\xe0\x42\x20\x1c\x20\x40\xa0\x18\x20\x40\xf0\x15\x98\x39\x02\x02" "\x12\x04\x02\x02\xfe\x03\xfa\x01\xf6\x03\x6b\x81\x99\x63\x25\xe0" \
+    "\x53\x20\x23\xe0\x53\x20\x20\xe0\x56\x60\x17\x98\xc1\xff\x7f\x33" "\x20\x01\x00\x00\x51\xa4\x41\x5f\x00\x00\xbc\x01\x48\x16\xc3\x7b" \
+    "\x98\xbe\x04\x00\x00\x00\x00\x00\x00\x00\x00\x10\xb9\x00\x08\x00" "\x01\x1d\xcf\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00" \
+    "\x00\x10\xc9\x03\x05\x00\x02\x2d\xb0\x00\x00\x1e\xff\x00\x00\x00" "\x00\x00\x00\x00\x00\x00\x00\x88\x04\x00\x00\x01\x03\x0d\x87\x6d" \
+    "\xc1\x0d\x83\xa5\x49\x00\x91\xbc\x41\x0e\xa8\x49\x22\x0e\x37\xe5" "\x3e\x00\x5f\x98\x0f\x0c\x68\xfe\x0c\xfa\xa1\xfe\x21\x06\x29\x02" \
+    "\x00\x10\x72\x02\x05\x00\x02\x94\x0c\x00\x00\x2a\xff\x00\x00\x00" "\x00\x00\x00\x00\x00\x00\x00\x10\x6f\x04\x05\x00\x02\xd6\xe8\x00" \
+    "\x00\x57\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x10\xba\x04" "\x05\x00\x02\x05\x7d\x00\x00\x38\xff\x00\x00\x00\x00\x00\x00\x00" \
+    "\x00\x00\x00\xfe\x21\xad\x10\x00\xfd\xfe\x00\x13\x00\x04\x82\x01" "\x04\x00\xb0\xff\xaf\x00\x00\x20\x06\x00\x70\x60\xc6\x10\x16\x80" \
+    "\x40\x30\x80\x00\x00\x6a\x75\x17\x00\x00\x87\x00\x00\x90\x11\x11" "\x96\x07\x98\x31\x3a\x04\xe6\x03\x26\x04\xd2\x03\x1e\x04\xd2\x43" \
+    "\xad\x80\x19\xe2\x2e\xe0\x37\x60\x30\xe0\x37\x48\x0c\x98\x39\xf2" "\x02\x02\x05\x12\x03\x22\x05\x12\x03\x36\x45\xc8\x80\x19\xe3\x43" \
+    "\xa0\x39\xa0\x44\xe0\x38\xa0\x44\x60\x36\x78\x0d\x98\x31\xd6\x02" "\x1e\x05\xee\x02\x36\x05\xee\x02\x4e\xc5\x02\x81\x19\x68\x10\x98" \
+    "\x21\x12\x03\x6a\x03\x12\x03\x72\xc3\x15\x81\x99\x23\x27\xe0\x38" "\x60\x28\xa0\x37\xa0\x2a\xe0\x39\x78\x11\x98\x41\x22\x81\x19\x23" \
+    "\x34\xe0\x53\x60\x33\xa0\x54\xe0\x2a\xa0\x54\xa8\x14\x98\x39\x1a" "\x04\xd6\x04\x1e\x04\xd2\x04\x1e\x04\xce\xc4\x4a\x81\x19\xb0\x14" \
+    "\x98\x49\x4b\x81\x19\xb8\x14\x98\x31\x1e\x03\xa6\x05\x3a\x03\x8a" "\x05\x32\x03\x82\x85\x69\x81\x19\x23\x30\x60\x36\x60\x31\x60\x36" \
+    "\x60\x31\x20\x35\xfc\xff\x37\xc3\x0b\x00\x00\x90\xce\x19\xa6\x05" "\x00\xc0\x1b\x00\x8c\xf8\x2b\x87\xc3\x3f\x00\x00\x00\x00\x00\x00" \
+    "\x00\x00\x0d\x8f\x10\x10\x10\xa2\xa4\x49\x00\x2c\x4b\xfb\x0c\x4c" "\x6f\x22\x0e\x37\xe5\x3e\x00\x5a\xff\x0f\x0c\x68\xfe\x5d\x2e\x66" \
+    "\xff\x21\x06\xa2\x01\x00\x10\x29\x02\x05\x00\x02\xde\x29\x00\x00" "\x6f\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x10\xa0\x03\x05" \
+    "\x00\x02\x7c\xa8\x00\x00\x3e\xff\x00\x00\x00\x00\x00\x00\x00\x00" "\x00\x00\xfd\x56\x01\xa5\x00\x04\x82\x01\x04\x00\xd0\xaa\xb4\x00" \
+    "\x00\x38\x04\x00\xd0\x5c\x7c\x50\x60\xc0\xcc\xb1\x13\x90\x2a\xd0" "\x13\xb0\x2a\x70\x15\xb0\x2a\xa2\x06\xcc\x18\xb1\x01\xa7\x01\xb5" \
+    "\x01\xa3\x01\xb5\x01\x99\xe1\x6a\xc0\xcc\x51\x10\x90\x22\x70\x10" "\x70\x22\x70\x10\xd0\x21\x62\x07\xcc\x1c\x09\x02\x9f\x02\x09\x02" \
+    "\xab\x02\xfb\x01\xb9\x62\x77\xc0\xcc\xb1\x0e\xf0\x1c\x50\x10\x90" "\x1e\x30\x11\x90\x1e\xd4\x07\xcc\x1c\x93\x01\xb9\x02\x89\x01\xaf" \
+    "\x02\x39\x01\xaf\xe2\x85\xc0\xcc\x31\x18\x50\x26\x30\x18\x70\x27" "\x90\x17\x10\x28\x86\x08\xcc\x18\x15\x02\x57\x02\x2b\x02\x57\x02" \
+    "\x49\x02\x39\xc2\x89\xc0\x0c\x20\x09\xcc\x18\x27\x01\x45\x02\x31" "\x01\x45\x02\x39\x01\x3d\x22\x9c\xc0\x8c\xb1\x1d\x70\x28\xb0\x1d" \
+    "\x70\x27\xb0\x1e\x70\x26\xc4\x09\xcc\x18\xd9\x01\xaf\x02\xd3\x01" "\xa9\x02\xe7\x01\x95\x62\x9f\xc0\xcc\x11\x10\x30\x23\x70\x10\xd0" \
+    "\x22\x70\x10\xd0\x21\x5e\x0a\xcc\x1c\x15\x02\x2f\x02\x1f\x02\x39" "\x02\x2f\x02\x39\x02\xa6\xc0\xcc\xf1\x1b\xf0\x28\xf0\x1b\x90\x29" \
+    "\xd0\x1d\x90\x29\x62\x0a\xcc\x44\xa6\xc0\xcc\x51\x12\xb0\x24\x50" "\x12\x10\x25\x90\x12\x50\x25\x66\x0a\xcc\x1c\x0f\x01\x83\x02\x0b" \
+    "\x01\x83\x02\x09\x01\x81\x82\xa6\xc0\x8c\x91\x15\x90\x29\xd0\x14" "\xd0\x28\xf0\x12\xd0\x28\x86\x0b\xcc\x1c\x05\x01\x09\x02\x01\x01" \
+    "\x05\x02\xf3\x00\x05\xe2\xff\xbf\x19\x45\x01\x00\x80\xfc\xff\xbf" "\x29\x00\x00\xde\x00\xa8\x46\x60\x48\x68\x01\x03\x00\x00\x00\x00" \
+    "\x00\x00\x00\x00\x0b\x21\x06\x24\x03\x28\x00\x99\x01\x10\xa2\x01" "\x05\x00\x02\xfd\x00\x00\x00\x69\xff\x00\x00\x00\x00\x00\x00\x00" \
+    "\x00\x00\x00\x10\x44\x03\x05\x00\x02\x44\x24\x00\x00\x72\xff\x00" "\x00\x00\x00\x00\x00\x00\x00\x00\x00\xfd\x4a\x01\xd8\x01\x66\x8c" \
+    "\xdc\x80\xcd\x80\xd9\x80\xd0\x80\xdd\x80\xd4\xd0\x25\x60\xe6\x88" "\x07\xc8\x11\x88\x07\x58\x12\xf8\x07\xc8\x12\x0e\x03\x66\x8e\x1c" \
+    "\x81\x20\x81\x17\x81\x25\x81\x17\x81\x26\x91\x34\x60\xc6\x48\x0c" "\xe8\x14\x48\x0c\x88\x14\xe8\x0b\x28\x14\x7c\x03\x66\x8c\xf1\x80" \
+    "\x42\x81\xf1\x80\x3d\x81\xe9\x80\x35\x01\x39\x60\xc6\x68\x10\xb8" "\x0f\x38\x10\xe8\x0f\x28\x10\xd8\x0f\xb4\x03\x66\x8e\x8d\x80\x37" \
+    "\x81\x8d\x80\x44\x81\x8c\x80\x45\x71\x43\x60\x06\x45\x04\x66\x8c" "\x8a\x80\x2a\x81\x8f\x80\x2a\x81\x8f\x80\x30\x51\x4b\x60\xc6\x88" \
+    "\x0b\x18\x0d\x68\x0b\x18\x0d\xd8\x0a\xa8\x0d\xc5\x04\x66\x88\xf2" "\x80\x45\x81\xf0\x80\x45\xb1\x4e\x60\xc6\x08\x08\x68\x12\x08\x08" \
+    "\xb8\x12\xb8\x07\xb8\x12\x35\x05\x66\x60\x53\x60\xc6\x38\x11\x78" "\x13\x28\x11\x78\x13\xa8\x10\xf8\x12\x37\x05\x66\x8e\x88\x80\x27" \
+    "\x81\x89\x80\x26\x81\x89\x80\x25\x81\x53\x60\xe6\x18\x0e\x28\x14" "\xf8\x0d\x08\x14\xf8\x0d\xb8\x13\x39\x05\x66\xa0\x53\x60\xe6\xc8" \
+    "\x08\x78\x12\xe8\x08\x98\x12\xf8\x08\x88\x12\x3b\x05\x66\x8c\xc9" "\x80\x45\x81\xc6\x80\x48\x81\xba\x80\x48\xc1\x53\x60\x26\x3d\x05" \
+    "\x66\xe0\x53\x60\xc6\x08\x11\x38\x12\x08\x11\xe8\x11\x58\x11\xe8" "\x11\x4a\x05\x66\x8c\xbc\x80\xd2\x80\xb5\x80\xcb\x80\xb5\x80\xb8" \
+    "\xf0\xff\xdf\x4c\x08\x00\x00\x40\xf2\xf5\x3c\x1d\x00\x00\x6f\x00" "\x76\xfe\x90\x19\xfa\x80\x01\x00\x00\x00\x00\x00\x03\x00\x00\xb4" \
+    "\x04\x00\x00\x01\x03\x10\x65\x00\x05\x00\x02\xd6\xbd\x00\x00\x36" "\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x10\x27\x05\x05\x00" \
+    "\x02\x1d\x3e\x00\x00\x53\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00" "\x00\xfe\x00\x87\x12\x00\xfd\xf2\x00\x31\x00\x04\x82\x01\x04\x00" \
+    "\x80\x8c\xa8\x00\x00\x20\x06\x00\xb0\xd4\xbc\xf0\x32\xc0\x8c\xb1" "\x15\xd0\x26\xf0\x14\xd0\x26\x30\x14\x90\x27\xba\x05\xcc\x1c\x55" \
+    "\x01\x8d\x02\x51\x01\x91\x02\x29\x01\x91\xa2\x6c\xc0\xcc\xb1\x20" "\xf0\x23\x90\x20\xd0\x23\x50\x20\xd0\x23\xf6\x06\xcc\x1c\xd7\x01" \
+    "\x8d\x02\xd7\x01\x91\x02\xc5\x01\xa3\xe2\x72\xc0\x8c\x31\x24\x30" "\x21\x90\x24\x30\x21\x30\x25\x90\x20\x42\x07\xcc\x1c\x15\x01\x55" \
+    "\x02\x0b\x01\x55\x02\xf1\x00\x3b\x82\x75\xc0\xcc\xb1\x13\x10\x23" "\xb0\x13\xf0\x21\xd0\x13\xd0\x21\x5a\x07\xcc\x1c\x33\x01\xdb\x01" \
+    "\x1f\x01\xdb\x01\x01\x01\xbd\x41\x79\xc0\xcc\x51\x14\x90\x27\xb0" "\x13\x90\x27\xb0\x13\x70\x27\x5e\x08\xcc\x1c\xcb\x01\xad\x02\xc1" \
+    "\x01\xb7\x02\x57\x01\xb7\xe2\x87\xc0\x8c\x11\x16\xf0\x26\xf0\x15" "\xf0\x26\xd0\x15\xd0\x26\xf4\x08\xcc\x1c\xdb\x01\x81\x02\xe7\x01" \
+    "\x8d\x02\x07\x02\x8d\xe2\xff\xbf\x99\x20\x01\x00\x80\x04\x00\x80" "\x21\x00\x00\xde\x00\x04\x00\x00\x38\xec\x9a\x00\x00\x00\x00\x00" \
+    "\x00\x03\x00\x00\x0d\x2a\x21\xf4\x0c\x64\x1b\x48\x00\xf0\x41\x5f" "\x0d\x15\x50\xf7\x0d\x37\xe5\x3e\x00\x52\x8a\x03\x0c\x68\xfe\x6a" \
+    "\xe8\xe1\xff\x21\x06\xeb\x04\x00\xfd\x0f\x01\x13\x00\x04\x50\x04" "\x80\x40\x30\x80\x00\x00\x56\xc3\x15\x00\x00\x93\x00\x00\x76\x8b" \
+    "\x19\x0e\x03\x98\x39\x2a\x04\x86\x03\x46\x04\x86\x03\x6e\x04\xae" "\x83\x44\x80\x19\xa3\x41\x20\x4f\x20\x41\xa0\x4e\x20\x41\x20\x4a" \
+    "\xd4\x06\x98\x39\x7a\x02\x72\x04\x7a\x02\x46\x04\x52\x02\x1e\x44" "\xb7\x80\x19\xa3\x2a\xa0\x51\x20\x2a\x20\x52\x20\x25\x20\x52\x1c" \
+    "\x0c\x98\x31\xe6\x03\x4a\x05\xb2\x03\x7e\x05\xae\x02\x7e\x45\xc6" "\x80\x19\xe3\x2d\x20\x55\x20\x28\x20\x55\xe0\x17\xe0\x44\x48\x0e" \
+    "\x98\x01\xe6\x80\x19\x68\x0e\x98\x81\xf9\x80\x19\xe3\x2e\xa0\x2f" "\xe0\x2e\x60\x31\xa0\x2d\xa0\x32\x58\x10\x98\x31\x4e\x04\x9e\x04" \
+    "\x62\x04\x8a\x04\x86\x04\x8a\xc4\x2d\x81\x99\xa3\x27\x60\x47\xa0" "\x27\x60\x46\x20\x27\xe0\x45\x1c\x13\x98\x39\x62\x02\x5e\x04\x76" \
+    "\x02\x4a\x04\x76\x02\x3a\xc4\x4b\x81\x19\x63\x44\xe0\x4a\x60\x44" "\x60\x49\x20\x42\x20\x47\x58\x16\x98\x31\x4e\x04\xb6\x04\x3a\x04" \
+    "\xa2\x04\x3a\x04\x82\xc4\x73\x81\x19\xe3\x40\xe0\x4f\xe0\x40\xa0" "\x4c\xa0\x3f\x60\x4b\xfc\xff\x37\xa3\x28\x00\x00\x90\xff\xff\x57" \
+    "\x08\x00\x40\x1e\x80\xff\xff\x37\x07\x2c\xc6\xe3\x01\xe5\x03\x00" "\x60\x00\x00\x10\xeb\x04\x05\x00\x02\x2b\x25\x00\x00\x5a\xff\x00" \
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\xfd\xa3\x00\x13\x00\x04\x82" "\x01\x04\x00\x00\xd9\x9f\x00\x00\x38\x04\x00\xe0\x9d\xbe\x10\x06" \
+    "\x80\x40\x30\x80\x00\x00\x70\x6e\x14\x00\x00\x87\x00\x00\x6a\x05" "\x1a\x46\x07\x98\x31\xee\x01\xb6\x03\x1a\x02\x8a\x03\x5a\x02\x8a" \
+    "\x83\x82\x80\x19\xe3\x26\x20\x3c\xe0\x26\xe0\x3a\x20\x27\xa0\x3a" "\xd4\x0d\x98\x21\x26\x04\x52\x04\x22\x04\x4e\x44\xde\x80\x19\xa2" \
+    "\x38\xa0\x50\xe0\x37\xa0\x50\xa4\x0e\x98\x31\x1a\x02\x8e\x03\x06" "\x02\x8e\x03\xf2\x01\x7a\x03\xee\x80\x19\x54\x0f\x98\x31\x16\x03" \
+    "\x06\x05\xfa\x02\xea\x04\xda\x02\xea\xc4\xff\x7f\x33\x56\x02\x00" "\x00\x01\x96\xc0\x61\x00\x00\xbc\x01\xe0\x75\xbf\x72\x80\x0f\x03" \
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x10\xef\x00\x05\x00\x02\x10\x61" "\x00\x00\x4a\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x0d\x6a" \
+    "\xe0\x64\x0d\x9e\x9d\x49\x00\x79\xb7\xb5\x0d\x15\x50\xf7\x0d\x37" "\xe5\x3e\x00\x52\x0a\x05\x0c\x68\xfe\x25\xf0\xf9\xfb\x21\x06\x81" \
+    "\x03\x00\x10\x86\x03\x05\x00\x02\x8c\x30\x00\x00\x6b\xff\x00\x00" "\x00\x00\x00\x00\x00\x00\x00\x00\xfd\x8c\x00\x12\x00\x04\x82\x01" \
+    "\x04\x00\x10\x31\x9c\x00\x00\x08\x06\x00\x60\x73\xc8\xb0\x48\xc0" "\xcc\x71\x14\x70\x1a\xb0\x14\x30\x1a\x50\x15\x30\x1a\xd0\x04\xcc" \
+    "\x18\x47\x01\xad\x01\x47\x01\xa1\x01\x4b\x01\x9d\x61\x52\xc0\x8c" "\x71\x16\x90\x19\xd0\x15\x30\x1a\xd0\x15\xd0\x1a\x3a\x06\xcc\x18" \
+    "\x17\x01\x39\x02\x0d\x01\x2f\x02\x03\x01\x39\x62\x74\xc0\x0c\xb4" "\x07\xcc\x04\x86\xc0\xcc\xf1\x22\xd0\x23\xb0\x24\xd0\x23\xb0\x26" \
+    "\xd0\x21\xfe\xff\x9b\x51\x14\x00\x00\x48\xff\xfa\x89\x02\x00\xe0" "\x0d\x80\x1d\x98\xf6\x83\xf7\x1f\x00\x00\x00\x00\x00\x00\x00\x00" \
+    "\x10\x36\x01\x05\x00\x02\xdc\x7b\x00\x00\x3d\xff\x00\x00\x00\x00" "\x00\x00\x00\x00\x00\x00\x10\x81\x03\x05\x00\x02\x12\xb2\x00\x00" \
+    "\x4c\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xfd\xab\x00\x2b" "\x00\x04\x82\x01\x04\x00\x10\x3e\xad\x00\x00\x20\x06\x00\xb0\x9a" \
+    "\xbf\x50\x40\xc0\xcc\xd1\x11\x30\x21\xd0\x11\xd0\x21\xf0\x11\xf0" "\x21\xea\x05\xcc\x18\x3d\x01\x7f\x02\x3d\x01\x89\x02\x33\x01\x93" \
+    "\x02\x64\xc0\xcc\xf1\x12\xf0\x20\xf0\x12\x90\x21\xb0\x12\x90\x21" "\x08\x07\xcc\xa0\x70\xc0\x8c\x51\x1f\xd0\x1a\x50\x1f\xb0\x1a\x10" \
+    "\x1f\x70\x1a\x1a\x07\xcc\xe0\x71\xc0\x8c\xf1\x22\x10\x22\x10\x23" "\xf0\x21\xb0\x23\xf0\x21\xb6\x07\xcc\xa0\x7d\xc0\x0c\xb1\x21\x30" \
+    "\x20\x10\x21\x30\x20\x7e\x08\xcc\x18\x5f\x01\x6f\x02\x5d\x01\x6d" "\x02\x5d\x01\x63\xe2\xff\xbf\x19\x45\x01\x00\x80\x7c\xe9\x20\x2a" \
+    "\x00\x00\xde\x00\x94\x3f\x58\x48\x6c\x8e\x00\x00\x00\x00\x00\x00" "\x00\x00\x00\x6d\x04\x00\x00\x01\x03\xfe\xe0\xf2\x13\x00\xfd\x64" \
+    "\x01\x5d\x00\x04\x82\x01\x04\x00\xf0\x64\xad\x00\x00\x78\x04\x00" "\x80\xe0\x8e\xf0\x17\xc0\x0c\xc6\x01\xcc\xa0\x21\xc0\x0c\x64\x02" \
+    "\xcc\x00\x40\xc0\xcc\x11\x20\x90\x19\x10\x1f\x90\x1a\x90\x1f\x10" "\x1b\x64\x04\xcc\x18\x07\x02\x75\x02\x07\x02\x71\x02\x09\x02\x6f" \
+    "\xc2\x46\xc0\x8c\x31\x22\xb0\x1d\xd0\x21\xb0\x1d\x50\x21\x30\x1d" "\xae\x05\xcc\x1c\xef\x01\xab\x01\xdf\x01\xab\x01\xd5\x01\xa1\x01" \
+    "\x5b\xc0\xcc\x71\x0f\x50\x21\x70\x0f\xb0\x20\x10\x10\x10\x20\xb2" "\x05\xcc\x44\x5b\xc0\x0c\xb6\x05\xcc\x80\x5b\xc0\x0c\xba\x05\xcc" \
+    "\x1c\x25\x01\xf5\x01\x25\x01\xf7\x01\x23\x01\xf9\xc1\x5b\xc0\x0c" "\xbe\x05\xcc\x00\x5c\xc0\x0c\xc2\x05\xcc\x40\x5c\xc0\x0c\xc6\x05" \
+    "\xcc\x1c\x0f\x01\x21\x02\x0f\x01\x2b\x02\xeb\x00\x2b\x82\x5c\xc0" "\x0c\xca\x05\xcc\x04\x83\xc0\xcc\x31\x1c\x70\x2b\x30\x1b\x70\x2b" \
+    "\x90\x1a\x10\x2c\xc8\x08\xcc\x80\x96\xc0\x8c\x11\x18\x70\x2b\x70" "\x14\x70\x2b\xd0\x12\xd0\x29\xa4\x09\xcc\xf0\x41\xe2\xec\x02\xa5" \
+    "\x01\x0d\x62\x9f\xc0\x8c\xb1\x12\xb0\x1c\x50\x12\x50\x1c\x50\x12" "\x70\x1b\x26\x0a\xcc\x1c\xdd\x01\xab\x01\xe5\x01\xab\x01\xef\x01" \
+    "\xb5\x41\xa3\xc0\xcc\x71\x10\x50\x26\x30\x10\x10\x26\x30\x10\x70" "\x25\xa2\x0a\xcc\x18\x4f\x01\x6f\x02\x4d\x01\x6d\x02\x3f\x01\x6d" \
+    "\xe2\xab\xc0\x8c\x51\x1c\xb0\x2a\xd0\x1c\xb0\x2a\x50\x1d\x30\x2a" "\x04\x0b\xcc\x18\x23\x02\x63\x02\x2d\x02\x6d\x02\x31\x02\x6d\xe2" \
+    "\xff\xbf\x19\x45\x01\x00\x80\x04\x00\xc0\x1d\x00\x00\xf6\x00\x04" "\x00\x80\x44\xf8\xed\x4c\x1a\x10\x1a\x00\x00\x03\x00\x00\x0d\x05" \
+    "\x63\x9e\x0f\x0e\xa3\x49\x00\xc6\xad\x5d\x0c\x6c\xd8\xf8\x0d\x37" "\xe5\x3e\x00\x51\x6d\x7b\x0b\x68\xfe\x19\x2f\x53\xff\x18\x06\xd0" \
+    "\x05\x00\xfd\x8e\x01\x1f\x00\x04\x50\x09\xc0\x8c\x91\x0e\xf0\x23" "\xb0\x0d\x10\x23\xb0\x0d\xf0\x21\x2e\x01\xcc\x18\xfd\x01\x87\x02" \
+    "\x07\x02\x91\x02\x15\x02\x91\xa2\x18\xc0\x0c\xe6\x01\xcc\x40\x25" "\xc0\x0c\x66\x02\xcc\x18\xe1\x01\x71\x02\xf3\x01\x83\x02\xf3\x01" \
+    "\x8d\xe2\x29\xc0\x8c\xd1\x22\xb0\x1a\x50\x22\x30\x1a\x70\x21\x10" "\x1b\xd0\x02\xcc\xe0\x35\xc0\x0c\xfc\x03\xcc\x18\x41\x01\xd1\x01" \
+    "\x37\x01\xd1\x01\x37\x01\xa7\x61\x41\xc0\x8c\x51\x15\xd0\x1a\x50" "\x15\x90\x18\xf0\x15\xf0\x17\x2c\x04\xcc\x1c\x41\x02\xf1\x01\x4b" \
+    "\x02\xe7\x01\x4b\x02\xd5\xe1\x4b\xc0\xcc\xf1\x22\xd0\x21\xf0\x22" "\x70\x22\x90\x23\x70\x22\x24\x05\xcc\x18\xad\x01\xa7\x02\xb7\x01" \
+    "\xa7\x02\xc1\x01\x9d\xe2\x52\xc0\x8c\xd1\x0f\x50\x21\xd0\x0f\x70" "\x1f\x30\x10\x10\x1f\xcc\x05\xcc\x18\x47\x02\x09\x02\x5f\x02\x09" \
+    "\x02\x63\x02\x05\xe2\x5c\xc0\x4c\xd0\x05\xcc\x20\x5d\xc0\x0c\xd4" "\x05\xcc\x18\x73\x02\x51\x02\x69\x02\x5b\x02\x5f\x02\x51\x62\x5d" \
+    "\xc0\x0c\xd8\x05\xcc\x1c\xe7\x01\x97\x02\xe7\x01\x8d\x02\xeb\x01" "\x89\xa2\x5d\xc0\xcc\xf1\x17\xf0\x29\x50\x17\xf0\x29\x50\x17\x90" \
+    "\x2a\x64\x06\xcc\x1c\xdf\x00\x05\x02\xeb\x00\xf9\x01\xeb\x00\xdb" "\xe1\x67\xc0\x8c\x51\x12\x70\x1c\x50\x12\xd0\x1b\x10\x14\x10\x1a" \
+    "\xaa\x07\xcc\x1c\x1d\x01\x51\x02\x27\x01\x51\x02\x27\x01\x4f\x62" "\x8b\xc0\x8c\x51\x15\x30\x2a\xb0\x14\x30\x2a\xb0\x14\x70\x29\xcc" \
+    "\x09\xcc\x1c\xd3\x01\x8d\x02\xd9\x01\x8d\x02\xe5\x01\x81\x02\xa4" "\xc0\xcc\x51\x20\x70\x26\x70\x20\x50\x26\x70\x20\xd0\x25\xda\x0a" \
+    "\xcc\x18\xa7\x01\xa1\x02\xb1\x01\xa1\x02\xc1\x01\xb1\xe2\xff\xbf" "\x19\x45\x01\x00\x80\x20\x21\x4b\x29\x00\x00\xde\x00\x48\xfa\x4b" \
+    "\x4a\xa4\x5b\x03\x00\x00\x00\x00\x00\x06\x00\x00\x10\x20\x00\x08" "\x00\x01\x39\x03\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00" \
+    "\x00\x00\x10\xd0\x05\x05\x00\x02\x8b\x1f\x00\x00\x54\xff\x00\x00" "\x00\x00\x00\x00\x00\x00\x00\x00\xfd\x2c\x01\xb4\x00\x04\x10\x23" \
+    "\xc0\x0c\xd4\x02\xcc\x40\x30\xc0\x0c\x0e\x03\xcc\xc0\x33\xc0\x0c" "\x78\x03\xcc\xa0\x40\xc0\x0c\x22\x04\xcc\x60\x53\xc0\xcc\x71\x21" \
+    "\xd0\x25\xb0\x21\x10\x26\x50\x22\x10\x26\xdc\x05\xcc\x1c\x63\x01" "\x99\x01\x77\x01\x85\x01\x77\x01\x7b\xe1\x5d\xc0\xcc\xb1\x13\xb0" \
+    "\x25\xb0\x13\x50\x25\x90\x13\x30\x25\xe0\x05\xcc\x20\x5e\xc0\x0c" "\xe4\x05\xcc\x60\x5e\xc0\x4c\xe8\x05\xcc\x18\xaf\x01\xa1\x02\xc3" \
+    "\x01\xb5\x02\xd9\x01\xb5\x62\x64\xc0\x8c\x71\x17\x50\x29\x70\x17" "\xb0\x27\xb0\x17\x70\x27\xf6\x06\xcc\x18\x6d\x01\x8b\x02\x77\x01" \
+    "\x95\x02\x77\x01\x9f\x42\x76\xc0\xcc\x11\x15\xd0\x29\x30\x13\xf0" "\x27\x30\x13\x50\x26\x54\x09\xcc\x1c\x19\x02\xcf\x01\x09\x02\xdf" \
+    "\x01\x01\x02\xdf\x81\x99\xc0\xcc\xb1\x17\x90\x29\x10\x17\x30\x2a" "\xb0\x16\x30\x2a\xc0\x09\xcc\x1c\x81\x01\xb1\x02\x79\x01\xb9\x02" \
+    "\x6f\x01\xb9\x02\xa4\xc0\x8c\x51\x20\x70\x26\x70\x20\x50\x26\x70" "\x20\xd0\x25\x94\x0a\xcc\x1c\x11\x02\x55\x02\x11\x02\x43\x02\x1b" \
+    "\x02\x39\xa2\xae\xc0\x8c\xf1\x1e\x30\x1b\x50\x1f\x90\x1b\xf0\x1e" "\xf0\x1b\xf6\x0a\xcc\x1c\x19\x02\xa7\x01\x0f\x02\xb1\x01\x07\x02" \
+    "\xa9\xe1\xff\xbf\x19\x45\x01\x00\x80\xfc\xff\x7f\x22\x00\x00\xde" "\x00\x04\x00\x80\x3b\xf0\x68\x03\x00\x00\x00\x00\x00\x03\x00\x00";
+
+const QByteArray& ReplayCompression::dictionary()
+{
+    static const QByteArray dictionary = QByteArray::fromRawData(DICTIONARY_V1, int(sizeof(DICTIONARY_V1)) - 1);
+    return dictionary;
+}
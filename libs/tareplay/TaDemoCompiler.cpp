@@ -18,6 +18,7 @@
 #include <fstream>
 #include <sstream>
 
+#include "gpgnet/GpgNetFrameParser.h"
 #include "gpgnet/GpgNetParse.h"
 #include "gpgnet/GpgNetServerMessages.h"
 #include "taflib/HexDump.h"
@@ -58,24 +59,41 @@ QString TaDemoCompiler::UserContext::ipAddr()
 
 TaDemoCompiler::GameContext::GameContext() :
     gameId(0u),
-    expiryCountdown(GAME_EXPIRY_TICKS)
+    pendingMoves(new std::ostringstream()),
+    expiryCountdown(GAME_EXPIRY_TICKS),
+    unitDataHashVersion(0u)
 { }
 
 QString TaDemoCompiler::GameContext::getUnitDataHash() const
 {
-    QCryptographicHash md5(QCryptographicHash::Md5);
-    unitData.hash([&md5](std::uint32_t datum) {
-        md5.addData((const char*)&datum, sizeof(datum));
-    });
-    return md5.result().toHex();
+    if (sharedUnitData)
+    {
+        return sharedUnitData->hash;
+    }
+    if (unitDataHash.isNull() || unitDataHashVersion != unitData.hashVersion())
+    {
+        QCryptographicHash md5(QCryptographicHash::Md5);
+        unitData.hash([&md5](std::uint32_t datum) {
+            md5.addData((const char*)&datum, sizeof(datum));
+        });
+        unitDataHash = md5.result().toHex();
+        unitDataHashVersion = unitData.hashVersion();
+    }
+    return unitDataHash;
+}
+
+const tapacket::UnitDataRepo& TaDemoCompiler::GameContext::getUnitData() const
+{
+    return sharedUnitData ? sharedUnitData->units : unitData;
 }
 
 TaDemoCompiler::TaDemoCompiler(
-    QString demoPathTemplate, QHostAddress addr, quint16 port, quint32 minDemoSize, NoUserContextOption noUserContextOption):
+    QString demoPathTemplate, QHostAddress addr, quint16 port, quint32 minDemoSize, NoUserContextOption noUserContextOption, int commitIntervalMs):
     m_demoPathTemplate(demoPathTemplate),
     m_minDemoSize(minDemoSize),
     m_timerCounter(0u),
-    m_noUserContextOption(noUserContextOption)
+    m_noUserContextOption(noUserContextOption),
+    m_demoWriter(commitIntervalMs)
 {
     qInfo() << "[TaDemoCompiler::TaDemoCompiler] starting server on addr" << addr << "port" << port;
     m_tcpServer.listen(addr, port);
@@ -161,10 +179,18 @@ void TaDemoCompiler::onReadyRead()
         UserContext& userContext = *itUserContext.value().data();
 
         bool committedMoves = false;
+        gpgnet::GpgNetFrameParser::Command frame;
         while (!itUserContext.value()->dataStream->atEnd())
         {
-            QVariantList command = userContext.gpgNetParser.GetCommand(*userContext.dataStream);
-            QString cmd = command[0].toString();
+            if (!userContext.gpgNetParser.next(*sender, frame))
+            {
+                break;
+            }
+
+            // moves are the bulk of the traffic. they're committed straight from the frame without conversion to QVariant
+            const bool isMove = frame.is(GameMoveMessage::ID);
+            QVariantList command = isMove ? QVariantList() : frame.toVariantList();
+            QString cmd = isMove ? QString(GameMoveMessage::ID) : command[0].toString();
 
             if (cmd == HelloMessage::ID)
             {
@@ -217,7 +243,11 @@ void TaDemoCompiler::onReadyRead()
                         itGame->expiryCountdown = GAME_EXPIRY_TICKS;
                         if (itGame->demoCompilation)
                         {
-                            commitMove(itGame.value(), userContext.gamePlayerNumber, GameMoveMessage(command));
+                            if (frame.argCount() < 1 || !frame.arg(0).isBytes())
+                            {
+                                throw std::runtime_error("Unexpected command");
+                            }
+                            commitMove(itGame.value(), userContext.gamePlayerNumber, frame.arg(0).data, frame.arg(0).size);
                             committedMoves = true;
                         }
                     }
@@ -265,6 +295,12 @@ void TaDemoCompiler::onReadyRead()
                 {
                     GameUnitDataMessage msg(command);
                     GameContext& game = itGame.value();
+                    if (game.sharedUnitData)
+                    {
+                        // shared copy is immutable.  carry on with a private one
+                        game.unitData = game.sharedUnitData->units;
+                        game.sharedUnitData.reset();
+                    }
                     game.unitData.add(tapacket::bytestring((std::uint8_t*)msg.unitData.data(), msg.unitData.size()));
                     game.expiryCountdown = GAME_EXPIRY_TICKS;
                 }
@@ -287,6 +323,11 @@ void TaDemoCompiler::onReadyRead()
                         itGame->playersLockedIn = msg.lockedInPlayers;
                         itGame->finalFileName = m_demoPathTemplate.arg(itGame->gameId);
                         itGame->tempFileName = itGame->finalFileName + ".part";
+                        if (!itGame->sharedUnitData)
+                        {
+                            itGame->sharedUnitData = m_unitDataStore.intern(itGame->getUnitDataHash(), itGame->unitData);
+                            itGame->unitData.clear();
+                        }
                         itGame->demoCompilation = commitHeaders(itGame.value(), itGame->tempFileName);
                     }
                     if (!itGame->demoCompilation)
@@ -310,10 +351,10 @@ void TaDemoCompiler::onReadyRead()
                     {
                         int enabledUnitCount = 0;
                         int unitCount = 0;
-                        const auto& units = game.unitData.get();
+                        const auto& units = game.getUnitData().get();
                         for (auto it = units.begin(); it != units.end(); ++it)
                         {
-                            tapacket::TUnitData ud(it->second.data());
+                            tapacket::TUnitData ud(it->subpacket());
                             if (ud.sub == 0x03)
                             {
                                 qInfo() << QString("gameId:%1, sub:%2, id:%3, status:%4, limit:%5, crc:%6, raw:%7")
@@ -323,9 +364,8 @@ void TaDemoCompiler::onReadyRead()
                                     .arg(ud.u.statusAndLimit[0], 4, 16, QChar('0'))
                                     .arg(ud.u.statusAndLimit[1], 4, 16, QChar('0'))
                                     .arg(ud.u.crc, 8, 16, QChar('0'))
-                                    .arg(QString(QByteArray((const char*)it->second.data(), it->second.size()).toHex()));
-                                auto key02 = tapacket::UnitDataRepo::SubAndId(0x02, ud.id);
-                                if (ud.u.statusAndLimit[0] == 0x0101 && units.count(key02) > 0u)
+                                    .arg(QString(QByteArray((const char*)it->bytes, sizeof(it->bytes)).toHex()));
+                                if (ud.u.statusAndLimit[0] == 0x0101 && game.getUnitData().find(0x02, ud.id) != NULL)
                                 {
                                     ++enabledUnitCount;
                                 }
@@ -343,7 +383,7 @@ void TaDemoCompiler::onReadyRead()
         }
         if (committedMoves)
         {
-            m_games[userContext.gameId].demoCompilation->flush();
+            queuePendingMoves(m_games[userContext.gameId]);
         }
     }
     catch (const gpgnet::GpgNetParse::DataNotReady &)
@@ -363,9 +403,9 @@ void TaDemoCompiler::onReadyRead()
     }
 }
 
-std::shared_ptr<std::ostream> TaDemoCompiler::commitHeaders(const GameContext& game, QString filename)
+std::shared_ptr<AsyncDemoWriter::File> TaDemoCompiler::commitHeaders(const GameContext& game, QString filename)
 {
-    std::shared_ptr<std::ostream> fs;
+    std::shared_ptr<AsyncDemoWriter::File> fs;
     qInfo() << "[TaDemoCompiler::commitHeaders] creating new demo compilation" << filename;
 
     QVector<quint32> knownLockedInPlayers;
@@ -401,8 +441,8 @@ std::shared_ptr<std::ostream> TaDemoCompiler::commitHeaders(const GameContext& g
         }
     }
 
-    fs.reset(new std::ofstream(filename.toStdString(), std::ios::binary));
-    tapacket::TADemoWriter tad(fs.get());
+    std::ostringstream headers;
+    tapacket::TADemoWriter tad(&headers);
 
     tapacket::Header header;
     std::strcpy(header.magic, "TA Demo");
@@ -487,13 +527,23 @@ std::shared_ptr<std::ostream> TaDemoCompiler::commitHeaders(const GameContext& g
         }
     }
 
-    tapacket::UnitData unitData;
-    for (const auto& ud : game.unitData.get())
+    if (game.sharedUnitData)
     {
-        unitData.unitData += ud.second;
+        headers.write(game.sharedUnitData->demoRecord.data(), game.sharedUnitData->demoRecord.size());
+    }
+    else
+    {
+        tapacket::UnitData unitData;
+        unitData.unitData.reserve(game.unitData.get().size() * tapacket::UnitDataRepo::RECORD_SIZE);
+        for (const auto& ud : game.unitData.get())
+        {
+            unitData.unitData.append(ud.bytes, sizeof(ud.bytes));
+        }
+        tad.write(unitData);
     }
-    tad.write(unitData);
     tad.flush();
+    fs = m_demoWriter.open(filename);
+    m_demoWriter.write(fs, headers.str());
 
     QJsonObject jo;
     jo.insert("gameId", int(game.gameId));
@@ -525,7 +575,7 @@ std::shared_ptr<std::ostream> TaDemoCompiler::commitHeaders(const GameContext& g
     return fs;
 }
 
-void TaDemoCompiler::commitMove(TaDemoCompiler::GameContext& game, int playerNumber, const GameMoveMessage& moves)
+void TaDemoCompiler::commitMove(TaDemoCompiler::GameContext& game, int playerNumber, const char* moves, int size)
 {
     // TADR file format requires:
     // - unencrypted
@@ -539,14 +589,20 @@ void TaDemoCompiler::commitMove(TaDemoCompiler::GameContext& game, int playerNum
         game.timer.start();
     }
 
-    tapacket::TADemoWriter tad(game.demoCompilation.get());
+    tapacket::TADemoWriter tad(game.pendingMoves.get());
     tapacket::Packet packet;
     packet.time = game.timer.restart();
     packet.sender = playerNumber;
-    packet.data.assign((std::uint8_t*)moves.moves.data(), moves.moves.size());
+    packet.data.assign((const std::uint8_t*)moves, size);
     tad.write(packet);
 }
 
+void TaDemoCompiler::queuePendingMoves(TaDemoCompiler::GameContext& game)
+{
+    m_demoWriter.write(game.demoCompilation, game.pendingMoves->str());
+    game.pendingMoves->str(std::string());
+}
+
 void TaDemoCompiler::timerEvent(QTimerEvent* event)
 {
     try
@@ -583,18 +639,19 @@ void TaDemoCompiler::closeExpiredGames()
     {
         if (m_games[gameid].demoCompilation)
         {
-            if (m_games[gameid].demoCompilation->tellp() >= m_minDemoSize)
+            // rename/remove happens on the writer thread once everything queued before it has been synced to disk
+            queuePendingMoves(m_games[gameid]);
+            if (m_games[gameid].demoCompilation->bytesQueued() >= m_minDemoSize)
             {
                 qInfo() << "[TaDemoCompiler::closeExpiredGames] game" << gameid << "has expired. closing" << m_games[gameid].finalFileName;
-                m_games[gameid].demoCompilation.reset();
-                QFile::rename(m_games[gameid].tempFileName, m_games[gameid].finalFileName);
+                m_demoWriter.close(m_games[gameid].demoCompilation, m_games[gameid].finalFileName);
             }
             else
             {
                 qInfo() << "[TaDemoCompiler::closeExpiredGames] game" << gameid << "has expired and is too small. Deleting" << m_games[gameid].finalFileName;
-                m_games[gameid].demoCompilation.reset();
-                QFile::remove(m_games[gameid].tempFileName);
+                m_demoWriter.close(m_games[gameid].demoCompilation, QString());
             }
+            m_games[gameid].demoCompilation.reset();
         }
         m_games.remove(gameid);
     }
@@ -1,8 +1,12 @@
 #pragma once
 
 #include "tapacket/UnitDataRepo.h"
+#include "AsyncDemoWriter.h"
+#include "UnitDataStore.h"
 #include <QtCore/qelapsedtimer.h>
 
+#include <sstream>
+
 namespace tareplay {
 
     class TaDemoCompiler: public QObject
@@ -17,7 +21,7 @@ namespace tareplay {
             DISCONNECT_FROM_HOST
         };
 
-        TaDemoCompiler(QString demoPathTemplate, QHostAddress addr, quint16 port, quint32 minDemoSize, NoUserContextOption noUserContextOption);
+        TaDemoCompiler(QString demoPathTemplate, QHostAddress addr, quint16 port, quint32 minDemoSize, NoUserContextOption noUserContextOption, int commitIntervalMs);
         ~TaDemoCompiler();
 
         void sendStopRecordingToAllInGame(quint32 gameId);
@@ -34,7 +38,7 @@ namespace tareplay {
             quint32 playerDpId;
             QString playerName;
             QSharedPointer<QDataStream> dataStream;
-            gpgnet::GpgNetParse gpgNetParser;
+            gpgnet::GpgNetFrameParser gpgNetParser;
             QSharedPointer<gpgnet::GpgNetSend> gpgNetSerialiser;
             GamePlayerMessage gamePlayerInfo;
             int gamePlayerNumber;   // 1..10
@@ -45,18 +49,24 @@ namespace tareplay {
         {
             GameContext();
             QString getUnitDataHash() const;
+            const tapacket::UnitDataRepo& getUnitData() const;     // sharedUnitData if set, otherwise unitData
 
             quint32 gameId;
             GameInfoMessage header;
             QMap<quint32, QSharedPointer<UserContext> > players;    // keyed by Dplay ID
             QVector<quint32> playersLockedIn;                       // those that actually progressed to loading
-            tapacket::UnitDataRepo unitData;
+            tapacket::UnitDataRepo unitData;                        // as received.  emptied once moved into sharedUnitData
+            std::shared_ptr<const UnitDataStore::Entry> sharedUnitData; // set when headers are committed
             QElapsedTimer timer;
 
-            std::shared_ptr<std::ostream> demoCompilation;
+            std::shared_ptr<AsyncDemoWriter::File> demoCompilation;
+            std::shared_ptr<std::ostringstream> pendingMoves;   // moves committed since last handed to m_demoWriter
             QString tempFileName;
             QString finalFileName;
             int expiryCountdown;    // continuing messages from players keep this counter from expiring
+
+            mutable QString unitDataHash;               // cache for getUnitDataHash()
+            mutable std::uint32_t unitDataHashVersion;  // unitData.hashVersion() at which unitDataHash was computed
         };
 
         void onNewConnection();
@@ -67,8 +77,9 @@ namespace tareplay {
         void timerEvent(QTimerEvent* event);
         void handleBadConnection(QAbstractSocket* sender);
 
-        std::shared_ptr<std::ostream> commitHeaders(const GameContext& game, QString filename);
-        void commitMove(GameContext &, int playerNumber, const GameMoveMessage &);
+        std::shared_ptr<AsyncDemoWriter::File> commitHeaders(const GameContext& game, QString filename);
+        void commitMove(GameContext &, int playerNumber, const char* moves, int size);
+        void queuePendingMoves(GameContext &);
 
         QString m_demoPathTemplate;
         quint32 m_minDemoSize;
@@ -77,6 +88,8 @@ namespace tareplay {
         QMap<quint32, GameContext> m_games;
         quint32 m_timerCounter;
         NoUserContextOption m_noUserContextOption;
+        AsyncDemoWriter m_demoWriter;
+        UnitDataStore m_unitDataStore;
     };
 
 }
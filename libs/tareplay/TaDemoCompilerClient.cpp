@@ -6,6 +6,7 @@
 using namespace tareplay;
 
 TaDemoCompilerClient::TaDemoCompilerClient(QString taDemoCompilerHostName, quint16 taDemoCompilerPort, quint32 tafGameId) :
+    m_tcpSocket(this),  // parented so that it follows us through moveToThread()
     m_taDemoCompilerHostName(taDemoCompilerHostName),
     m_taDemoCompilerPort(taDemoCompilerPort),
     m_tafGameId(tafGameId),
@@ -175,8 +176,7 @@ void TaDemoCompilerClient::sendMoves(QByteArray moves)
         qInfo() << "[TaDemoCompilerClient::sendMoves]" << moves.size() << "bytes";
     }
 
-    m_protocol.sendCommand(GameMoveMessage::ID, 1);
-    m_protocol.sendArgument(moves);
+    m_encoder.send(m_tcpSocket, GameMoveMessage::ID, moves);
 }
 
 void TaDemoCompilerClient::sendDebugRequest(quint32 gameId)
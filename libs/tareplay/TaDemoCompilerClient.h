@@ -3,6 +3,7 @@
 #include <QtCore/qset.h>
 #include <QtNetwork/qtcpsocket.h>
 #include <QtNetwork/qhostaddress.h>
+#include "gpgnet/GpgNetEncoder.h"
 #include "gpgnet/GpgNetSend.h"
 #include "tapacket/TPacket.h"
 
@@ -61,6 +62,7 @@ namespace tareplay {
         quint32 m_hostDplayId;
         QDataStream m_datastream;
         gpgnet::GpgNetSend m_protocol;
+        gpgnet::GpgNetEncoder m_encoder;    // for the high rate messages
         qint64 m_ticks;
         QSet<quint32> m_dpConnectedPlayers;
     };
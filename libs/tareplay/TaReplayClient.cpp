@@ -1,4 +1,5 @@
 #include "TaReplayClient.h"
+#include "ReplayCompression.h"
 
 #include "QtCore/qtemporaryfile.h"
 #include "QtCore/qdir.h"
@@ -7,6 +8,8 @@
 #include "taflib/HexDump.h"
 #include "qlogging.h"
 
+#include <algorithm>
+
 using namespace tareplay;
 
 TaReplayClient::TaReplayClient(QString replayServerHostName, quint16 replayServerPort, quint32 tafGameId, quint32 position):
@@ -14,6 +17,7 @@ TaReplayClient::TaReplayClient(QString replayServerHostName, quint16 replayServe
     m_replayServerPort(replayServerPort),
     m_tafGameId(tafGameId),
     m_position(position),
+    m_bulkBytesRemaining(0u),
     m_socketStream(&m_tcpSocket),
     m_gpgNetSerialiser(m_socketStream)
 {
@@ -73,6 +77,8 @@ void TaReplayClient::onSocketStateChanged(QAbstractSocket::SocketState socketSta
         if (socketState == QAbstractSocket::UnconnectedState)
         {
             qWarning() << "[TaReplayClient::onSocketStateChanged] socket disconnected";
+            m_bulkBytesRemaining = 0u;
+            m_gpgNetParser.reset();
         }
         else if (socketState == QAbstractSocket::ConnectedState)
         {
@@ -94,9 +100,10 @@ void TaReplayClient::onSocketStateChanged(QAbstractSocket::SocketState socketSta
 void TaReplayClient::sendSubscribe(quint32 gameId, quint32 position)
 {
     qInfo() << "[TaReplayClient::sendSubscribe] gameId,position" << gameId << position;
-    m_gpgNetSerialiser.sendCommand(TaReplayServerSubscribe::ID, 2);
+    m_gpgNetSerialiser.sendCommand(TaReplayServerSubscribe::ID, 3);
     m_gpgNetSerialiser.sendArgument(gameId);
     m_gpgNetSerialiser.sendArgument(position);
+    m_gpgNetSerialiser.sendArgument(TaReplayServerSubscribe::FLAG_BULK_TRANSFER | TaReplayServerSubscribe::FLAG_COMPRESSION_DICT_V1);
 }
 
 void TaReplayClient::onReadyRead()
@@ -105,6 +112,15 @@ void TaReplayClient::onReadyRead()
     {
         while (m_tcpSocket.bytesAvailable() > 0)
         {
+            if (m_bulkBytesRemaining > 0u)
+            {
+                QByteArray data = m_tcpSocket.read(std::min(m_tcpSocket.bytesAvailable(), qint64(m_bulkBytesRemaining)));
+                m_replayBufferOStream.write(data.data(), data.size());
+                m_position += data.size();
+                m_bulkBytesRemaining -= data.size();
+                continue;
+            }
+
             QVariantList command = m_gpgNetParser.GetCommand(m_socketStream);
             QString cmd = command[0].toString();
 
@@ -116,11 +132,31 @@ void TaReplayClient::onReadyRead()
                     m_replayBufferOStream.write(msg.data.data(), msg.data.size());
                     m_position += msg.data.size();
                 }
+                else if (msg.status == TaReplayServerStatus::OK_COMPRESSED)
+                {
+                    QByteArray data = ReplayCompression::uncompress(msg.data);
+                    if (data.isEmpty())
+                    {
+                        throw std::runtime_error("unable to uncompress replay data");
+                    }
+                    m_replayBufferOStream.write(data.data(), data.size());
+                    m_position += data.size();
+                }
                 else
                 {
                     emit gameNotFound(msg.status);
                 }
             }
+            else if (cmd == TaReplayServerBulk::ID)
+            {
+                TaReplayServerBulk msg(command);
+                qInfo() << "[TaReplayClient::onReadyRead] bulk transfer of completed demo. position,size" << msg.position << msg.size;
+                if (msg.position != m_position)
+                {
+                    qWarning() << "[TaReplayClient::onReadyRead] bulk transfer position" << msg.position << "does not match our position" << m_position;
+                }
+                m_bulkBytesRemaining = msg.size;
+            }
             else
             {
                 qWarning() << "[TaReplayClient::onReadyRead] unexpected message from replay server!" << cmd;
@@ -37,6 +37,7 @@ namespace tareplay {
         quint16 m_replayServerPort;
         quint16 m_tafGameId;
         quint32 m_position;
+        quint32 m_bulkBytesRemaining;   // raw demo bytes still to follow a TaReplayServerBulk header
 
         QTcpSocket m_tcpSocket;
         QDataStream m_socketStream;
@@ -5,19 +5,27 @@
 #include <QtCore/qobject.h>
 #include <QtCore/qpair.h>
 #include <QtCore/qmap.h>
+#include <QtCore/qtimer.h>
 #include <QtNetwork/qhostaddress.h>
 #include <QtNetwork/qtcpserver.h>
 #include <QtNetwork/qtcpsocket.h>
 
+#include <algorithm>
 #include <cstring>
 #include <iostream>
 #include <fstream>
 #include <sstream>
 
+#ifdef __linux__
+#include <cerrno>
+#include <sys/sendfile.h>
+#endif
+
 #include "gpgnet/GpgNetParse.h"
 #include "taflib/Logger.h"
 #include "taflib/HexDump.h"
 
+#include "ReplayCompression.h"
 #include "TaReplayServerMessages.h"
 #include "TaReplayServer.h"
 
@@ -25,14 +33,18 @@ using namespace tareplay;
 
 static const int MAX_NUM_GAME_OPTIONS = 1000;
 static const int CHUNK_SIZE = 1000;
+static const int COMPRESSED_CHUNK_SIZE = 4096;
+static const int MAX_COMPRESSED_CHUNKS = 256;       // per game.  the most recent, which subscribers keeping up with the delay are reading
 
 TaReplayServer::UserContext::UserContext(QTcpSocket* socket):
     gameId(0u),
     userDataStream(new QDataStream(socket)),
-    enableLogWarn(true)
+    enableLogWarn(true),
+    bulkTransferEnabled(false),
+    bulkPosition(0),
+    compressionEnabled(false)
 {
     userDataStream->setByteOrder(QDataStream::ByteOrder::LittleEndian);
-    userDataStreamProtol.reset(new gpgnet::GpgNetSend(*userDataStream));
     gpgNetParser.reset(new gpgnet::GpgNetParse());
 }
 
@@ -161,8 +173,12 @@ void TaReplayServer::onReadyRead()
                 TaReplayServerSubscribe msg(command);
                 if (!m_gameInfo.contains(msg.gameId))
                 {
-                    qInfo() << "[TaReplayServer::onReadyRead][SUBSCRIBE] GAME NOT FOUND: no entry in m_gameInfo" << msg.gameId << "position:" << msg.position;
-                    sendData(userContext, TaReplayServerStatus::GAME_NOT_FOUND, QByteArray());
+                    // no longer live.  its completed demo is served without delay, in bulk if the client accepts it
+                    if (!subscribeCompletedGame(userContext, msg))
+                    {
+                        qInfo() << "[TaReplayServer::onReadyRead][SUBSCRIBE] GAME NOT FOUND: no entry in m_gameInfo and no completed replay file" << msg.gameId << "position:" << msg.position;
+                        sendData(userContext, TaReplayServerStatus::GAME_NOT_FOUND, QByteArray());
+                    }
                     continue;
                 }
                 const GameInfo& game = m_gameInfo[msg.gameId];
@@ -205,8 +221,8 @@ void TaReplayServer::onReadyRead()
                  qInfo()
                      << "[TaReplayServer::onReadyRead][SUBSCRIBE] gameId=" << msg.gameId << "position=" << msg.position
                      << "log.size=" << game.demoFileSizeLog->size() << "game.delay=" << game.delaySeconds
-                     << "demofile.tellg=" << userContext.demoFile->tellg();
-                userContext.gameId = msg.gameId;
+                     << "demofile.tellg=" << userContext.demoFile->tellg() << "flags=" << msg.flags;
+                setSubscription(userContext, msg);
             }
             else
             {
@@ -231,6 +247,38 @@ void TaReplayServer::onReadyRead()
     }
 }
 
+bool TaReplayServer::subscribeCompletedGame(UserContext& user, const TaReplayServerSubscribe& msg)
+{
+    QString fn = findCompletedReplayFileForGame(msg.gameId);
+    if (fn.isEmpty())
+    {
+        return false;
+    }
+
+    QSharedPointer<std::istream> demoFile(new std::ifstream(fn.toStdString().c_str(), std::ios::in | std::ios::binary));
+    if (!demoFile->good())
+    {
+        return false;
+    }
+    demoFile->seekg(0, std::ios::end);
+    const std::streamoff size = demoFile->tellg();
+    demoFile->seekg(std::min(std::streamoff(msg.position), std::max(std::streamoff(0), size)), std::ios::beg);
+
+    qInfo() << "[TaReplayServer::subscribeCompletedGame] gameId=" << msg.gameId << "position=" << msg.position
+        << "file size=" << size << "demofile.tellg=" << demoFile->tellg() << "flags=" << msg.flags;
+    user.demoFile = demoFile;
+    setSubscription(user, msg);
+    return true;
+}
+
+void TaReplayServer::setSubscription(UserContext& user, const TaReplayServerSubscribe& msg)
+{
+    user.gameId = msg.gameId;
+    user.bulkTransferEnabled = (msg.flags & TaReplayServerSubscribe::FLAG_BULK_TRANSFER) != 0u;
+    user.bulkFile.reset();
+    user.compressionEnabled = (msg.flags & TaReplayServerSubscribe::FLAG_COMPRESSION_DICT_V1) != 0u;
+}
+
 std::istream* TaReplayServer::findReplayFileForGame(quint32 gameId)
 {
     QFileInfo fileInfo;
@@ -246,11 +294,27 @@ std::istream* TaReplayServer::findReplayFileForGame(quint32 gameId)
     return NULL;
 }
 
+QString TaReplayServer::findCompletedReplayFileForGame(quint32 gameId)
+{
+    // TaDemoCompiler renames .part to the final name once the game is closed
+    QString fn = m_demoPathTemplate.arg(gameId);
+    QFileInfo partInfo(fn + ".part");
+    QFileInfo fileInfo(fn);
+    if (!partInfo.exists() && fileInfo.exists() && fileInfo.isFile())
+    {
+        return fileInfo.absoluteFilePath();
+    }
+    return QString();
+}
+
 void TaReplayServer::sendData(UserContext &user, TaReplayServerStatus status, QByteArray data)
 {
-    user.userDataStreamProtol->sendCommand(TaReplayServerData::ID, 2);
-    user.userDataStreamProtol->sendArgument(int(status));
-    user.userDataStreamProtol->sendArgument(data);
+    m_encoder.send(*user.userDataStream->device(), TaReplayServerData::ID, int(status), data);
+}
+
+void TaReplayServer::sendBulkHeader(UserContext &user, quint32 position, quint32 size)
+{
+    m_encoder.send(*user.userDataStream->device(), TaReplayServerBulk::ID, position, size);
 }
 
 void TaReplayServer::timerEvent(QTimerEvent* event)
@@ -325,6 +389,10 @@ void TaReplayServer::serviceUser(UserContext& user)
         }
         return;
     }
+    else if (user.bulkTransferEnabled && !m_gameInfo.contains(user.gameId) && serviceUserBulk(user))
+    {
+        return;
+    }
     else if (m_gameInfo.contains(user.gameId) && m_gameInfo[user.gameId].demoFileSizeLog.isNull())
     {
         if (user.enableLogWarn)
@@ -353,9 +421,21 @@ void TaReplayServer::serviceUser(UserContext& user)
         return;
     }
 
+    // compressed chunks are cached per game, so only while the game is live
+    const bool compressed = user.compressionEnabled && m_gameInfo.contains(user.gameId);
+
     bool firstBytes = user.demoFile->tellg() == std::streampos(0);
     while(user.userDataStream->device()->bytesToWrite() < m_maxBytesPerUserPerSecond)
     {
+        if (compressed)
+        {
+            if (!serviceUserCompressedChunk(user, dataEscrowThreshold))
+            {
+                break;
+            }
+            continue;
+        }
+
         const int maxBytesReveal = dataEscrowThreshold - user.demoFile->tellg();
         const int thisChunkSize = std::min(maxBytesReveal, CHUNK_SIZE);
         if (thisChunkSize <= 0)
@@ -363,16 +443,11 @@ void TaReplayServer::serviceUser(UserContext& user)
             break;
         }
 
-        data.resize(thisChunkSize);
-        user.demoFile->clear();
-        user.demoFile->read(data.data(), data.size());
-        user.demoFile->clear();
-        if (user.demoFile->gcount() <= 0)
+        data = readDemoFile(user, thisChunkSize);
+        if (data.isEmpty())
         {
             break;
         }
-
-        data.truncate(user.demoFile->gcount());
         sendData(user, TaReplayServerStatus::OK, data);
     }
 
@@ -381,3 +456,159 @@ void TaReplayServer::serviceUser(UserContext& user)
         qInfo() << "[TaReplayServer::serviceUser] sending first chunk of data to user: pointer,gameId,bytes" << QString("%1").arg(quint64(&user), 16, 16) << user.gameId << user.userDataStream->device()->bytesToWrite();
     }
 }
+
+QByteArray TaReplayServer::readDemoFile(UserContext& user, int maxBytes)
+{
+    QByteArray data(maxBytes, 0);
+    user.demoFile->clear();
+    user.demoFile->read(data.data(), data.size());
+    user.demoFile->clear();
+    data.truncate(std::max(std::streamsize(0), user.demoFile->gcount()));
+    return data;
+}
+
+// @return false if nothing more can be sent yet
+bool TaReplayServer::serviceUserCompressedChunk(UserContext& user, int dataEscrowThreshold)
+{
+    user.demoFile->clear();
+    const int position = user.demoFile->tellg();
+    const int chunkIndex = position / COMPRESSED_CHUNK_SIZE;
+    const int chunkBegin = chunkIndex * COMPRESSED_CHUNK_SIZE;
+    const int chunkEnd = chunkBegin + COMPRESSED_CHUNK_SIZE;
+
+    // partial chunks are held back until complete so that every subscriber sees the same chunk boundaries
+    if (position < 0 || chunkEnd > dataEscrowThreshold)
+    {
+        return false;
+    }
+
+    if (position != chunkBegin)
+    {
+        // eg subscribed at an arbitrary position. send uncompressed up to the next chunk boundary
+        QByteArray data = readDemoFile(user, chunkEnd - position);
+        if (data.isEmpty())
+        {
+            return false;
+        }
+        sendData(user, TaReplayServerStatus::OK, data);
+        return true;
+    }
+
+    GameInfo& game = m_gameInfo[user.gameId];
+    QByteArray compressed;
+    auto it = game.compressedChunks.find(chunkIndex);
+    if (it == game.compressedChunks.end())
+    {
+        QByteArray data = readDemoFile(user, COMPRESSED_CHUNK_SIZE);
+        if (data.size() < COMPRESSED_CHUNK_SIZE)
+        {
+            user.demoFile->seekg(position, std::ios::beg);
+            return false;
+        }
+        compressed = ReplayCompression::compress(data);
+        if (compressed.isEmpty())
+        {
+            qWarning() << "[TaReplayServer::serviceUserCompressedChunk] unable to compress chunk" << chunkIndex << "of gameId" << user.gameId;
+            user.demoFile->seekg(position, std::ios::beg);
+            return false;
+        }
+
+        // oldest first.  a chunk older than all those cached, for a subscriber far behind the rest, is evicted straight away
+        game.compressedChunks.insert(chunkIndex, compressed);
+        while (game.compressedChunks.size() > MAX_COMPRESSED_CHUNKS)
+        {
+            game.compressedChunks.erase(game.compressedChunks.begin());
+        }
+    }
+    else
+    {
+        compressed = it.value();
+        user.demoFile->seekg(chunkEnd, std::ios::beg);
+    }
+    sendData(user, TaReplayServerStatus::OK_COMPRESSED, compressed);
+    return true;
+}
+
+// @return bytes handed to the kernel, 0 if the socket would block, -1 on error
+static qint64 sendFileChunk(QTcpSocket* socket, QFile& file, qint64 position, qint64 maxBytes)
+{
+#ifdef __linux__
+    // straight from page cache to socket. we bypass QTcpSocket's write buffer, so caller must ensure it is empty
+    off_t offset = position;
+    ssize_t n = ::sendfile(int(socket->socketDescriptor()), file.handle(), &offset, size_t(maxBytes));
+    if (n < 0)
+    {
+        return (errno == EAGAIN || errno == EWOULDBLOCK) ? 0 : -1;
+    }
+    return n;
+#else
+    if (!file.seek(position))
+    {
+        return -1;
+    }
+    return socket->write(file.read(maxBytes));
+#endif
+}
+
+bool TaReplayServer::serviceUserBulk(UserContext& user)
+{
+    QTcpSocket* socket = qobject_cast<QTcpSocket*>(user.userDataStream->device());
+    if (socket == NULL)
+    {
+        return false;
+    }
+
+    if (user.bulkFile.isNull())
+    {
+        QString fn = findCompletedReplayFileForGame(user.gameId);
+        if (fn.isEmpty())
+        {
+            return false;
+        }
+
+        QSharedPointer<QFile> file(new QFile(fn));
+        user.demoFile->clear();
+        const qint64 position = user.demoFile->tellg();
+        if (!file->open(QIODevice::ReadOnly) || position < 0 || position > file->size())
+        {
+            qWarning() << "[TaReplayServer::serviceUserBulk] unable to start bulk transfer of" << fn << "from position" << position;
+            return false;
+        }
+
+        qInfo() << "[TaReplayServer::serviceUserBulk] starting bulk transfer: pointer,gameId,position,size" << QString("%1").arg(quint64(&user), 16, 16) << user.gameId << position << file->size();
+        user.bulkFile = file;
+        user.bulkPosition = position;
+        sendBulkHeader(user, quint32(position), quint32(file->size() - position));
+    }
+
+    // header frame (and anything else Qt is holding) has to reach the socket before the raw body
+    socket->flush();
+    qint64 budget = m_maxBytesPerUserPerSecond;
+    while (socket->bytesToWrite() == 0 && budget > 0 && user.bulkPosition < user.bulkFile->size())
+    {
+        const qint64 n = sendFileChunk(socket, *user.bulkFile, user.bulkPosition, std::min(budget, user.bulkFile->size() - user.bulkPosition));
+        if (n < 0)
+        {
+            qWarning() << "[TaReplayServer::serviceUserBulk] bulk transfer failed for gameId" << user.gameId << "at position" << user.bulkPosition << ". closing users connection ...";
+            user.bulkFile.reset();
+            user.demoFile.reset();
+            // deferred since closing synchronously would remove the user from m_users while timerEvent is iterating it
+            QTimer::singleShot(0, socket, [socket]() { socket->close(); });
+            return true;
+        }
+        else if (n == 0)
+        {
+            break;
+        }
+        user.bulkPosition += n;
+        budget -= n;
+    }
+
+    if (user.bulkPosition >= user.bulkFile->size())
+    {
+        qInfo() << "[TaReplayServer::serviceUserBulk] bulk transfer complete: pointer,gameId,bytes" << QString("%1").arg(quint64(&user), 16, 16) << user.gameId << user.bulkPosition;
+        user.bulkFile.reset();
+        user.demoFile.reset();
+    }
+    return true;
+}
@@ -1,9 +1,11 @@
 #pragma once
 
+#include <QtCore/qfile.h>
 #include <QtCore/qqueue.h>
 #include <QtNetwork/qtcpserver.h>
 
 
+#include "gpgnet/GpgNetEncoder.h"
 #include "gpgnet/GpgNetSend.h"
 
 #include "TaReplayServerMessages.h"
@@ -33,6 +35,10 @@ namespace tareplay {
 
             // the last delaySeconds worth of file sizes in bytes;
             QSharedPointer<QQueue<int> > demoFileSizeLog;
+
+            // compressed demo file keyed by chunk index. shared by all subscribers to the game.
+            // only the most recent chunks are kept, so it doesn't grow with the game
+            QMap<int, QByteArray> compressedChunks;
         };
 
         struct UserContext
@@ -42,13 +48,20 @@ namespace tareplay {
 
             quint32 gameId;
             QSharedPointer<QDataStream> userDataStream;
-            QSharedPointer<gpgnet::GpgNetSend> userDataStreamProtol;
             QSharedPointer<gpgnet::GpgNetParse> gpgNetParser;
             QSharedPointer<std::istream> demoFile;
             bool enableLogWarn;
+
+            // bulk transfer of a completed demo. body bypasses GpgNet framing once the TaReplayServerBulk header is sent
+            bool bulkTransferEnabled;
+            QSharedPointer<QFile> bulkFile;
+            qint64 bulkPosition;
+
+            bool compressionEnabled;
         };
 
         void sendData(UserContext &user, TaReplayServerStatus status, QByteArray data);
+        void sendBulkHeader(UserContext &user, quint32 position, quint32 size);
 
         void onNewConnection();
         void onSocketStateChanged(QAbstractSocket::SocketState socketState);
@@ -56,7 +69,14 @@ namespace tareplay {
         void timerEvent(QTimerEvent* event);
         void updateFileSizeLog(GameInfo& gameInfo);
         void serviceUser(UserContext& user);
+        bool serviceUserBulk(UserContext& user);
+        bool serviceUserCompressedChunk(UserContext& user, int dataEscrowThreshold);
+        QByteArray readDemoFile(UserContext& user, int maxBytes);
+        // @return false if gameId has no completed replay file
+        bool subscribeCompletedGame(UserContext& user, const TaReplayServerSubscribe& msg);
+        void setSubscription(UserContext& user, const TaReplayServerSubscribe& msg);
         std::istream* findReplayFileForGame(quint32 gameId);
+        QString findCompletedReplayFileForGame(quint32 gameId);
 
         QString m_demoPathTemplate;
         quint16 m_delaySeconds;
@@ -64,6 +84,7 @@ namespace tareplay {
         QTcpServer m_tcpServer;
         QMap<QTcpSocket*, QSharedPointer<UserContext> > m_users;
         QMap<quint32, GameInfo> m_gameInfo;
+        gpgnet::GpgNetEncoder m_encoder;
     };
 
 }
\ No newline at end of file
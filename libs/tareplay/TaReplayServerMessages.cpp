@@ -5,7 +5,9 @@
 using namespace tareplay;
 
 TaReplayServerSubscribe::TaReplayServerSubscribe():
-    gameId(0u)
+    gameId(0u),
+    position(0u),
+    flags(0u)
 { }
 
 const char * const TaReplayServerSubscribe::ID = "ReplayServerSubscribe";
@@ -24,6 +26,7 @@ void TaReplayServerSubscribe::set(QVariantList command)
     }
     gameId = command[1].toUInt();
     position = command[2].toUInt();
+    flags = command.size() > 3 ? command[3].toUInt() : 0u;
 }
 
 TaReplayServerData::TaReplayServerData():
@@ -47,3 +50,26 @@ void TaReplayServerData::set(QVariantList command)
     status = TaReplayServerStatus(command[1].toUInt());
     data = command[2].toByteArray();
 }
+
+TaReplayServerBulk::TaReplayServerBulk():
+    position(0u),
+    size(0u)
+{ }
+
+const char* const TaReplayServerBulk::ID = "ReplayServerBulk";
+
+TaReplayServerBulk::TaReplayServerBulk(QVariantList command)
+{
+    set(command);
+}
+
+void TaReplayServerBulk::set(QVariantList command)
+{
+    QString cmd = command[0].toString();
+    if (cmd.compare(ID))
+    {
+        throw std::runtime_error("Unexpected command");
+    }
+    position = command[1].toUInt();
+    size = command[2].toUInt();
+}
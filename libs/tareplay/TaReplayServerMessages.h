@@ -10,8 +10,15 @@ namespace tareplay {
     class TaReplayServerSubscribe
     {
     public:
+        // optional capabilities advertised by the client. older clients send none
+        static const quint32 FLAG_BULK_TRANSFER = 1u;   // client accepts TaReplayServerBulk followed by raw file bytes
+        // client accepts TaReplayServerStatus::OK_COMPRESSED data made with ReplayCompression's dictionary version 1.
+        // 2u is retired: it meant a dictionary each side built at run time, which nothing guaranteed would match
+        static const quint32 FLAG_COMPRESSION_DICT_V1 = 4u;
+
         quint32 gameId;
         quint32 position;
+        quint32 flags;
 
         static const char * const ID;
         TaReplayServerSubscribe();
@@ -24,7 +31,8 @@ namespace tareplay {
         CONNECTING = 0,
         OK = 1,
         GAME_NOT_FOUND = 2,
-        LIVE_REPLAY_DISABLED = 3
+        LIVE_REPLAY_DISABLED = 3,
+        OK_COMPRESSED = 4       // data is ReplayCompression::compress'd
     };
 
     class TaReplayServerData
@@ -40,6 +48,20 @@ namespace tareplay {
         void set(QVariantList command);
     };
 
+    // header for a completed demo. the next 'size' bytes on the socket are raw demo file content starting at 'position'
+    class TaReplayServerBulk
+    {
+    public:
+
+        quint32 position;
+        quint32 size;
+
+        static const char* const ID;
+        TaReplayServerBulk();
+        TaReplayServerBulk(QVariantList command);
+        void set(QVariantList command);
+    };
+
 }
 
 Q_DECLARE_METATYPE(tareplay::TaReplayServerStatus)
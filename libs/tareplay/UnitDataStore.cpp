@@ -0,0 +1,73 @@
+#include "UnitDataStore.h"
+#include "tapacket/TADemoWriter.h"
+
+#include <QtCore/qdebug.h>
+
+#include <cstring>
+#include <sstream>
+
+using namespace tareplay;
+
+static_assert(sizeof(tapacket::UnitDataRepo::Record) == tapacket::UnitDataRepo::RECORD_SIZE, "UnitDataRepo records are expected to be packed");
+
+std::shared_ptr<const UnitDataStore::Entry> UnitDataStore::intern(const QString& hash, const tapacket::UnitDataRepo& units)
+{
+    removeExpired();
+
+    auto range = m_entries.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        std::shared_ptr<const Entry> entry = it->second.lock();
+        if (entry && isSameTable(entry->units, units))
+        {
+            return entry;
+        }
+    }
+
+    std::shared_ptr<Entry> entry(new Entry());
+    entry->hash = hash;
+    entry->units = units;
+
+    const std::vector<tapacket::UnitDataRepo::Record>& records = units.get();
+    tapacket::UnitData unitData;
+    if (!records.empty())
+    {
+        unitData.unitData.assign(records.front().bytes, records.size() * tapacket::UnitDataRepo::RECORD_SIZE);
+    }
+    std::ostringstream ss;
+    tapacket::TADemoWriter(&ss).write(unitData);
+    entry->demoRecord = ss.str();
+
+    m_entries.insert(std::make_pair(hash, std::weak_ptr<const Entry>(entry)));
+    qInfo() << "[UnitDataStore::intern] new unit data table. hash:" << hash << "records:" << records.size() << "tables in use:" << m_entries.size();
+    return entry;
+}
+
+std::size_t UnitDataStore::size()
+{
+    removeExpired();
+    return m_entries.size();
+}
+
+bool UnitDataStore::isSameTable(const tapacket::UnitDataRepo& a, const tapacket::UnitDataRepo& b)
+{
+    const std::vector<tapacket::UnitDataRepo::Record>& ra = a.get();
+    const std::vector<tapacket::UnitDataRepo::Record>& rb = b.get();
+    return ra.size() == rb.size() &&
+        (ra.empty() || std::memcmp(ra.data(), rb.data(), ra.size() * tapacket::UnitDataRepo::RECORD_SIZE) == 0);
+}
+
+void UnitDataStore::removeExpired()
+{
+    for (auto it = m_entries.begin(); it != m_entries.end(); )
+    {
+        if (it->second.expired())
+        {
+            it = m_entries.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "tapacket/UnitDataRepo.h"
+#include <QtCore/qstring.h>
+
+#include <map>
+#include <memory>
+#include <string>
+
+namespace tareplay {
+
+    // Content addressed store of unit data tables so that games played on the same mod version share one copy.
+    // Stored tables are immutable, and are released once no game refers to them any more
+    class UnitDataStore
+    {
+    public:
+        struct Entry
+        {
+            QString hash;                   // of the enabled units, as TaDemoCompiler::GameContext::getUnitDataHash
+            tapacket::UnitDataRepo units;
+            std::string demoRecord;         // units serialised as a tapacket::UnitData demo record, ready to write into a .tad
+        };
+
+        // @return the stored table identical to units, storing a copy first if there isn't one
+        std::shared_ptr<const Entry> intern(const QString& hash, const tapacket::UnitDataRepo& units);
+
+        // number of distinct tables currently in use
+        std::size_t size();
+
+    private:
+        static bool isSameTable(const tapacket::UnitDataRepo& a, const tapacket::UnitDataRepo& b);
+        void removeExpired();
+
+        // hash only covers enabled units, so tables sharing a hash are compared in full before being shared
+        std::multimap<QString, std::weak_ptr<const Entry> > m_entries;
+    };
+
+}